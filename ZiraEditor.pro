@@ -50,11 +50,14 @@ SOURCES += \
     src/linenumber.cpp \
     src/highlightdata.cpp \
     src/highlight.cpp \
+    src/highlightworker.cpp \
     src/completepopup.cpp \
     src/search.cpp \
     src/linemark.cpp \
     src/linemap.cpp \
     src/highlightwords.cpp \
+    src/highlightwordsmap.cpp \
+    src/highlightwordstables.cpp \
     src/completewords.cpp \
     src/editortab.cpp \
     src/parserworker.cpp \
@@ -80,6 +83,8 @@ SOURCES += \
     src/helpwords.cpp \
     src/createprojectdialog.cpp \
     src/project.cpp \
+    src/projectsymbols.cpp \
+    src/projectwatcher.cpp \
     src/searchdialog.cpp \
     src/git.cpp \
     src/servers.cpp \
@@ -117,11 +122,13 @@ HEADERS += \
     include/linenumber.h \
     include/highlightdata.h \
     include/highlight.h \
+    include/highlightworker.h \
     include/completepopup.h \
     include/search.h \
     include/linemark.h \
     include/linemap.h \
     include/highlightwords.h \
+    include/highlightwordsmap.h \
     include/completewords.h \
     include/editortab.h \
     include/parserworker.h \
@@ -147,12 +154,13 @@ HEADERS += \
     include/helpwords.h \
     include/createprojectdialog.h \
     include/project.h \
+    include/projectsymbols.h \
+    include/projectwatcher.h \
     include/searchdialog.h \
     include/git.h \
     include/servers.h \
     include/editprojectdialog.h \
     include/quickaccess.h \
-    include/types.h \
     include/settingsdialog.h \
     include/helpdialog.h \
     include/popup.h \
@@ -182,6 +190,18 @@ FORMS += \
     ui/shortcutsdialog.ui \
     ui/welcome.ui
 
+# highlight keyword tables are compiled from qrc/resources/highlight,
+# run "make highlightwords" after changing the word lists
+highlightwords.target = highlightwords
+highlightwords.commands = python3 $$PWD/tools/highlightwords.py
+QMAKE_EXTRA_TARGETS += highlightwords
+
+# parser tests are the tests/tests.pro subproject,
+# run "make check" to build and run them
+check.target = check
+check.commands = $$QMAKE_QMAKE -o tests/Makefile $$PWD/tests/tests.pro && $(MAKE) -C tests check
+QMAKE_EXTRA_TARGETS += check
+
 RESOURCES += \
     qrc/fonts.qrc \
     qrc/highlight.qrc \
@@ -13,9 +13,11 @@
 #include <QHash>
 #include <QToolButton>
 #include <QTimer>
+#include <QThread>
 #include "spellcheckerinterface.h"
 #include "settings.h"
 #include "highlight.h"
+#include "highlightworker.h"
 #include "completepopup.h"
 #include "highlightwords.h"
 #include "completewords.h"
@@ -53,6 +55,9 @@ public:
     QString getFileExtension();
     void initMode(QString ext);
     void initHighlighter();
+    void remapHighlightFormats();
+    bool loadHighlightCache(QString cacheFile);
+    void saveHighlightCache(QString cacheFile);
     void reset();
     void detectTabsMode();
     void convertNewLines(QString & txt);
@@ -90,22 +95,25 @@ public:
     void gotoLine(int line, bool focus = true);
     void gotoLineSymbol(int line, int symbol);
     int getCursorLine();
-    void setParseResult(ParsePHP::ParseResult result);
-    void setParseResult(ParseJS::ParseResult result);
-    void setParseResult(ParseCSS::ParseResult result);
+    void setParseResult(ParsePHP::SharedParseResult result);
+    void setParseResult(ParseJS::SharedParseResult result);
+    void setParseResult(ParseCSS::SharedParseResult result);
+    int getParseDocumentId();
+    void resetParseEdits();
     void setGitAnnotations(QHash<int, Git::Annotation> annotations);
     void setGitDiffLines(QHash<int, Git::DiffLine> mLines);
     bool isUndoable();
     bool isRedoable();
     bool isBackable();
     bool isForwadable();
-    void highlightUnusedVars(bool update = true);
+    void highlightUnusedVars();
     void resetExtraSelections();
     void setParseError(bool error);
     bool getParseError();
     void highlightError(int pos, int length);
     void highlightErrorLine(int line);
     void setIsBigFile(bool isBig);
+    void checkFile();
     void setFileIsDeleted();
     void setFileIsOutdated();
 protected:
@@ -121,10 +129,14 @@ protected:
     void contextMenuEvent(QContextMenuEvent *event) override;
     bool event(QEvent *e) override;
     void paintEvent(QPaintEvent *e) override;
+    void showEvent(QShowEvent *e) override;
     bool onKeyPress(QKeyEvent *e);
     bool onKeyRelease(QKeyEvent * e);
     void clearTextHoverFormat();
     void clearErrorsFormat();
+    QString getVariableTypePHP(int index);
+    void recordParseEdit(int position, int charsRemoved, int charsAdded);
+    Parse::TextEdits takeParseEdits();
     void insertFromMimeData(const QMimeData *source) override;
     void updateWidgetsGeometry();
     void setTabsSettings();
@@ -183,6 +195,11 @@ protected:
     QString getFixedCompleteClassConstName(QString clsConstComplete);
     void enableGestures();
     void disableGestures();
+    void highlightInBackgroundStart();
+    void highlightInBackgroundComplete();
+    void highlightComplete();
+    void logHighlightChanges();
+    void updateLongLineColumns();
 public slots:
     void save(QString name = "");
     void back();
@@ -219,6 +236,9 @@ private slots:
     void onRedoAvailable(bool available);
     void searchInFilesRequested();
     void highlightProgressChanged(int percent);
+    void highlightInBackgroundFinished(int job, SharedHighlightResult result);
+    void applyHighlightInBackgroundResults();
+    void highlightIdle();
     void spellProgressChanged(int percent);
     void contentsChange(int position, int charsRemoved, int charsAdded);
     void duplicateLine();
@@ -247,6 +267,8 @@ private:
     std::string encodingFallback;
     bool overwrite;
     bool highlighterInitialized;
+    bool highlightFormatsStale;
+    bool highlightCompleted;
     bool isUndoAvailable;
     bool isRedoAvailable;
 
@@ -256,6 +278,19 @@ private:
     CompletePopup * completePopup;
     QWidget * search;
     Highlight * highlight;
+    HighlightWorker * highlightWorker;
+    QThread highlightThread;
+    bool highlightInBackground;
+    bool highlightLazy;
+    bool highlightDebugStats;
+    long long highlightChangesCount;
+    long long highlightChangesBlocksCount;
+    QTimer highlightIdleTimer;
+    int highlightWorkerJob;
+    SharedHighlightResult highlightResult;
+    QList<int> highlightApplyQueue;
+    int highlightApplyRevision;
+    int highlightApplyVisibleCount;
     QWidget * breadcrumbs;
     QWidget * lineAnnotation;
     QToolButton * qaBtn;
@@ -329,11 +364,12 @@ private:
     QRegularExpression spellWordExpr;
 
     ParsePHP parserPHP;
-    ParsePHP::ParseResult parseResultPHP;
+    ParsePHP::SharedParseResult parseResultPHP;
+    QHash<int, QString> detectedVariableTypesPHP;
     ParseJS parserJS;
-    ParseJS::ParseResult parseResultJS;
+    ParseJS::SharedParseResult parseResultJS;
     ParseCSS parserCSS;
-    ParseCSS::ParseResult parseResultCSS;
+    ParseCSS::SharedParseResult parseResultCSS;
     QHash<int, Git::Annotation> gitAnnotations;
     QHash<int, Git::DiffLine> gitDiffLines;
 
@@ -361,6 +397,12 @@ private:
     int lastModifiedMsec;
     bool warningDisplayed;
     bool parseLocked;
+    static int parseDocumentsCount;
+    int parseDocumentId;
+    int parseRevision;
+    int parseBaseRevision;
+    int parseDocumentRevision;
+    QVector<Parse::TextEdit> parseEdits;
     bool showBreadcrumbs;
     bool cleanBeforeSave;
 
@@ -373,6 +415,8 @@ private:
     std::unordered_map<int, std::string>::iterator markPointsIterator;
     std::unordered_map<int, int> modifiedLines;
     std::unordered_map<int, int>::iterator modifiedLinesIterator;
+    std::unordered_map<std::string, QTextBlock> unusedVarsBlocks;
+    std::unordered_map<std::string, QTextBlock>::iterator unusedVarsBlocksIterator;
 
     QVector<int> backPositions;
     QVector<int> forwardPositions;
@@ -421,9 +465,9 @@ signals:
     void reloaded(int index);
     void showDeclaration(int index, QString name);
     void showHelp(int index, QString name);
-    void parsePHP(int index, QString text);
-    void parseJS(int index, QString text);
-    void parseCSS(int index, QString text);
+    void parsePHP(int index, Parse::TextEdits edits);
+    void parseJS(int index, Parse::TextEdits edits);
+    void parseCSS(int index, Parse::TextEdits edits);
     void undoRedoChanged(int index);
     void backForwardChanged(int index);
     void searchInFiles(QString text);
@@ -432,6 +476,8 @@ signals:
     void warning(int index, QString slug, QString text);
     void showPopupText(int index, QString text);
     void showPopupError(int index, QString text);
+    void highlightText(int job, QString text, QString ext, QString fileName, bool isBigFile);
+    void highlightRelease();
 };
 
 #endif // EDITOR_H
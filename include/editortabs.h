@@ -18,6 +18,7 @@ public:
     void createTab(QString filepath, bool initHighlight = true);
     bool closeWindowAllowed();
     Editor * getActiveEditor();
+    Editor * findTabEditor(QString filepath);
     QStringList getOpenTabFiles();
     QList<int> getOpenTabLines();
     int getCurrentTabIndex();
@@ -26,6 +27,7 @@ public:
     void setActiveTab(int index);
     void setTabLines(QList<int> lines);
     void initHighlighters();
+    void remapHighlightFormats();
     QRect getGeometry();
     QRect getGeometryGlobal();
     QRect getGeometryMappedTo(QWidget * parent);
@@ -50,9 +52,9 @@ signals:
     void editorReady(int index);
     void editorShowDeclaration(QString name);
     void editorShowHelp(QString name);
-    void editorParsePHPRequested(int index, QString text);
-    void editorParseJSRequested(int index, QString text);
-    void editorParseCSSRequested(int index, QString text);
+    void editorParsePHPRequested(int index, Parse::TextEdits edits);
+    void editorParseJSRequested(int index, Parse::TextEdits edits);
+    void editorParseCSSRequested(int index, Parse::TextEdits edits);
     void editorUndoRedoChanged();
     void editorBackForwardChanged();
     void editorSearchInFilesRequested(QString text);
@@ -86,9 +88,9 @@ private slots:
     void reloaded(int index);
     void showDeclaration(int index, QString name);
     void showHelp(int index, QString name);
-    void parsePHP(int index, QString text);
-    void parseJS(int index, QString text);
-    void parseCSS(int index, QString text);
+    void parsePHP(int index, Parse::TextEdits edits);
+    void parseJS(int index, Parse::TextEdits edits);
+    void parseCSS(int index, Parse::TextEdits edits);
     void undoRedoChanged(int index);
     void backForwardChanged(int index);
     void searchInFiles(QString text);
@@ -38,6 +38,8 @@ class Helper
 public:
     static QString loadFile(QString path, std::string encoding, std::string fallbackEncoding, bool silent = false);
     static QString loadTextFile(QString path, std::string encoding, std::string fallbackEncoding, bool silent = false);
+    static QString decodeTextData(const QByteArray & byteArray, std::string encoding, std::string fallbackEncoding, bool silent = false);
+    static quint64 hashData(const QByteArray & data);
     static bool saveTextFile(QString path, const QString & text, std::string encoding);
     static bool createFile(QString path);
     static bool createDir(QString path);
@@ -54,7 +56,6 @@ public:
     static qint64 getFileSize(QString path);
     static QString intToStr(int n);
     static QString doubleToStr(double n);
-    static QString stripScopedText(QString scopedText);
     static void log(int n);
     static void log(QString str);
     static void log(const char * str);
@@ -7,6 +7,9 @@
 #ifndef HIGHLIGHT_H
 #define HIGHLIGHT_H
 
+#include <QTextLayout>
+#include <QSet>
+#include <QDataStream>
 #include "settings.h"
 #include "highlightdata.h"
 #include "highlightwords.h"
@@ -42,6 +45,29 @@ extern const int STATE_COMMENT_ML_UNKNOWN;
 extern const int STATE_STRING_SQ_UNKNOWN;
 extern const int STATE_STRING_DQ_UNKNOWN;
 
+// highlight result of a block, passed from the background worker to the editor.
+// Format ranges refer to palette ids, formats that are not in the palette follow in order.
+struct HighlightBlockResult
+{
+    int userState;
+    uint textHash;
+    QSharedPointer<HighlightData> data;
+    QVector<int> rangeStarts;
+    QVector<int> rangeLengths;
+    QVector<ushort> rangeIds;
+    QVector<QTextCharFormat> extraFormats;
+};
+
+struct HighlightResult
+{
+    QVector<HighlightBlockResult> blocks;
+    QSet<QString> changedVarsKeys;
+    std::unordered_map<std::string, std::string> knownFunctions;
+    QStringList foundModes;
+};
+
+typedef QSharedPointer<HighlightResult> SharedHighlightResult;
+
 extern const QString EXTENSION_DART;
 extern const QString EXTENSION_INI;
 extern const QString EXTENSION_TXT;
@@ -52,10 +78,23 @@ class Highlight : public QObject
 public:
     Highlight(QTextDocument * parent);
     void rehighlight();
+    void remapFormats();
+    void exportResult(QDataStream & out);
+    SharedHighlightResult importResult(QDataStream & in);
     void rehighlightBlock(QTextBlock & block);
     void resetHighlightBlock(QTextBlock & block);
     void highlightChanges(QTextCursor curs);
-    void updateBlocks(int lastBlockNumber);
+    bool updateBlocks(int lastBlockNumber);
+    bool setLongLineVisibleColumns(int firstColumn, int lastColumn);
+    void updateLongBlocks(int firstBlockNumber, int lastBlockNumber);
+    void startLazyHighlight(int blockNumber = 0);
+    bool isLazyHighlightPending();
+    bool highlightTo(int blockNumber);
+    bool highlightNext(int msec);
+    int takeHighlightedBlocksCount();
+    int getStateMemoryUsage(int & unsharedBytes);
+    qint64 getParseTime(qint64 & charsCount);
+    qint64 getAppliedFormatBlocksCount(qint64 & skippedCount);
     void resetMode();
     void initMode(QString ext, int lastBlockNumber);
     std::string getModeType();
@@ -75,7 +114,7 @@ public:
     QStringList getKnownFunctions(QString clsName = "");
     int getKnownVarPosition(QString clsName, QString funcName, QString varName);
     int getKnownVarBlockNumber(QString clsName, QString funcName, QString varName);
-    void setHighlightVarsMode(bool varsMode);
+    QStringList updateKnownVars();
     void setFirstRunMode(bool runMode);
     bool isDirty();
     void setIsBigFile(bool isBig);
@@ -83,21 +122,36 @@ public:
     QString getJsExtMode();
     void setFileName(QString name);
     bool isTextMode();
+    void setCollectMode(bool collect);
+    void setInertCharsSkipping(bool skipping);
+    SharedHighlightResult takeCollectedResult();
+    void importBlock(QTextBlock & block, const HighlightBlockResult & result);
+    void importSymbols(const HighlightResult & result);
 
     std::unordered_map<std::string, int> unusedVars;
     std::unordered_map<std::string, int>::iterator unusedVarsIterator;
 protected:
     void highlightBlock(QTextBlock & block, bool markDirty = true);
-    void setFormat(int start, int count, const QTextCharFormat &format);
+    void setFormat(int start, int count, int formatId);
     QTextCharFormat format(int pos) const;
+    const QTextCharFormat & getFormat(int formatId) const;
+    int addFormat(const QTextCharFormat & format);
     void applyFormatChanges(bool markDirty = true);
+    void appendFormatRanges(QVector<QTextLayout::FormatRange> & ranges, QVector<ushort> & rangeIds, const QVector<ushort> & formatIds, const QVector<QTextCharFormat> & extra, int offset) const;
+    void setFormatRanges(const QVector<QTextLayout::FormatRange> & ranges, const QVector<ushort> & rangeIds, bool markDirty);
+    bool isLongBlock(const QString & text) const;
+    int findLongBlockChunkEnd(const QString & text, int start) const;
+    bool parseLongBlock(const QString & text, int & parsedChars);
+    void applyLongBlockFormats(bool markDirty = true);
     bool parseBlock(const QString & text);
+    QString getVarsKeyPHP();
     void reset();
     void addSpecialChar(QChar c, int pos);
     void addSpecialWord(QString w, int pos);
-    void restoreState();
-    void highlightString(int start, int length, const QTextCharFormat format);
-    void highlightChar(int start, const QTextCharFormat format);
+    HighlightData * previousBlockData();
+    void restoreState(HighlightData * prevBlockData);
+    void highlightString(int start, int length, int formatId);
+    void highlightChar(int start, int formatId);
     void changeBlockState();
     bool detectMode(const QChar & c, int pos, bool isWSpace, bool isLast);
     bool detectModeOpen(const QChar & c, int pos, bool isWSpace, bool isLast);
@@ -137,13 +191,16 @@ protected:
     void parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, bool isWSpace, bool isLast, int & keywordPHPStartPrev, int & keywordPHPLengthPrev);
     void parseUnknown(const QChar & c, int pos, bool isAlpha, bool isAlnum, bool isWSpace, bool isLast, int & keywordUnknownStartPrev, int & keywordUnknownLengthPrev);
     void updateState(const QChar & c, int pos, int & pState);
+    int skipInertChars(const QString & text, int pos, int modeId, int pState, int keywordCSSStartPrev, int keywordJSStartPrev, int keywordPHPStartPrev, int keywordUnknownStartPrev);
     void openBlockDataLists();
     void closeBlockDataLists(int textSize);
     void highlightSpell();
     void highlightError(int pos, int length);
+    void lazyHighlight(int blocksCount, int msec);
 private:
     QTextDocument * doc;
-    QVector<QTextCharFormat> formatChanges;
+    QVector<ushort> formatChanges; // HighlightWords palette ids or extraFormats ids
+    QVector<QTextCharFormat> extraFormats; // formats built for the current block only
     HighlightWords * HW;
     bool highlightSpaces;
     bool highlightTabs;
@@ -166,6 +223,7 @@ private:
     std::unordered_map<std::string, int>::iterator knownVarsPositionsIterator;
     std::unordered_map<std::string, std::string> usedVars;
     std::unordered_map<std::string, std::string>::iterator usedVarsIterator;
+    QSet<QString> changedVarsKeys;
     std::unordered_map<std::string, std::string> knownFunctions;
     std::unordered_map<std::string, std::string>::iterator knownFunctionsIterator;
 
@@ -270,6 +328,7 @@ private:
     QString keywordStringPHP;
     QString keywordStringHTML;
     QString keywordStringUnknown;
+    QString classWordKeyPHP;
     int keywordJSOpened;
     int keywordCSSOpened;
     int keywordPHPOpened;
@@ -324,6 +383,12 @@ private:
     QVector<int> funcStartsPHP;
     QVector<int> funcEndsPHP;
     QVector<QString> funcNamesPHP;
+    QVector<QString> varsKeysPHP;
+    QVector<QString> varsNamesPHP;
+    QVector<int> varsPositionsPHP;
+    QVector<int> varsBlockOffsetsPHP;
+    QVector<QString> usedVarsKeysPHP;
+    QVector<QString> usedVarsNamesPHP;
     QString expectedNsNamePHP;
     QString expectedClsNamePHP;
     QString expectedFuncNamePHP;
@@ -371,10 +436,26 @@ private:
     QVector<int> tagChainStartsHTML;
     QVector<int> tagChainEndsHTML;
     QVector<QString> tagChainsHTML;
-    bool highlightVarsMode;
     bool firstRunMode;
     bool rehighlightBlockMode;
+    bool collectMode;
+    bool inertCharsSkipping;
+    QVector<HighlightBlockResult> collectedBlocks;
+    bool longBlockChunkMode;
+    HighlightData * longBlockChunkPrevData;
+    HighlightStateTable<HighlightScope> scopeTable;
+    HighlightStateTable<HighlightStrings> stringsTable;
+    int longLineFirstColumn;
+    int longLineLastColumn;
     int lastVisibleBlockNumber;
+    int lazyBlockNumber;
+    int lazyProgressPercent;
+    int highlightedBlocksCount;
+    bool debugStats;
+    qint64 parsedCharsCount;
+    qint64 parseNsecs;
+    qint64 appliedFormatBlocksCount;
+    qint64 skippedFormatBlocksCount;
     bool isBigFile;
     QStringList foundModes;
     bool expectAndSignPHP;
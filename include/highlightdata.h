@@ -8,13 +8,97 @@
 #define HIGHLIGHTDATA_H
 
 #include <QTextBlockUserData>
+#include <QSharedData>
+#include <QExplicitlySharedDataPointer>
+#include <QSharedPointer>
+#include <QTextCharFormat>
+#include <QDataStream>
+#include <QHash>
 #include <unordered_map>
 
-class HighlightData : public QTextBlockUserData
+// kinds of position intervals stored in HighlightData
+const int INTERVALS_MODE = 0;
+const int INTERVALS_STATE = 1;
+const int INTERVALS_NS_PHP = 2;
+const int INTERVALS_CLS_PHP = 3;
+const int INTERVALS_FUNC_PHP = 4;
+const int INTERVALS_CLS_JS = 5;
+const int INTERVALS_FUNC_JS = 6;
+const int INTERVALS_MEDIA_CSS = 7;
+const int INTERVALS_TAG_CHAIN_HTML = 8;
+const int INTERVALS_COUNT = 9;
+
+// scope state carried from block to block,
+// shared by neighbouring blocks while it does not change
+class HighlightScope : public QSharedData
 {
 public:
-    HighlightData();
-    void reset();
+    HighlightScope();
+    bool operator==(const HighlightScope & other) const;
+    int getMemoryUsage() const;
+    void updateHash();
+    void write(QDataStream & out) const;
+    void read(QDataStream & in);
+    uint hash;
+    QString nsNamePHP;
+    QList<int> nsScopeChainPHP;
+    QString nsChainPHP;
+    QString clsNamePHP;
+    QList<int> clsScopeChainPHP;
+    QString clsChainPHP;
+    QString funcNamePHP;
+    QList<int> funcScopeChainPHP;
+    QString funcChainPHP;
+    QString expectedNsNamePHP;
+    QString expectedClsNamePHP;
+    QString expectedFuncNamePHP;
+    QStringList expectedFuncArgsPHP;
+    QVector<int> expectedFuncArgsPHPPositions;
+    QVector<int> expectedFuncArgsPHPBlocks;
+    QStringList varsChainsPHP;
+    QStringList usedVarsChainsPHP;
+    QString varsGlobChainPHP;
+    QString usedVarsGlobChainPHP;
+    QString varsClsChainPHP;
+    QString varsChainPHP;
+    QString usedVarsChainPHP;
+    QVector<bool> clsOpensPHP;
+    QString varsClsOpenChainPHP;
+    QStringList clsPropsChainPHP;
+    QString funcNameJS;
+    QList<int> funcScopeChainJS;
+    QString funcChainJS;
+    QString expectedFuncNameJS;
+    QString expectedFuncVarJS;
+    QString varsChainJS;
+    QStringList expectedFuncArgsJS;
+    QString mediaNameCSS;
+    QString expectedMediaNameCSS;
+    QString cssNamesChain;
+    QString tagChainHTML;
+    QString operatorsChainPHP;
+    std::unordered_map<int, std::string> operatorsPHP;
+    QString operatorsChainJS;
+    std::unordered_map<int, std::string> operatorsJS;
+    QString expectedClsNameJS;
+    QString clsNameJS;
+    QString clsChainJS;
+    QList<int> clsScopeChainJS;
+    QVector<bool> clsOpensJS;
+};
+
+// mode and escape strings carried from block to block,
+// shared by the blocks that end in the same state
+class HighlightStrings : public QSharedData
+{
+public:
+    HighlightStrings();
+    bool operator==(const HighlightStrings & other) const;
+    int getMemoryUsage() const;
+    void updateHash();
+    void write(QDataStream & out) const;
+    void read(QDataStream & in);
+    uint hash;
     QString stringBlock;
     QString mode;
     QString prevMode;
@@ -26,15 +110,110 @@ public:
     QString prevModeString;
     QString prevModeExpectC;
     QString prevModeStringC;
+    QString stringEscStringCSS;
+    QString stringEscStringJS;
+    QString regexpEscStringJS;
+    QString regexpPrevCharJS;
+    QString exprEscStringJS;
+    QString stringEscVariableJS;
+    QString keywordPHPprevString;
+    QString keywordPHPprevStringPrevChar;
+    QString keywordJSprevString;
+    QString keywordJSprevStringPrevChar;
+};
+
+const int HIGHLIGHT_STATE_TABLE_MIN_SIZE = 256;
+
+// Equal scopes and strings of all blocks point to one entry of the table,
+// not only those of neighbouring blocks. Entries that no block refers to
+// any more are dropped when the table has doubled in size.
+template<typename T>
+class HighlightStateTable
+{
+public:
+    HighlightStateTable() : count(0), limit(HIGHLIGHT_STATE_TABLE_MIN_SIZE) {}
+    // replaces the state with the equal entry or adds it to the table
+    void intern(QExplicitlySharedDataPointer<T> & state)
+    {
+        QVector<QExplicitlySharedDataPointer<T>> & bucket = entries[state->hash];
+        for (int i=0; i<bucket.size(); i++) {
+            if (bucket.at(i) == state) return;
+            if (*bucket.at(i) == *state) {
+                state = bucket.at(i);
+                return;
+            }
+        }
+        bucket.append(state);
+        if (++count > limit) prune();
+    }
+    void clear()
+    {
+        entries.clear();
+        count = 0;
+        limit = HIGHLIGHT_STATE_TABLE_MIN_SIZE;
+    }
+    int size() const
+    {
+        return count;
+    }
+private:
+    void prune()
+    {
+        count = 0;
+        typename QHash<uint, QVector<QExplicitlySharedDataPointer<T>>>::iterator it = entries.begin();
+        while (it != entries.end()) {
+            QVector<QExplicitlySharedDataPointer<T>> & bucket = it.value();
+            for (int i=bucket.size()-1; i>=0; i--) {
+                if (bucket.at(i)->ref.loadAcquire() == 1) bucket.remove(i);
+            }
+            count += bucket.size();
+            if (bucket.size() == 0) it = entries.erase(it);
+            else ++it;
+        }
+        limit = qMax(HIGHLIGHT_STATE_TABLE_MIN_SIZE, count * 2);
+    }
+    QHash<uint, QVector<QExplicitlySharedDataPointer<T>>> entries;
+    int count;
+    int limit;
+};
+
+class HighlightData;
+
+// part of a long line that is parsed as if it was a separate line,
+// see Highlight::parseLongBlock
+struct HighlightChunk
+{
+    int start;
+    int length;
+    uint textHash;
+    QSharedPointer<HighlightData> data; // state at the end of the chunk
+    QVector<ushort> formatIds;
+    QVector<QTextCharFormat> extraFormats;
+};
+
+class HighlightData : public QTextBlockUserData
+{
+public:
+    HighlightData();
+    void reset();
+    int getMemoryUsage() const;
+    void updateStateHash();
+    void copyState(const HighlightData & other);
+    bool isSameState(const HighlightData & other) const;
+    void setIntervals(int kind, const QVector<int> & starts, const QVector<int> & ends);
+    int getIntervalsCount(int kind) const;
+    int findInterval(int kind, int pos) const;
+    void mergeChunks(const QVector<HighlightChunk> & chunks);
+    void write(QDataStream & out, QHash<const HighlightScope *, int> & scopeIndexes, QHash<const HighlightStrings *, int> & stringsIndexes) const;
+    bool read(QDataStream & in, QVector<QExplicitlySharedDataPointer<HighlightScope>> & scopes, QVector<QExplicitlySharedDataPointer<HighlightStrings>> & stringsList);
+    QExplicitlySharedDataPointer<HighlightScope> scope;
+    QExplicitlySharedDataPointer<HighlightStrings> strings;
+    uint stateHash;
     bool prevModeSkip;
     bool prevModeSkipC;
     int state;
     int prevState;
     int prevPrevState;
-    QString stringEscStringCSS;
-    QString stringEscStringJS;
-    QString regexpEscStringJS;
-    QString regexpPrevCharJS;
     int bracesCSS;
     int bracesJS;
     int bracesPHP;
@@ -44,106 +223,50 @@ public:
     bool cssMediaScope;
     bool keywordPHPScoped;
     bool keywordJSScoped;
-    QString exprEscStringJS;
-    QString stringEscVariableJS;
     QVector<QChar> specialChars;
     QVector<int> specialCharsPos;
     QVector<QString> specialWords;
     QVector<int> specialWordsPos;
-    QVector<int> modeStarts;
-    QVector<int> modeEnds;
     QVector<std::string> modeTags;
-    QVector<int> stateStarts;
-    QVector<int> stateEnds;
     QVector<int> stateIds;
     bool hasMarkPoint;
     bool isModified;
-    QString nsNamePHP;
-    QList<int> nsScopeChainPHP;
-    QString nsChainPHP;
-    QVector<int> nsStartsPHP;
-    QVector<int> nsEndsPHP;
     QVector<QString> nsNamesPHP;
-    QString clsNamePHP;
-    QList<int> clsScopeChainPHP;
-    QString clsChainPHP;
-    QVector<int> clsStartsPHP;
-    QVector<int> clsEndsPHP;
     QVector<QString> clsNamesPHP;
-    QString funcNamePHP;
-    QList<int> funcScopeChainPHP;
-    QString funcChainPHP;
-    QVector<int> funcStartsPHP;
-    QVector<int> funcEndsPHP;
     QVector<QString> funcNamesPHP;
-    QString expectedNsNamePHP;
-    QString expectedClsNamePHP;
-    QString expectedFuncNamePHP;
+    QVector<QString> varsKeysPHP;
+    QVector<QString> varsNamesPHP;
+    QVector<int> varsPositionsPHP;
+    QVector<int> varsBlockOffsetsPHP;
+    QVector<QString> usedVarsKeysPHP;
+    QVector<QString> usedVarsNamesPHP;
     int expectedFuncParsPHP;
-    QStringList expectedFuncArgsPHP;
-    QVector<int> expectedFuncArgsPHPPositions;
-    QVector<int> expectedFuncArgsPHPBlocks;
     int nsScopePHP;
     int clsScopePHP;
     int funcScopePHP;
-    QStringList varsChainsPHP;
-    QStringList usedVarsChainsPHP;
-    QString varsGlobChainPHP;
-    QString usedVarsGlobChainPHP;
-    QString varsClsChainPHP;
-    QString varsChainPHP;
-    QString usedVarsChainPHP;
     bool clsOpenPHP;
-    QVector<bool> clsOpensPHP;
-    QString varsClsOpenChainPHP;
-    QStringList clsPropsChainPHP;
     bool isGlobalPHP;
-    QString funcNameJS;
-    QList<int> funcScopeChainJS;
-    QString funcChainJS;
-    QVector<int> funcStartsJS;
-    QVector<int> funcEndsJS;
     QVector<QString> funcNamesJS;
-    QString expectedFuncNameJS;
-    QString expectedFuncVarJS;
     int expectedFuncParsJS;
     int funcScopeJS;
-    QString varsChainJS;
-    QStringList expectedFuncArgsJS;
-    QString mediaNameCSS;
-    QVector<int> mediaStartsCSS;
-    QVector<int> mediaEndsCSS;
     QVector<QString> mediaNamesCSS;
-    QString expectedMediaNameCSS;
-    QString cssNamesChain;
     int expectedMediaParsCSS;
     int mediaScopeCSS;
-    QString tagChainHTML;
-    QVector<int> tagChainStartsHTML;
-    QVector<int> tagChainEndsHTML;
     QVector<QString> tagChainsHTML;
-    QString keywordPHPprevString;
-    QString keywordPHPprevStringPrevChar;
-    QString keywordJSprevString;
-    QString keywordJSprevStringPrevChar;
     QVector<int> spellStarts;
     QVector<int> spellLengths;
-    QString operatorsChainPHP;
-    std::unordered_map<int, std::string> operatorsPHP;
-    QString operatorsChainJS;
-    std::unordered_map<int, std::string> operatorsJS;
     bool wantUpdate;
-    QString expectedClsNameJS;
-    QString clsNameJS;
     int clsScopeJS;
-    QString clsChainJS;
     QVector<QString> clsNamesJS;
-    QVector<int> clsStartsJS;
-    QVector<int> clsEndsJS;
-    QList<int> clsScopeChainJS;
-    QVector<bool> clsOpensJS;
     bool clsOpenJS;
     bool isNewBlock;
+    // offset and count of each kind followed by start/end pairs of all kinds,
+    // a negative count means the intervals are not sorted by position
+    QVector<int> intervals;
+    QVector<HighlightChunk> chunks;
+    uint chunksPrevStateHash;
+    QSharedPointer<HighlightData> chunksPrevState; // state of the previous line the chunks were parsed after
+    QVector<ushort> formatRangeIds; // palette id of each format range of the block layout
 };
 
 #endif // HIGHLIGHTDATA_H
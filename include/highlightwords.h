@@ -8,18 +8,17 @@
 #define HIGHLIGHTWORDS_H
 
 #include <QObject>
-#include <unordered_map>
 #include <QTextCharFormat>
+#include <QReadWriteLock>
 #include "settings.h"
+#include "highlightwordsmap.h"
 
 class HighlightWords : public QObject
 {
     Q_OBJECT
 public:
     static HighlightWords& instance();
-    static void loadDelayed();
     static void setColors();
-    static void reload();
     static void reset();
     static void addPHPClass(QString k);
     static void addPHPFunction(QString k);
@@ -59,32 +58,19 @@ public:
     QTextCharFormat tabFormat;
     QTextCharFormat colorFormat;
     QTextCharFormat punctuationFormat;
-    std::unordered_map<std::string, QTextCharFormat> phpwords;
-    std::unordered_map<std::string, QTextCharFormat>::iterator phpwordsIterator;
-    std::unordered_map<std::string, QTextCharFormat> phpwordsCS;
-    std::unordered_map<std::string, QTextCharFormat>::iterator phpwordsCSIterator;
-    std::unordered_map<std::string, QTextCharFormat> phpClassWordsCS;
-    std::unordered_map<std::string, QTextCharFormat>::iterator phpClassWordsCSIterator;
-    std::unordered_map<std::string, QTextCharFormat> jswordsCS;
-    std::unordered_map<std::string, QTextCharFormat>::iterator jswordsCSIterator;
-    std::unordered_map<std::string, QTextCharFormat> jsExtDartWordsCS;
-    std::unordered_map<std::string, QTextCharFormat>::iterator jsExtDartWordsCSIterator;
-    std::unordered_map<std::string, QTextCharFormat> csswords;
-    std::unordered_map<std::string, QTextCharFormat>::iterator csswordsIterator;
-    std::unordered_map<std::string, QTextCharFormat> htmlwords;
-    std::unordered_map<std::string, QTextCharFormat>::iterator htmlwordsIterator;
-    std::unordered_map<std::string, QTextCharFormat> htmlshorts;
-    std::unordered_map<std::string, QTextCharFormat>::iterator htmlshortsIterator;
-    std::unordered_map<std::string, QTextCharFormat> generalwords;
-    std::unordered_map<std::string, QTextCharFormat>::iterator generalwordsIterator;
+    HighlightWordsMap phpwords;
+    HighlightWordsMap phpwordsCS;
+    HighlightWordsMap phpClassWordsCS;
+    HighlightWordsMap jswordsCS;
+    HighlightWordsMap jsExtDartWordsCS;
+    HighlightWordsMap csswords;
+    HighlightWordsMap htmlwords;
+    HighlightWordsMap htmlshorts;
+    HighlightWordsMap generalwords;
+    const QTextCharFormat & getFormat(int formatId) const { return *palette[formatId]; }
+    QReadWriteLock lock; // held for reading by background highlighters
 protected:
-    void loadPHPWords();
-    void loadJSWords();
-    void loadCSSWords();
-    void loadGeneralWords();
-    void _loadDelayed();
     void _setColors();
-    void _reload();
     void _reset();
     void _addPHPClass(QString k);
     void _addPHPFunction(QString k);
@@ -99,11 +85,10 @@ protected:
     void _addCSSProperty(QString k);
     void _addHTMLTag(QString k);
     void _addHTMLShortTag(QString k);
-    void _load();
 private:
     HighlightWords();
-public slots:
-    static void load();
+    QTextCharFormat noFormat;
+    const QTextCharFormat * palette[FORMATS_COUNT];
 };
 
 #endif // HIGHLIGHTWORDS_H
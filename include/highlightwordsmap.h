@@ -0,0 +1,94 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#ifndef HIGHLIGHTWORDSMAP_H
+#define HIGHLIGHTWORDSMAP_H
+
+#include <QString>
+#include <vector>
+
+// ids of the formats in the HighlightWords palette,
+// compiled word tables only use the ids below FORMAT_VARIABLE
+const int FORMAT_NONE = 0;
+const int FORMAT_KEYWORD = 1;
+const int FORMAT_CLASS = 2;
+const int FORMAT_KNOWN_FUNCTION = 3;
+const int FORMAT_KNOWN_VARIABLE = 4;
+const int FORMAT_CONST = 5;
+const int FORMAT_KNOWN = 6;
+const int FORMAT_CSS_SPECIAL = 7;
+const int FORMAT_PSEUDO_CLASS = 8;
+const int FORMAT_VARIABLE = 9;
+const int FORMAT_UNUSED_VARIABLE = 10;
+const int FORMAT_SINGLE_LINE_COMMENT = 11;
+const int FORMAT_MULTI_LINE_COMMENT = 12;
+const int FORMAT_STRING = 13;
+const int FORMAT_FUNCTION = 14;
+const int FORMAT_PHP_TAG = 15;
+const int FORMAT_TAG = 16;
+const int FORMAT_TAG_NAME = 17;
+const int FORMAT_SELECTOR = 18;
+const int FORMAT_SELECTOR_TAG = 19;
+const int FORMAT_PROPERTY = 20;
+const int FORMAT_EXPRESSION = 21;
+const int FORMAT_SPACE = 22;
+const int FORMAT_TAB = 23;
+const int FORMAT_COLOR = 24;
+const int FORMAT_PUNCTUATION = 25;
+const int FORMATS_COUNT = 26;
+
+// minimal perfect hash table generated at build time
+// from the word lists in qrc/resources/highlight
+struct HighlightWordsTable
+{
+    int size;
+    const int * seeds;
+    const char * const * words;
+    const unsigned char * formats;
+};
+
+extern const HighlightWordsTable HIGHLIGHT_PHP_WORDS;
+extern const HighlightWordsTable HIGHLIGHT_PHP_WORDS_CS;
+extern const HighlightWordsTable HIGHLIGHT_JS_WORDS_CS;
+extern const HighlightWordsTable HIGHLIGHT_CSS_WORDS;
+extern const HighlightWordsTable HIGHLIGHT_GENERAL_WORDS;
+
+// maps words to format ids, keyed directly on UTF-16 text,
+// so that words can be looked up from a slice of the block text.
+// Built-in words come from a compiled table, words added at runtime
+// are kept in an open addressing overlay that takes precedence.
+class HighlightWordsMap
+{
+public:
+    explicit HighlightWordsMap(bool caseInsensitive = false, const HighlightWordsTable * table = nullptr);
+    void insert(const QString & key, int formatId);
+    int find(const QChar * data, int length) const;
+    int find(const QString & key) const { return find(key.constData(), key.size()); }
+    bool contains(const QString & key) const { return find(key) != FORMAT_NONE; }
+    void clear();
+    int size() const { return count + (table != nullptr ? table->size : 0); }
+protected:
+    struct Entry {
+        uint hash;
+        int keyOffset; // -1 for empty slot
+        int keyLength;
+        int formatId;
+    };
+    ushort fold(ushort c) const;
+    uint hashKey(const QChar * data, int length) const;
+    uint tableHash(uint seed, const QChar * data, int length) const;
+    int findInTable(const QChar * data, int length) const;
+    int findSlot(const QChar * data, int length, uint hash) const;
+    void rehash(int capacity);
+    bool caseInsensitive;
+    const HighlightWordsTable * table;
+    int count;
+    int mask;
+    std::vector<Entry> entries;
+    std::vector<ushort> keys;
+};
+
+#endif // HIGHLIGHTWORDSMAP_H
@@ -0,0 +1,37 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#ifndef HIGHLIGHTWORKER_H
+#define HIGHLIGHTWORKER_H
+
+#include <QObject>
+#include <QTextDocument>
+#include <QAtomicInt>
+#include "highlight.h"
+
+Q_DECLARE_METATYPE(SharedHighlightResult)
+
+// highlights a copy of the text, the document of the worker
+// is not shared with the editor, results are passed by value
+class HighlightWorker : public QObject
+{
+    Q_OBJECT
+public:
+    explicit HighlightWorker(QObject *parent = nullptr);
+    void cancel();
+private:
+    QTextDocument * doc;
+    Highlight * highlight;
+    QAtomicInt wantStop; // set from the GUI thread
+public slots:
+    void highlightText(int job, QString text, QString ext, QString fileName, bool isBigFile);
+    void release();
+signals:
+    void progressChanged(int percent);
+    void highlightFinished(int job, SharedHighlightResult result);
+};
+
+#endif // HIGHLIGHTWORKER_H
@@ -26,6 +26,7 @@
 #include "gitbrowser.h"
 #include "helpwords.h"
 #include "project.h"
+#include "projectwatcher.h"
 #include "git.h"
 #include "spellcheckerinterface.h"
 #include "terminalinterface.h"
@@ -35,7 +36,6 @@
 #include "popup.h"
 #include "tabslist.h"
 #include "welcome.h"
-#include "types.h"
 #include "style.h"
 #include "menudialog.h"
 
@@ -56,10 +56,10 @@ namespace Ui {
     class ShortcutsDialog;
 }
 
-Q_DECLARE_METATYPE(ParsePHP::ParseResult)
-Q_DECLARE_METATYPE(ParseJS::ParseResult)
-Q_DECLARE_METATYPE(ParseCSS::ParseResult)
-Q_DECLARE_METATYPE(WordsMapList)
+Q_DECLARE_METATYPE(ParsePHP::SharedParseResult)
+Q_DECLARE_METATYPE(ParseJS::SharedParseResult)
+Q_DECLARE_METATYPE(ParseCSS::SharedParseResult)
+Q_DECLARE_METATYPE(Parse::TextEdits)
 
 class MainWindow : public QMainWindow
 {
@@ -88,13 +88,15 @@ protected:
     void setHelpTabSource(QString path);
     void setHelpTabContents(QString html);
     void scrollMessagesTabToTop();
-    void parseTab();
-    void parseTabSplit();
+    void parseTab(bool saved = false);
+    void parseTabSplit(bool saved = false);
+    bool isOpenProjectFile(QString path);
     void reloadWords();
     QString getGitWorkingDir();
     void runServersCommand(QString command, QString pwd, QString description);
     void compileSass(QString src, QString dst);
     void applyThemeColors(QString pluginsDir, bool light, bool applyFont);
+    void applyColorScheme();
     void applyThemeIcons();
     void updateTabsListButton();
     void resetLastSearchParams();
@@ -110,6 +112,7 @@ public slots:
     void on_actionOpenProject_triggered();
     void on_actionNewProject_triggered();
     void saveStateBeforeExit();
+    void saveProject();
 private slots:
     void on_actionOpenFile_triggered();
     void on_actionNewFile_triggered();
@@ -202,10 +205,14 @@ private slots:
     void execPHPFinished(int tabIndex, QString output);
     void execPHPWebServerFinished(bool success, QString output);
     void parsePHPCSFinished(int tabIndex, QStringList errorTexts, QStringList errorLines);
-    void parseMixedFinished(int tabIndex, ParsePHP::ParseResult result);
-    void parseJSFinished(int tabIndex, ParseJS::ParseResult result);
-    void parseCSSFinished(int tabIndex, ParseCSS::ParseResult result);
+    void parseMixedFinished(int tabIndex, ParsePHP::SharedParseResult result);
+    void parseJSFinished(int tabIndex, ParseJS::SharedParseResult result);
+    void parseCSSFinished(int tabIndex, ParseCSS::SharedParseResult result);
+    void parseEditsRejected(int tabIndex, int documentId);
     void parseProjectFinished(bool success = true, bool isModified = true);
+    void projectFileUpdated(QStringList files, QVariantMap oldMap, QVariantMap newMap);
+    void projectFilesChanged(QStringList files);
+    void projectRescanRequested();
     void projectCreateRequested(QString name, QString path, bool lintEnabled, bool csEnabled);
     void projectEditRequested(QString name, QString path, bool lintEnabled, bool csEnabled);
     void projectOpenRequested(QString path);
@@ -220,9 +227,9 @@ private slots:
     void editorShowHelp(QString name);
     void helpBrowserAnchorClicked(QUrl url);
     void messagesBrowserAnchorClicked(QUrl url);
-    void editorParsePHPRequested(int index, QString text);
-    void editorParseJSRequested(int index, QString text);
-    void editorParseCSSRequested(int index, QString text);
+    void editorParsePHPRequested(int index, Parse::TextEdits edits);
+    void editorParseJSRequested(int index, Parse::TextEdits edits);
+    void editorParseCSSRequested(int index, Parse::TextEdits edits);
     void menuEditOnShow();
     void menuViewOnShow();
     void menuToolsOnShow();
@@ -277,11 +284,14 @@ private:
     Ui::MainWindow *ui;
     ParserWorker * parserWorker;
     QThread parserThread;
+    QThread projectWatcherThread;
+    QString watchedProjectPath;
     FileBrowser * filebrowser;
     Navigator * navigator;
     GitBrowser * gitBrowser;
     EditorTabs * editorTabs;
     Project * project;
+    ProjectWatcher * projectWatcher;
     Git * git;
     TerminalInterface * terminal;
     QToolButton * tabsListButton;
@@ -308,6 +318,7 @@ private:
     bool parsePHPEnabled;
     bool parseJSEnabled;
     bool parseCSSEnabled;
+    bool watchProjectEnabled;
     bool gitCommandsEnabled;
     bool serverCommandsEnabled;
     QuickAccess * qa;
@@ -336,12 +347,19 @@ signals:
     void parseMixed(int tabIndex, QString content);
     void parseJS(int tabIndex, QString content);
     void parseCSS(int tabIndex, QString content);
+    void parseMixedEdits(int tabIndex, Parse::TextEdits edits);
+    void parseJSEdits(int tabIndex, Parse::TextEdits edits);
+    void parseCSSEdits(int tabIndex, Parse::TextEdits edits);
     void parseProject(QString path);
+    void parseProjectFile(int tabIndex, QString text, QString projectPath, QString path);
+    void parseProjectFiles(QString projectPath, QStringList files);
+    void startProjectWatcher(QString path);
+    void stopProjectWatcher();
     void searchInFiles(QString searchDirectory, QString searchText, QString searchExtensions, bool searchOptionCase, bool searchOptionWord, bool searchOptionRegexp, QStringList excludeDirs);
     void gitCommand(QString path, QString command, QStringList attrs, bool outputResult = true, bool silent = false);
     void serversCommand(QString command, QString pwd);
     void sassCommand(QString src, QString dst);
-    void quickFind(QString dir, QString text, WordsMapList words, QStringList wordPrefixes);
+    void quickFind(QString dir, QString text, QString projectPath);
     void installAndroidPack();
 };
 
@@ -19,14 +19,17 @@ class Navigator : public QObject
     Q_OBJECT
 public:
     explicit Navigator(QTreeWidget * widget);
-    void build(ParsePHP::ParseResult result);
-    void build(ParseJS::ParseResult result);
-    void build(ParseCSS::ParseResult result);
+    void build(ParsePHP::SharedParseResult result);
+    void build(ParseJS::SharedParseResult result);
+    void build(ParseCSS::SharedParseResult result);
     void clear();
     void focus();
     bool isFocused();
 protected:
     bool eventFilter(QObject *watched, QEvent *event) override;
+    void updateTree(QTreeWidgetItem * root, QList<QTreeWidgetItem *> expandedItems);
+    bool isSameItem(QTreeWidgetItem * item, QTreeWidgetItem * newItem);
+    void updateItemLines(QTreeWidgetItem * item, QTreeWidgetItem * newItem);
 private:
     QTreeWidget * treeWidget;
 signals:
@@ -8,24 +8,56 @@
 #define PARSE_H
 
 #include <QRegularExpression>
+#include <QVector>
+#include <QSet>
 
 class Parse
 {
 public:
+    // token position in the parsed text
+    struct Token {
+        int start;
+        int length;
+    };
+    // change of a document text, an edit with a negative
+    // count of removed chars replaces the whole text
+    struct TextEdit {
+        int position;
+        int removed;
+        QString added;
+    };
+    // changes of a document since its base revision,
+    // the size is the size of the text after the changes
+    struct TextEdits {
+        int documentId;
+        int baseRevision;
+        int revision;
+        int size;
+        QVector<TextEdit> edits;
+    };
     Parse();
     virtual ~Parse();
     virtual void prepare(QString & text);
-    virtual QString strip(QRegularExpressionMatch & match, QString & text, int group);
     virtual int getLine(QString & text, int offset);
     virtual QString getLineText(QString & text, int offset);
     virtual int getFirstNotEmptyLineTo(QString & text, int offset);
     virtual int findOpenScope(QVector<int> list);
     virtual int findCloseScope(QVector<int> list);
 protected:
-    QRegularExpression stringDQExpression;
-    QRegularExpression stringSQExpression;
-    QRegularExpression commentMLExpression;
-    QRegularExpression backtickExpression;
+    void resetLineIndex();
+    void updateLineIndex(const QString & text);
+    int findLineIndex(int offset) const;
+    int findString(const QString & text, int offset, ushort quote, int & end) const;
+    int findCommentML(const QString & text, int offset, int & end) const;
+    QString intern(const QString & name);
+    static QString stripScopedText(QString scopedText);
+    // start offsets of the lines of the last text passed to getLine,
+    // the text is identified by its data and size
+    QVector<int> lineOffsets;
+    const QChar * lineIndexData;
+    int lineIndexSize;
+    // names of the current parse result, equal names share their data
+    QSet<QString> resultNames;
 };
 
 #endif // PARSE_H
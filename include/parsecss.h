@@ -9,6 +9,7 @@
 
 #include "parse.h"
 #include <QVector>
+#include <QSharedPointer>
 #include <unordered_map>
 
 class ParseCSS : public Parse
@@ -56,13 +57,15 @@ public:
         QVector<ParseResultComment> comments;
         QVector<ParseResultError> errors;
     };
+    typedef QSharedPointer<const ParseResult> SharedParseResult;
 
-    ParseCSS::ParseResult parse(QString text);
+    ParseCSS::SharedParseResult parse(QString text);
 
     static std::unordered_map<std::string, std::string> mainTags;
 protected:
     void reset();
-    QString cleanUp(QString text);
+    void appendTokens(const QString & text, int from, int to);
+    void tokenize(QString & text);
     bool isValidName(QString name);
     bool isColor(QString name);
     void addSelector(QString name, int line);
@@ -72,13 +75,13 @@ protected:
     void addFont(QString name, int line);
     void addComment(QString text, int line);
     void addError(QString text, int line, int symbol);
-    void parseCode(QString & code, QString & origText);
+    void parseCode(QString & origText);
 private:
     ParseCSS::ParseResult result;
 
-    QRegularExpression parseExpression;
     QRegularExpression nameExpression;
     QRegularExpression colorExpression;
+    QVector<Token> tokens;
 
     std::unordered_map<std::string, std::string>::iterator mainTagsIterator;
 
@@ -9,6 +9,7 @@
 
 #include "parse.h"
 #include <QVector>
+#include <QSharedPointer>
 #include <unordered_map>
 
 class ParseJS : public Parse
@@ -68,13 +69,17 @@ public:
         QVector<ParseResultComment> comments;
         QVector<ParseResultError> errors;
     };
+    typedef QSharedPointer<const ParseResult> SharedParseResult;
 
-    ParseJS::ParseResult parse(QString text);
+    ParseJS::SharedParseResult parse(QString text);
 protected:
     void reset();
-    QString cleanUp(QString text);
+    int findCommentSL(const QString & text, int offset, int & end) const;
+    int findRegexp(const QString & text, int offset, int & end) const;
+    void appendTokens(const QString & text, int from, int to);
+    void tokenize(QString & text);
     bool isValidName(QString name);
-    void parseCode(QString & code, QString & origText);
+    void parseCode(QString & origText);
     void addClass(QString name, int line);
     void addFunction(QString clsName, QString name, QString args, int minArgs, int maxArgs, bool isGlobal, QString returnType, QString comment, int line);
     void updateFunctionReturnType(QString clsName, QString funcName, QString returnType);
@@ -84,10 +89,8 @@ protected:
     void addComment(QString text, int line);
     void addError(QString text, int line, int symbol);
 
-    QRegularExpression commentSLExpression;
-    QRegularExpression regexpExpression;
-    QRegularExpression parseExpression;
     QRegularExpression nameExpression;
+    QVector<Token> tokens;
 private:
     ParseJS::ParseResult result;
 
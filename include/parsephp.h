@@ -10,6 +10,7 @@
 #include "parse.h"
 #include <unordered_map>
 #include <QVector>
+#include <QSharedPointer>
 
 extern const QString IMPORT_TYPE_CLASS;
 extern const QString IMPORT_TYPE_FUNCTION;
@@ -93,14 +94,129 @@ public:
         QVector<ParseResultComment> comments;
         QVector<ParseResultError> errors;
     };
+    // parse results are immutable once parsed and shared by all consumers
+    typedef QSharedPointer<const ParseResult> SharedParseResult;
 
-    ParsePHP::ParseResult parse(QString text);
+    ParsePHP::SharedParseResult parse(QString text);
+    ParsePHP::SharedParseResult parse(QString text, int changeStart, int changeEnd);
     static std::unordered_map<std::string, std::string> dataTypes;
 protected:
+    // tokens of a code block between php tags
+    struct CodeRegion {
+        int start;
+        int tokensFrom;
+        int tokensTo;
+    };
+    // comment found by the tokenizer and the line it ends on
+    struct CodeComment {
+        int start;
+        int end;
+        int line;
+    };
+    // tokens of the previously parsed text that a scan can catch up with
+    // after the changed part of the text
+    struct TokensRescan {
+        int changeStart;
+        int changeEnd;
+        int delta;
+        QVector<Token> tokens;
+        QVector<CodeRegion> codeRegions;
+        QVector<CodeComment> codeComments;
+        QVector<int> heredocFailures;
+        int noClosingDQFrom;
+        int noClosingSQFrom;
+        int noClosingBacktickFrom;
+    };
+    // state of the symbol pass in a code region
+    struct CodeState {
+        CodeState();
+        bool isSameScope(const CodeState & other) const;
+        void shiftPositions(int from, int delta);
+        QString current_namespace;
+        QString current_class;
+        bool current_class_is_abstract;
+        QString current_class_parent;
+        QStringList current_class_interfaces;
+        QString current_interface;
+        QString current_interface_parent;
+        QString current_trait;
+        QString current_function;
+        QString current_function_args;
+        bool current_function_is_static;
+        bool current_function_is_abstract;
+        QString current_function_visibility;
+        int current_function_min_args;
+        int current_function_max_args;
+        QString current_function_return_type;
+        QString current_variable;
+        bool current_variable_is_static;
+        QString current_variable_visibility;
+        QString current_variable_type;
+        QString current_constant;
+        QString current_constant_value;
+        QStringList parent_namespaces;
+        QVector<int> parent_namespace_scopes;
+        QString expected_function_name;
+        QStringList expected_function_args;
+        QStringList expected_function_arg_types;
+        QString expected_class_name;
+        int scope;
+        int namespaceScope, classScope, interfaceScope, traitScope, functionScope, anonymFunctionScope, anonymClassScope;
+        int pars;
+        int curlyBrackets, roundBrackets, squareBrackets;
+        QVector<int> curlyBracketsList, roundBracketsList, squareBracketsList;
+        int functionArgPars;
+        int functionArgsStart;
+        int constantValueStart;
+        bool functionParsFound, classParsFound;
+        int expect;
+        QString expectName;
+        QString prevK, prevPrevK, prevPrevPrevK, prevPrevPrevPrevK, prevPrevPrevPrevPrevK, prevPrevPrevPrevPrevPrevK, prevPrevPrevPrevPrevPrevPrevK, prevPrevPrevPrevPrevPrevPrevPrevK;
+        int useStart, namespaceStart, classStart, interfaceStart, traitStart, functionStart, variableStart, constantStart;
+        QString class_static_variable, class_variable;
+        QStringList functionChainList, classChainList, traitChainList;
+    };
+    // body of a named function found by the symbol pass. The states do not keep
+    // the bracket lists, their sizes are stored instead.
+    struct FunctionBody {
+        int regionIndex;
+        int openToken;
+        int closeToken; // -1 while the body is not closed
+        int start; // positions of the braces in the text
+        int end;
+        CodeState openState;
+        CodeState closeState;
+        int openCurlyBrackets, openRoundBrackets, openSquareBrackets;
+        int closeCurlyBrackets, closeRoundBrackets, closeSquareBrackets;
+        std::unordered_map<std::string, std::string> classAliases;
+        std::unordered_map<std::string, std::string> functionAliases;
+        std::unordered_map<std::string, std::string> constantAliases;
+        // counts of the results when the body is opened and closed
+        int functionsCount;
+        int classesCount;
+        int constantsCount;
+        int namespacesCount;
+        int importsCount;
+        int variablesCount;
+        int closeVariablesCount;
+        // arguments of the function, their types can be changed in the body
+        QVector<int> argIndexes;
+        QVector<ParseResultVariable> args;
+        bool hasSideEffects;
+    };
     void reset();
-    QString cleanUp(QString text);
+    void tokenize(QString & text);
+    bool retokenize(QString & text, int changeStart, int changeEnd, int & prevIndex, int & indexDelta);
+    int scanTokens(QString & text, int offset, CodeRegion & region, const TokensRescan * rescan = nullptr);
+    void parseTokens(QString & text, bool keepFunctionBodies);
+    void openFunctionBody(int regionIndex, int token, const CodeState & state);
+    void closeFunctionBody(int token, const CodeState & state);
+    bool reparseFunctionBody(QString & text, int changeStart, int changeEnd, int prevIndex, int indexDelta);
+    void collectComments(QString & text);
+    void addComments();
     bool isValidName(QString name);
-    void parseCode(QString & code, QString & origText, int textOffset);
+    void parseCode(QString & origText, const CodeRegion & region, int regionIndex, int tokensFrom, int tokensTo, CodeState & state);
+    void addBracketErrors(QString & origText, int textOffset, const CodeState & state);
     QString toAbs(QString ns, QString path, QString type = "");
     void addImport(QString nsName, QString name, QString path, QString type, int line);
     void addNamespace(QString name, int line);
@@ -115,16 +231,23 @@ protected:
     void addComment(QString text, int line);
     void addError(QString text, int line, int symbol);
 
-    QRegularExpression phpExpression;
-    QRegularExpression phpStartExpression;
-    QRegularExpression phpEndExpression;
-    QRegularExpression stringHeredocExpression;
-    QRegularExpression stringHeredocDQExpression;
-    QRegularExpression stringNowdocExpression;
-    QRegularExpression commentSLExpression;
-    QRegularExpression commentSLAExpression;
-    QRegularExpression parseExpression;
     QRegularExpression nameExpression;
+    QVector<Token> tokens;
+    QVector<CodeRegion> codeRegions;
+    QVector<CodeComment> codeComments;
+    // counts of tokens when the lookups of a heredoc failed and
+    // when the lookups of closing quotes failed, or -1
+    QVector<int> heredocFailures;
+    int noClosingDQFrom;
+    int noClosingSQFrom;
+    int noClosingBacktickFrom;
+    QString parsedText;
+    ParsePHP::SharedParseResult parsedResult;
+    // kept to parse a changed function body again, see reparseFunctionBody
+    QVector<FunctionBody> functionBodies;
+    QVector<CodeState> regionStates; // state at the end of each code region
+    QVector<int> regionErrors; // index of the first error of each code region
+    bool classScopeChanged;
 private:
     std::unordered_map<std::string, std::string> classAliases;
     std::unordered_map<std::string, std::string>::iterator classAliasesIterator;
@@ -9,11 +9,11 @@
 
 #include <QObject>
 #include <QDir>
+#include <QVariantMap>
 #include "settings.h"
 #include "parsephp.h"
 #include "parsejs.h"
 #include "parsecss.h"
-#include "types.h"
 
 extern const QString PHP_WEBSERVER_URI;
 
@@ -24,8 +24,8 @@ public:
     explicit ParserWorker(QObject *parent = nullptr);
     ~ParserWorker();
 protected:
-    void parseProjectDir(QString dir, QStringList & files);
-    void parseProjectFile(QString file, QVariantMap & map);
+    void parseProjectDir(QString dir, QStringList & files, QSet<QString> & linkedDirs);
+    void updateProjectFiles(QString projectPath, QStringList files, QVector<ParsePHP::SharedParseResult> results, QVector<QVariantMap> states, QVariantMap touchedStates);
     void searchInDir(QString searchDirectory, QString searchText, QString searchExtensions, bool searchOptionCase, bool searchOptionWord, bool searchOptionRegexp, QStringList excludeDirs);
     void searchInFile(QString file, QString searchText, bool searchOptionCase, bool searchOptionWord, bool searchOptionRegexp);
     void searchInFilesResultFound(QString file, QString lineText, int line, int symbol);
@@ -37,6 +37,15 @@ protected:
     bool installAndroidPackFiles();
     bool isAndroidPackInstalled();
     void setAndroidBinPaths();
+    // text of a document that is parsed from its edits
+    struct ParsedDocument {
+        int revision;
+        int parsedPHPRevision;
+        int usedAt;
+        QString text;
+        ParsePHP parserPHP;
+    };
+    ParsedDocument * applyEdits(int tabIndex, Parse::TextEdits & edits, int & changeStart, int & changeEnd);
 private:
     QString phpPath;
     QString gitPath;
@@ -49,6 +58,7 @@ private:
     std::string encoding;
     std::string encodingFallback;
     bool enabled;
+    bool debugStats;
     int searchResultsCount;
     bool searchBreaked;
     bool isBusy;
@@ -60,16 +70,22 @@ private:
     QStringList androidGitFiles;
     QStringList androidOtherFiles;
     qint64 phpWebServerPid;
+    std::unordered_map<int, ParsedDocument> parsedDocuments;
+    int parsedDocumentsUsage;
+    QString pendingProjectPath;
+    QStringList pendingProjectFiles;
 signals:
     void lintFinished(int tabIndex, QStringList errorTexts, QStringList errorLines, QString output);
     void execPHPFinished(int tabIndex, QString output);
     void execPHPWebServerFinished(bool success, QString output);
     void phpcsFinished(int tabIndex, QStringList errorTexts, QStringList errorLines);
-    void parseMixedFinished(int tabIndex, ParsePHP::ParseResult result);
-    void parseJSFinished(int tabIndex, ParseJS::ParseResult result);
-    void parseCSSFinished(int tabIndex, ParseCSS::ParseResult result);
+    void parseMixedFinished(int tabIndex, ParsePHP::SharedParseResult result);
+    void parseJSFinished(int tabIndex, ParseJS::SharedParseResult result);
+    void parseCSSFinished(int tabIndex, ParseCSS::SharedParseResult result);
+    void parseEditsRejected(int tabIndex, int documentId);
     void parseProjectFinished(bool success = true, bool isModified = true);
     void parseProjectProgress(int v);
+    void projectFileUpdated(QStringList files, QVariantMap oldMap, QVariantMap newMap);
     void searchInFilesFound(QString file, QString lineText, int line, int symbol);
     void searchInFilesFinished();
     void message(QString text);
@@ -95,12 +111,17 @@ public slots:
     void parseMixed(int tabIndex, QString text);
     void parseJS(int tabIndex, QString text);
     void parseCSS(int tabIndex, QString text);
+    void parseMixedEdits(int tabIndex, Parse::TextEdits edits);
+    void parseJSEdits(int tabIndex, Parse::TextEdits edits);
+    void parseCSSEdits(int tabIndex, Parse::TextEdits edits);
     void parseProject(QString path);
+    void parseProjectFile(int tabIndex, QString text, QString projectPath, QString path);
+    void parseProjectFiles(QString projectPath, QStringList files);
     void searchInFiles(QString searchDirectory, QString searchText, QString searchExtensions, bool searchOptionCase, bool searchOptionWord, bool searchOptionRegexp, QStringList excludeDirs);
     void gitCommand(QString path, QString command, QStringList attrs, bool outputResult = true, bool silent = false);
     void serversCommand(QString command, QString pwd);
     void sassCommand(QString src, QString dst);
-    void quickFind(QString dir, QString text, WordsMapList words, QStringList wordPrefixes);
+    void quickFind(QString dir, QString text, QString projectPath);
     void cancelRequested();
     void installAndroidPack();
 };
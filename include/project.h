@@ -8,7 +8,11 @@
 #define PROJECT_H
 
 #include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QFileInfo>
 #include "parsephp.h"
+#include "projectsymbols.h"
 #include "completewords.h"
 #include "highlightwords.h"
 #include "helpwords.h"
@@ -35,26 +39,33 @@ public:
     bool isPHPCSEnabled();
     void loadWords();
     void deleteDataFile();
+    QString getHighlightCacheFile(QString path);
+    void cleanHighlightCache(QStringList openTabFiles);
     void findDeclaration(QString name, QString & path, int & line);
     static QVariantMap createPHPResultMap();
-    static QVariantMap loadPHPDataMap(QString path);
+    static bool openPHPSymbols(QString path, ProjectSymbols & symbols);
     static bool isProjectFile(QString path);
-    static void checkParsePHPFilesModified(QStringList & files, QVariantMap & data, QVariantMap & map);
-    static void parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QString path, QString lastModified);
+    static bool isExcludedDir(QString name);
+    static bool isProjectDir(const QFileInfo & fInfo, QSet<QString> & linkedDirs);
+    static QVariantMap createPHPFileState(QString path, const QByteArray & data);
+    static QVariantMap readPHPFileState(QString path);
+    static bool isPHPFileChanged(QString path, const QVariantMap & state, QVariantMap & newState);
+    static bool checkParsePHPFilesModified(QStringList & files, ProjectSymbols & symbols, QVariantMap & map);
+    static void parsePHPResult(ParsePHP::SharedParseResult result, QVariantMap & map, QString path, QVariantMap state);
     static void savePHPResults(QString path, QVariantMap & map);
-    std::unordered_map<std::string, std::string> phpFunctionDeclarations;
-    std::unordered_map<std::string, std::string>::iterator phpFunctionDeclarationsIterator;
-    std::unordered_map<std::string, std::string> phpClassMethodDeclarations;
-    std::unordered_map<std::string, std::string>::iterator phpClassMethodDeclarationsIterator;
-    std::unordered_map<std::string, std::string> phpClassDeclarations;
-    std::unordered_map<std::string, std::string>::iterator phpClassDeclarationsIterator;
+    static void updatePHPResults(QString path, ProjectSymbols & symbols, const QSet<QString> & paths, QVariantMap & map, const QVariantMap & states);
+    static bool isPHPWordsOutdated(QString path);
+    void updatePHPWords(QStringList files, QVariantMap & oldMap, QVariantMap & newMap);
 protected:
     void reset();
+    static void deleteLegacyFiles(QString project_dir);
     void loadPHPWords(QString project_dir);
+    void addPHPWord(const QString & type, QString k);
+    void removePHPWord(const QString & type, QString k);
     bool updateMetaFile(QString name, QString path, bool lintEnabled, bool csEnabled, QString time_created, QString time_modified, QStringList openTabFiles, QList<int> openTabLines, int currentTabIndex, QString todo);
-    static std::unordered_map<std::string, std::string> getPHPFilesMapFromData(QVariantMap & data);
     static void preparePHPResults(QString project_dir, QVariantMap & map);
-    static void preparePHPClasses(QString cls_name, QVariantMap cls, QString & cls_args, QString & class_consts_str, QString & class_properties_str, QString & class_methods_str, QString & class_method_types_str, QString & class_methods_search_str, QString & class_methods_help_str,std::unordered_map<std::string, std::string> & cls_methods_map, std::unordered_map<std::string, std::string> & cls_props_map, std::unordered_map<std::string, std::string> & cls_consts_map);
+    static void preparePHPWords(QVariantMap & map, QHash<QString, QString> & words);
+    static void preparePHPClasses(QString cls_name, QVariantMap cls, QString & cls_args, QString & class_consts_str, QString & class_properties_str, QString & class_methods_str, QString & class_method_types_str, QString & class_methods_help_str,std::unordered_map<std::string, std::string> & cls_methods_map, std::unordered_map<std::string, std::string> & cls_props_map, std::unordered_map<std::string, std::string> & cls_consts_map);
 private:
     Project();
     QString projectName;
@@ -0,0 +1,125 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#ifndef PROJECTSYMBOLS_H
+#define PROJECTSYMBOLS_H
+
+#include <QFile>
+#include <QVariantMap>
+#include <QVector>
+#include <QHash>
+#include <QSet>
+
+extern const QString PROJECT_PHP_SYMBOLS_FILE;
+extern const QString PROJECT_PHP_SYMBOLS_EXPORT_FILE;
+
+// binary database of the PHP symbols of a project.
+// Symbols are fixed size records grouped by file, class members follow
+// their class. Strings are kept in a single UTF-16 table and referenced
+// by offset and length. Files are sorted by path and top-level symbols
+// are indexed by kind and name, so that lookups are binary searches
+// in the memory mapped file.
+class ProjectSymbols
+{
+public:
+    enum SymbolKind {
+        KIND_CONSTANT = 1,
+        KIND_GLOBAL = 2,
+        KIND_FUNCTION = 3,
+        KIND_CLASS = 4,
+        KIND_CLASS_CONSTANT = 5,
+        KIND_PROPERTY = 6,
+        KIND_METHOD = 7
+    };
+    ProjectSymbols();
+    ~ProjectSymbols();
+    bool open(QString path);
+    void close();
+    bool isOpen();
+    int getFilesCount();
+    QString getFilePath(int fileIndex);
+    int findFile(const QString & path);
+    int findSymbol(int kind, const QString & name);
+    QVector<int> findSymbols(int kind, const QString & name);
+    int findClassMember(int classIndex, int kind, const QString & name);
+    QVector<int> searchSymbols(int kind, const QString & text, int limit);
+    QString getSymbolName(int index);
+    QVariantMap getFileState(int fileIndex);
+    QString getSymbolFile(int index, int & line);
+    QVariantMap getSymbol(int index);
+    void readFile(int fileIndex, QVariantMap & map);
+    bool update(QString path, const QSet<QString> & paths, QVariantMap & map, const QVariantMap & states);
+    static void insertSymbol(QVariantMap & kindMap, const QVariantMap & m);
+    static bool save(QString path, QVariantMap & map);
+    static bool exportJSON(QString path, QVariantMap & map);
+protected:
+    struct Header {
+        quint32 magic;
+        quint32 version;
+        qint32 stringsOffset;
+        qint32 stringsSize;
+        qint32 filesOffset;
+        qint32 filesCount;
+        qint32 symbolsOffset;
+        qint32 symbolsCount;
+        qint32 namesOffset;
+        qint32 namesCount;
+    };
+    struct StringRef {
+        qint32 offset;
+        qint32 length;
+    };
+    struct FileRecord {
+        StringRef path;
+        StringRef lastModified;
+        qint32 symbolsFrom;
+        qint32 symbolsCount;
+        qint64 size;
+        quint64 hash;
+    };
+    struct SymbolRecord {
+        qint32 kind;
+        qint32 flags;
+        qint32 line;
+        qint32 membersCount;
+        StringRef name;
+        StringRef value;
+        StringRef args;
+        StringRef synopsis;
+        StringRef visibility;
+        StringRef comment;
+    };
+    // collects the sections of a new database
+    struct Builder {
+        QVector<ushort> stringsData;
+        QHash<QString, StringRef> stringRefs;
+        QHash<qint64, StringRef> copiedRefs;
+        QVector<FileRecord> filesData;
+        QVector<SymbolRecord> symbolsData;
+        StringRef addString(const QString & str);
+        StringRef copyString(const ushort * source, const StringRef & ref);
+        SymbolRecord createSymbol(int kind, const QVariantMap & m);
+        void groupSymbols(QVariantMap & map, QHash<QString, QVector<SymbolRecord>> & fileSymbols);
+        void addFile(const QString & path, const QVariantMap & state, const QVector<SymbolRecord> & fileSymbols);
+        bool write(QString path);
+    };
+    QString getString(const StringRef & ref);
+    int compareString(const StringRef & ref, const QString & str);
+    QString rawString(const StringRef & ref);
+    int findSymbolClass(int index);
+    int findName(int kind, const QString & name);
+    StringRef copyString(Builder & builder, const StringRef & ref);
+    QVariantMap readSymbol(int index, const QString & file);
+    QFile file;
+    const uchar * data;
+    const Header * header;
+    const ushort * strings;
+    const FileRecord * files;
+    const SymbolRecord * symbols;
+    const qint32 * names;
+};
+
+#endif // PROJECTSYMBOLS_H
@@ -0,0 +1,49 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#ifndef PROJECTWATCHER_H
+#define PROJECTWATCHER_H
+
+#include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QSocketNotifier>
+
+// watches the directories of a project with inotify (Linux only)
+// and reports the changed files in batches.
+// Runs on its own thread, directories are walked there.
+class ProjectWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ProjectWatcher(QObject *parent = nullptr);
+    ~ProjectWatcher();
+protected:
+    void addDir(QString dir, bool isNew);
+private:
+    QString rootPath;
+    int fd;
+    QSocketNotifier * notifier;
+    QHash<int, QString> watchDirs;
+    QSet<QString> changedFiles;
+    QSet<QString> linkedDirs;
+    bool overflowed;
+    QTimer * timer;
+    QElapsedTimer batchTimer;
+signals:
+    void filesChanged(QStringList files);
+    void rescanRequested();
+public slots:
+    void start(QString path);
+    void stop();
+private slots:
+    void readEvents();
+    void timerTimeout();
+};
+
+#endif // PROJECTWATCHER_H
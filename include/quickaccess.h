@@ -26,12 +26,13 @@ public:
     QSize sizeHint() const override;
     void slideIn(int x, int y, int width, int height);
     void slideOut();
-    void setParseResult(ParsePHP::ParseResult result, QString file);
-    void setParseResult(ParseJS::ParseResult result, QString file);
-    void setParseResult(ParseCSS::ParseResult result, QString file);
+    void setParseResult(ParsePHP::SharedParseResult result, QString file);
+    void setParseResult(ParseJS::SharedParseResult result, QString file);
+    void setParseResult(ParseCSS::SharedParseResult result, QString file);
 protected:
     bool eventFilter(QObject *watched, QEvent *event) override;
     void restoreResults();
+    void updateResults(QList<QListWidgetItem *> items);
     void animateIn();
     void animateOut();
     QLineEdit * findEdit;
@@ -40,9 +41,9 @@ protected:
 private:
     QAction * clearAction;
     QString lastSearch;
-    ParsePHP::ParseResult parseResultPHP;
-    ParseJS::ParseResult parseResultJS;
-    ParseCSS::ParseResult parseResultCSS;
+    ParsePHP::SharedParseResult parseResultPHP;
+    ParseJS::SharedParseResult parseResultJS;
+    ParseCSS::SharedParseResult parseResultCSS;
     QString parseResultFile;
     int parseResultType;
     bool findLocked;
@@ -1,15 +0,0 @@
-/*******************************************
- * Zira Editor
- * A lightweight PHP Editor
- * (C)2019 https://github.com/ziracms/editor
- *******************************************/
-
-#ifndef TYPES_H
-#define TYPES_H
-
-#include <list>
-#include <unordered_map>
-
-typedef std::list<std::unordered_map<std::string, std::string>> WordsMapList;
-
-#endif // TYPES_H
@@ -32,6 +32,9 @@
 #include <QInputDialog>
 #include <QAction>
 #include <QScreen>
+#include <QFile>
+#include <QCryptographicHash>
+#include <QDataStream>
 #include "math.h"
 #include "helper.h"
 #include "icon.h"
@@ -49,6 +52,12 @@ const int INTERVAL_SPELL_CHECK_MILLISECONDS = 500;
 
 const int SPELLCHECKER_INIT_BLOCKS_COUNT = 10;
 
+const int HIGHLIGHT_WORKER_MIN_BLOCKS_COUNT = 1000;
+const int HIGHLIGHT_WORKER_APPLY_BLOCKS_COUNT = 500;
+const int HIGHLIGHT_EXTRA_BLOCKS_COUNT = 100;
+const int HIGHLIGHT_IDLE_SLICE_MILLISECONDS = 10;
+const quint32 HIGHLIGHT_CACHE_VERSION = 3;
+
 const int TOOLTIP_OFFSET = 20;
 const int TOOLTIP_SCREEN_MARGIN = 10;
 
@@ -76,6 +85,9 @@ const int TOO_BIG_FILE_SIZE = 1048576;
 
 const int LONG_LINE_CHARS_COUNT = 72;
 const int FIRST_BLOCK_BIN_SEARCH_SCROLL_VALUE = 300;
+const int PARSE_EDITS_LIMIT = 1000;
+
+int Editor::parseDocumentsCount = 0;
 
 const QString SNIPPET_PREFIX = "Snippet: @";
 
@@ -302,6 +314,24 @@ Editor::Editor(QWidget * parent):
     unusedVariableColor = QColor(unusedVariableColorStr.c_str());
     connect(document(), SIGNAL(contentsChange(int,int,int)), this, SLOT(contentsChange(int,int,int)));
     connect(highlight, SIGNAL(progressChanged(int)), this, SLOT(highlightProgressChanged(int)));
+    highlightWorker = nullptr;
+    highlightWorkerJob = 0;
+    highlightApplyRevision = 0;
+    highlightApplyVisibleCount = 0;
+    highlightInBackground = false;
+    std::string highlightInBackgroundStr = Settings::get("highlight_in_background");
+    if (highlightInBackgroundStr == "yes") highlightInBackground = true;
+    highlightLazy = false;
+    std::string highlightLazyStr = Settings::get("highlight_lazy");
+    if (highlightLazyStr == "yes") highlightLazy = true;
+    highlightDebugStats = false;
+    std::string highlightDebugStatsStr = Settings::get("highlight_debug_stats");
+    if (highlightDebugStatsStr == "yes") highlightDebugStats = true;
+    highlightChangesCount = 0;
+    highlightChangesBlocksCount = 0;
+    highlightIdleTimer.setInterval(0);
+    highlightIdleTimer.setSingleShot(true);
+    connect(&highlightIdleTimer, SIGNAL(timeout()), this, SLOT(highlightIdle()));
 
     // update area slots
     connect(this->document(), SIGNAL(blockCountChanged(int)), this, SLOT(blockCountChanged(int)));
@@ -439,6 +469,13 @@ Editor::Editor(QWidget * parent):
     overwrite = false;
     tabIndex = -1;
     parseLocked = false;
+    parseDocumentId = ++parseDocumentsCount;
+    parseResultPHP = ParsePHP::SharedParseResult(new ParsePHP::ParseResult());
+    parseResultJS = ParseJS::SharedParseResult(new ParseJS::ParseResult());
+    parseResultCSS = ParseCSS::SharedParseResult(new ParseCSS::ParseResult());
+    parseRevision = 0;
+    parseBaseRevision = -1;
+    parseDocumentRevision = -1;
     isUndoAvailable = false;
     isRedoAvailable = false;
     lastCursorPositionBlockNumber = -1;
@@ -525,6 +562,11 @@ Editor::Editor(QWidget * parent):
 
 Editor::~Editor()
 {
+    if (highlightWorker != nullptr) {
+        highlightWorker->cancel();
+        highlightThread.quit();
+        highlightThread.wait();
+    }
     delete highlight;
 }
 
@@ -566,10 +608,18 @@ void Editor::setTabsSettings()
 void Editor::reset()
 {
     setReadOnly(true);
+    if (highlightWorker != nullptr) highlightWorker->cancel();
+    highlightWorkerJob++;
+    highlightResult.reset();
+    highlightApplyQueue.clear();
+    highlightIdleTimer.stop();
     highlight->resetMode();
+    unusedVarsBlocks.clear();
     fileName = "";
     extension = "";
     highlighterInitialized = false;
+    highlightFormatsStale = false;
+    highlightCompleted = false;
     is_ready = false;
     cursorPositionChangeLocked = false;
     scrollBarValueChangeLocked = false;
@@ -592,6 +642,8 @@ void Editor::reset()
     lastModifiedMsec = 0;
     warningDisplayed = false;
     parseLocked = false;
+    parseBaseRevision = -1;
+    parseEdits.clear();
     isUndoAvailable = false;
     isRedoAvailable = false;
     backPositions.clear();
@@ -719,12 +771,25 @@ void Editor::initHighlighter()
 
     highlight->setIsBigFile(isBigFile);
     highlight->initMode(extension, getLastVisibleBlockIndex());
+    updateLongLineColumns();
 
     bool isFocused = hasFocus();
     int line = getCursorLine();
-    highlight->setFirstRunMode(true);
-    highlight->rehighlight();
-    highlight->setFirstRunMode(false);
+    // blocks restored from the cache are not parsed, see loadHighlightCache
+    bool cached = !highlightResult.isNull();
+    bool background = !cached && highlightInBackground && document()->blockCount() >= HIGHLIGHT_WORKER_MIN_BLOCKS_COUNT;
+    bool lazy = !cached && !background && highlightLazy;
+    if (background) {
+        highlightInBackgroundStart();
+    } else if (lazy) {
+        // only visible blocks are highlighted now, the rest in idle time
+        highlight->startLazyHighlight();
+        highlight->highlightTo(getLastVisibleBlockIndex() + HIGHLIGHT_EXTRA_BLOCKS_COUNT);
+    } else if (!cached) {
+        highlight->setFirstRunMode(true);
+        highlight->rehighlight();
+        highlight->setFirstRunMode(false);
+    }
     if (line > 1) gotoLine(line, false);
     if (isFocused) setFocus();
 
@@ -733,8 +798,196 @@ void Editor::initHighlighter()
     is_ready = true;
     cursorPositionChangedDelayed();
     emit ready(tabIndex);
-    if (highlight->getModeType() == MODE_MIXED) highlightUnusedVars(false);
+    if (cached) {
+        // applied like a result of the worker, after the cursor is restored
+        highlightInBackgroundFinished(highlightWorkerJob, highlightResult);
+        return;
+    }
+    if (background) return;
+    if (lazy && highlight->isLazyHighlightPending()) {
+        highlightIdleTimer.start();
+        return;
+    }
+    highlightComplete();
+}
+
+// hidden editors remap the formats when they are shown
+void Editor::remapHighlightFormats()
+{
+    if (!isVisible()) {
+        highlightFormatsStale = true;
+        return;
+    }
+    highlightFormatsStale = false;
+    highlight->remapFormats();
+}
+
+// cached highlight is valid while the file is not changed
+static QByteArray getHighlightCacheKey(QString fileName, const QString & text)
+{
+    QFileInfo fInfo(fileName);
+    QByteArray key;
+    QDataStream out(&key, QIODevice::WriteOnly);
+    out << HIGHLIGHT_CACHE_VERSION << static_cast<quint32>(FORMATS_COUNT) << fileName;
+    out << fInfo.size() << fInfo.lastModified().toMSecsSinceEpoch();
+    out << QCryptographicHash::hash(text.toUtf8(), QCryptographicHash::Md5);
+    return key;
+}
+
+// restores the highlight saved in the previous session,
+// it is applied by initHighlighter instead of parsing the file
+bool Editor::loadHighlightCache(QString cacheFile)
+{
+    if (highlighterInitialized || fileName.size() == 0 || isModified()) return false;
+    QFile f(cacheFile);
+    if (!f.open(QIODevice::ReadOnly)) return false;
+    QDataStream in(&f);
+    QByteArray key;
+    in >> key;
+    if (in.status() != QDataStream::Ok || key != getHighlightCacheKey(fileName, document()->toPlainText())) return false;
+    highlightResult = highlight->importResult(in);
+    return !highlightResult.isNull();
+}
+
+void Editor::saveHighlightCache(QString cacheFile)
+{
+    if (!highlightCompleted || fileName.size() == 0 || isModified()) return;
+    QFile f(cacheFile);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) return;
+    QDataStream out(&f);
+    out << getHighlightCacheKey(fileName, document()->toPlainText());
+    highlight->exportResult(out);
+}
+
+void Editor::highlightComplete()
+{
+    highlightCompleted = true;
+    if (highlight->getModeType() == MODE_MIXED) highlightUnusedVars();
     initSpellChecker();
+    if (highlightDebugStats) {
+        int unsharedBytes = 0;
+        int bytes = highlight->getStateMemoryUsage(unsharedBytes);
+        int blocksCount = qMax(1, document()->blockCount());
+        Helper::log("Highlight state: "+Helper::intToStr(bytes / 1024)+" KB, "+Helper::intToStr(bytes / blocksCount)+" bytes per line ("+Helper::intToStr(unsharedBytes / blocksCount)+" bytes per line unshared)\n");
+        qint64 charsCount = 0;
+        qint64 nsecs = highlight->getParseTime(charsCount);
+        if (charsCount > 0) Helper::log("Highlight parse: "+Helper::intToStr(static_cast<int>(nsecs / 1000000))+" ms, "+Helper::intToStr(static_cast<int>(nsecs / charsCount))+" ns per char\n");
+        qint64 skippedCount = 0;
+        qint64 appliedCount = highlight->getAppliedFormatBlocksCount(skippedCount);
+        Helper::log("Highlight formats: "+Helper::intToStr(static_cast<int>(appliedCount))+" lines applied, "+Helper::intToStr(static_cast<int>(skippedCount))+" unchanged lines skipped\n");
+    }
+}
+
+void Editor::highlightIdle()
+{
+    if (!highlight->isLazyHighlightPending()) return;
+    if (highlight->highlightNext(HIGHLIGHT_IDLE_SLICE_MILLISECONDS)) {
+        highlightIdleTimer.start();
+    } else {
+        highlightComplete();
+    }
+}
+
+void Editor::highlightInBackgroundStart()
+{
+    if (highlightWorker == nullptr) {
+        highlightWorker = new HighlightWorker();
+        highlightWorker->moveToThread(&highlightThread);
+        connect(&highlightThread, &QThread::finished, highlightWorker, &QObject::deleteLater);
+        connect(this, SIGNAL(highlightText(int,QString,QString,QString,bool)), highlightWorker, SLOT(highlightText(int,QString,QString,QString,bool)));
+        connect(this, SIGNAL(highlightRelease()), highlightWorker, SLOT(release()));
+        connect(highlightWorker, SIGNAL(progressChanged(int)), this, SLOT(highlightProgressChanged(int)));
+        connect(highlightWorker, SIGNAL(highlightFinished(int,SharedHighlightResult)), this, SLOT(highlightInBackgroundFinished(int,SharedHighlightResult)));
+        highlightThread.start();
+    }
+    highlightWorkerJob++;
+    highlightApplyQueue.clear();
+    QFileInfo fInfo(fileName);
+    emit highlightText(highlightWorkerJob, document()->toPlainText(), extension, fInfo.baseName(), isBigFile);
+}
+
+void Editor::highlightInBackgroundFinished(int job, SharedHighlightResult result)
+{
+    // results of a cancelled or outdated job
+    if (job != highlightWorkerJob || result.isNull()) return;
+    highlightResult = result;
+    highlight->importSymbols(*result);
+    // blocks edited while the worker was running are highlighted by the editor itself
+    int validBlocksCount = 0;
+    QTextBlock block = document()->firstBlock();
+    while (block.isValid() && validBlocksCount < result->blocks.size() && qHash(block.text()) == result->blocks.at(validBlocksCount).textHash) {
+        validBlocksCount++;
+        block = block.next();
+    }
+    // visible blocks go first
+    highlightApplyQueue.clear();
+    int firstBlockNumber = qMax(0, getFirstVisibleBlockIndex() - HIGHLIGHT_EXTRA_BLOCKS_COUNT);
+    int lastBlockNumber = qMin(validBlocksCount - 1, getLastVisibleBlockIndex() + HIGHLIGHT_EXTRA_BLOCKS_COUNT);
+    for (int i=firstBlockNumber; i<=lastBlockNumber; i++) {
+        highlightApplyQueue.append(i);
+    }
+    for (int i=0; i<validBlocksCount; i++) {
+        if (i >= firstBlockNumber && i <= lastBlockNumber) continue;
+        highlightApplyQueue.append(i);
+    }
+    highlightApplyRevision = document()->revision();
+    highlightApplyVisibleCount = qMax(0, lastBlockNumber - firstBlockNumber + 1);
+    applyHighlightInBackgroundResults();
+}
+
+void Editor::applyHighlightInBackgroundResults()
+{
+    if (highlightResult.isNull() || highlightApplyQueue.size() == 0) return;
+    if (document()->revision() != highlightApplyRevision) {
+        // text was changed, remaining blocks are highlighted in idle time
+        highlightApplyQueue.clear();
+        highlightInBackgroundComplete();
+        return;
+    }
+    int count = qMax(highlightApplyVisibleCount, HIGHLIGHT_WORKER_APPLY_BLOCKS_COUNT);
+    highlightApplyVisibleCount = 0;
+    int startPos = -1, endPos = -1;
+    while (count > 0 && highlightApplyQueue.size() > 0) {
+        int blockNumber = highlightApplyQueue.takeFirst();
+        QTextBlock block = document()->findBlockByNumber(blockNumber);
+        if (block.isValid() && blockNumber < highlightResult->blocks.size()) {
+            highlight->importBlock(block, highlightResult->blocks.at(blockNumber));
+            if (startPos >= 0 && block.position() != endPos) {
+                document()->markContentsDirty(startPos, endPos - startPos);
+                startPos = -1;
+            }
+            if (startPos < 0) startPos = block.position();
+            endPos = block.position() + block.length();
+        }
+        count--;
+    }
+    if (startPos >= 0) document()->markContentsDirty(startPos, endPos - startPos);
+    if (highlightApplyQueue.size() > 0) {
+        QTimer::singleShot(0, this, SLOT(applyHighlightInBackgroundResults()));
+    } else {
+        highlightInBackgroundComplete();
+    }
+}
+
+void Editor::highlightInBackgroundComplete()
+{
+    highlightResult.reset();
+    emit highlightRelease();
+    // blocks that did not get the results and the blocks after them
+    // are highlighted in idle time, like a lazy highlight
+    QTextBlock block = document()->firstBlock();
+    while (block.isValid() && block.userData() != nullptr) {
+        block = block.next();
+    }
+    if (block.isValid()) {
+        highlight->startLazyHighlight(block.blockNumber());
+        highlight->highlightTo(getLastVisibleBlockIndex() + HIGHLIGHT_EXTRA_BLOCKS_COUNT);
+        if (highlight->isLazyHighlightPending()) {
+            highlightIdleTimer.start();
+            return;
+        }
+    }
+    highlightComplete();
 }
 
 void Editor::initSpellChecker()
@@ -864,24 +1117,32 @@ void Editor::paintEvent(QPaintEvent * event)
     QTextEdit::paintEvent(event);
 }
 
-void Editor::setParseResult(ParsePHP::ParseResult result)
+void Editor::setParseResult(ParsePHP::SharedParseResult result)
 {
     parseResultPHP = result;
+    detectedVariableTypesPHP.clear();
     parseLocked = false;
 }
 
-void Editor::setParseResult(ParseJS::ParseResult result)
+void Editor::setParseResult(ParseJS::SharedParseResult result)
 {
     parseResultJS = result;
     parseLocked = false;
 }
 
-void Editor::setParseResult(ParseCSS::ParseResult result)
+void Editor::setParseResult(ParseCSS::SharedParseResult result)
 {
     parseResultCSS = result;
     parseLocked = false;
 }
 
+QString Editor::getVariableTypePHP(int index)
+{
+    QString type = parseResultPHP->variables.at(index).type;
+    if (type.size() == 0) type = detectedVariableTypesPHP.value(index);
+    return type;
+}
+
 void Editor::setGitAnnotations(QHash<int, Git::Annotation> annotations)
 {
     if (warningDisplayed) return;
@@ -1518,6 +1779,13 @@ void Editor::resizeEvent(QResizeEvent * e)
     if (!searchDisplayOnTop && static_cast<Search *>(search)->isVisible()) {
         static_cast<Search *>(search)->updateScrollBar();
     }
+    if (is_ready) updateLongLineColumns();
+}
+
+void Editor::showEvent(QShowEvent * e)
+{
+    QTextEdit::showEvent(e);
+    if (highlightFormatsStale) remapHighlightFormats();
 }
 
 void Editor::updateWidgetsGeometry()
@@ -1843,15 +2111,7 @@ void Editor::comment()
 void Editor::focusInEvent(QFocusEvent *e)
 {
     focused = true;
-    if (fileName.size() > 0 && !Helper::fileExists(fileName) && !warningDisplayed) {
-        setFileIsDeleted();
-    } else if (fileName.size() > 0 && Helper::fileExists(fileName) && lastModifiedMsec > 0 && !warningDisplayed) {
-        QFileInfo fInfo(fileName);
-        QDateTime dtModified = fInfo.lastModified();
-        if (dtModified.time().msec() != lastModifiedMsec) {
-            setFileIsOutdated();
-        }
-    }
+    checkFile();
     if (!searchDisplayOnTop && static_cast<Search *>(search)->isVisible()) {
         static_cast<Search *>(search)->updateScrollBar();
     }
@@ -1866,6 +2126,19 @@ void Editor::focusOutEvent(QFocusEvent *e)
     QTextEdit::focusOutEvent(e);
 }
 
+void Editor::checkFile()
+{
+    if (fileName.size() > 0 && !Helper::fileExists(fileName) && !warningDisplayed) {
+        setFileIsDeleted();
+    } else if (fileName.size() > 0 && Helper::fileExists(fileName) && lastModifiedMsec > 0 && !warningDisplayed) {
+        QFileInfo fInfo(fileName);
+        QDateTime dtModified = fInfo.lastModified();
+        if (dtModified.time().msec() != lastModifiedMsec) {
+            setFileIsOutdated();
+        }
+    }
+}
+
 void Editor::setFileIsDeleted()
 {
     if (warningDisplayed) return;
@@ -2648,11 +2921,27 @@ void Editor::blockCountChanged(int /*blockCount*/)
 void Editor::horizontalScrollbarValueChanged(int /* sliderPos */)
 {
     updateLineAnnotationView();
+    if (is_ready) updateLongLineColumns();
     if (!searchDisplayOnTop && static_cast<Search *>(search)->isVisible()) {
         static_cast<Search *>(search)->updateScrollBar();
     }
 }
 
+// long lines are formatted only around the visible columns
+void Editor::updateLongLineColumns()
+{
+    int firstColumn = -1, lastColumn = -1;
+    if (!wrapLines) {
+        QFontMetrics fm(font());
+        int charWidth = qMax(1, fm.horizontalAdvance(" "));
+        firstColumn = horizontalScrollBar()->value() / charWidth;
+        lastColumn = firstColumn + viewport()->width() / charWidth;
+    }
+    if (highlight->setLongLineVisibleColumns(firstColumn, lastColumn)) {
+        highlight->updateLongBlocks(getFirstVisibleBlockIndex(), getLastVisibleBlockIndex());
+    }
+}
+
 void Editor::verticalScrollbarValueChanged(int /* sliderPos */)
 {
     firstVisibleBlockIndex = -1;
@@ -2731,16 +3020,19 @@ void Editor::wheelEvent(QWheelEvent *e)
 
 void Editor::contentsChange(int position, int charsRemoved, int charsAdded)
 {
+    recordParseEdit(position, charsRemoved, charsAdded);
     if (!is_ready || isReadOnly()) return;
     QTextBlock block = document()->findBlock(position);
     if (!block.isValid()) return;
 
+    if (highlightDebugStats) highlight->takeHighlightedBlocksCount();
     highlight->resetHighlightBlock(block);
 
     QTextBlock lastBlock = document()->findBlock(position + charsAdded + (charsRemoved > 0 ? 1 : 0));
     if (!lastBlock.isValid()) {
         QTextCursor curs = QTextCursor(block);
         highlight->highlightChanges(curs);
+        if (highlightDebugStats) logHighlightChanges();
         return;
     }
 
@@ -2756,6 +3048,15 @@ void Editor::contentsChange(int position, int charsRemoved, int charsAdded)
         QTextCursor curs = QTextCursor(block);
         highlight->highlightChanges(curs);
     }
+    if (highlightDebugStats) logHighlightChanges();
+}
+
+void Editor::logHighlightChanges()
+{
+    int blocksCount = highlight->takeHighlightedBlocksCount();
+    highlightChangesCount++;
+    highlightChangesBlocksCount += blocksCount;
+    Helper::log("Rehighlighted "+Helper::intToStr(blocksCount)+" lines (average: "+Helper::intToStr(static_cast<int>(highlightChangesBlocksCount / highlightChangesCount))+" lines per edit)\n");
 }
 
 void Editor::textChanged()
@@ -2905,32 +3206,27 @@ bool Editor::isKnownWord(QString word)
         }
     }
     if (!known) {
-        HW->phpwordsIterator = HW->phpwords.find(word.toLower().toStdString());
-        if (HW->phpwordsIterator != HW->phpwords.end()) {
+        if (HW->phpwords.contains(word)) {
             known = true;
         }
     }
     if (!known) {
-        HW->phpwordsCSIterator = HW->phpwordsCS.find(word.toStdString());
-        if (HW->phpwordsCSIterator != HW->phpwordsCS.end()) {
+        if (HW->phpwordsCS.contains(word)) {
             known = true;
         }
     }
     if (!known) {
-        HW->jswordsCSIterator = HW->jswordsCS.find(word.toStdString());
-        if (HW->jswordsCSIterator != HW->jswordsCS.end()) {
+        if (HW->jswordsCS.contains(word)) {
             known = true;
         }
     }
     if (!known) {
-        HW->csswordsIterator = HW->csswords.find(word.toLower().toStdString());
-        if (HW->csswordsIterator != HW->csswords.end()) {
+        if (HW->csswords.contains(word)) {
             known = true;
         }
     }
     if (!known) {
-        HW->htmlwordsIterator = HW->htmlwords.find(word.toLower().toStdString());
-        if (HW->htmlwordsIterator != HW->htmlwords.end()) {
+        if (HW->htmlwords.contains(word)) {
             known = true;
         }
     }
@@ -3171,16 +3467,16 @@ QString Editor::completeClassNamePHPAtCursor(QTextCursor & curs, QString prevWor
         // search imports
         ParsePHP::ParseResultNamespace ns;
         ParsePHP::ParseResultImport imp;
-        for (int i=0; i<parseResultPHP.namespaces.size(); i++) {
-            ParsePHP::ParseResultNamespace _ns = parseResultPHP.namespaces.at(i);
+        for (int i=0; i<parseResultPHP->namespaces.size(); i++) {
+            const ParsePHP::ParseResultNamespace & _ns = parseResultPHP->namespaces.at(i);
             if (_ns.name == nsName) {
                 ns = _ns;
                 break;
             }
         }
         for (int c=0; c<ns.importsIndexes.size(); c++) {
-            if (parseResultPHP.imports.size() <= ns.importsIndexes.at(c)) break;
-            ParsePHP::ParseResultImport _imp = parseResultPHP.imports.at(ns.importsIndexes.at(c));
+            if (parseResultPHP->imports.size() <= ns.importsIndexes.at(c)) break;
+            const ParsePHP::ParseResultImport & _imp = parseResultPHP->imports.at(ns.importsIndexes.at(c));
             if (_imp.type == IMPORT_TYPE_CLASS && _imp.name == clsAlias) {
                 imp = _imp;
                 break;
@@ -3311,8 +3607,8 @@ void Editor::detectCompleteTextCSS(QString text, QChar cursorTextPrevChar)
     }
     if (completePopup->count() < completePopup->limit()) {
         // css id & class selectors
-        for (int i=parseResultCSS.names.size()-1; i>=0; i--){
-            ParseCSS::ParseResultName _name = parseResultCSS.names.at(i);
+        for (int i=parseResultCSS->names.size()-1; i>=0; i--){
+            const ParseCSS::ParseResultName & _name = parseResultCSS->names.at(i);
             QString k = _name.name;
             if (k.indexOf(text, 0, Qt::CaseInsensitive)==0) {
                 completePopup->addItem(k, k);
@@ -3407,8 +3703,8 @@ void Editor::detectCompleteTextJS(QString text, int cursorTextPos, QChar cursorT
         }
         // parsed classes
         if (completePopup->count() < completePopup->limit()) {
-            for (int i=0; i<parseResultJS.classes.size(); i++){
-                ParseJS::ParseResultClass cls = parseResultJS.classes.at(i);
+            for (int i=0; i<parseResultJS->classes.size(); i++){
+                const ParseJS::ParseResultClass & cls = parseResultJS->classes.at(i);
                 QString k = cls.name;
                 if (k.indexOf(text, 0, Qt::CaseInsensitive)==0) {
                     completePopup->addItem(k, k);
@@ -3418,8 +3714,8 @@ void Editor::detectCompleteTextJS(QString text, int cursorTextPos, QChar cursorT
         }
         // parsed functions
         if (completePopup->count() < completePopup->limit()) {
-            for (int i=0; i<parseResultJS.functions.size(); i++){
-                ParseJS::ParseResultFunction func = parseResultJS.functions.at(i);
+            for (int i=0; i<parseResultJS->functions.size(); i++){
+                const ParseJS::ParseResultFunction & func = parseResultJS->functions.at(i);
                 if (func.clsName.size() > 0) continue;
                 QString k = func.name;
                 QString p = "( " + func.args + " )";
@@ -3433,8 +3729,8 @@ void Editor::detectCompleteTextJS(QString text, int cursorTextPos, QChar cursorT
         std::unordered_map<std::string, std::string> vars;
         std::unordered_map<std::string, std::string>::iterator varsIterator;
         if (completePopup->count() < completePopup->limit()) {
-            for (int i=parseResultJS.variables.size()-1; i>=0; i--){
-                ParseJS::ParseResultVariable _variable = parseResultJS.variables.at(i);
+            for (int i=parseResultJS->variables.size()-1; i>=0; i--){
+                const ParseJS::ParseResultVariable & _variable = parseResultJS->variables.at(i);
                 //if (_variable.clsName.size() > 0) continue;
                 QString k = _variable.name;
                 if (k.indexOf(text, 0, Qt::CaseInsensitive)==0) {
@@ -3450,8 +3746,8 @@ void Editor::detectCompleteTextJS(QString text, int cursorTextPos, QChar cursorT
         // highlighted vars
         if (completePopup->count() < completePopup->limit()) {
             HighlightData * blockData = dynamic_cast<HighlightData *>(curs.block().userData());
-            if (blockData != nullptr && blockData->varsChainJS.size()>0 && (blockData->varsChainJS.indexOf(text, 0, Qt::CaseInsensitive)==0 || blockData->varsChainJS.indexOf(","+text, 0, Qt::CaseInsensitive)>0)) {
-                QStringList varsList = blockData->varsChainJS.split(",");
+            if (blockData != nullptr && blockData->scope->varsChainJS.size()>0 && (blockData->scope->varsChainJS.indexOf(text, 0, Qt::CaseInsensitive)==0 || blockData->scope->varsChainJS.indexOf(","+text, 0, Qt::CaseInsensitive)>0)) {
+                QStringList varsList = blockData->scope->varsChainJS.split(",");
                 for (QString k : varsList) {
                     if (k == text) continue; // need this
                     if (k.indexOf(text, 0, Qt::CaseInsensitive)==0) {
@@ -3495,8 +3791,8 @@ void Editor::detectCompleteTextJS(QString text, int cursorTextPos, QChar cursorT
         }
         // parsed functions
         if (completePopup->count() < completePopup->limit()) {
-            for (int i=0; i<parseResultJS.functions.size(); i++){
-                ParseJS::ParseResultFunction func = parseResultJS.functions.at(i);
+            for (int i=0; i<parseResultJS->functions.size(); i++){
+                const ParseJS::ParseResultFunction & func = parseResultJS->functions.at(i);
                 if (func.clsName.size() == 0) continue;
                 QString k = func.name;
                 QString p = "( " + func.args + " )";
@@ -3510,8 +3806,8 @@ void Editor::detectCompleteTextJS(QString text, int cursorTextPos, QChar cursorT
         std::unordered_map<std::string, std::string> vars;
         std::unordered_map<std::string, std::string>::iterator varsIterator;
         if (completePopup->count() < completePopup->limit()) {
-            for (int i=0; i<parseResultJS.variables.size(); i++){
-                ParseJS::ParseResultVariable _variable = parseResultJS.variables.at(i);
+            for (int i=0; i<parseResultJS->variables.size(); i++){
+                const ParseJS::ParseResultVariable & _variable = parseResultJS->variables.at(i);
                 if (_variable.clsName.size() == 0) continue;
                 QString k = _variable.name;
                 if (k.indexOf(text, 0, Qt::CaseInsensitive)==0) {
@@ -3696,8 +3992,8 @@ void Editor::detectCompleteTextPHPGlobalContext(QString text, int cursorTextPos,
             } else if (prevWord.toLower() == "parent" && clsName.size() > 0) {
                 QString ns = "";
                 if (nsName.size() > 0) ns = nsName + "\\";
-                for (int i=0; i<parseResultPHP.classes.size(); i++) {
-                    ParsePHP::ParseResultClass _cls = parseResultPHP.classes.at(i);
+                for (int i=0; i<parseResultPHP->classes.size(); i++) {
+                    const ParsePHP::ParseResultClass & _cls = parseResultPHP->classes.at(i);
                     if (_cls.name == "\\"+ns+clsName) {
                         QString parentClass = _cls.parent;
                         if (parentClass.size() > 0 && parentClass.at(0) == "\\") parentClass = parentClass.mid(1);
@@ -3766,8 +4062,8 @@ void Editor::detectCompleteTextPHPGlobalContext(QString text, int cursorTextPos,
             QString _clsName = clsName.size() > 0 ? ns + clsName : "";
             QString _funcName = funcName;
             if (_clsName.size() == 0 && _funcName.size() > 0) _funcName = ns + _funcName;
-            for (int i=parseResultPHP.variables.size()-1; i>=0; i--) {
-                ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+            for (int i=parseResultPHP->variables.size()-1; i>=0; i--) {
+                const ParsePHP::ParseResultVariable & _variable = parseResultPHP->variables.at(i);
                 QString k = _variable.name;
                 if (_variable.clsName != _clsName || _variable.funcName != _funcName) continue;
                 //if (k == text) continue;
@@ -3785,8 +4081,8 @@ void Editor::detectCompleteTextPHPGlobalContext(QString text, int cursorTextPos,
         // highlighted vars
         if (!isClass && completePopup->count() < completePopup->limit()) {
             HighlightData * blockData = dynamic_cast<HighlightData *>(curs.block().userData());
-            if (blockData != nullptr && blockData->varsChainPHP.size()>0 && (blockData->varsChainPHP.indexOf(text, 0, Qt::CaseInsensitive)==0 || blockData->varsChainPHP.indexOf(","+text, 0, Qt::CaseInsensitive)>0)) {
-                QStringList varsList = blockData->varsChainPHP.split(",");
+            if (blockData != nullptr && blockData->scope->varsChainPHP.size()>0 && (blockData->scope->varsChainPHP.indexOf(text, 0, Qt::CaseInsensitive)==0 || blockData->scope->varsChainPHP.indexOf(","+text, 0, Qt::CaseInsensitive)>0)) {
+                QStringList varsList = blockData->scope->varsChainPHP.split(",");
                 for (QString k : varsList) {
                     if (k == text) continue; // need this
                     if (k.indexOf(text, 0, Qt::CaseInsensitive)==0) {
@@ -3834,8 +4130,8 @@ void Editor::detectCompleteTextPHPGlobalContext(QString text, int cursorTextPos,
             if (prevWord.toLower() == "parent" && clsName.size() > 0) {
                 QString ns = "";
                 if (nsName.size() > 0) ns = nsName + "\\";
-                for (int i=0; i<parseResultPHP.classes.size(); i++) {
-                    ParsePHP::ParseResultClass _cls = parseResultPHP.classes.at(i);
+                for (int i=0; i<parseResultPHP->classes.size(); i++) {
+                    const ParsePHP::ParseResultClass & _cls = parseResultPHP->classes.at(i);
                     if (_cls.name == "\\"+ns+clsName) {
                         QString parentClass = _cls.parent;
                         if (parentClass.size() > 0 && parentClass.at(0) == "\\") parentClass = parentClass.mid(1);
@@ -3938,10 +4234,11 @@ void Editor::detectCompleteTextPHPObjectContext(QString text, int cursorTextPos,
                 if (_clsName.size() > 0) _clsName = ns + _clsName;
                 else if (_funcName.size() > 0) _funcName = ns + _funcName;
                 ParsePHP::ParseResultVariable variable;
-                for (int i=0; i<parseResultPHP.variables.size(); i++) {
-                    ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+                for (int i=0; i<parseResultPHP->variables.size(); i++) {
+                    const ParsePHP::ParseResultVariable & _variable = parseResultPHP->variables.at(i);
                     if (_variable.name == prevWord && _variable.clsName == _clsName && _variable.funcName == _funcName) {
                         variable = _variable;
+                        variable.type = getVariableTypePHP(i);
                         break;
                     }
                 }
@@ -3979,10 +4276,11 @@ void Editor::detectCompleteTextPHPObjectContext(QString text, int cursorTextPos,
             if (nsName.size() > 0) ns += nsName + "\\";
             QString _clsName = ns + clsName;
             ParsePHP::ParseResultVariable variable;
-            for (int i=0; i<parseResultPHP.variables.size(); i++) {
-                ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+            for (int i=0; i<parseResultPHP->variables.size(); i++) {
+                const ParsePHP::ParseResultVariable & _variable = parseResultPHP->variables.at(i);
                 if (_variable.name == prevWord && _variable.clsName == _clsName && _variable.funcName.size() == 0) {
                     variable = _variable;
+                    variable.type = getVariableTypePHP(i);
                     break;
                 }
             }
@@ -4024,10 +4322,11 @@ void Editor::detectCompleteTextPHPObjectContext(QString text, int cursorTextPos,
             if (nsName.size() > 0) ns += nsName + "\\";
             QString _clsName = ns + clsName;
             ParsePHP::ParseResultVariable variable;
-            for (int i=0; i<parseResultPHP.variables.size(); i++) {
-                ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+            for (int i=0; i<parseResultPHP->variables.size(); i++) {
+                const ParsePHP::ParseResultVariable & _variable = parseResultPHP->variables.at(i);
                 if (_variable.name == "$"+prevWord && _variable.clsName == _clsName && _variable.funcName.size() == 0) {
                     variable = _variable;
+                    variable.type = getVariableTypePHP(i);
                     break;
                 }
             }
@@ -4200,16 +4499,14 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
         }
         if (prevWord.toLower() == "return" || prevWord.toLower() == "else" || prevWord.toLower() == "echo") break;
         /*
-        HW->phpwordsIterator = HW->phpwords.find(prevWord.toLower().toStdString());
-        if (HW->phpwordsIterator != HW->phpwords.end()) break;
+        if (HW->phpwords.contains(prevWord)) break;
         */
         if (prevChar == ")") {
             detectParsOpenAtCursor(curs);
             prevWord = findPrevWordNonSpaceAtCursor(curs, MODE_PHP);
             if (prevWord.toLower() == "if" || prevWord.toLower() == "echo") break;
             /*
-            HW->phpwordsIterator = HW->phpwords.find(prevWord.toLower().toStdString());
-            if (HW->phpwordsIterator != HW->phpwords.end()) break;
+            if (HW->phpwords.contains(prevWord)) break;
             */
             if (prevWord.size() > 0) {
                 keyW = prevWord;
@@ -4247,9 +4544,10 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
             QString _clsName = clsName, _funcName = funcName;
             if (clsName.size() > 0) _clsName = ns + clsName;
             else if (funcName.size() > 0) _funcName = ns + funcName;
-            for (int i=0; i<parseResultPHP.variables.size(); i++) {
-                ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+            for (int i=0; i<parseResultPHP->variables.size(); i++) {
+                ParsePHP::ParseResultVariable _variable = parseResultPHP->variables.at(i);
                 if (_variable.name == keyW && _variable.clsName == _clsName && _variable.funcName == _funcName) {
+                    _variable.type = getVariableTypePHP(i);
                     // detect variable type
                     if (_variable.type.size() == 0 && _variable.line > 0 && _variable.line-1 < cursorTextBlockNumber) {
                         QTextCursor _curs = textCursor();
@@ -4281,7 +4579,8 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
                         }
                         if (_varType.size() == 0) _varType = "mixed";
                         _variable.type = "\\"+_varType;
-                        parseResultPHP.variables.replace(i, _variable);
+                        // parse result is shared, detected types are kept aside
+                        detectedVariableTypesPHP.insert(i, _variable.type);
                     }
                     prevType = _variable.type;
                     break;
@@ -4295,8 +4594,8 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
                 QString _clsName = clsName, _funcName = funcName;
                 if (clsName.size() > 0) _clsName = ns + clsName;
                 else if (funcName.size() > 0) _funcName = ns + funcName;
-                for (int i=0; i<parseResultPHP.functions.size(); i++) {
-                    ParsePHP::ParseResultFunction _func = parseResultPHP.functions.at(i);
+                for (int i=0; i<parseResultPHP->functions.size(); i++) {
+                    const ParsePHP::ParseResultFunction & _func = parseResultPHP->functions.at(i);
                     if (_func.name == _funcName && _func.clsName == _clsName && _func.line > 0 && _func.line-1 != cursorTextBlockNumber) {
                         QTextCursor _curs = textCursor();
                         _curs.movePosition(QTextCursor::Start);
@@ -4322,10 +4621,10 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
                     }
                 }
                 if (varName.size() > 0) {
-                    for (int i=0; i<parseResultPHP.variables.size(); i++) {
-                        ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+                    for (int i=0; i<parseResultPHP->variables.size(); i++) {
+                        const ParsePHP::ParseResultVariable & _variable = parseResultPHP->variables.at(i);
                         if (_variable.name == varName && _variable.clsName.size() == 0 && _variable.funcName.size() == 0) {
-                            prevType = _variable.type;
+                            prevType = getVariableTypePHP(i);
                             break;
                         }
                     }
@@ -4353,8 +4652,8 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
         if (clsName != "anonymous class") {
             QString ns = "";
             if (nsName.size() > 0) ns = nsName + "\\";
-            for (int i=0; i<parseResultPHP.classes.size(); i++) {
-                ParsePHP::ParseResultClass _cls = parseResultPHP.classes.at(i);
+            for (int i=0; i<parseResultPHP->classes.size(); i++) {
+                const ParsePHP::ParseResultClass & _cls = parseResultPHP->classes.at(i);
                 if (_cls.name == "\\"+ns+clsName) {
                     QString parentClass = _cls.parent;
                     if (parentClass.size() > 0 && parentClass.at(0) == "\\") parentClass = parentClass.mid(1);
@@ -4413,10 +4712,10 @@ QString Editor::detectCompleteTypeAtCursorPHP(QTextCursor & curs, QString nsName
                 // search variable type
                 if (nextWord[0] != "$") nextWord = "$" + nextWord;
                 QString _clsName = "\\" + prevType;
-                for (int i=0; i<parseResultPHP.variables.size(); i++) {
-                    ParsePHP::ParseResultVariable _variable = parseResultPHP.variables.at(i);
+                for (int i=0; i<parseResultPHP->variables.size(); i++) {
+                    const ParsePHP::ParseResultVariable & _variable = parseResultPHP->variables.at(i);
                     if (_variable.name == nextWord && _variable.clsName == _clsName && _variable.funcName.size() == 0) {
-                        prevType = _variable.type;
+                        prevType = getVariableTypePHP(i);
                         break;
                     }
                 }
@@ -4661,8 +4960,8 @@ void Editor::completePopupSelected(QString text, QString data)
                     // find imports
                     ParsePHP::ParseResultNamespace ns;
                     ParsePHP::ParseResultImport imp;
-                    for (int i=0; i<parseResultPHP.namespaces.size(); i++) {
-                        ParsePHP::ParseResultNamespace _ns = parseResultPHP.namespaces.at(i);
+                    for (int i=0; i<parseResultPHP->namespaces.size(); i++) {
+                        const ParsePHP::ParseResultNamespace & _ns = parseResultPHP->namespaces.at(i);
                         if (_ns.name == nsName) {
                             ns = _ns;
                             line = _ns.line;
@@ -4670,8 +4969,8 @@ void Editor::completePopupSelected(QString text, QString data)
                         }
                     }
                     for (int c=0; c<ns.importsIndexes.size(); c++) {
-                        if (parseResultPHP.imports.size() <= ns.importsIndexes.at(c)) break;
-                        ParsePHP::ParseResultImport _imp = parseResultPHP.imports.at(ns.importsIndexes.at(c));
+                        if (parseResultPHP->imports.size() <= ns.importsIndexes.at(c)) break;
+                        const ParsePHP::ParseResultImport & _imp = parseResultPHP->imports.at(ns.importsIndexes.at(c));
                         line = _imp.line;
                         if (_imp.type == IMPORT_TYPE_CLASS && _imp.name == clsName) {
                             imp = _imp;
@@ -4818,6 +5117,74 @@ void Editor::parseResultChanged()
     }
 }
 
+void Editor::recordParseEdit(int position, int charsRemoved, int charsAdded)
+{
+    // formats changes are reported without a new document revision
+    if (document()->revision() == parseDocumentRevision) return;
+    parseDocumentRevision = document()->revision();
+    parseRevision++;
+    if (parseBaseRevision < 0) return;
+    // whole document changes may include the last paragraph separator
+    if (position + charsAdded > document()->characterCount() - 1 || parseEdits.size() >= PARSE_EDITS_LIMIT) {
+        parseBaseRevision = -1;
+        parseEdits.clear();
+        return;
+    }
+    QString added = "";
+    if (charsAdded > 0) {
+        QTextCursor curs = QTextCursor(document());
+        curs.setPosition(position);
+        curs.setPosition(position + charsAdded, QTextCursor::KeepAnchor);
+        added = curs.selectedText();
+        // same replacements as in toPlainText
+        QChar * data = added.data();
+        for (int i=0; i<added.size(); i++) {
+            ushort c = data[i].unicode();
+            if (c == QChar::ParagraphSeparator || c == QChar::LineSeparator || c == 0xfdd0 || c == 0xfdd1) {
+                data[i] = QChar::LineFeed;
+            } else if (c == QChar::Nbsp) {
+                data[i] = QChar::Space;
+            }
+        }
+    }
+    Parse::TextEdit edit = {position, charsRemoved, added};
+    parseEdits.append(edit);
+}
+
+Parse::TextEdits Editor::takeParseEdits()
+{
+    Parse::TextEdits edits;
+    edits.documentId = parseDocumentId;
+    edits.revision = parseRevision;
+    // edits positions are valid only for LF line endings
+    if (parseBaseRevision < 0 || newLineMode != LF) {
+        QString content = getContent();
+        Parse::TextEdit edit = {0, -1, content};
+        edits.baseRevision = -1;
+        edits.size = content.size();
+        edits.edits.append(edit);
+    } else {
+        edits.baseRevision = parseBaseRevision;
+        edits.size = document()->characterCount() - 1;
+        edits.edits = parseEdits;
+    }
+    parseEdits.clear();
+    parseBaseRevision = newLineMode == LF ? parseRevision : -1;
+    return edits;
+}
+
+int Editor::getParseDocumentId()
+{
+    return parseDocumentId;
+}
+
+void Editor::resetParseEdits()
+{
+    parseBaseRevision = -1;
+    parseEdits.clear();
+    parseResultChanged();
+}
+
 void Editor::parseResultPHPChanged(bool async)
 {
     if (!parsePHPEnabled) return;
@@ -4826,25 +5193,26 @@ void Editor::parseResultPHPChanged(bool async)
     int pos = curs.positionInBlock();
     std::string mode = highlight->findModeAtCursor(& block, pos);
     if (mode != MODE_PHP) return;
-    QString content = getContent();
-    if (!async) parseResultPHP = parserPHP.parse(content);
-    else emit parsePHP(getTabIndex(), content);
+    if (!async) {
+        parseResultPHP = parserPHP.parse(getContent());
+        detectedVariableTypesPHP.clear();
+    } else {
+        emit parsePHP(getTabIndex(), takeParseEdits());
+    }
 }
 
 void Editor::parseResultJSChanged(bool async)
 {
     if (!parseJSEnabled) return;
-    QString content = getContent();
-    if (!async) parseResultJS = parserJS.parse(content);
-    else emit parseJS(getTabIndex(), content);
+    if (!async) parseResultJS = parserJS.parse(getContent());
+    else emit parseJS(getTabIndex(), takeParseEdits());
 }
 
 void Editor::parseResultCSSChanged(bool async)
 {
     if (!parseCSSEnabled) return;
-    QString content = getContent();
-    if (!async) parseResultCSS = parserCSS.parse(content);
-    else emit parseCSS(getTabIndex(), content);
+    if (!async) parseResultCSS = parserCSS.parse(getContent());
+    else emit parseCSS(getTabIndex(), takeParseEdits());
 }
 
 void Editor::tooltip(int offset)
@@ -4899,8 +5267,8 @@ void Editor::tooltip(int offset)
             } else if (prevText.toLower() == "parent" && clsName.size() > 0) {
                 QString ns = "";
                 if (nsName.size() > 0) ns = nsName + "\\";
-                for (int i=0; i<parseResultPHP.classes.size(); i++) {
-                    ParsePHP::ParseResultClass _cls = parseResultPHP.classes.at(i);
+                for (int i=0; i<parseResultPHP->classes.size(); i++) {
+                    const ParsePHP::ParseResultClass & _cls = parseResultPHP->classes.at(i);
                     if (_cls.name == "\\"+ns+clsName) {
                         QString parentClass = _cls.parent;
                         if (parentClass.size() > 0 && parentClass.at(0) == "\\") parentClass = parentClass.mid(1);
@@ -6952,66 +7320,49 @@ QString Editor::getContent()
     return text;
 }
 
-void Editor::highlightUnusedVars(bool update)
+void Editor::highlightUnusedVars()
 {
     if (!experimentalMode) return;
     if (isBigFile || highlight->getFoundModes().contains(QString::fromStdString(MODE_HTML))) return;
+    // only scopes with changed variables are checked again
+    QStringList changedKeys = highlight->updateKnownVars();
+    if (changedKeys.size() == 0) return;
     setReadOnly(true);
-    QVector<QTextBlock> unusedVarsBlocks;
-    highlight->unusedVars.clear();
-    // update highlighter
-    if (update) {
-        highlight->setHighlightVarsMode(true);
-        highlight->rehighlight();
-        highlight->setHighlightVarsMode(false);
-    }
-    QStringList knownFunctions = highlight->getKnownFunctions();
-    // function vars
-    for (int i=0; i<knownFunctions.size(); i++) {
-        QString funcKey = knownFunctions.at(i);
-        QString clsName = "", funcName = "";
-        if (funcKey.indexOf("::") >= 0) {
-            clsName = funcKey.mid(0, funcKey.indexOf("::"));
-            funcName = funcKey.mid(funcKey.indexOf("::")+2);
-        } else {
-            funcName = funcKey;
+    QVector<QTextBlock> updateBlocks;
+    for (int i=0; i<changedKeys.size(); i++) {
+        QString prefix = changedKeys.at(i) + "::";
+        for (unusedVarsBlocksIterator = unusedVarsBlocks.begin(); unusedVarsBlocksIterator != unusedVarsBlocks.end();) {
+            if (QString::fromStdString(unusedVarsBlocksIterator->first).indexOf(prefix) == 0) {
+                highlight->unusedVars.erase(unusedVarsBlocksIterator->first);
+                if (unusedVarsBlocksIterator->second.isValid()) updateBlocks.append(unusedVarsBlocksIterator->second);
+                unusedVarsBlocksIterator = unusedVarsBlocks.erase(unusedVarsBlocksIterator);
+            } else {
+                unusedVarsBlocksIterator++;
+            }
         }
-        if (funcName.size() == 0) continue;
+    }
+    for (int i=0; i<changedKeys.size(); i++) {
+        QString funcKey = changedKeys.at(i);
+        QString clsName = funcKey.mid(0, funcKey.indexOf("::"));
+        QString funcName = funcKey.mid(funcKey.indexOf("::")+2);
+        // class properties are not checked, empty key is used for global vars
+        if (funcName.size() == 0 && clsName.size() > 0) continue;
         QStringList vars = highlight->getKnownVars(clsName, funcName);
         QStringList used = highlight->getUsedVars(clsName, funcName);
         QString usedChain = used.join(",") + ",";
-        for (int i=0; i<vars.size(); i++) {
-            QString varName =vars.at(i);
+        for (int v=0; v<vars.size(); v++) {
+            QString varName =vars.at(v);
             if (usedChain.indexOf(varName + ",") < 0) {
                 int pos = highlight->getKnownVarPosition(clsName, funcName, varName);
                 int blockNumber = highlight->getKnownVarBlockNumber(clsName, funcName, varName);
                 if (pos >= 0 && blockNumber >= 0) {
-                    QTextCursor curs = textCursor();
-                    curs.movePosition(QTextCursor::Start);
-                    if (blockNumber > 0) curs.movePosition(QTextCursor::NextBlock, QTextCursor::MoveAnchor, blockNumber);
-                    QString k = clsName + "::" + funcName + "::" + varName;
-                    highlight->unusedVars[k.toStdString()] = pos;
-                    unusedVarsBlocks.append(curs.block());
-                }
-            }
-        }
-    }
-    // global vars
-    QStringList vars = highlight->getKnownVars("", "");
-    QStringList used = highlight->getUsedVars("", "");
-    QString usedChain = used.join(",") + ",";
-    for (int i=0; i<vars.size(); i++) {
-        QString varName =vars.at(i);
-        if (usedChain.indexOf(varName + ",") < 0) {
-            int pos = highlight->getKnownVarPosition("", "", varName);
-            int blockNumber = highlight->getKnownVarBlockNumber("", "", varName);
-            if (pos >= 0 && blockNumber >= 0) {
-                QTextCursor curs = textCursor();
-                curs.movePosition(QTextCursor::Start);
-                if (blockNumber > 0) curs.movePosition(QTextCursor::NextBlock, QTextCursor::MoveAnchor, blockNumber);
-                QString k = "::::" + varName;
-                highlight->unusedVars[k.toStdString()] = pos;
-                unusedVarsBlocks.append(curs.block());
+                    QTextBlock block = document()->findBlockByNumber(blockNumber);
+                    if (!block.isValid()) continue;
+                    std::string k = (funcKey + "::" + varName).toStdString();
+                    highlight->unusedVars[k] = pos;
+                    unusedVarsBlocks[k] = block;
+                    updateBlocks.append(block);
+                }
             }
         }
     }
@@ -7019,8 +7370,9 @@ void Editor::highlightUnusedVars(bool update)
     blockSignals(true);
     std::unordered_map<int, int> highlightedBlocks;
     std::unordered_map<int, int>::iterator highlightedBlocksIterator;
-    for (int i=0; i<unusedVarsBlocks.size(); i++) {
-        QTextBlock block = unusedVarsBlocks.at(i);
+    for (int i=0; i<updateBlocks.size(); i++) {
+        QTextBlock block = updateBlocks.at(i);
+        if (!block.isValid()) continue;
         highlightedBlocksIterator = highlightedBlocks.find(block.blockNumber());
         if (highlightedBlocksIterator != highlightedBlocks.end()) continue;
         highlight->rehighlightBlock(block);
@@ -7083,7 +7435,7 @@ void Editor::save(QString name)
     emit statusBarText(tabIndex, tr("Saved"));
     if (nameChanged) emit filenameChanged(tabIndex, fileName);
     emit saved(tabIndex);
-    if (highlight->getModeType() == MODE_MIXED) highlightUnusedVars(true);
+    if (highlight->getModeType() == MODE_MIXED) highlightUnusedVars();
 }
 
 void Editor::switchOverwrite()
@@ -7272,15 +7624,15 @@ void Editor::showDeclarationRequested()
                     QString _clsName = clsName, _funcName = funcName;
                     if (clsName.size() > 0) _clsName = ns + clsName;
                     else if (funcName.size() > 0) _funcName = ns + funcName;
-                    for (int i=0; i<parseResultPHP.functions.size(); i++) {
-                        ParsePHP::ParseResultFunction _func = parseResultPHP.functions.at(i);
+                    for (int i=0; i<parseResultPHP->functions.size(); i++) {
+                        const ParsePHP::ParseResultFunction & _func = parseResultPHP->functions.at(i);
                         if (_func.name == ns+name && _func.clsName == _clsName && _func.line > 0 && _func.line-1 != block.blockNumber()) {
                             goLine = _func.line;
                         }
                     }
                     if (goLine == 0) {
-                        for (int i=0; i<parseResultPHP.classes.size(); i++) {
-                            ParsePHP::ParseResultClass _cls = parseResultPHP.classes.at(i);
+                        for (int i=0; i<parseResultPHP->classes.size(); i++) {
+                            const ParsePHP::ParseResultClass & _cls = parseResultPHP->classes.at(i);
                             if (_cls.name == ns+name && _cls.line > 0 && _cls.line-1 != block.blockNumber()) {
                                 goLine = _cls.line;
                             }
@@ -7291,12 +7643,12 @@ void Editor::showDeclarationRequested()
                     }
                 } else {
                     QStringList nameList = name.split("::");
-                    for (int i=0; i<parseResultPHP.classes.size(); i++) {
-                        ParsePHP::ParseResultClass _cls = parseResultPHP.classes.at(i);
+                    for (int i=0; i<parseResultPHP->classes.size(); i++) {
+                        const ParsePHP::ParseResultClass & _cls = parseResultPHP->classes.at(i);
                         if (_cls.name == "\\"+nameList.at(0) && _cls.line > 0 && _cls.line-1 != block.blockNumber()) {
                             for (int y=0; y<_cls.functionIndexes.size(); y++) {
-                                if (_cls.functionIndexes.at(y) >= parseResultPHP.functions.size()) break;
-                                ParsePHP::ParseResultFunction _func = parseResultPHP.functions.at(_cls.functionIndexes.at(y));
+                                if (_cls.functionIndexes.at(y) >= parseResultPHP->functions.size()) break;
+                                const ParsePHP::ParseResultFunction & _func = parseResultPHP->functions.at(_cls.functionIndexes.at(y));
                                 if (_func.name == nameList.at(1) && _func.line > 0 && _func.line-1 != block.blockNumber()) {
                                     goLine = _func.line;
                                 }
@@ -7310,8 +7662,8 @@ void Editor::showDeclarationRequested()
             curs.movePosition(QTextCursor::StartOfBlock);
             curs.movePosition(QTextCursor::NextCharacter, QTextCursor::MoveAnchor, cursorTextPos);
             QChar prevChar = findPrevCharNonSpaceAtCursos(curs);
-            for (int i=0; i<parseResultJS.functions.size(); i++) {
-                ParseJS::ParseResultFunction _func = parseResultJS.functions.at(i);
+            for (int i=0; i<parseResultJS->functions.size(); i++) {
+                const ParseJS::ParseResultFunction & _func = parseResultJS->functions.at(i);
                 if (prevChar == "." && _func.clsName.size() == 0) continue;
                 if (_func.name == name && _func.line > 0 && _func.line-1 != block.blockNumber()) {
                     goLine = _func.line;
@@ -7518,6 +7870,7 @@ void Editor::reloadRequested()
     QString _extension = extension;
     reset();
     highlight->resetMode();
+    unusedVarsBlocks.clear();
     setFileName(_fileName);
     convertNewLines(txt);
     setPlainText(txt);
@@ -7557,6 +7910,8 @@ void Editor::scrollToMiddle(QTextCursor cursor, int line)
             verticalScrollBar()->setValue(newV);
         }
     }
+    // jumping far ahead needs the state of all blocks above
+    highlight->updateBlocks(getLastVisibleBlockIndex());
 }
 
 void Editor::searchInFilesRequested()
@@ -50,6 +50,17 @@ Editor * EditorTabs::getTabEditor(int index)
     return editorTab->getEditor();
 }
 
+Editor * EditorTabs::findTabEditor(QString filepath)
+{
+    for (int i=0; i<tabWidget->count(); i++){
+        Editor * textEditor = getTabEditor(i);
+        if (textEditor != nullptr && textEditor->getFileName() == filepath) {
+            return textEditor;
+        }
+    }
+    return nullptr;
+}
+
 QString EditorTabs::getTabNameFromPath(QString filepath)
 {
     QString tabName = filepath;
@@ -95,9 +106,9 @@ void EditorTabs::createTab(QString filepath, bool initHighlight)
     connect(editor, SIGNAL(ready(int)), this, SLOT(ready(int)));
     connect(editor, SIGNAL(showDeclaration(int,QString)), this, SLOT(showDeclaration(int,QString)));
     connect(editor, SIGNAL(showHelp(int,QString)), this, SLOT(showHelp(int,QString)));
-    connect(editor, SIGNAL(parsePHP(int,QString)), this, SLOT(parsePHP(int,QString)));
-    connect(editor, SIGNAL(parseJS(int,QString)), this, SLOT(parseJS(int,QString)));
-    connect(editor, SIGNAL(parseCSS(int,QString)), this, SLOT(parseCSS(int,QString)));
+    connect(editor, SIGNAL(parsePHP(int,Parse::TextEdits)), this, SLOT(parsePHP(int,Parse::TextEdits)));
+    connect(editor, SIGNAL(parseJS(int,Parse::TextEdits)), this, SLOT(parseJS(int,Parse::TextEdits)));
+    connect(editor, SIGNAL(parseCSS(int,Parse::TextEdits)), this, SLOT(parseCSS(int,Parse::TextEdits)));
     connect(editor, SIGNAL(undoRedoChanged(int)), this, SLOT(undoRedoChanged(int)));
     connect(editor, SIGNAL(backForwardChanged(int)), this, SLOT(backForwardChanged(int)));
     connect(editor, SIGNAL(searchInFiles(QString)), this, SLOT(searchInFiles(QString)));
@@ -399,6 +410,16 @@ void EditorTabs::initHighlighters()
     }
 }
 
+void EditorTabs::remapHighlightFormats()
+{
+    for (int i=0; i<tabWidget->count(); i++) {
+        Editor * tabEditor = getTabEditor(i);
+        if (tabEditor != nullptr) {
+            tabEditor->remapHighlightFormats();
+        }
+    }
+}
+
 void EditorTabs::showDeclaration(int index, QString name)
 {
     if (editor == nullptr || editor->getTabIndex() != index) return;
@@ -528,22 +549,22 @@ void EditorTabs::ready(int index)
     emit editorReady(index);
 }
 
-void EditorTabs::parsePHP(int index, QString text)
+void EditorTabs::parsePHP(int index, Parse::TextEdits edits)
 {
     if (editor == nullptr || editor->getTabIndex() != index || !editor->isReady()) return;
-    emit editorParsePHPRequested(index, text);
+    emit editorParsePHPRequested(index, edits);
 }
 
-void EditorTabs::parseJS(int index, QString text)
+void EditorTabs::parseJS(int index, Parse::TextEdits edits)
 {
     if (editor == nullptr || editor->getTabIndex() != index || !editor->isReady()) return;
-    emit editorParseJSRequested(index, text);
+    emit editorParseJSRequested(index, edits);
 }
 
-void EditorTabs::parseCSS(int index, QString text)
+void EditorTabs::parseCSS(int index, Parse::TextEdits edits)
 {
     if (editor == nullptr || editor->getTabIndex() != index || !editor->isReady()) return;
-    emit editorParseCSSRequested(index, text);
+    emit editorParseCSSRequested(index, edits);
 }
 
 void EditorTabs::undoRedoChanged(int index)
@@ -24,6 +24,7 @@
 #include <QInputDialog>
 #include <QScreen>
 #include <QPropertyAnimation>
+#include <QtEndian>
 #include "mainwindow.h"
 #include "fileiconprovider.h"
 #include "filedialog.h"
@@ -38,6 +39,13 @@ const QString APPLICATION_NAME = "Zira Editor";
 const QString APPLICATION_VERSION = "2.1.1";
 const QString ORGANIZATION_NAME = "Zira";
 const QString PROJECT_NAME = "Zira project";
+
+// xxHash64 primes
+const quint64 HASH_PRIME_1 = 11400714785074694791ULL;
+const quint64 HASH_PRIME_2 = 14029467366897019727ULL;
+const quint64 HASH_PRIME_3 = 1609587929392839161ULL;
+const quint64 HASH_PRIME_4 = 9650029242287828579ULL;
+const quint64 HASH_PRIME_5 = 2870177450012600261ULL;
 const QString AUTHOR_EMAIL_USERNAME = "ziracms";
 const QString AUTHOR_EMAIL_DOMAIN = "gmail.com";
 const QString AUTHOR_CARD_URL = "https://yoomoney.ru/to";
@@ -79,7 +87,11 @@ QString Helper::loadTextFile(QString path, std::string encoding, std::string fal
     if (!inputFile.open(QIODevice::ReadOnly | QIODevice::Text)) return "";
     QByteArray byteArray = inputFile.readAll();
     inputFile.close();
+    return decodeTextData(byteArray, encoding, fallbackEncoding, silent);
+}
 
+QString Helper::decodeTextData(const QByteArray & byteArray, std::string encoding, std::string fallbackEncoding, bool silent)
+{
     QTextCodec::ConverterState state;
     QTextCodec *codec = QTextCodec::codecForName(encoding.c_str());
     QString txt = codec->toUnicode(byteArray.constData(), byteArray.size(), &state);
@@ -94,6 +106,67 @@ QString Helper::loadTextFile(QString path, std::string encoding, std::string fal
     return txt;
 }
 
+// 64-bit xxHash (XXH64) with zero seed
+quint64 Helper::hashData(const QByteArray & data)
+{
+    auto rotl = [](quint64 x, int r) -> quint64 {
+        return (x << r) | (x >> (64 - r));
+    };
+    auto round = [&rotl](quint64 acc, quint64 input) -> quint64 {
+        acc += input * HASH_PRIME_2;
+        acc = rotl(acc, 31);
+        return acc * HASH_PRIME_1;
+    };
+    auto mergeRound = [&round](quint64 acc, quint64 val) -> quint64 {
+        acc ^= round(0, val);
+        return acc * HASH_PRIME_1 + HASH_PRIME_4;
+    };
+    const uchar * p = reinterpret_cast<const uchar *>(data.constData());
+    const uchar * end = p + data.size();
+    quint64 h;
+    if (data.size() >= 32) {
+        quint64 v1 = HASH_PRIME_1 + HASH_PRIME_2;
+        quint64 v2 = HASH_PRIME_2;
+        quint64 v3 = 0;
+        quint64 v4 = 0 - HASH_PRIME_1;
+        const uchar * limit = end - 32;
+        do {
+            v1 = round(v1, qFromLittleEndian<quint64>(p));
+            v2 = round(v2, qFromLittleEndian<quint64>(p + 8));
+            v3 = round(v3, qFromLittleEndian<quint64>(p + 16));
+            v4 = round(v4, qFromLittleEndian<quint64>(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = HASH_PRIME_5;
+    }
+    h += static_cast<quint64>(data.size());
+    for (; p + 8 <= end; p += 8) {
+        h ^= round(0, qFromLittleEndian<quint64>(p));
+        h = rotl(h, 27) * HASH_PRIME_1 + HASH_PRIME_4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<quint64>(qFromLittleEndian<quint32>(p)) * HASH_PRIME_1;
+        h = rotl(h, 23) * HASH_PRIME_2 + HASH_PRIME_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= static_cast<quint64>(*p) * HASH_PRIME_5;
+        h = rotl(h, 11) * HASH_PRIME_1;
+    }
+    h ^= h >> 33;
+    h *= HASH_PRIME_2;
+    h ^= h >> 29;
+    h *= HASH_PRIME_3;
+    h ^= h >> 32;
+    return h;
+}
+
 bool Helper::saveTextFile(QString path, const QString & text, std::string encoding)
 {
     QFile outputFile(path);
@@ -221,67 +294,6 @@ QString Helper::doubleToStr(double n)
     return QString::fromStdString(ss.str());
 }
 
-QString Helper::stripScopedText(QString scopedText)
-{
-    // parenthesis
-    int pars = 0, parsStart = -1;
-    int p = scopedText.indexOf("(");
-    if (p >= 0) {
-        pars++;
-        parsStart = p;
-    }
-    while(p >= 0) {
-        int pO = scopedText.indexOf("(", p+1);
-        int pC = scopedText.indexOf(")", p+1);
-        int pM = -1;
-        if (pO >= 0 && pC >= 0) pM = std::min(pO, pC);
-        else if (pO >= 0 && pC < 0) pM = pO;
-        else if (pO < 0 && pC >= 0) pM = pC;
-        if (pM >= 0) {
-            if (pM == pO) {
-                if (pars == 0) parsStart = pM;
-                pars++;
-            }
-            if (pM == pC) pars--;
-            int start = parsStart + 1;
-            int len = pM-parsStart-1;
-            if (pars == 0 && len > 0) {
-                scopedText.replace(start, len, QString(" ").repeated(len));
-            }
-        }
-        p = pM;
-    }
-    // braces
-    int scope = 0, scopeStart = -1;
-    p = scopedText.indexOf("{");
-    if (p >= 0) {
-        scope++;
-        scopeStart = p;
-    }
-    while(p >= 0) {
-        int pO = scopedText.indexOf("{", p+1);
-        int pC = scopedText.indexOf("}", p+1);
-        int pM = -1;
-        if (pO >= 0 && pC >= 0) pM = std::min(pO, pC);
-        else if (pO >= 0 && pC < 0) pM = pO;
-        else if (pO < 0 && pC >= 0) pM = pC;
-        if (pM >= 0) {
-            if (pM == pO) {
-                if (scope == 0) scopeStart = pM;
-                scope++;
-            }
-            if (pM == pC) scope--;
-            int start = scopeStart + 1;
-            int len = pM-scopeStart-1;
-            if (scope == 0 && len > 0) {
-                scopedText.replace(start, len, QString(" ").repeated(len));
-            }
-        }
-        p = pM;
-    }
-    return scopedText.replace(QRegularExpression("[\\s]+"), " ");
-}
-
 void Helper::log(int n)
 {
     QString str = intToStr(n);
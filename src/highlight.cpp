@@ -9,8 +9,17 @@
 #include <QTextStream>
 #include <QTextCursor>
 #include <QTextBlock>
+#include <QElapsedTimer>
+#include <QSet>
+#include <QtAlgorithms>
+#include <cstring>
 #include "helper.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HIGHLIGHT_SSE2
+#endif
+
 const std::string MODE_PHP = "php";
 const std::string MODE_JS = "js";
 const std::string MODE_CSS = "css";
@@ -53,6 +62,140 @@ const QString CMAKE_LISTS_FILENAME = "CMakeLists";
 const QString ROBOTS_FILENAME = "robots";
 
 const int EXTRA_HIGHLIGHT_BLOCKS_COUNT = 100; // should be >= 1
+const int LONG_LINE_MIN_LENGTH = 10000;
+const int LONG_LINE_CHUNK_SIZE = 4096;
+const int LONG_LINE_MAX_CHUNK_SIZE = 16384;
+const int LAZY_HIGHLIGHT_CHECK_TIME_BLOCKS_COUNT = 10;
+
+const int MODE_ID_UNKNOWN = 0;
+const int MODE_ID_HTML = 1;
+const int MODE_ID_CSS = 2;
+const int MODE_ID_JS = 3;
+const int MODE_ID_PHP = 4;
+
+const unsigned char CHAR_CLASS_ALPHA = 1;
+const unsigned char CHAR_CLASS_DIGIT = 2;
+const unsigned char CHAR_CLASS_SPACE = 4;
+
+// same classes as isalpha(), isdigit() and QChar::isSpace() for ASCII
+constexpr unsigned char charClass(int c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_') ? CHAR_CLASS_ALPHA :
+           ((c >= '0' && c <= '9') ? CHAR_CLASS_DIGIT :
+           ((c == ' ' || (c >= 0x09 && c <= 0x0d)) ? CHAR_CLASS_SPACE : 0));
+}
+
+#define CHAR_CLASS_4(c) charClass(c), charClass(c+1), charClass(c+2), charClass(c+3)
+#define CHAR_CLASS_16(c) CHAR_CLASS_4(c), CHAR_CLASS_4(c+4), CHAR_CLASS_4(c+8), CHAR_CLASS_4(c+12)
+
+// generated at compile time
+constexpr unsigned char CHAR_CLASSES[128] = {
+    CHAR_CLASS_16(0), CHAR_CLASS_16(16), CHAR_CLASS_16(32), CHAR_CLASS_16(48),
+    CHAR_CLASS_16(64), CHAR_CLASS_16(80), CHAR_CLASS_16(96), CHAR_CLASS_16(112)
+};
+
+const int SKIP_INERT_CHARS_MIN_COUNT = 8;
+
+// Chars that can end a run of inert chars in a state, a run is highlighted
+// with the format of the state. Html text has no format of its own.
+struct InertCharsRun {
+    int modeId;
+    const char * stops;
+    int formatId;
+};
+
+// indexed by state
+constexpr InertCharsRun INERT_CHARS_RUNS[] = {
+    { MODE_ID_HTML, "<", FORMAT_NONE },                        // STATE_NONE
+    { MODE_ID_CSS, "*<", FORMAT_MULTI_LINE_COMMENT },          // STATE_COMMENT_ML_CSS
+    { MODE_ID_JS, "*<", FORMAT_MULTI_LINE_COMMENT },           // STATE_COMMENT_ML_JS
+    { MODE_ID_JS, "<", FORMAT_SINGLE_LINE_COMMENT },           // STATE_COMMENT_SL_JS
+    { MODE_ID_PHP, "*;(", FORMAT_MULTI_LINE_COMMENT },         // STATE_COMMENT_ML_PHP
+    { MODE_ID_PHP, "?;(", FORMAT_SINGLE_LINE_COMMENT },        // STATE_COMMENT_SL_PHP
+    { MODE_ID_HTML, "-<>", FORMAT_MULTI_LINE_COMMENT },        // STATE_COMMENT_ML_HTML
+    { MODE_ID_HTML, "'<>", FORMAT_STRING },                    // STATE_STRING_SQ_HTML
+    { MODE_ID_HTML, "\"<>", FORMAT_STRING },                   // STATE_STRING_DQ_HTML
+    { MODE_ID_JS, "'\\<", FORMAT_STRING },                     // STATE_STRING_SQ_JS
+    { MODE_ID_JS, "\"\\<", FORMAT_STRING },                    // STATE_STRING_DQ_JS
+    { MODE_ID_PHP, "'\\;(", FORMAT_STRING },                   // STATE_STRING_SQ_PHP
+    { MODE_ID_PHP, "\"\\;(${}", FORMAT_STRING },               // STATE_STRING_DQ_PHP
+    { MODE_ID_PHP, "\\;(${}", FORMAT_STRING },                 // STATE_STRING_HEREDOC
+    { MODE_ID_PHP, ";(", FORMAT_STRING },                      // STATE_STRING_NOWDOC
+    { MODE_ID_CSS, "'\\<", FORMAT_STRING },                    // STATE_STRING_SQ_CSS
+    { MODE_ID_CSS, "\"\\<", FORMAT_STRING },                   // STATE_STRING_DQ_CSS
+    { MODE_ID_HTML, nullptr, FORMAT_NONE },                    // STATE_TAG
+    { MODE_ID_JS, nullptr, FORMAT_NONE },                      // STATE_REGEXP_JS
+    { MODE_ID_JS, nullptr, FORMAT_NONE },                      // STATE_EXPRESSION_JS
+    { MODE_ID_PHP, nullptr, FORMAT_NONE },                     // STATE_EXPRESSION_PHP
+    { MODE_ID_UNKNOWN, "", FORMAT_SINGLE_LINE_COMMENT },       // STATE_COMMENT_SL_UNKNOWN
+    { MODE_ID_UNKNOWN, "*", FORMAT_MULTI_LINE_COMMENT },       // STATE_COMMENT_ML_UNKNOWN
+    { MODE_ID_UNKNOWN, "'\\", FORMAT_STRING },                 // STATE_STRING_SQ_UNKNOWN
+    { MODE_ID_UNKNOWN, "\"\\", FORMAT_STRING }                 // STATE_STRING_DQ_UNKNOWN
+};
+
+const int INERT_CHARS_RUNS_COUNT = sizeof(INERT_CHARS_RUNS) / sizeof(InertCharsRun);
+static_assert(INERT_CHARS_RUNS_COUNT == STATE_STRING_DQ_UNKNOWN + 1, "INERT_CHARS_RUNS should have a row for each state");
+
+// returns position of the first ASCII char from stops in [from, to) or "to"
+static int findStopChar(const ushort * data, int from, int to, const char * stops)
+{
+    int i = from;
+    #if defined(HIGHLIGHT_SSE2)
+    const int stopsCount = static_cast<int>(strlen(stops));
+    if (stopsCount == 0) return to;
+    if (stopsCount <= 8) {
+        __m128i stopVectors[8];
+        for (int s=0; s<stopsCount; s++) {
+            stopVectors[s] = _mm_set1_epi16(static_cast<short>(stops[s]));
+        }
+        for (; i + 8 <= to; i += 8) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+            __m128i found = _mm_cmpeq_epi16(chunk, stopVectors[0]);
+            for (int s=1; s<stopsCount; s++) {
+                found = _mm_or_si128(found, _mm_cmpeq_epi16(chunk, stopVectors[s]));
+            }
+            int mask = _mm_movemask_epi8(found);
+            if (mask != 0) return i + static_cast<int>(qCountTrailingZeroBits(static_cast<uint>(mask))) / 2;
+        }
+    }
+    #endif
+    for (; i < to; i++) {
+        ushort code = data[i];
+        if (code > 0 && code < 128 && strchr(stops, code) != nullptr) return i;
+    }
+    return to;
+}
+
+static int getModeId(const std::string & mode)
+{
+    if (mode == MODE_HTML) return MODE_ID_HTML;
+    if (mode == MODE_CSS) return MODE_ID_CSS;
+    if (mode == MODE_JS) return MODE_ID_JS;
+    if (mode == MODE_PHP) return MODE_ID_PHP;
+    return MODE_ID_UNKNOWN;
+}
+
+// starts a new word in the buffer of the previous one,
+// so that keywords are accumulated without allocations
+static inline void startWord(QString & word, const QChar & c)
+{
+    word.resize(1);
+    word.data()[0] = c;
+}
+
+// replaces the char of a one char string in place
+static inline void setChar(QString & str, const QChar & c)
+{
+    startWord(str, c);
+}
+
+// copies a word instead of sharing its data, so that
+// the source buffer can still be reused by startWord
+static inline void copyWord(QString & dst, const QString & src)
+{
+    dst.resize(src.size());
+    if (src.size() > 0) memcpy(dst.data(), src.constData(), src.size() * sizeof(QChar));
+}
 
 Highlight::Highlight(QTextDocument * parent) :
     doc(parent)
@@ -63,6 +206,9 @@ Highlight::Highlight(QTextDocument * parent) :
     else highlightTabs = false;
     if (highlightSpacesStr == "yes") highlightSpaces = true;
     else highlightSpaces = false;
+    std::string debugStatsStr = Settings::get("highlight_debug_stats");
+    if (debugStatsStr == "yes") debugStats = true;
+    else debugStats = false;
 
     // highlight modes by extension
     QString phpExtentionsStr = QString::fromStdString(Settings::get("highlight_php_extensions"));
@@ -99,10 +245,22 @@ Highlight::Highlight(QTextDocument * parent) :
     enabled = false;
     modeType = MODE_UNKNOWN;
     block_state = 0;
-    highlightVarsMode = false;
     firstRunMode = false;
     rehighlightBlockMode = false;
+    collectMode = false;
+    inertCharsSkipping = true;
+    longBlockChunkMode = false;
+    longBlockChunkPrevData = nullptr;
+    longLineFirstColumn = -1;
+    longLineLastColumn = -1;
     lastVisibleBlockNumber = -1;
+    lazyBlockNumber = -1;
+    lazyProgressPercent = 0;
+    highlightedBlocksCount = 0;
+    parsedCharsCount = 0;
+    parseNsecs = 0;
+    appliedFormatBlocksCount = 0;
+    skippedFormatBlocksCount = 0;
     dirty = false;
     isBigFile = false;
     extension = "";
@@ -112,37 +270,89 @@ Highlight::Highlight(QTextDocument * parent) :
     HW = &HighlightWords::instance();
 }
 
-void Highlight::setFormat(int start, int count, const QTextCharFormat &format)
+void Highlight::setFormat(int start, int count, int formatId)
 {
     if (start < 0 || start >= formatChanges.count()) return;
     const int end = qMin(start + count, formatChanges.count());
+    ushort * ids = formatChanges.data();
     for (int i = start; i < end; i++) {
-        formatChanges[i] = format;
+        ids[i] = static_cast<ushort>(formatId);
     }
 }
 
+const QTextCharFormat & Highlight::getFormat(int formatId) const
+{
+    if (formatId < FORMATS_COUNT) return HW->getFormat(formatId);
+    return extraFormats.at(formatId - FORMATS_COUNT);
+}
+
 QTextCharFormat Highlight::format(int pos) const
 {
     if (pos < 0 || pos >= formatChanges.count()) return QTextCharFormat();
-    return formatChanges.at(pos);
+    return getFormat(formatChanges.at(pos));
+}
+
+// registers a format that is not in the palette (underlines, css colors)
+int Highlight::addFormat(const QTextCharFormat & format)
+{
+    extraFormats.append(format);
+    return FORMATS_COUNT + extraFormats.size() - 1;
 }
 
 void Highlight::applyFormatChanges(bool markDirty)
 {
-    QTextLayout *layout = cBlock.layout();
     QVector<QTextLayout::FormatRange> ranges;
+    QVector<ushort> rangeIds;
+    appendFormatRanges(ranges, rangeIds, formatChanges, extraFormats, 0);
+    setFormatRanges(ranges, rangeIds, markDirty);
+}
+
+void Highlight::appendFormatRanges(QVector<QTextLayout::FormatRange> & ranges, QVector<ushort> & rangeIds, const QVector<ushort> & formatIds, const QVector<QTextCharFormat> & extra, int offset) const
+{
+    const ushort * ids = formatIds.constData();
+    const int count = formatIds.count();
     int i = 0;
-    while (i < formatChanges.count()) {
+    while (i < count) {
+        while (i < count && ids[i] == FORMAT_NONE) ++i;
+        if (i == count) break;
         QTextLayout::FormatRange r;
-        while (i < formatChanges.count() && formatChanges.at(i) == r.format) ++i;
-        if (i == formatChanges.count()) break;
-        r.start = i;
-        r.format = formatChanges.at(i);
-        while (i < formatChanges.count() && formatChanges.at(i) == r.format) ++i;
-        Q_ASSERT(i <= formatChanges.count());
-        r.length = i - r.start;
+        const ushort id = ids[i];
+        r.start = offset + i;
+        r.format = id < FORMATS_COUNT ? HW->getFormat(id) : extra.at(id - FORMATS_COUNT);
+        while (i < count && ids[i] == id) ++i;
+        r.length = offset + i - r.start;
         ranges << r;
+        rangeIds << id;
+    }
+}
+
+void Highlight::setFormatRanges(const QVector<QTextLayout::FormatRange> & ranges, const QVector<ushort> & rangeIds, bool markDirty)
+{
+    // palette ids are kept to remap the formats when colors change
+    if (blockData != nullptr) blockData->formatRangeIds = rangeIds;
+    if (collectMode) {
+        // formats are applied later to the original document
+        int blockNumber = cBlock.blockNumber();
+        if (collectedBlocks.size() <= blockNumber) collectedBlocks.resize(blockNumber + 1);
+        HighlightBlockResult & result = collectedBlocks[blockNumber];
+        result.rangeStarts.clear();
+        result.rangeLengths.clear();
+        result.extraFormats.clear();
+        result.rangeIds = rangeIds;
+        for (int i=0; i<ranges.size(); i++) {
+            result.rangeStarts.append(ranges.at(i).start);
+            result.rangeLengths.append(ranges.at(i).length);
+            if (rangeIds.at(i) >= FORMATS_COUNT) result.extraFormats.append(ranges.at(i).format);
+        }
+        return;
+    }
+    QTextLayout *layout = cBlock.layout();
+    // unchanged blocks do not need a relayout and a repaint
+    if (layout->formats() == ranges) {
+        skippedFormatBlocksCount++;
+        return;
     }
+    appliedFormatBlocksCount++;
     layout->setFormats(ranges);
     if (markDirty) doc->markContentsDirty(cBlock.position(), cBlock.length() > 0 ? 1 : 0);
 }
@@ -292,6 +502,12 @@ void Highlight::reset()
     funcStartsPHP.clear();
     funcEndsPHP.clear();
     funcNamesPHP.clear();
+    varsKeysPHP.clear();
+    varsNamesPHP.clear();
+    varsPositionsPHP.clear();
+    varsBlockOffsetsPHP.clear();
+    usedVarsKeysPHP.clear();
+    usedVarsNamesPHP.clear();
     expectedNsNamePHP = "";
     expectedClsNamePHP = "";
     expectedFuncNamePHP = "";
@@ -384,12 +600,33 @@ void Highlight::resetMode()
     enabled = false;
     modeType = MODE_UNKNOWN;
     block_state = 0;
-    highlightVarsMode = false;
     firstRunMode = false;
     rehighlightBlockMode = false;
+    collectMode = false;
+    longBlockChunkMode = false;
+    longBlockChunkPrevData = nullptr;
+    longLineFirstColumn = -1;
+    longLineLastColumn = -1;
+    collectedBlocks.clear();
     lastVisibleBlockNumber = -1;
+    lazyBlockNumber = -1;
+    lazyProgressPercent = 0;
+    highlightedBlocksCount = 0;
+    parsedCharsCount = 0;
+    parseNsecs = 0;
+    appliedFormatBlocksCount = 0;
+    skippedFormatBlocksCount = 0;
     dirty = false;
     foundModes.clear();
+    knownVars.clear();
+    knownVarsBlocks.clear();
+    knownVarsPositions.clear();
+    usedVars.clear();
+    changedVarsKeys.clear();
+    knownFunctions.clear();
+    unusedVars.clear();
+    scopeTable.clear();
+    stringsTable.clear();
     extension = "";
     jsExtMode = "";
     fileName = "";
@@ -416,6 +653,81 @@ bool Highlight::isTextMode()
     return extension.size() == 0 || (extension == EXTENSION_TXT && fileName != ROBOTS_FILENAME && fileName != CMAKE_LISTS_FILENAME) || extension == EXTENSION_MD;
 }
 
+void Highlight::setCollectMode(bool collect)
+{
+    collectMode = collect;
+    collectedBlocks.clear();
+}
+
+// skipping can be turned off to compare the timings
+void Highlight::setInertCharsSkipping(bool skipping)
+{
+    inertCharsSkipping = skipping;
+}
+
+// copies the collected results, so that they can be passed to another thread
+SharedHighlightResult Highlight::takeCollectedResult()
+{
+    SharedHighlightResult result = SharedHighlightResult(new HighlightResult());
+    result->blocks.resize(doc->blockCount());
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        int blockNumber = block.blockNumber();
+        HighlightBlockResult & blockResult = result->blocks[blockNumber];
+        if (blockNumber < collectedBlocks.size()) blockResult = collectedBlocks.at(blockNumber);
+        blockResult.userState = block.userState();
+        blockResult.textHash = qHash(block.text());
+        HighlightData * blockData = dynamic_cast<HighlightData *>(block.userData());
+        if (blockData != nullptr) blockResult.data = QSharedPointer<HighlightData>(new HighlightData(*blockData));
+        block = block.next();
+    }
+    collectedBlocks.clear();
+    result->changedVarsKeys = changedVarsKeys;
+    result->knownFunctions = knownFunctions;
+    result->foundModes = foundModes;
+    return result;
+}
+
+void Highlight::importBlock(QTextBlock & block, const HighlightBlockResult & result)
+{
+    if (result.data.isNull()) return;
+    HighlightData * data = new HighlightData(*result.data);
+    scopeTable.intern(data->scope);
+    stringsTable.intern(data->strings);
+    HighlightData * blockData = dynamic_cast<HighlightData *>(block.userData());
+    if (blockData != nullptr) {
+        // keep editor marks
+        data->hasMarkPoint = blockData->hasMarkPoint;
+        data->isModified = blockData->isModified;
+    }
+    block.setUserData(data);
+    block.setUserState(result.userState);
+    // palette formats are taken from the current color scheme
+    QVector<QTextLayout::FormatRange> ranges;
+    int extraIndex = 0;
+    for (int i=0; i<result.rangeIds.size() && i<result.rangeStarts.size() && i<result.rangeLengths.size(); i++) {
+        QTextLayout::FormatRange r;
+        r.start = result.rangeStarts.at(i);
+        r.length = result.rangeLengths.at(i);
+        ushort id = result.rangeIds.at(i);
+        if (id < FORMATS_COUNT) r.format = HW->getFormat(id);
+        else if (extraIndex < result.extraFormats.size()) r.format = result.extraFormats.at(extraIndex++);
+        ranges << r;
+    }
+    block.layout()->setFormats(ranges);
+}
+
+void Highlight::importSymbols(const HighlightResult & result)
+{
+    // variables are collected from the imported blocks by updateKnownVars
+    changedVarsKeys.unite(result.changedVarsKeys);
+    knownFunctions = result.knownFunctions;
+    for (int i=0; i<result.foundModes.size(); i++) {
+        QString foundMode = result.foundModes.at(i);
+        if (!foundModes.contains(foundMode)) foundModes.append(foundMode);
+    }
+}
+
 void Highlight::initMode(QString ext, int lastBlockNumber)
 {
     enabled = true;
@@ -435,10 +747,12 @@ void Highlight::initMode(QString ext, int lastBlockNumber)
     }
 }
 
-void Highlight::updateBlocks(int lastBlockNumber)
+bool Highlight::updateBlocks(int lastBlockNumber)
 {
-    if (!enabled) return;
+    if (!enabled) return false;
     lastVisibleBlockNumber = lastBlockNumber;
+    // blocks above the viewport should be highlighted first to get the correct state
+    highlightTo(lastVisibleBlockNumber + EXTRA_HIGHLIGHT_BLOCKS_COUNT);
     QTextCursor curs = QTextCursor(doc);
     curs.movePosition(QTextCursor::Start);
     bool wantUpdate = false;
@@ -453,20 +767,136 @@ void Highlight::updateBlocks(int lastBlockNumber)
         }
     } while(curs.movePosition(QTextCursor::NextBlock));
     if (wantUpdate) highlightChanges(curs);
+    return wantUpdate;
+}
+
+void Highlight::startLazyHighlight(int blockNumber)
+{
+    lazyBlockNumber = blockNumber;
+    lazyProgressPercent = 0;
+}
+
+bool Highlight::isLazyHighlightPending()
+{
+    return enabled && lazyBlockNumber >= 0;
+}
+
+bool Highlight::highlightTo(int blockNumber)
+{
+    if (!isLazyHighlightPending() || blockNumber < lazyBlockNumber) return false;
+    lazyHighlight(blockNumber - lazyBlockNumber + 1, -1);
+    return true;
+}
+
+bool Highlight::highlightNext(int msec)
+{
+    if (!isLazyHighlightPending()) return false;
+    lazyHighlight(-1, msec);
+    return isLazyHighlightPending();
+}
+
+int Highlight::takeHighlightedBlocksCount()
+{
+    int count = highlightedBlocksCount;
+    highlightedBlocksCount = 0;
+    return count;
+}
+
+qint64 Highlight::getParseTime(qint64 & charsCount)
+{
+    charsCount = parsedCharsCount;
+    return parseNsecs;
+}
+
+qint64 Highlight::getAppliedFormatBlocksCount(qint64 & skippedCount)
+{
+    skippedCount = skippedFormatBlocksCount;
+    return appliedFormatBlocksCount;
+}
+
+int Highlight::getStateMemoryUsage(int & unsharedBytes)
+{
+    int bytes = 0;
+    unsharedBytes = 0;
+    QSet<const HighlightScope *> scopes;
+    QSet<const HighlightStrings *> strings;
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        HighlightData * blockData = dynamic_cast<HighlightData *>(block.userData());
+        if (blockData != nullptr) {
+            int dataBytes = blockData->getMemoryUsage();
+            int scopeBytes = blockData->scope->getMemoryUsage();
+            int stringsBytes = blockData->strings->getMemoryUsage();
+            bytes += dataBytes;
+            unsharedBytes += dataBytes + scopeBytes + stringsBytes;
+            if (!scopes.contains(blockData->scope.constData())) {
+                scopes.insert(blockData->scope.constData());
+                bytes += scopeBytes;
+            }
+            if (!strings.contains(blockData->strings.constData())) {
+                strings.insert(blockData->strings.constData());
+                bytes += stringsBytes;
+            }
+        }
+        block = block.next();
+    }
+    return bytes;
+}
+
+void Highlight::lazyHighlight(int blocksCount, int msec)
+{
+    QTextBlock block = doc->findBlockByNumber(lazyBlockNumber);
+    if (!block.isValid()) block = doc->lastBlock();
+    // blocks could be removed above since the last pass
+    while (block.isValid() && block.previous().isValid() && block.previous().userData() == nullptr) {
+        block = block.previous();
+    }
+    if (!block.isValid()) {
+        lazyBlockNumber = -1;
+        emit progressChanged(100);
+        return;
+    }
+    QElapsedTimer timer;
+    timer.start();
+    bool _firstRunMode = firstRunMode;
+    firstRunMode = true;
+    rehighlightBlockMode = true;
+    dirty = true;
+    int startPos = block.position();
+    int endPos = startPos;
+    int count = 0;
+    do {
+        highlightBlock(block, false);
+        endPos = block.position() + block.length();
+        block = block.next();
+        count++;
+        if (blocksCount > 0 && count >= blocksCount) break;
+        if (msec > 0 && count % LAZY_HIGHLIGHT_CHECK_TIME_BLOCKS_COUNT == 0 && timer.elapsed() >= msec) break;
+    } while(block.isValid());
+    rehighlightBlockMode = false;
+    firstRunMode = _firstRunMode;
+    doc->markContentsDirty(startPos, endPos - startPos);
+    dirty = false;
+    if (block.isValid()) {
+        lazyBlockNumber = block.blockNumber();
+        int percent = lazyBlockNumber * 100 / doc->blockCount();
+        if (percent - lazyProgressPercent > 10) {
+            lazyProgressPercent = percent;
+            emit progressChanged(percent);
+        }
+    } else {
+        lazyBlockNumber = -1;
+        emit progressChanged(100);
+    }
 }
 
 std::string Highlight::findModeAtCursor(QTextBlock * block, int pos)
 {
     if (modeType != MODE_MIXED) return modeType;
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->modeStarts.size()>0 && blockData->modeEnds.size()>0 && blockData->modeTags.size()>0 &&
-        blockData->modeStarts.size()==blockData->modeEnds.size() && blockData->modeStarts.size()==blockData->modeTags.size()
-    ) {
-        for (int i=0; i<blockData->modeStarts.size(); i++) {
-            if (blockData->modeStarts.at(i) <= pos && blockData->modeEnds.at(i) >= pos) {
-                return blockData->modeTags.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->modeTags.size()>0 && blockData->getIntervalsCount(INTERVALS_MODE)==blockData->modeTags.size()) {
+        int i = blockData->findInterval(INTERVALS_MODE, pos);
+        if (i >= 0) return blockData->modeTags.at(i);
     }
     return MODE_HTML;
 }
@@ -474,14 +904,9 @@ std::string Highlight::findModeAtCursor(QTextBlock * block, int pos)
 int Highlight::findStateAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->stateStarts.size()>0 && blockData->stateEnds.size()>0 && blockData->stateIds.size()>0 &&
-        blockData->stateStarts.size()==blockData->stateEnds.size() && blockData->stateStarts.size()==blockData->stateIds.size()
-    ) {
-        for (int i=0; i<blockData->stateStarts.size(); i++) {
-            if (blockData->stateStarts.at(i) <= pos && blockData->stateEnds.at(i) >= pos) {
-                return blockData->stateIds.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->stateIds.size()>0 && blockData->getIntervalsCount(INTERVALS_STATE)==blockData->stateIds.size()) {
+        int i = blockData->findInterval(INTERVALS_STATE, pos);
+        if (i >= 0) return blockData->stateIds.at(i);
     }
     return STATE_NONE;
 }
@@ -495,14 +920,9 @@ bool Highlight::isStateOpen(QTextBlock * block, int pos)
 QString Highlight::findNsPHPAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->nsStartsPHP.size()>0 && blockData->nsEndsPHP.size()>0 && blockData->nsNamesPHP.size()>0 &&
-        blockData->nsStartsPHP.size()==blockData->nsEndsPHP.size() && blockData->nsStartsPHP.size()==blockData->nsNamesPHP.size()
-    ) {
-        for (int i=0; i<blockData->nsStartsPHP.size(); i++) {
-            if (blockData->nsStartsPHP.at(i) <= pos && blockData->nsEndsPHP.at(i) >= pos) {
-                return blockData->nsNamesPHP.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->nsNamesPHP.size()>0 && blockData->getIntervalsCount(INTERVALS_NS_PHP)==blockData->nsNamesPHP.size()) {
+        int i = blockData->findInterval(INTERVALS_NS_PHP, pos);
+        if (i >= 0) return blockData->nsNamesPHP.at(i);
     }
     return "";
 }
@@ -510,14 +930,9 @@ QString Highlight::findNsPHPAtCursor(QTextBlock * block, int pos)
 QString Highlight::findClsPHPAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->clsStartsPHP.size()>0 && blockData->clsEndsPHP.size()>0 && blockData->clsNamesPHP.size()>0 &&
-        blockData->clsStartsPHP.size()==blockData->clsEndsPHP.size() && blockData->clsStartsPHP.size()==blockData->clsNamesPHP.size()
-    ) {
-        for (int i=0; i<blockData->clsStartsPHP.size(); i++) {
-            if (blockData->clsStartsPHP.at(i) <= pos && blockData->clsEndsPHP.at(i) >= pos) {
-                return blockData->clsNamesPHP.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->clsNamesPHP.size()>0 && blockData->getIntervalsCount(INTERVALS_CLS_PHP)==blockData->clsNamesPHP.size()) {
+        int i = blockData->findInterval(INTERVALS_CLS_PHP, pos);
+        if (i >= 0) return blockData->clsNamesPHP.at(i);
     }
     return "";
 }
@@ -525,14 +940,9 @@ QString Highlight::findClsPHPAtCursor(QTextBlock * block, int pos)
 QString Highlight::findFuncPHPAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->funcStartsPHP.size()>0 && blockData->funcEndsPHP.size()>0 && blockData->funcNamesPHP.size()>0 &&
-        blockData->funcStartsPHP.size()==blockData->funcEndsPHP.size() && blockData->funcStartsPHP.size()==blockData->funcNamesPHP.size()
-    ) {
-        for (int i=0; i<blockData->funcStartsPHP.size(); i++) {
-            if (blockData->funcStartsPHP.at(i) <= pos && blockData->funcEndsPHP.at(i) >= pos) {
-                return blockData->funcNamesPHP.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->funcNamesPHP.size()>0 && blockData->getIntervalsCount(INTERVALS_FUNC_PHP)==blockData->funcNamesPHP.size()) {
+        int i = blockData->findInterval(INTERVALS_FUNC_PHP, pos);
+        if (i >= 0) return blockData->funcNamesPHP.at(i);
     }
     return "";
 }
@@ -540,14 +950,9 @@ QString Highlight::findFuncPHPAtCursor(QTextBlock * block, int pos)
 QString Highlight::findClsJSAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->clsStartsJS.size()>0 && blockData->clsEndsJS.size()>0 && blockData->clsNamesJS.size()>0 &&
-        blockData->clsStartsJS.size()==blockData->clsEndsJS.size() && blockData->clsStartsJS.size()==blockData->clsNamesJS.size()
-    ) {
-        for (int i=0; i<blockData->clsStartsJS.size(); i++) {
-            if (blockData->clsStartsJS.at(i) <= pos && blockData->clsEndsJS.at(i) >= pos) {
-                return blockData->clsNamesJS.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->clsNamesJS.size()>0 && blockData->getIntervalsCount(INTERVALS_CLS_JS)==blockData->clsNamesJS.size()) {
+        int i = blockData->findInterval(INTERVALS_CLS_JS, pos);
+        if (i >= 0) return blockData->clsNamesJS.at(i);
     }
     return "";
 }
@@ -555,14 +960,9 @@ QString Highlight::findClsJSAtCursor(QTextBlock * block, int pos)
 QString Highlight::findFuncJSAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->funcStartsJS.size()>0 && blockData->funcEndsJS.size()>0 && blockData->funcNamesJS.size()>0 &&
-        blockData->funcStartsJS.size()==blockData->funcEndsJS.size() && blockData->funcStartsJS.size()==blockData->funcNamesJS.size()
-    ) {
-        for (int i=0; i<blockData->funcStartsJS.size(); i++) {
-            if (blockData->funcStartsJS.at(i) <= pos && blockData->funcEndsJS.at(i) >= pos) {
-                return blockData->funcNamesJS.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->funcNamesJS.size()>0 && blockData->getIntervalsCount(INTERVALS_FUNC_JS)==blockData->funcNamesJS.size()) {
+        int i = blockData->findInterval(INTERVALS_FUNC_JS, pos);
+        if (i >= 0) return blockData->funcNamesJS.at(i);
     }
     return "";
 }
@@ -570,14 +970,9 @@ QString Highlight::findFuncJSAtCursor(QTextBlock * block, int pos)
 QString Highlight::findMediaCSSAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->mediaStartsCSS.size()>0 && blockData->mediaEndsCSS.size()>0 && blockData->mediaNamesCSS.size()>0 &&
-        blockData->mediaStartsCSS.size()==blockData->mediaEndsCSS.size() && blockData->mediaStartsCSS.size()==blockData->mediaNamesCSS.size()
-    ) {
-        for (int i=0; i<blockData->mediaStartsCSS.size(); i++) {
-            if (blockData->mediaStartsCSS.at(i) <= pos && blockData->mediaEndsCSS.at(i) >= pos) {
-                return blockData->mediaNamesCSS.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->mediaNamesCSS.size()>0 && blockData->getIntervalsCount(INTERVALS_MEDIA_CSS)==blockData->mediaNamesCSS.size()) {
+        int i = blockData->findInterval(INTERVALS_MEDIA_CSS, pos);
+        if (i >= 0) return blockData->mediaNamesCSS.at(i);
     }
     return "";
 }
@@ -585,14 +980,9 @@ QString Highlight::findMediaCSSAtCursor(QTextBlock * block, int pos)
 QString Highlight::findTagChainHTMLAtCursor(QTextBlock * block, int pos)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block->userData());
-    if (blockData != nullptr && blockData->tagChainStartsHTML.size()>0 && blockData->tagChainEndsHTML.size()>0 && blockData->tagChainsHTML.size()>0 &&
-        blockData->tagChainStartsHTML.size()==blockData->tagChainEndsHTML.size() && blockData->tagChainStartsHTML.size()==blockData->tagChainsHTML.size()
-    ) {
-        for (int i=0; i<blockData->tagChainStartsHTML.size(); i++) {
-            if (blockData->tagChainStartsHTML.at(i) <= pos && blockData->tagChainEndsHTML.at(i) >= pos) {
-                return blockData->tagChainsHTML.at(i);
-            }
-        }
+    if (blockData != nullptr && blockData->tagChainsHTML.size()>0 && blockData->getIntervalsCount(INTERVALS_TAG_CHAIN_HTML)==blockData->tagChainsHTML.size()) {
+        int i = blockData->findInterval(INTERVALS_TAG_CHAIN_HTML, pos);
+        if (i >= 0) return blockData->tagChainsHTML.at(i);
     }
     return "";
 }
@@ -650,6 +1040,64 @@ int Highlight::getKnownVarBlockNumber(QString clsName, QString funcName, QString
     return -1;
 }
 
+QString Highlight::getVarsKeyPHP()
+{
+    QString ns = "\\";
+    if (nsNamePHP.size() > 0) ns += nsNamePHP + "\\";
+    QString _clsName = clsNamePHP.size() > 0 ? ns + clsNamePHP : "";
+    return _clsName + "::" + funcNamePHP;
+}
+
+QStringList Highlight::updateKnownVars()
+{
+    QStringList keys;
+    if (changedVarsKeys.size() == 0) return keys;
+    for (const QString & k : changedVarsKeys) {
+        keys.append(k);
+        knownVars.erase(k.toStdString());
+        usedVars.erase(k.toStdString());
+    }
+    for (knownVarsPositionsIterator = knownVarsPositions.begin(); knownVarsPositionsIterator != knownVarsPositions.end();) {
+        QString kk = QString::fromStdString(knownVarsPositionsIterator->first);
+        if (changedVarsKeys.contains(kk.mid(0, kk.lastIndexOf("::")))) {
+            knownVarsBlocks.erase(knownVarsPositionsIterator->first);
+            knownVarsPositionsIterator = knownVarsPositions.erase(knownVarsPositionsIterator);
+        } else {
+            knownVarsPositionsIterator++;
+        }
+    }
+    // one pass over the variables recorded in blocks, nothing is parsed again
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        HighlightData * blockData = dynamic_cast<HighlightData *>(block.userData());
+        if (blockData != nullptr) {
+            for (int i=0; i<blockData->varsKeysPHP.size(); i++) {
+                QString k = blockData->varsKeysPHP.at(i);
+                if (!changedVarsKeys.contains(k)) continue;
+                QString varName = blockData->varsNamesPHP.at(i);
+                std::string kk = (k + "::" + varName).toStdString();
+                if (knownVarsPositions.find(kk) != knownVarsPositions.end()) continue;
+                std::string & varsChain = knownVars[k.toStdString()];
+                if (varsChain.size() > 0) varsChain += ",";
+                varsChain += varName.toStdString();
+                int pos = blockData->varsPositionsPHP.at(i);
+                knownVarsPositions[kk] = pos;
+                knownVarsBlocks[kk] = pos >= 0 ? block.blockNumber() + blockData->varsBlockOffsetsPHP.at(i) : -1;
+            }
+            for (int i=0; i<blockData->usedVarsKeysPHP.size(); i++) {
+                QString k = blockData->usedVarsKeysPHP.at(i);
+                if (!changedVarsKeys.contains(k)) continue;
+                std::string & usedChain = usedVars[k.toStdString()];
+                if (usedChain.size() > 0) usedChain += ",";
+                usedChain += blockData->usedVarsNamesPHP.at(i).toStdString();
+            }
+        }
+        block = block.next();
+    }
+    changedVarsKeys.clear();
+    return keys;
+}
+
 QStringList Highlight::getUsedVars(QString clsName, QString funcName)
 {
     QStringList vars;
@@ -681,11 +1129,6 @@ QStringList Highlight::getKnownFunctions(QString clsName)
     return funcs;
 }
 
-void Highlight::setHighlightVarsMode(bool varsMode)
-{
-    highlightVarsMode = varsMode;
-}
-
 void Highlight::setFirstRunMode(bool runMode)
 {
     firstRunMode = runMode;
@@ -696,19 +1139,19 @@ QStringList Highlight::getFoundModes()
     return foundModes;
 }
 
-void Highlight::highlightString(int start, int length, const QTextCharFormat format)
+void Highlight::highlightString(int start, int length, int formatId)
 {
-    setFormat(start, length, format);
+    setFormat(start, length, formatId);
 }
 
-void Highlight::highlightChar(int start, const QTextCharFormat format)
+void Highlight::highlightChar(int start, int formatId)
 {
-    setFormat(start, 1, format);
+    setFormat(start, 1, formatId);
 }
 
 void Highlight::changeBlockState()
 {
-    if (highlightVarsMode || firstRunMode) return;
+    if (firstRunMode) return;
     cBlock.setUserState(static_cast<int>(++block_state));
 }
 
@@ -726,8 +1169,6 @@ bool Highlight::detectMode(const QChar & c, int pos, bool isWSpace, bool isLast)
 
 bool Highlight::detectModeOpen(const QChar & c, int pos, bool isWSpace, bool isLast)
 {
-    std::string _mode = mode;
-
     if (mode!=MODE_PHP && c.toLatin1() == '<') {
         // php in opening tag
         prevModeString = modeString;
@@ -744,6 +1185,15 @@ bool Highlight::detectModeOpen(const QChar & c, int pos, bool isWSpace, bool isL
 
     if (modeString.size()==0) return false;
 
+    // tag name is read, nothing changes until the next "<" or ">"
+    if (modeSkip && !isLast && c.toLatin1() != '>' && modeExpect.size() == 0 && modeString.size() <= 8 &&
+        modeString.at(modeString.size()-1) != '>' && modeString != QLatin1String("<?=")
+    ) {
+        return false;
+    }
+
+    std::string _mode = mode;
+
     if (!isWSpace && !modeSkip) {
         modeString += c;
     }
@@ -810,8 +1260,6 @@ bool Highlight::detectModeOpen(const QChar & c, int pos, bool isWSpace, bool isL
 
 bool Highlight::detectModeClose(const QChar & c, int pos, bool isWSpace)
 {
-    std::string _mode = mode;
-
     if (mode == MODE_PHP && stringSQOpenedPHP < 0 && stringDQOpenedPHP < 0 && stringBOpened < 0 && commentMLOpenedPHP < 0 && exprOpenedPHP < 0 && c.toLatin1() == '?') {
         modeExpectC = "";
         modeStringC = c;
@@ -849,6 +1297,8 @@ bool Highlight::detectModeClose(const QChar & c, int pos, bool isWSpace)
 
     if (modeStringC.size()==0) return false;
 
+    std::string _mode = mode;
+
     if (!isWSpace && !modeSkipC) {
         modeStringC += c;
     }
@@ -1360,7 +1810,7 @@ bool Highlight::detectRegexpJS(const QChar & c, int pos, bool isWSPace, bool isA
         if (c.toLatin1() == '<') prevRegexpEscStringJS = regexpEscStringJS;
         regexpEscStringJS = "";
     } else if (regexpOpenedJS < 0 && !isWSPace && (isAlnum || c.toLatin1() == '$' || c.toLatin1() == ')' || c.toLatin1() == ']' || c.toLatin1() == '<' || c.toLatin1() == '~')) {
-        regexpPrevCharJS = c;
+        setChar(regexpPrevCharJS, c);
     } else if (regexpOpenedJS < 0 && !isWSPace) {
         regexpPrevCharJS = "";
     }
@@ -1373,16 +1823,16 @@ int Highlight::detectKeywordHTML(const QChar & c, int pos, bool isAlpha, bool is
         keywordHTMLOpened = -2;
     } else if (!opened && keywordHTMLOpened==-2 && !isAlnum) {
         keywordHTMLOpened = -1;
-        keywordHTMLprevPrevChar = keywordHTMLprevChar;
-        keywordHTMLprevChar = c;
+        copyWord(keywordHTMLprevPrevChar, keywordHTMLprevChar);
+        setChar(keywordHTMLprevChar, c);
     } else if (!opened && keywordHTMLOpened!=-2 && isAlpha) {
-        keywordStringHTML = c;
+        startWord(keywordStringHTML, c);
         keywordHTMLOpened = pos;
     } else if (keywordHTMLOpened>=0 && isAlnum) {
         keywordStringHTML += c;
     } else if (keywordHTMLOpened<0) {
-        keywordHTMLprevPrevChar = keywordHTMLprevChar;
-        keywordHTMLprevChar = c;
+        copyWord(keywordHTMLprevPrevChar, keywordHTMLprevChar);
+        setChar(keywordHTMLprevChar, c);
     }
     if (keywordHTMLOpened>=0 && (!isAlnum || isLast)) {
         int kOpened = keywordHTMLOpened;
@@ -1395,24 +1845,24 @@ int Highlight::detectKeywordHTML(const QChar & c, int pos, bool isAlpha, bool is
 int Highlight::detectKeywordCSS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bool isLast) {
     if (!isAlpha && c.toLatin1() == '-') isAlpha = true;
     if (!isAlnum && c.toLatin1() == '-') isAlnum = true;
-    if (!isAlpha && isAlnum && keywordCSSprevChar == "#") isAlpha = true;
+    if (!isAlpha && isAlnum && keywordCSSprevChar == QLatin1String("#")) isAlpha = true;
     bool opened = stringSQOpenedCSS >= 0 || stringDQOpenedCSS >= 0 || commentMLOpenedCSS >= 0 || keywordCSSOpened >= 0;
     if (!opened && keywordCSSOpened!=-2 && isAlnum && !isAlpha) {
         keywordCSSOpened = -2;
     } else if (!opened && keywordCSSOpened==-2 && !isAlnum) {
         keywordCSSOpened = -1;
-        keywordCSSprevPrevChar = keywordCSSprevChar;
-        keywordCSSprevChar = c;
+        copyWord(keywordCSSprevPrevChar, keywordCSSprevChar);
+        setChar(keywordCSSprevChar, c);
     } else if (!opened && keywordCSSOpened!=-2 && isAlpha) {
-        keywordStringCSS = c;
+        startWord(keywordStringCSS, c);
         keywordCSSOpened = pos;
-        if (keywordCSSprevChar == "#") isColorKeyword = true;
+        if (keywordCSSprevChar == QLatin1String("#")) isColorKeyword = true;
         else isColorKeyword = false;
     } else if (keywordCSSOpened>=0 && isAlnum) {
         keywordStringCSS += c;
     } else if (keywordCSSOpened<0) {
-        keywordCSSprevPrevChar = keywordCSSprevChar;
-        keywordCSSprevChar = c;
+        copyWord(keywordCSSprevPrevChar, keywordCSSprevChar);
+        setChar(keywordCSSprevChar, c);
     }
     if (keywordCSSOpened>=0 && isColorKeyword && isAlnum && !isdigit(c.toLatin1())) {
         QChar _c = c.toLower();
@@ -1434,14 +1884,14 @@ int Highlight::detectKeywordJS(const QChar & c, int pos, bool isAlpha, bool isAl
         keywordJSOpened = -2;
     } else if (!opened && keywordJSOpened==-2 && !isAlnum) {
         keywordJSOpened = -1;
-        keywordJSprevChar = c;
+        setChar(keywordJSprevChar, c);
     } else if (!opened && keywordJSOpened!=-2 && isAlpha) {
-        keywordStringJS = c;
+        startWord(keywordStringJS, c);
         keywordJSOpened = pos;
     } else if (keywordJSOpened>=0 && isAlnum) {
         keywordStringJS += c;
     } else if (keywordJSOpened<0) {
-        keywordJSprevChar = c;
+        setChar(keywordJSprevChar, c);
     }
     if (keywordJSOpened>=0 && (!isAlnum || isLast)) {
         int kOpened = keywordJSOpened;
@@ -1458,16 +1908,16 @@ int Highlight::detectKeywordPHP(const QChar & c, int pos, bool isAlpha, bool isA
         keywordPHPOpened = -2;
     } else if (!opened && keywordPHPOpened==-2 && !isAlnum) {
         keywordPHPOpened = -1;
-        keywordPHPprevPrevChar = keywordPHPprevChar;
-        keywordPHPprevChar = c;
+        copyWord(keywordPHPprevPrevChar, keywordPHPprevChar);
+        setChar(keywordPHPprevChar, c);
     } else if (!opened && keywordPHPOpened!=-2 && isAlpha) {
-        keywordStringPHP = c;
+        startWord(keywordStringPHP, c);
         keywordPHPOpened = pos;
     } else if (keywordPHPOpened>=0 && isAlnum) {
         keywordStringPHP += c;
     } else if (keywordPHPOpened<0) {
-        keywordPHPprevPrevChar = keywordPHPprevChar;
-        keywordPHPprevChar = c;
+        copyWord(keywordPHPprevPrevChar, keywordPHPprevChar);
+        setChar(keywordPHPprevChar, c);
     }
     if (keywordPHPOpened>=0 && (!isAlnum || isLast)) {
         int kOpened = keywordPHPOpened;
@@ -1633,14 +2083,14 @@ int Highlight::detectKeywordUnknown(const QChar & c, int pos, bool isAlpha, bool
         keywordUnknownOpened = -2;
     } else if (!opened && keywordUnknownOpened==-2 && !isAlnum) {
         keywordUnknownOpened = -1;
-        keywordUnknownprevChar = c;
+        setChar(keywordUnknownprevChar, c);
     } else if (!opened && keywordUnknownOpened!=-2 && isAlpha) {
-        keywordStringUnknown = c;
+        startWord(keywordStringUnknown, c);
         keywordUnknownOpened = pos;
     } else if (keywordUnknownOpened>=0 && isAlnum) {
         keywordStringUnknown += c;
     } else if (keywordUnknownOpened<0) {
-        keywordUnknownprevChar = c;
+        setChar(keywordUnknownprevChar, c);
     }
     if (keywordUnknownOpened>=0 && (!isAlnum || isLast)) {
         int kOpened = keywordUnknownOpened;
@@ -1650,119 +2100,122 @@ int Highlight::detectKeywordUnknown(const QChar & c, int pos, bool isAlpha, bool
     return -1;
 }
 
-void Highlight::restoreState() {
+HighlightData * Highlight::previousBlockData()
+{
+    QTextBlock prevBlock = cBlock.previous();
+    if (!prevBlock.isValid()) return nullptr;
+    return dynamic_cast<HighlightData *>(prevBlock.userData());
+}
+
+void Highlight::restoreState(HighlightData * prevBlockData) {
     // load previous block data
-    QTextCursor curs = QTextCursor(cBlock);
-    if (curs.movePosition(QTextCursor::MoveOperation::PreviousBlock)) {
-        HighlightData * prevBlockData = dynamic_cast<HighlightData *>(curs.block().userData());
-        if (prevBlockData != nullptr) {
-            state = prevBlockData->state;
-            prevState = prevBlockData->prevState;
-            prevPrevState = prevBlockData->prevPrevState;
-            mode = prevBlockData->mode.toStdString();
-            prevMode = prevBlockData->prevMode.toStdString();
-            modeExpect = prevBlockData->modeExpect.toStdString();
-            if (modeExpect.size()>0) {
-                modeString = prevBlockData->modeString;
-                modeSpos = 0;
-                modeSkip = true;
-            }
-            prevModeExpect = prevBlockData->prevModeExpect.toStdString();
-            prevModeString = prevBlockData->prevModeString;
-            prevModeSkip = prevBlockData->prevModeSkip;
-            if (prevModeString.size()>0) {
-                prevModeSpos = 0;
-            }
-            modeExpectC = prevBlockData->modeExpectC.toStdString();
-            if (modeExpectC.size()>0) {
-                modeStringC = prevBlockData->modeStringC;
-                modeCpos = 0;
-                modeSkipC = true;
-            }
-            prevModeExpectC = prevBlockData->prevModeExpectC.toStdString();
-            prevModeStringC = prevBlockData->prevModeStringC;
-            prevModeSkipC = prevBlockData->prevModeSkipC;
-            if (prevModeStringC.size()>0) {
-                prevModeCpos = 0;
-            }
-            stringEscStringCSS = prevBlockData->stringEscStringCSS;
-            stringEscStringJS = prevBlockData->stringEscStringJS;
-            stringBlock = prevBlockData->stringBlock;
-            regexpEscStringJS = prevBlockData->regexpEscStringJS;
-            regexpPrevCharJS = prevBlockData->regexpPrevCharJS;
-            bracesCSS = prevBlockData->bracesCSS;
-            bracesJS = prevBlockData->bracesJS;
-            bracesPHP = prevBlockData->bracesPHP;
-            parensCSS = prevBlockData->parensCSS;
-            parensJS = prevBlockData->parensJS;
-            parensPHP = prevBlockData->parensPHP;
-            cssMediaScope = prevBlockData->cssMediaScope;
-            keywordPHPScoped = prevBlockData->keywordPHPScoped;
-            keywordJSScoped = prevBlockData->keywordJSScoped;
-            exprEscStringJS = prevBlockData->exprEscStringJS;
-            stringEscVariableJS = prevBlockData->stringEscVariableJS;
-            nsNamePHP = prevBlockData->nsNamePHP;
-            nsChainPHP = prevBlockData->nsChainPHP;
-            nsScopeChainPHP = prevBlockData->nsScopeChainPHP;
-            clsNamePHP = prevBlockData->clsNamePHP;
-            clsChainPHP = prevBlockData->clsChainPHP;
-            clsScopeChainPHP = prevBlockData->clsScopeChainPHP;
-            funcNamePHP = prevBlockData->funcNamePHP;
-            funcChainPHP = prevBlockData->funcChainPHP;
-            funcScopeChainPHP = prevBlockData->funcScopeChainPHP;
-            expectedNsNamePHP = prevBlockData->expectedNsNamePHP;
-            expectedClsNamePHP = prevBlockData->expectedClsNamePHP;
-            expectedFuncNamePHP = prevBlockData->expectedFuncNamePHP;
-            expectedFuncParsPHP = prevBlockData->expectedFuncParsPHP;
-            expectedFuncArgsPHP = prevBlockData->expectedFuncArgsPHP;
-            expectedFuncArgsPHPPositions = prevBlockData->expectedFuncArgsPHPPositions;
-            expectedFuncArgsPHPBlocks = prevBlockData->expectedFuncArgsPHPBlocks;
-            nsScopePHP = prevBlockData->nsScopePHP;
-            clsScopePHP = prevBlockData->clsScopePHP;
-            funcScopePHP = prevBlockData->funcScopePHP;
-            varsChainsPHP = prevBlockData->varsChainsPHP;
-            usedVarsChainsPHP = prevBlockData->usedVarsChainsPHP;
-            varsGlobChainPHP = prevBlockData->varsGlobChainPHP;
-            usedVarsGlobChainPHP = prevBlockData->usedVarsGlobChainPHP;
-            varsClsChainPHP = prevBlockData->varsClsChainPHP;
-            varsChainPHP = prevBlockData->varsChainPHP;
-            usedVarsChainPHP = prevBlockData->usedVarsChainPHP;
-            clsOpenPHP = prevBlockData->clsOpenPHP;
-            clsOpensPHP = prevBlockData->clsOpensPHP;
-            varsClsOpenChainPHP = prevBlockData->varsClsOpenChainPHP;
-            clsPropsChainPHP = prevBlockData->clsPropsChainPHP;
-            isGlobalPHP = prevBlockData->isGlobalPHP;
-            funcNameJS = prevBlockData->funcNameJS;
-            funcScopeChainJS = prevBlockData->funcScopeChainJS;
-            funcChainJS = prevBlockData->funcChainJS;
-            expectedFuncNameJS = prevBlockData->expectedFuncNameJS;
-            expectedFuncVarJS = prevBlockData->expectedFuncVarJS;
-            expectedFuncParsJS = prevBlockData->expectedFuncParsJS;
-            funcScopeJS = prevBlockData->funcScopeJS;
-            varsChainJS = prevBlockData->varsChainJS;
-            expectedFuncArgsJS = prevBlockData->expectedFuncArgsJS;
-            mediaNameCSS = prevBlockData->mediaNameCSS;
-            expectedMediaNameCSS = prevBlockData->expectedMediaNameCSS;
-            expectedMediaParsCSS = prevBlockData->expectedMediaParsCSS;
-            mediaScopeCSS = prevBlockData->mediaScopeCSS;
-            tagChainHTML = prevBlockData->tagChainHTML;
-            keywordPHPprevString = prevBlockData->keywordPHPprevString;
-            keywordPHPprevStringPrevChar = prevBlockData->keywordPHPprevStringPrevChar;
-            keywordJSprevString = prevBlockData->keywordJSprevString;
-            keywordJSprevStringPrevChar = prevBlockData->keywordJSprevStringPrevChar;
-            cssNamesChain = prevBlockData->cssNamesChain;
-            operatorsChainPHP = prevBlockData->operatorsChainPHP;
-            operatorsPHP = prevBlockData->operatorsPHP;
-            operatorsChainJS = prevBlockData->operatorsChainJS;
-            operatorsJS = prevBlockData->operatorsJS;
-            expectedClsNameJS = prevBlockData->expectedClsNameJS;
-            clsNameJS = prevBlockData->clsNameJS;
-            clsScopeJS = prevBlockData->clsScopeJS;
-            clsChainJS = prevBlockData->clsChainJS;
-            clsScopeChainJS = prevBlockData->clsScopeChainJS;
-            clsOpensJS = prevBlockData->clsOpensJS;
-            clsOpenJS = prevBlockData->clsOpenJS;
+    if (prevBlockData != nullptr) {
+        state = prevBlockData->state;
+        prevState = prevBlockData->prevState;
+        prevPrevState = prevBlockData->prevPrevState;
+        mode = prevBlockData->strings->mode.toStdString();
+        prevMode = prevBlockData->strings->prevMode.toStdString();
+        modeExpect = prevBlockData->strings->modeExpect.toStdString();
+        if (modeExpect.size()>0) {
+            modeString = prevBlockData->strings->modeString;
+            modeSpos = 0;
+            modeSkip = true;
+        }
+        prevModeExpect = prevBlockData->strings->prevModeExpect.toStdString();
+        prevModeString = prevBlockData->strings->prevModeString;
+        prevModeSkip = prevBlockData->prevModeSkip;
+        if (prevModeString.size()>0) {
+            prevModeSpos = 0;
+        }
+        modeExpectC = prevBlockData->strings->modeExpectC.toStdString();
+        if (modeExpectC.size()>0) {
+            modeStringC = prevBlockData->strings->modeStringC;
+            modeCpos = 0;
+            modeSkipC = true;
         }
+        prevModeExpectC = prevBlockData->strings->prevModeExpectC.toStdString();
+        prevModeStringC = prevBlockData->strings->prevModeStringC;
+        prevModeSkipC = prevBlockData->prevModeSkipC;
+        if (prevModeStringC.size()>0) {
+            prevModeCpos = 0;
+        }
+        stringEscStringCSS = prevBlockData->strings->stringEscStringCSS;
+        stringEscStringJS = prevBlockData->strings->stringEscStringJS;
+        stringBlock = prevBlockData->strings->stringBlock;
+        regexpEscStringJS = prevBlockData->strings->regexpEscStringJS;
+        regexpPrevCharJS = prevBlockData->strings->regexpPrevCharJS;
+        bracesCSS = prevBlockData->bracesCSS;
+        bracesJS = prevBlockData->bracesJS;
+        bracesPHP = prevBlockData->bracesPHP;
+        parensCSS = prevBlockData->parensCSS;
+        parensJS = prevBlockData->parensJS;
+        parensPHP = prevBlockData->parensPHP;
+        cssMediaScope = prevBlockData->cssMediaScope;
+        keywordPHPScoped = prevBlockData->keywordPHPScoped;
+        keywordJSScoped = prevBlockData->keywordJSScoped;
+        exprEscStringJS = prevBlockData->strings->exprEscStringJS;
+        stringEscVariableJS = prevBlockData->strings->stringEscVariableJS;
+        nsNamePHP = prevBlockData->scope->nsNamePHP;
+        nsChainPHP = prevBlockData->scope->nsChainPHP;
+        nsScopeChainPHP = prevBlockData->scope->nsScopeChainPHP;
+        clsNamePHP = prevBlockData->scope->clsNamePHP;
+        clsChainPHP = prevBlockData->scope->clsChainPHP;
+        clsScopeChainPHP = prevBlockData->scope->clsScopeChainPHP;
+        funcNamePHP = prevBlockData->scope->funcNamePHP;
+        funcChainPHP = prevBlockData->scope->funcChainPHP;
+        funcScopeChainPHP = prevBlockData->scope->funcScopeChainPHP;
+        expectedNsNamePHP = prevBlockData->scope->expectedNsNamePHP;
+        expectedClsNamePHP = prevBlockData->scope->expectedClsNamePHP;
+        expectedFuncNamePHP = prevBlockData->scope->expectedFuncNamePHP;
+        expectedFuncParsPHP = prevBlockData->expectedFuncParsPHP;
+        expectedFuncArgsPHP = prevBlockData->scope->expectedFuncArgsPHP;
+        expectedFuncArgsPHPPositions = prevBlockData->scope->expectedFuncArgsPHPPositions;
+        expectedFuncArgsPHPBlocks = prevBlockData->scope->expectedFuncArgsPHPBlocks;
+        nsScopePHP = prevBlockData->nsScopePHP;
+        clsScopePHP = prevBlockData->clsScopePHP;
+        funcScopePHP = prevBlockData->funcScopePHP;
+        varsChainsPHP = prevBlockData->scope->varsChainsPHP;
+        usedVarsChainsPHP = prevBlockData->scope->usedVarsChainsPHP;
+        varsGlobChainPHP = prevBlockData->scope->varsGlobChainPHP;
+        usedVarsGlobChainPHP = prevBlockData->scope->usedVarsGlobChainPHP;
+        varsClsChainPHP = prevBlockData->scope->varsClsChainPHP;
+        varsChainPHP = prevBlockData->scope->varsChainPHP;
+        usedVarsChainPHP = prevBlockData->scope->usedVarsChainPHP;
+        clsOpenPHP = prevBlockData->clsOpenPHP;
+        clsOpensPHP = prevBlockData->scope->clsOpensPHP;
+        varsClsOpenChainPHP = prevBlockData->scope->varsClsOpenChainPHP;
+        clsPropsChainPHP = prevBlockData->scope->clsPropsChainPHP;
+        isGlobalPHP = prevBlockData->isGlobalPHP;
+        funcNameJS = prevBlockData->scope->funcNameJS;
+        funcScopeChainJS = prevBlockData->scope->funcScopeChainJS;
+        funcChainJS = prevBlockData->scope->funcChainJS;
+        expectedFuncNameJS = prevBlockData->scope->expectedFuncNameJS;
+        expectedFuncVarJS = prevBlockData->scope->expectedFuncVarJS;
+        expectedFuncParsJS = prevBlockData->expectedFuncParsJS;
+        funcScopeJS = prevBlockData->funcScopeJS;
+        varsChainJS = prevBlockData->scope->varsChainJS;
+        expectedFuncArgsJS = prevBlockData->scope->expectedFuncArgsJS;
+        mediaNameCSS = prevBlockData->scope->mediaNameCSS;
+        expectedMediaNameCSS = prevBlockData->scope->expectedMediaNameCSS;
+        expectedMediaParsCSS = prevBlockData->expectedMediaParsCSS;
+        mediaScopeCSS = prevBlockData->mediaScopeCSS;
+        tagChainHTML = prevBlockData->scope->tagChainHTML;
+        keywordPHPprevString = prevBlockData->strings->keywordPHPprevString;
+        keywordPHPprevStringPrevChar = prevBlockData->strings->keywordPHPprevStringPrevChar;
+        keywordJSprevString = prevBlockData->strings->keywordJSprevString;
+        keywordJSprevStringPrevChar = prevBlockData->strings->keywordJSprevStringPrevChar;
+        cssNamesChain = prevBlockData->scope->cssNamesChain;
+        operatorsChainPHP = prevBlockData->scope->operatorsChainPHP;
+        operatorsPHP = prevBlockData->scope->operatorsPHP;
+        operatorsChainJS = prevBlockData->scope->operatorsChainJS;
+        operatorsJS = prevBlockData->scope->operatorsJS;
+        expectedClsNameJS = prevBlockData->scope->expectedClsNameJS;
+        clsNameJS = prevBlockData->scope->clsNameJS;
+        clsScopeJS = prevBlockData->clsScopeJS;
+        clsChainJS = prevBlockData->scope->clsChainJS;
+        clsScopeChainJS = prevBlockData->scope->clsScopeChainJS;
+        clsOpensJS = prevBlockData->scope->clsOpensJS;
+        clsOpenJS = prevBlockData->clsOpenJS;
     }
 
     if (state == STATE_TAG || prevState == STATE_TAG || prevPrevState == STATE_TAG) {
@@ -1856,7 +2309,7 @@ void Highlight::highlightSpell()
             QTextCharFormat uFormat = format(start);
             uFormat.setUnderlineStyle(QTextCharFormat::WaveUnderline);
             uFormat.setUnderlineColor(spellColor);
-            highlightString(start, length, uFormat);
+            highlightString(start, length, addFormat(uFormat));
         }
     }
 }
@@ -1867,7 +2320,7 @@ void Highlight::highlightError(int pos, int length)
     QTextCharFormat uFormat = format(pos);
     uFormat.setUnderlineStyle(QTextCharFormat::WaveUnderline);
     uFormat.setUnderlineColor(errorColor);
-    highlightString(pos, length, uFormat);
+    highlightString(pos, length, addFormat(uFormat));
 }
 
 bool Highlight::parseMode(const QChar & c, int pos, bool isWSpace, bool isLast, std::string & pMode, int & pState)
@@ -1903,9 +2356,9 @@ bool Highlight::parseMode(const QChar & c, int pos, bool isWSpace, bool isLast,
         pMode = mode;
         // highlight tag
         if (mode == MODE_PHP) {
-            highlightString(modeSpos, pos-modeSpos+1, HW->phpTagFormat);
+            highlightString(modeSpos, pos-modeSpos+1, FORMAT_PHP_TAG);
         } else if (mode == MODE_JS || mode == MODE_CSS) {
-            highlightChar(pos, HW->tagFormat);
+            highlightChar(pos, FORMAT_TAG);
         }
 
         QString modeTag = "";
@@ -1945,9 +2398,9 @@ bool Highlight::parseMode(const QChar & c, int pos, bool isWSpace, bool isLast,
 
         // highlight tag
         if (pMode == MODE_PHP) {
-            highlightString(modeCpos, pos-modeCpos+1, HW->phpTagFormat);
+            highlightString(modeCpos, pos-modeCpos+1, FORMAT_PHP_TAG);
         } else if ((pMode == MODE_JS || pMode == MODE_CSS) && modeCposed == modeCpos) {
-            highlightString(modeCpos, pos-modeCpos+1, HW->tagFormat);
+            highlightString(modeCpos, pos-modeCpos+1, FORMAT_TAG);
         }
 
         QString modeTag = "";
@@ -2024,29 +2477,29 @@ void Highlight::parseHTML(const QChar & c, const QChar & prevC, int pos, bool is
     if (mode != MODE_HTML) return;
     bool tagChanged = detectTag(c, pos);
     if (tagOpened>=0 || tagChanged) {
-        highlightChar(pos, HW->tagFormat);
+        highlightChar(pos, FORMAT_TAG);
     }
 
     // html comments
     bool commentHTMLchanged = detectCommentHTML(c);
     if (commentHTMLOpened>=0 && commentHTMLchanged) {
-        highlightString(commentHTMLOpened, pos-commentHTMLOpened+1, HW->multiLineCommentFormat);
+        highlightString(commentHTMLOpened, pos-commentHTMLOpened+1, FORMAT_MULTI_LINE_COMMENT);
     } else if (commentHTMLOpened<0 && commentHTMLchanged) {
-        highlightChar(pos, HW->multiLineCommentFormat);
+        highlightChar(pos, FORMAT_MULTI_LINE_COMMENT);
     } else if (commentHTMLOpened>=0) {
-        highlightChar(pos, HW->multiLineCommentFormat);
+        highlightChar(pos, FORMAT_MULTI_LINE_COMMENT);
     }
 
     // html string (single quote)
     bool stringSQchangedHTML = detectStringSQHTML(c, pos);
     if ((stringSQOpenedHTML>=0 && state == STATE_STRING_SQ_HTML) || stringSQchangedHTML) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // html string (double quote)
     bool stringDQchangedHTML = detectStringDQHTML(c, pos);
     if ((stringDQOpenedHTML>=0 && state == STATE_STRING_DQ_HTML)|| stringDQchangedHTML) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // html tag keywords
@@ -2054,21 +2507,20 @@ void Highlight::parseHTML(const QChar & c, const QChar & prevC, int pos, bool is
     if (keywordHTMLStart>=0) {
         int keywordHTMLLength = pos-keywordHTMLStart;
         if (isLast && isAlnum) keywordHTMLLength += 1;
-        if ((keywordHTMLprevChar=="<" || (keywordHTMLprevChar=="/" && keywordHTMLprevPrevChar=="<")) && keywordStringHTML != "script" && keywordStringHTML != "style") {
-            HW->htmlwordsIterator = HW->htmlwords.find(keywordStringHTML.toLower().toStdString());
-            if (HW->htmlwordsIterator != HW->htmlwords.end()) {
-                QTextCharFormat format = HW->htmlwordsIterator->second;
-                highlightString(keywordHTMLStart, keywordHTMLLength, format);
+        if ((keywordHTMLprevChar == QLatin1String("<") || (keywordHTMLprevChar == QLatin1String("/") && keywordHTMLprevPrevChar == QLatin1String("<"))) && keywordStringHTML != QLatin1String("script") && keywordStringHTML != QLatin1String("style")) {
+            int formatId = HW->htmlwords.find(keywordStringHTML);
+            if (formatId != FORMAT_NONE) {
+                highlightString(keywordHTMLStart, keywordHTMLLength, formatId);
             } else {
-                highlightString(keywordHTMLStart, keywordHTMLLength, HW->tagNameFormat);
+                highlightString(keywordHTMLStart, keywordHTMLLength, FORMAT_TAG_NAME);
             }
-            if (keywordHTMLprevChar == "/") {
+            if (keywordHTMLprevChar == QLatin1String("/")) {
                 addSpecialWord(keywordHTMLprevChar+keywordStringHTML, keywordHTMLStart);
                 // close tag chain
                 if (tagChainHTML.size() > 0) {
                     QStringList tagChainList = tagChainHTML.split(",");
                     QString lastTag = tagChainList.last();
-                    if (lastTag.toLower() == keywordStringHTML.toLower()) {
+                    if (lastTag.compare(keywordStringHTML, Qt::CaseInsensitive) == 0) {
                         tagChainList.removeLast();
                         tagChainEndsHTML.append(keywordHTMLStart+keywordStringHTML.size());
                         QString tagChainN = "";
@@ -2095,8 +2547,8 @@ void Highlight::parseHTML(const QChar & c, const QChar & prevC, int pos, bool is
                 tagChainsHTML.append(tagChainHTML);
             }
         }
-        keywordHTMLprevPrevChar = c;
-        keywordHTMLprevChar = c;
+        setChar(keywordHTMLprevPrevChar, c);
+        setChar(keywordHTMLprevChar, c);
     }
 
     // close open short tag
@@ -2106,8 +2558,7 @@ void Highlight::parseHTML(const QChar & c, const QChar & prevC, int pos, bool is
         if (prevC.toLatin1() == '/') doClose = true;
         if (!doClose) {
             QString lastTag = tagChainList.last();
-            HW->htmlshortsIterator = HW->htmlshorts.find(lastTag.toLower().toStdString());
-            if (HW->htmlshortsIterator != HW->htmlshorts.end()) {
+            if (HW->htmlshorts.contains(lastTag)) {
                 doClose = true;
             }
         }
@@ -2130,9 +2581,9 @@ void Highlight::parseHTML(const QChar & c, const QChar & prevC, int pos, bool is
     // tabs and spaces
     if (stringSQOpenedHTML < 0 && stringDQOpenedHTML < 0 && commentHTMLOpened < 0 && keywordHTMLOpened < 0) {
         if (highlightTabs && c.toLatin1() == '\t') {
-            highlightChar(pos, HW->tabFormat);
+            highlightChar(pos, FORMAT_TAB);
         } else if (highlightSpaces && c.toLatin1() == ' ') {
-            highlightChar(pos, HW->spaceFormat);
+            highlightChar(pos, FORMAT_SPACE);
         }
     }
 }
@@ -2143,28 +2594,28 @@ void Highlight::parseCSS(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     // css string (single quote)
     bool stringSQchangedCSS = detectStringSQCSS(c, pos);
     if ((stringSQOpenedCSS>=0 && state == STATE_STRING_SQ_CSS) || stringSQchangedCSS) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // css string (double quote)
     bool stringDQchangedCSS = detectStringDQCSS(c, pos);
     if ((stringDQOpenedCSS>=0 && state == STATE_STRING_DQ_CSS)|| stringDQchangedCSS) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // comments (multi-line)
     bool commentsMLchangedCSS = detectMLCommentCSS(c, pos);
     if ((commentMLOpenedCSS>=0 && state == STATE_COMMENT_ML_CSS)|| commentsMLchangedCSS) {
-        highlightChar(pos, HW->multiLineCommentFormat);
+        highlightChar(pos, FORMAT_MULTI_LINE_COMMENT);
         if (commentMLOpenedCSS>=0 && state == STATE_COMMENT_ML_CSS && commentsMLchangedCSS && pos>0) {
-            highlightChar(pos-1, HW->multiLineCommentFormat);
+            highlightChar(pos-1, FORMAT_MULTI_LINE_COMMENT);
         }
     }
 
     // keywords & selectors && functions
     int keywordCSSStart = detectKeywordCSS(c, pos, isAlpha, isAlnum, isLast);
     if (keywordCSSStart>=0) {
-        if (keywordCSSprevChar == "@" && keywordStringCSS == "media") {
+        if (keywordCSSprevChar == QLatin1String("@") && keywordStringCSS == QLatin1String("media")) {
             cssMediaScope = true;
             if (mediaNameCSS.size() == 0 && mediaScopeCSS < 0) {
                 expectedMediaNameCSS = keywordStringCSS;
@@ -2173,43 +2624,41 @@ void Highlight::parseCSS(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
         }
         int keywordCSSLength = pos-keywordCSSStart;
         if (isLast && (isAlnum || c.toLatin1() == '-')) keywordCSSLength += 1;
-        if ((keywordCSSprevChar == "@" || keywordCSSprevChar == "!") && keywordCSSStart>0) {
+        if ((keywordCSSprevChar == QLatin1String("@") || keywordCSSprevChar == QLatin1String("!")) && keywordCSSStart>0) {
             keywordCSSStart -= 1;
             keywordCSSLength += 1;
         }
-        if (keywordCSSprevChar != "#" && keywordCSSprevChar != "." && keywordCSSprevPrevChar != "&") {
+        if (keywordCSSprevChar != QLatin1String("#") && keywordCSSprevChar != QLatin1String(".") && keywordCSSprevPrevChar != QLatin1String("&")) {
             bool kFound = false;
-            if (keywordCSSprevChar != "$" && keywordCSSprevChar != "%") {
+            if (keywordCSSprevChar != QLatin1String("$") && keywordCSSprevChar != QLatin1String("%")) {
                 // css keywords
                 if (!isBigFile) {
-                    HW->csswordsIterator = HW->csswords.find(keywordStringCSS.toLower().toStdString());
-                    if (HW->csswordsIterator != HW->csswords.end()) {
-                        QTextCharFormat format = HW->csswordsIterator->second;
-                        highlightString(keywordCSSStart, keywordCSSLength, format);
+                    int formatId = HW->csswords.find(keywordStringCSS);
+                    if (formatId != FORMAT_NONE) {
+                        highlightString(keywordCSSStart, keywordCSSLength, formatId);
                         keywordCSSStart = -1;
                         kFound = true;
                     }
                 }
                 if (!kFound && cssValuePart) {
                     // css selectors
-                    HW->htmlwordsIterator = HW->htmlwords.find(keywordStringCSS.toLower().toStdString());
-                    if (HW->htmlwordsIterator != HW->htmlwords.end()) {
-                        highlightString(keywordCSSStart, keywordCSSLength, HW->selectorTagFormat);
+                    if (HW->htmlwords.contains(keywordStringCSS)) {
+                        highlightString(keywordCSSStart, keywordCSSLength, FORMAT_SELECTOR_TAG);
                         kFound = true;
                     }
                 }
             }
             if (!kFound && !isBigFile) {
-                if (keywordCSSprevChar == "$" && keywordCSSStart > 0) {
-                    highlightString(keywordCSSStart-1, keywordCSSLength+1, HW->variableFormat);
-                } else if (keywordCSSprevChar == "%" && keywordCSSStart > 0) {
-                    highlightString(keywordCSSStart-1, keywordCSSLength+1, HW->knownVariableFormat);
+                if (keywordCSSprevChar == QLatin1String("$") && keywordCSSStart > 0) {
+                    highlightString(keywordCSSStart-1, keywordCSSLength+1, FORMAT_VARIABLE);
+                } else if (keywordCSSprevChar == QLatin1String("%") && keywordCSSStart > 0) {
+                    highlightString(keywordCSSStart-1, keywordCSSLength+1, FORMAT_KNOWN_VARIABLE);
                 } else if (bracesCSS > 0 && cssValuePart) {
                     // css properties
-                    highlightString(keywordCSSStart, keywordCSSLength, HW->propertyFormat);
+                    highlightString(keywordCSSStart, keywordCSSLength, FORMAT_PROPERTY);
                 }
             }
-        } else if ((keywordCSSprevChar == "#" || keywordCSSprevChar == ".") && parensCSS == 0) {
+        } else if ((keywordCSSprevChar == QLatin1String("#") || keywordCSSprevChar == QLatin1String(".")) && parensCSS == 0) {
             // css id & class selectors
             if (keywordCSSStart > 0) {
                 keywordCSSStart -= 1;
@@ -2218,31 +2667,32 @@ void Highlight::parseCSS(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
             QString cssName = keywordCSSprevChar + keywordStringCSS;
             cssNamesIterator = cssNames.find(cssName.toStdString());
             if (cssNamesIterator != cssNames.end()) {
-                highlightString(keywordCSSStart, keywordCSSLength, HW->selectorFormat);
+                highlightString(keywordCSSStart, keywordCSSLength, FORMAT_SELECTOR);
             } else if (!isColorKeyword) {
                 if (cssNamesChain.size() > 0) cssNamesChain += ",";
                 cssNamesChain += cssName;
-                highlightString(keywordCSSStart, keywordCSSLength, HW->selectorTagFormat);
+                highlightString(keywordCSSStart, keywordCSSLength, FORMAT_SELECTOR_TAG);
             }
         }
-        if (keywordCSSprevChar == "#" && !cssValuePart && isColorKeyword && !isBigFile && (keywordStringCSS.length() == 3 || keywordStringCSS.length() == 6 || keywordStringCSS.length() == 8) && QColor::isValidColor(keywordCSSprevChar+keywordStringCSS)) {
+        if (keywordCSSprevChar == QLatin1String("#") && !cssValuePart && isColorKeyword && !isBigFile && (keywordStringCSS.length() == 3 || keywordStringCSS.length() == 6 || keywordStringCSS.length() == 8) && QColor::isValidColor(keywordCSSprevChar+keywordStringCSS)) {
             // colors
             if (keywordCSSStart > 0 && parensCSS == 0) {
                 keywordCSSStart += 1;
                 keywordCSSLength -= 1;
             }
-            HW->colorFormat.setUnderlineColor(QColor(keywordCSSprevChar+keywordStringCSS));
-            highlightString(keywordCSSStart, keywordCSSLength, HW->colorFormat);
+            QTextCharFormat colorFormat = HW->colorFormat;
+            colorFormat.setUnderlineColor(QColor(keywordCSSprevChar+keywordStringCSS));
+            highlightString(keywordCSSStart, keywordCSSLength, addFormat(colorFormat));
         }
-        keywordCSSprevChar = c;
-        keywordCSSprevPrevChar = c;
+        setChar(keywordCSSprevChar, c);
+        setChar(keywordCSSprevPrevChar, c);
         keywordCSSStartPrev = keywordCSSStart;
         keywordCSSLengthPrev = keywordCSSLength;
     }
     if (keywordCSSStartPrev>=0 && keywordCSSLengthPrev>0) {
         // css functions
         if (c.toLatin1() == '(') {
-            highlightString(keywordCSSStartPrev, keywordCSSLengthPrev, HW->functionFormat);
+            highlightString(keywordCSSStartPrev, keywordCSSLengthPrev, FORMAT_FUNCTION);
             keywordCSSStartPrev = -1;
             keywordCSSLengthPrev = -1;
         } else if (!isWSpace) {
@@ -2290,7 +2740,7 @@ void Highlight::parseCSS(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     // css parentheses
     if (stringSQOpenedCSS < 0 && stringDQOpenedCSS < 0 && commentMLOpenedCSS < 0 && keywordCSSOpened < 0 && c.toLatin1() == '(') {
         parensCSS++;
-        if (expectedMediaNameCSS.size() > 0 && expectedMediaNameCSS == "media") {
+        if (expectedMediaNameCSS.size() > 0 && expectedMediaNameCSS == QLatin1String("media")) {
             expectedMediaParsCSS = parensCSS-1;
             expectedMediaNameCSS = "";
         }
@@ -2320,12 +2770,12 @@ void Highlight::parseCSS(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     // tabs, spaces, semicolons, commas
     if (stringSQOpenedCSS < 0 && stringDQOpenedCSS < 0 && commentMLOpenedCSS < 0 && keywordCSSOpened < 0) {
         if (highlightTabs && c.toLatin1() == '\t') {
-            highlightChar(pos, HW->tabFormat);
+            highlightChar(pos, FORMAT_TAB);
         } else if (highlightSpaces && c.toLatin1() == ' ') {
-            highlightChar(pos, HW->spaceFormat);
+            highlightChar(pos, FORMAT_SPACE);
         }
         if (!isBigFile && (c.toLatin1() == ';' || c.toLatin1() == ',' || c.toLatin1() == '{' || c.toLatin1() == '}' || c.toLatin1() == '(' || c.toLatin1() == ')' || c.toLatin1() == '[' || c.toLatin1() == ']')) {
-            highlightChar(pos, HW->punctuationFormat);
+            highlightChar(pos, FORMAT_PUNCTUATION);
         }
     }
 }
@@ -2337,19 +2787,19 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
     // js string (single quote)
     bool stringSQchangedJS = detectStringSQJS(c, pos);
     if ((stringSQOpenedJS>=0 && state == STATE_STRING_SQ_JS) || stringSQchangedJS) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // js string (double quote)
     bool stringDQchangedJS = detectStringDQJS(c, pos);
     if ((stringDQOpenedJS>=0 && state == STATE_STRING_DQ_JS) || stringDQchangedJS) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // js template
     bool exprChangedJS = detectExpressionJS(c, pos);
     if ((exprOpenedJS>=0 && state == STATE_EXPRESSION_JS) || exprChangedJS) {
-        highlightChar(pos, HW->knownFormat);
+        highlightChar(pos, FORMAT_KNOWN);
     }
 
     // js template expression
@@ -2358,13 +2808,13 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
         keywordJSScoped = false;
     } else if (exprOpenedJS >= 0 && keywordJSScopedOpened >= 0 && c.toLatin1() == '{' && !keywordJSScoped) {
         keywordJSScoped = true;
-        highlightString(keywordJSScopedOpened, pos-keywordJSScopedOpened, HW->expressionFormat);
+        highlightString(keywordJSScopedOpened, pos-keywordJSScopedOpened, FORMAT_EXPRESSION);
     } else if (exprOpenedJS >= 0 && keywordJSScopedOpened >= 0 && !isWSpace && !keywordJSScoped) {
         keywordJSScopedOpened = -1;
     } else if (exprOpenedJS >= 0 && keywordJSScopedOpened >= 0 && c.toLatin1() == '}' && keywordJSScoped) {
         keywordJSScopedOpened = -1;
         keywordJSScoped = false;
-        highlightChar(pos, HW->expressionFormat);
+        highlightChar(pos, FORMAT_EXPRESSION);
     }
     if (exprOpenedJS >= 0 && keywordJSScopedOpened < 0 && c.toLatin1() == '\\') {
         stringEscVariableJS += c;
@@ -2373,31 +2823,31 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
         stringEscVariableJS = "";
     }
     if (keywordJSScoped) {
-        highlightChar(pos, HW->expressionFormat);
+        highlightChar(pos, FORMAT_EXPRESSION);
     }
 
     // comments (single-line)
     bool commentsSLchangedJS = detectSLCommentJS(c, pos);
     if (commentSLOpenedJS>=0 || commentsSLchangedJS) {
-        highlightChar(pos, HW->singleLineCommentFormat);
+        highlightChar(pos, FORMAT_SINGLE_LINE_COMMENT);
         if (commentSLOpenedJS>=0 && commentsSLchangedJS && pos>0) {
-            highlightChar(pos-1, HW->singleLineCommentFormat);
+            highlightChar(pos-1, FORMAT_SINGLE_LINE_COMMENT);
         }
     }
 
     // js regexp
     bool regexpchangedJS = detectRegexpJS(c, pos, isWSpace, isAlnum);
     if ((regexpOpenedJS>=0 && state == STATE_REGEXP_JS)|| regexpchangedJS) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // comments (multi-line)
     if (!(regexpOpenedJS<0 && regexpchangedJS)) {
         bool commentsMLchangedJS = detectMLCommentJS(c, pos);
         if ((commentMLOpenedJS>=0 && state == STATE_COMMENT_ML_JS)|| commentsMLchangedJS) {
-            highlightChar(pos, HW->multiLineCommentFormat);
+            highlightChar(pos, FORMAT_MULTI_LINE_COMMENT);
             if (commentMLOpenedJS>=0 && state == STATE_COMMENT_ML_JS && commentsMLchangedJS && pos>0) {
-                highlightChar(pos-1, HW->multiLineCommentFormat);
+                highlightChar(pos-1, FORMAT_MULTI_LINE_COMMENT);
             }
         }
     } else {
@@ -2412,25 +2862,23 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
         if (isLast && (isAlnum || c.toLatin1() == '$')) keywordJSLength += 1;
         bool known = false;
         bool isKeyword = false;
-        if (keywordJSprevChar != "$" && (keywordJSprevChar != "." || keywordStringJS == "prototype") && keywordStringJS.size()>0) {
+        if (keywordJSprevChar != QLatin1String("$") && (keywordJSprevChar != QLatin1String(".") || keywordStringJS == QLatin1String("prototype")) && keywordStringJS.size()>0) {
             // js keywords
-            HW->jswordsCSIterator = HW->jswordsCS.find(keywordStringJS.toStdString());
-            if (HW->jswordsCSIterator != HW->jswordsCS.end()) {
-                QTextCharFormat format = HW->jswordsCSIterator->second;
-                if (keywordStringJS == "prototype" && keywordJSprevChar == ".") {
-                    highlightString(keywordJSStart, keywordJSLength, HW->keywordFormat);
+            int formatId = HW->jswordsCS.find(keywordStringJS);
+            if (formatId != FORMAT_NONE) {
+                if (keywordStringJS == QLatin1String("prototype") && keywordJSprevChar == QLatin1String(".")) {
+                    highlightString(keywordJSStart, keywordJSLength, FORMAT_KEYWORD);
                 } else {
-                    highlightString(keywordJSStart, keywordJSLength, format);
+                    highlightString(keywordJSStart, keywordJSLength, formatId);
                 }
                 keywordJSStart = -1;
                 known = true;
                 isKeyword = true;
             }
             if (!known && jsExtMode == EXTENSION_DART) {
-                HW->jsExtDartWordsCSIterator = HW->jsExtDartWordsCS.find(keywordStringJS.toStdString());
-                if (HW->jsExtDartWordsCSIterator != HW->jsExtDartWordsCS.end()) {
-                    QTextCharFormat format = HW->jsExtDartWordsCSIterator->second;
-                    highlightString(keywordJSStart, keywordJSLength, format);
+                formatId = HW->jsExtDartWordsCS.find(keywordStringJS);
+                if (formatId != FORMAT_NONE) {
+                    highlightString(keywordJSStart, keywordJSLength, formatId);
                     keywordJSStart = -1;
                     known = true;
                     isKeyword = true;
@@ -2439,55 +2887,55 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
             if (!known && c.toLatin1() != ':' && c.toLatin1() != '.' && !isBigFile) {
                 jsNamesIterator = jsNames.find(keywordStringJS.toStdString());
                 if (jsNamesIterator != jsNames.end()) {
-                    highlightString(keywordJSStart, keywordJSLength, HW->variableFormat);
+                    highlightString(keywordJSStart, keywordJSLength, FORMAT_VARIABLE);
                     known = true;
                 }
             }
         }
         if (!known && !isBigFile) {
-            if ((keywordJSprevString == "var" || keywordJSprevString == "let" || keywordJSprevString == "const") && keywordJSprevStringPrevChar != ".") {
+            if ((keywordJSprevString == QLatin1String("var") || keywordJSprevString == QLatin1String("let") || keywordJSprevString == QLatin1String("const")) && keywordJSprevStringPrevChar != QLatin1String(".")) {
                 if (varsChainJS.size() > 0) varsChainJS += ",";
                 varsChainJS += keywordStringJS;
                 jsNames[keywordStringJS.toStdString()] = keywordStringJS.toStdString();
-                highlightString(keywordJSStart, keywordJSLength, HW->variableFormat);
-            } else if (keywordJSprevChar != "." && c.toLatin1() == '.') {
-                highlightString(keywordJSStart, keywordJSLength, HW->classFormat);
-            } else if (keywordJSprevChar == ".") {
-                highlightString(keywordJSStart, keywordJSLength, HW->propertyFormat);
-            } else if (keywordJSprevChar != "." && c.toLatin1() == ':') {
-                highlightString(keywordJSStart, keywordJSLength, HW->propertyFormat);
-            } else if (keywordJSprevChar == "@") {
-                highlightString(keywordJSStart, keywordJSLength, HW->punctuationFormat);
-            } else if (keywordJSprevChar == "<" && c.toLatin1() == '>') {
-                highlightString(keywordJSStart, keywordJSLength, HW->classFormat);
-            } else if (keywordJSprevString == "class" || keywordJSprevString == "extends" || keywordJSprevString == "with") {
-                highlightString(keywordJSStart, keywordJSLength, HW->classFormat);
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_VARIABLE);
+            } else if (keywordJSprevChar != QLatin1String(".") && c.toLatin1() == '.') {
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_CLASS);
+            } else if (keywordJSprevChar == QLatin1String(".")) {
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_PROPERTY);
+            } else if (keywordJSprevChar != QLatin1String(".") && c.toLatin1() == ':') {
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_PROPERTY);
+            } else if (keywordJSprevChar == QLatin1String("@")) {
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_PUNCTUATION);
+            } else if (keywordJSprevChar == QLatin1String("<") && c.toLatin1() == '>') {
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_CLASS);
+            } else if (keywordJSprevString == QLatin1String("class") || keywordJSprevString == QLatin1String("extends") || keywordJSprevString == QLatin1String("with")) {
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_CLASS);
             } else if (expectedFuncNameJS.size() > 0 || expectedFuncParsJS >= 0) { // add arg if var is unknown
                 expectedFuncArgsJS.append(keywordStringJS);
-                highlightString(keywordJSStart, keywordJSLength, HW->variableFormat);
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_VARIABLE);
             } else if (isExpectJSVarChar || (isLast && (isAlnum || c.toLatin1() == '$'))) {
-                highlightString(keywordJSStart, keywordJSLength, HW->variableFormat);
+                highlightString(keywordJSStart, keywordJSLength, FORMAT_VARIABLE);
             } else if (!expectJSVar && (c.isSpace() || isLast)) {
                 expectJSVar = true;
             }
         }
         //if (keywordJSStartPrev>=0 && keywordJSLengthPrev>0) {
         if (prevIsKeyword && !isBigFile) {
-            highlightString(keywordJSStartPrev, keywordJSLengthPrev, HW->classFormat);
+            highlightString(keywordJSStartPrev, keywordJSLengthPrev, FORMAT_CLASS);
             expectVarInit = true;
         }
         if (keywordStringJS.size()>0 && !isBigFile) {
             // class scope
-            if (keywordStringJS.size() > 0 && (((keywordStringJS.toLower() == "class" || keywordStringJS.toLower() == "interface") && expectedClsNameJS.size() == 0) || expectedClsNameJS.toLower() == "class" || expectedClsNameJS.toLower() == "interface")) {
+            if (keywordStringJS.size() > 0 && (((keywordStringJS.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0 || keywordStringJS.compare(QLatin1String("interface"), Qt::CaseInsensitive) == 0) && expectedClsNameJS.size() == 0) || expectedClsNameJS.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0 || expectedClsNameJS.compare(QLatin1String("interface"), Qt::CaseInsensitive) == 0)) {
                 expectedClsNameJS = keywordStringJS;
             }
             // function scope
-            if (expectedFuncNameJS.size() == 0 && keywordStringJS.size() > 0 && keywordStringJS != "function" && !isKeyword) {
+            if (expectedFuncNameJS.size() == 0 && keywordStringJS.size() > 0 && keywordStringJS != QLatin1String("function") && !isKeyword) {
                 expectedFuncNameJS = "";
                 expectedFuncVarJS = keywordStringJS;
                 expectedFuncParsJS = -1;
                 expectedFuncArgsJS.clear();
-            } else if (expectedFuncNameJS.size() == 0 && expectedFuncVarJS.size() > 0 && keywordStringJS == "function" && expectedFuncVarJS.indexOf("=") > 0) {
+            } else if (expectedFuncNameJS.size() == 0 && expectedFuncVarJS.size() > 0 && keywordStringJS == QLatin1String("function") && expectedFuncVarJS.indexOf("=") > 0) {
                 QStringList expectedFuncNameJSList = expectedFuncVarJS.split("=");
                 if (expectedFuncNameJSList.size() == 2 && expectedFuncNameJSList.at(1) == "function") {
                     expectedFuncNameJS = expectedFuncNameJSList.at(0);
@@ -2499,7 +2947,7 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
                     expectedFuncParsJS = -1;
                 }
                 expectedFuncArgsJS.clear();
-            } else if (keywordStringJS.size() > 0 && (keywordStringJS == "function" || expectedFuncNameJS == "function")) {
+            } else if (keywordStringJS.size() > 0 && (keywordStringJS == QLatin1String("function") || expectedFuncNameJS == QLatin1String("function"))) {
                 expectedFuncNameJS = keywordStringJS;
                 expectedFuncVarJS = "";
                 expectedFuncParsJS = parensJS;
@@ -2508,21 +2956,21 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
                 expectedFuncVarJS = "";
             }
         }
-        if (keywordJSprevChar != "." && keywordJSprevChar != "@") {
+        if (keywordJSprevChar != QLatin1String(".") && keywordJSprevChar != QLatin1String("@")) {
             prevIsKeyword = true;
         }
-        keywordJSprevString = keywordStringJS;
-        keywordJSprevStringPrevChar = keywordJSprevChar;
-        keywordJSprevChar = c;
+        copyWord(keywordJSprevString, keywordStringJS);
+        copyWord(keywordJSprevStringPrevChar, keywordJSprevChar);
+        setChar(keywordJSprevChar, c);
         keywordJSStartPrev = keywordJSStart;
         keywordJSLengthPrev = keywordJSLength;
     }
     if (keywordJSStartPrev>=0 && keywordJSLengthPrev>0) {
         // js functions, variables, classes
         if (c.toLatin1() == '(') {
-            highlightString(keywordJSStartPrev, keywordJSLengthPrev, HW->functionFormat);
+            highlightString(keywordJSStartPrev, keywordJSLengthPrev, FORMAT_FUNCTION);
         } else if (expectJSVar && (isExpectJSVarChar || (isLast && isWSpace))) {
-            highlightString(keywordJSStartPrev, keywordJSLengthPrev, HW->variableFormat);
+            highlightString(keywordJSStartPrev, keywordJSLengthPrev, FORMAT_VARIABLE);
         }
         if (!isWSpace) {
             if (!isAlnum && c.toLatin1() != '$') {
@@ -2533,7 +2981,7 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
         }
     }
     if (expectVarInit) {
-        if (c.toLatin1() == '=' && keywordStringJS.size() > 0 && keywordJSprevChar != ".") {
+        if (c.toLatin1() == '=' && keywordStringJS.size() > 0 && keywordJSprevChar != QLatin1String(".")) {
             if (varsChainJS.size() > 0) varsChainJS += ",";
             varsChainJS += keywordStringJS;
             jsNames[keywordStringJS.toStdString()] = keywordStringJS.toStdString();
@@ -2554,7 +3002,7 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
             QString cClsNameJS = clsNameJS;
             int cClsScopeJS = clsScopeJS;
             if (clsScopeJS < 0) cClsNameJS = "";
-            if (expectedClsNameJS == "class" || expectedClsNameJS == "implements" || expectedClsNameJS == "extends") expectedClsNameJS = "anonymous class";
+            if (expectedClsNameJS == QLatin1String("class") || expectedClsNameJS == QLatin1String("implements") || expectedClsNameJS == QLatin1String("extends")) expectedClsNameJS = "anonymous class";
             if (clsStartsJS.size() > clsEndsJS.size()) clsEndsJS.append(pos);
             clsNameJS = expectedClsNameJS;
             clsScopeJS = bracesJS-1;
@@ -2658,18 +3106,18 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
         }
     }
 
-    if (expectedFuncNameJS.size() > 0 && expectedFuncNameJS == "function" && c.toLatin1() == '(' && expectedFuncParsJS == parensJS) {
+    if (expectedFuncNameJS.size() > 0 && expectedFuncNameJS == QLatin1String("function") && c.toLatin1() == '(' && expectedFuncParsJS == parensJS) {
         expectedFuncNameJS = "anonymous function";
     }
 
     // unexpected class scope
-    if (expectedClsNameJS.size() > 0 && expectedClsNameJS.toLower() == "class" && c.toLatin1() == '(') {
+    if (expectedClsNameJS.size() > 0 && expectedClsNameJS.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0 && c.toLatin1() == '(') {
         expectedClsNameJS = "anonymous class";
     } else if (expectedClsNameJS.size() > 0 && c.toLatin1() == ';') {
         expectedClsNameJS = "";
     }
     // unexpected function scope
-    if (expectedFuncNameJS.size() > 0 && expectedFuncNameJS != "function" && (c.toLatin1() == ';' || c.toLatin1() == ')' || c.toLatin1() == '}' || c.toLatin1() == ']' || c.toLatin1() == ',' || c.toLatin1() == ':' || c.toLatin1() == '=' || c.toLatin1() == '+' || c.toLatin1() == '-' || c.toLatin1() == '*' || c.toLatin1() == '/' || c.toLatin1() == '%' || c.toLatin1() == '&' || c.toLatin1() == '|' || c.toLatin1() == '?') && expectedFuncParsJS == parensJS) {
+    if (expectedFuncNameJS.size() > 0 && expectedFuncNameJS != QLatin1String("function") && (c.toLatin1() == ';' || c.toLatin1() == ')' || c.toLatin1() == '}' || c.toLatin1() == ']' || c.toLatin1() == ',' || c.toLatin1() == ':' || c.toLatin1() == '=' || c.toLatin1() == '+' || c.toLatin1() == '-' || c.toLatin1() == '*' || c.toLatin1() == '/' || c.toLatin1() == '%' || c.toLatin1() == '&' || c.toLatin1() == '|' || c.toLatin1() == '?') && expectedFuncParsJS == parensJS) {
         expectedFuncNameJS = "";
         expectedFuncParsJS = -1;
         expectedFuncArgsJS.clear();
@@ -2703,12 +3151,12 @@ void Highlight::parseJS(const QChar & c, int pos, bool isAlpha, bool isAlnum, bo
     // tabs, spaces, semicolons, commas
     if (stringSQOpenedJS < 0 && stringDQOpenedJS < 0 && commentSLOpenedJS < 0 && commentMLOpenedJS < 0 && regexpOpenedJS < 0 && keywordJSOpened < 0) {
         if (highlightTabs && c.toLatin1() == '\t') {
-            highlightChar(pos, HW->tabFormat);
+            highlightChar(pos, FORMAT_TAB);
         } else if (highlightSpaces && c.toLatin1() == ' ') {
-            highlightChar(pos, HW->spaceFormat);
+            highlightChar(pos, FORMAT_SPACE);
         }
         if (!isBigFile && (c.toLatin1() == ';' || c.toLatin1() == ',' || c.toLatin1() == '{' || c.toLatin1() == '}' || c.toLatin1() == '(' || c.toLatin1() == ')' || c.toLatin1() == '[' || c.toLatin1() == ']' || c.toLatin1() == '@')) {
-            highlightChar(pos, HW->punctuationFormat);
+            highlightChar(pos, FORMAT_PUNCTUATION);
         }
     }
 
@@ -2752,45 +3200,45 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     // php string (single quote)
     bool stringSQchangedPHP = detectStringSQPHP(c, pos);
     if ((stringSQOpenedPHP>=0 && state == STATE_STRING_SQ_PHP) || stringSQchangedPHP) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // php string (double quote)
     bool stringDQchangedPHP = detectStringDQPHP(c, pos);
     if ((stringDQOpenedPHP>=0 && state == STATE_STRING_DQ_PHP)|| stringDQchangedPHP) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // php shell expression
     bool exprChangedPHP = detectExpressionPHP(c, pos);
     if ((exprOpenedPHP>=0 && state == STATE_EXPRESSION_PHP)|| exprChangedPHP) {
-        highlightChar(pos, HW->expressionFormat);
+        highlightChar(pos, FORMAT_EXPRESSION);
     }
 
     // comments (single-line)
     bool commentsSLchangedPHP = detectSLCommentPHP(c, pos);
     if (commentSLOpenedPHP>=0 || commentsSLchangedPHP) {
-        highlightChar(pos, HW->singleLineCommentFormat);
+        highlightChar(pos, FORMAT_SINGLE_LINE_COMMENT);
         if (commentSLOpenedPHP>=0 && commentsSLchangedPHP && pos>0 && c.toLatin1() != '#') {
-            highlightChar(pos-1, HW->singleLineCommentFormat);
+            highlightChar(pos-1, FORMAT_SINGLE_LINE_COMMENT);
         }
     }
 
     // comments (multi-line)
     bool commentsMLchangedPHP = detectMLCommentPHP(c, pos);
     if ((commentMLOpenedPHP>=0 && state == STATE_COMMENT_ML_PHP)|| commentsMLchangedPHP) {
-        highlightChar(pos, HW->multiLineCommentFormat);
+        highlightChar(pos, FORMAT_MULTI_LINE_COMMENT);
         if (commentMLOpenedPHP>=0 && state == STATE_COMMENT_ML_PHP && commentsMLchangedPHP && pos>0) {
-            highlightChar(pos-1, HW->multiLineCommentFormat);
+            highlightChar(pos-1, FORMAT_MULTI_LINE_COMMENT);
         }
     }
 
     // heredoc
     detectStringBPHP(c, pos, isAlpha, isAlnum, isLast);
     if (stringBOpened>=0 && stringBStart>=0) {
-        highlightString(stringBStart, pos-stringBStart+1, HW->stringFormat);
+        highlightString(stringBStart, pos-stringBStart+1, FORMAT_STRING);
     } else if (stringBOpened>=0) {
-        highlightChar(pos, HW->stringFormat);
+        highlightChar(pos, FORMAT_STRING);
     }
 
     // dq-string variables
@@ -2799,16 +3247,16 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
         keywordPHPScoped = false;
     } else if ((stringDQOpenedPHP >= 0 || (stringBOpened >= 0 && state == STATE_STRING_HEREDOC)) && keywordPHPScopedOpened >= 0 && c.toLatin1() == '$' && !keywordPHPScoped) {
         keywordPHPScoped = true;
-        highlightString(keywordPHPScopedOpened, pos-keywordPHPScopedOpened, HW->expressionFormat);
+        highlightString(keywordPHPScopedOpened, pos-keywordPHPScopedOpened, FORMAT_EXPRESSION);
     } else if ((stringDQOpenedPHP >= 0 || (stringBOpened >= 0 && state == STATE_STRING_HEREDOC)) && keywordPHPScopedOpened >= 0 && !isWSpace && !keywordPHPScoped) {
         keywordPHPScopedOpened = -1;
     } else if ((stringDQOpenedPHP >= 0 || (stringBOpened >= 0 && state == STATE_STRING_HEREDOC)) && keywordPHPScopedOpened >= 0 && c.toLatin1() == '}' && keywordPHPScoped) {
         keywordPHPScopedOpened = -1;
         keywordPHPScoped = false;
-        highlightChar(pos, HW->expressionFormat);
+        highlightChar(pos, FORMAT_EXPRESSION);
     }
     bool forceDetectKeyword = false;
-    if ((stringDQOpenedPHP >= 0 || (stringBOpened >= 0 && state == STATE_STRING_HEREDOC)) && keywordPHPprevChar == "$" && stringEscVariablePHP.size()%2 == 0) {
+    if ((stringDQOpenedPHP >= 0 || (stringBOpened >= 0 && state == STATE_STRING_HEREDOC)) && keywordPHPprevChar == QLatin1String("$") && stringEscVariablePHP.size()%2 == 0) {
         forceDetectKeyword = true;
     }
     if ((stringDQOpenedPHP >= 0 || (stringBOpened >= 0 && state == STATE_STRING_HEREDOC)) && keywordPHPScopedOpened < 0 && c.toLatin1() == '\\') {
@@ -2817,7 +3265,7 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
         stringEscVariablePHP = "";
     }
     if (keywordPHPScoped) {
-        highlightChar(pos, HW->expressionFormat);
+        highlightChar(pos, FORMAT_EXPRESSION);
     }
 
     // keywords & variables & functions
@@ -2825,34 +3273,31 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     if (keywordPHPStart>=0) {
         int keywordPHPLength = pos-keywordPHPStart;
         if (isLast && isAlnum) keywordPHPLength += 1;
-        bool isObjectContext = keywordPHPprevPrevChar == "-" && keywordPHPprevChar == ">";
-        if (keywordPHPprevChar != "$" && !isObjectContext && keywordPHPprevChar != ":" && keywordStringPHP.size()>1 && keywordPHPprevString.toLower() != "const" && keywordPHPprevString.toLower() != "function") {
+        bool isObjectContext = keywordPHPprevPrevChar == QLatin1String("-") && keywordPHPprevChar == QLatin1String(">");
+        if (keywordPHPprevChar != QLatin1String("$") && !isObjectContext && keywordPHPprevChar != QLatin1String(":") && keywordStringPHP.size()>1 && keywordPHPprevString.compare(QLatin1String("const"), Qt::CaseInsensitive) != 0 && keywordPHPprevString.compare(QLatin1String("function"), Qt::CaseInsensitive) != 0) {
             // php keywords
-            HW->phpwordsIterator = HW->phpwords.find(keywordStringPHP.toLower().toStdString());
-            if (HW->phpwordsIterator != HW->phpwords.end()) {
-                QTextCharFormat format = HW->phpwordsIterator->second;
-                highlightString(keywordPHPStart, keywordPHPLength, format);
+            int formatId = HW->phpwords.find(keywordStringPHP);
+            if (formatId != FORMAT_NONE) {
+                highlightString(keywordPHPStart, keywordPHPLength, formatId);
                 keywordPHPStart = -1;
             } else {
-                HW->phpwordsCSIterator = HW->phpwordsCS.find(keywordStringPHP.toStdString());
-                if (HW->phpwordsCSIterator != HW->phpwordsCS.end()) {
-                    QTextCharFormat format = HW->phpwordsCSIterator->second;
-                    highlightString(keywordPHPStart, keywordPHPLength, format);
+                formatId = HW->phpwordsCS.find(keywordStringPHP);
+                if (formatId != FORMAT_NONE) {
+                    highlightString(keywordPHPStart, keywordPHPLength, formatId);
                     keywordPHPStart = -1;
                 }
             }
-            if (keywordStringPHP == "global" && funcNamePHP.size() > 0) {
+            if (keywordStringPHP == QLatin1String("global") && funcNamePHP.size() > 0) {
                 isGlobalPHP = true;
             }
-        } else if ((keywordPHPprevChar == "$" || isObjectContext) && !isBigFile) {
+        } else if ((keywordPHPprevChar == QLatin1String("$") || isObjectContext) && !isBigFile) {
             // php variables
             bool known = false;
-            if (keywordPHPprevChar == "$" && keywordPHPStart > 0) {
+            if (keywordPHPprevChar == QLatin1String("$") && keywordPHPStart > 0) {
                 keywordPHPStart -= 1;
                 keywordPHPLength += 1;
                 QString varName = keywordPHPprevChar + keywordStringPHP;
-                HW->phpwordsCSIterator = HW->phpwordsCS.find(varName.toStdString());
-                if (HW->phpwordsCSIterator != HW->phpwordsCS.end()) {
+                if (HW->phpwordsCS.contains(varName)) {
                     known = true;
                 } else if (varName == "$this" && clsNamePHP.size() > 0) {
                     known = true;
@@ -2860,7 +3305,7 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
                     expectedFuncArgsPHP.append(varName);
                     expectedFuncArgsPHPPositions.append(keywordPHPStart);
                     expectedFuncArgsPHPBlocks.append(cBlock.blockNumber());
-                } else if (keywordPHPprevPrevChar != ":" || keywordPHPprevStringPrevChar == "$") {
+                } else if (keywordPHPprevPrevChar != QLatin1String(":") || keywordPHPprevStringPrevChar == QLatin1String("$")) {
                     QString ns = "\\";
                     if (nsNamePHP.size() > 0) ns += nsNamePHP + "\\";
                     QString _clsName = clsNamePHP.size() > 0 ? ns + clsNamePHP : "";
@@ -2870,19 +3315,16 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
                         variables[varName.toStdString()] = varName.toStdString();
                         if (varsChainPHP.size() > 0) varsChainPHP += ",";
                         varsChainPHP += varName;
-                        // save to known vars
-                        if (highlightVarsMode || firstRunMode) {
-                            knownVars[k.toStdString()] = varsChainPHP.toStdString();
-                            QString kk = k + "::" + varName;
-                            knownVarsPositions[kk.toStdString()] = keywordPHPStart;
-                            knownVarsBlocks[kk.toStdString()] = cBlock.blockNumber();
-                        }
+                        // save to block symbols
+                        varsKeysPHP.append(k);
+                        varsNamesPHP.append(varName);
+                        varsPositionsPHP.append(keywordPHPStart);
+                        varsBlockOffsetsPHP.append(0);
                         if (isGlobalPHP) {
                             if (usedVarsGlobChainPHP.size() > 0) usedVarsGlobChainPHP += ",";
                             usedVarsGlobChainPHP += varName;
-                            if (highlightVarsMode || firstRunMode) {
-                                usedVars["::"] = usedVarsGlobChainPHP.toStdString();
-                            }
+                            usedVarsKeysPHP.append("::");
+                            usedVarsNamesPHP.append(varName);
                         }
                     } else {
                         known = true;
@@ -2891,12 +3333,11 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
                             usedVariables[varName.toStdString()] = varName.toStdString();
                             if (usedVarsChainPHP.size() > 0) usedVarsChainPHP += ",";
                             usedVarsChainPHP += varName;
+                            usedVarsKeysPHP.append(k);
+                            usedVarsNamesPHP.append(varName);
                         }
                     }
-                    if (highlightVarsMode || firstRunMode) {
-                        usedVars[k.toStdString()] = usedVarsChainPHP.toStdString();
-                    }
-                } else if ((keywordPHPprevString.toLower() == "self" || keywordPHPprevString.toLower() == "static") && keywordPHPprevStringPrevChar != "$") {
+                } else if ((keywordPHPprevString.compare(QLatin1String("self"), Qt::CaseInsensitive) == 0 || keywordPHPprevString.compare(QLatin1String("static"), Qt::CaseInsensitive) == 0) && keywordPHPprevStringPrevChar != QLatin1String("$")) {
                     clsPropsIterator = clsProps.find(varName.toStdString());
                     if (clsPropsIterator != clsProps.end()) {
                         known = true;
@@ -2905,7 +3346,7 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
             }
             if (isObjectContext) {
                 QString varName = "$" + keywordStringPHP;
-                if (keywordPHPprevString.toLower() == "this" && keywordPHPprevStringPrevChar == "$") {
+                if (keywordPHPprevString.compare(QLatin1String("this"), Qt::CaseInsensitive) == 0 && keywordPHPprevStringPrevChar == QLatin1String("$")) {
                     clsPropsIterator = clsProps.find(varName.toStdString());
                     if (clsPropsIterator != clsProps.end()) {
                         known = true;
@@ -2914,7 +3355,7 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
             }
             if (!known) {
                 bool unused = false;
-                if (keywordPHPprevChar == "$" && ((keywordPHPprevString.toLower() != "self" && keywordPHPprevString.toLower() != "static") || keywordPHPprevStringPrevChar == "$")) {
+                if (keywordPHPprevChar == QLatin1String("$") && ((keywordPHPprevString.compare(QLatin1String("self"), Qt::CaseInsensitive) != 0 && keywordPHPprevString.compare(QLatin1String("static"), Qt::CaseInsensitive) != 0) || keywordPHPprevStringPrevChar == QLatin1String("$"))) {
                     QString ns = "\\";
                     if (nsNamePHP.size() > 0) ns += nsNamePHP + "\\";
                     QString _clsName = clsNamePHP.size() > 0 ? ns + clsNamePHP : "";
@@ -2931,30 +3372,34 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
                         }
                     }
                 }
-                if (unused) highlightString(keywordPHPStart, keywordPHPLength, HW->unusedVariableFormat);
-                else highlightString(keywordPHPStart, keywordPHPLength, HW->variableFormat);
+                if (unused) highlightString(keywordPHPStart, keywordPHPLength, FORMAT_UNUSED_VARIABLE);
+                else highlightString(keywordPHPStart, keywordPHPLength, FORMAT_VARIABLE);
             } else {
-                highlightString(keywordPHPStart, keywordPHPLength, HW->knownVariableFormat);
+                highlightString(keywordPHPStart, keywordPHPLength, FORMAT_KNOWN_VARIABLE);
             }
-        } else if (keywordPHPprevChar == ":" && keywordPHPprevString.size() > 0 && !isBigFile) {
-            QString k = keywordPHPprevString.toLower()+"::"+keywordStringPHP;
-            HW->phpClassWordsCSIterator = HW->phpClassWordsCS.find(k.toStdString());
-            if (HW->phpClassWordsCSIterator != HW->phpClassWordsCS.end()) {
-                QTextCharFormat format = HW->phpClassWordsCSIterator->second;
-                highlightString(keywordPHPStart, keywordPHPLength, format);
+        } else if (keywordPHPprevChar == QLatin1String(":") && keywordPHPprevString.size() > 0 && !isBigFile) {
+            classWordKeyPHP.resize(keywordPHPprevString.size());
+            for (int i=0; i<keywordPHPprevString.size(); i++) {
+                classWordKeyPHP.data()[i] = keywordPHPprevString.at(i).toLower();
+            }
+            classWordKeyPHP += QLatin1String("::");
+            classWordKeyPHP += keywordStringPHP;
+            int formatId = HW->phpClassWordsCS.find(classWordKeyPHP);
+            if (formatId != FORMAT_NONE) {
+                highlightString(keywordPHPStart, keywordPHPLength, formatId);
             }
         }
-        if (keywordPHPprevChar != "$" && !isObjectContext && keywordStringPHP.size()>0 && !isBigFile) {
+        if (keywordPHPprevChar != QLatin1String("$") && !isObjectContext && keywordStringPHP.size()>0 && !isBigFile) {
             // namespace scope
-            if (keywordStringPHP.size() > 0 && (keywordStringPHP.toLower() == "namespace" && expectedNsNamePHP.size() == 0)) {
+            if (keywordStringPHP.size() > 0 && (keywordStringPHP.compare(QLatin1String("namespace"), Qt::CaseInsensitive) == 0 && expectedNsNamePHP.size() == 0)) {
                 expectedNsNamePHP = "\\";
             }
             // class scope
-            if (keywordStringPHP.size() > 0 && (((keywordStringPHP.toLower() == "class" || keywordStringPHP.toLower() == "interface" || keywordStringPHP.toLower() == "trait") && expectedClsNamePHP.size() == 0) || expectedClsNamePHP.toLower() == "class" || expectedClsNamePHP.toLower() == "interface" || expectedClsNamePHP.toLower() == "trait")) {
+            if (keywordStringPHP.size() > 0 && (((keywordStringPHP.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0 || keywordStringPHP.compare(QLatin1String("interface"), Qt::CaseInsensitive) == 0 || keywordStringPHP.compare(QLatin1String("trait"), Qt::CaseInsensitive) == 0) && expectedClsNamePHP.size() == 0) || expectedClsNamePHP.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0 || expectedClsNamePHP.compare(QLatin1String("interface"), Qt::CaseInsensitive) == 0 || expectedClsNamePHP.compare(QLatin1String("trait"), Qt::CaseInsensitive) == 0)) {
                 expectedClsNamePHP = keywordStringPHP;
             }
             // function scope
-            if (keywordStringPHP.size() > 0 && ((keywordStringPHP.toLower() == "function" && expectedFuncNamePHP.size() == 0) || expectedFuncNamePHP.toLower() == "function")) {
+            if (keywordStringPHP.size() > 0 && ((keywordStringPHP.compare(QLatin1String("function"), Qt::CaseInsensitive) == 0 && expectedFuncNamePHP.size() == 0) || expectedFuncNamePHP.compare(QLatin1String("function"), Qt::CaseInsensitive) == 0)) {
                 expectedFuncNamePHP = keywordStringPHP;
                 expectedFuncParsPHP = parensPHP;
                 expectedFuncArgsPHP.clear();
@@ -2962,10 +3407,10 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
                 expectedFuncArgsPHPBlocks.clear();
             }
         }
-        keywordPHPprevString = keywordStringPHP;
-        keywordPHPprevStringPrevChar = keywordPHPprevChar;
-        keywordPHPprevPrevChar = c;
-        keywordPHPprevChar = c;
+        copyWord(keywordPHPprevString, keywordStringPHP);
+        copyWord(keywordPHPprevStringPrevChar, keywordPHPprevChar);
+        setChar(keywordPHPprevPrevChar, c);
+        setChar(keywordPHPprevChar, c);
         keywordPHPStartPrev = keywordPHPStart;
         keywordPHPLengthPrev = keywordPHPLength;
     }
@@ -2977,7 +3422,7 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     if (keywordPHPStartPrev>=0 && keywordPHPLengthPrev>0) {
         // php functions
         if (c.toLatin1() == '(') {
-            highlightString(keywordPHPStartPrev, keywordPHPLengthPrev, HW->functionFormat);
+            highlightString(keywordPHPStartPrev, keywordPHPLengthPrev, FORMAT_FUNCTION);
             keywordPHPStartPrev = -1;
             keywordPHPLengthPrev = -1;
         } else if (!isWSpace) {
@@ -3015,7 +3460,7 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
             QString cClsNamePHP = clsNamePHP;
             int cClsScopePHP = clsScopePHP;
             if (clsScopePHP < 0) cClsNamePHP = "";
-            if (expectedClsNamePHP == "class" || expectedClsNamePHP == "implements" || expectedClsNamePHP == "extends") expectedClsNamePHP = "anonymous class";
+            if (expectedClsNamePHP == QLatin1String("class") || expectedClsNamePHP == QLatin1String("implements") || expectedClsNamePHP == QLatin1String("extends")) expectedClsNamePHP = "anonymous class";
             if (clsStartsPHP.size() > clsEndsPHP.size()) clsEndsPHP.append(pos);
             clsNamePHP = expectedClsNamePHP;
             clsScopePHP = bracesPHP-1;
@@ -3099,22 +3544,19 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
                 if (nsNamePHP.size() > 0) ns += nsNamePHP + "\\";
                 QString _clsName = clsNamePHP.size() > 0 ? ns + clsNamePHP : "";
                 QString k = _clsName + "::" + funcNamePHP;
-                // save to known vars
-                if (highlightVarsMode || firstRunMode) {
-                    knownVars[k.toStdString()] = varsChainPHP.toStdString();
-                    QString kk = k + "::" + varName;
-                    int eP = -1;
-                    if (expectedFuncArgsPHPPositions.size() == expectedFuncArgsPHP.size()) {
-                        eP = expectedFuncArgsPHPPositions.at(i);
-                    }
-                    knownVarsPositions[kk.toStdString()] = eP;
-                    int eB = -1;
-                    if (expectedFuncArgsPHPBlocks.size() == expectedFuncArgsPHP.size()) {
-                        eB = expectedFuncArgsPHPBlocks.at(i);
-                    }
-                    knownVarsBlocks[kk.toStdString()] = eB;
-                    usedVars[k.toStdString()] = usedVarsChainPHP.toStdString();
+                // save to block symbols, arguments can be declared in previous blocks
+                int eP = -1;
+                if (expectedFuncArgsPHPPositions.size() == expectedFuncArgsPHP.size()) {
+                    eP = expectedFuncArgsPHPPositions.at(i);
+                }
+                int eB = -1;
+                if (expectedFuncArgsPHPBlocks.size() == expectedFuncArgsPHP.size()) {
+                    eB = expectedFuncArgsPHPBlocks.at(i);
                 }
+                varsKeysPHP.append(k);
+                varsNamesPHP.append(varName);
+                varsPositionsPHP.append(eB >= 0 ? eP : -1);
+                varsBlockOffsetsPHP.append(eB >= 0 ? eB - cBlock.blockNumber() : 0);
             }
             expectedFuncArgsPHP.clear();
             expectedFuncArgsPHPPositions.clear();
@@ -3334,13 +3776,13 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
         expectedNsNamePHP = "";
     }
     // unexpected class scope
-    if (expectedClsNamePHP.size() > 0 && expectedClsNamePHP.toLower() == "class" && c.toLatin1() == '(') {
+    if (expectedClsNamePHP.size() > 0 && expectedClsNamePHP.compare(QLatin1String("class"), Qt::CaseInsensitive) == 0 && c.toLatin1() == '(') {
         expectedClsNamePHP = "anonymous class";
     } else if (expectedClsNamePHP.size() > 0 && c.toLatin1() == ';') {
         expectedClsNamePHP = "";
     }
     // unexpected function scope
-    if (expectedFuncNamePHP.size() > 0 && expectedFuncNamePHP.toLower() == "function" && c.toLatin1() == '(' && expectedFuncParsPHP == parensPHP) {
+    if (expectedFuncNamePHP.size() > 0 && expectedFuncNamePHP.compare(QLatin1String("function"), Qt::CaseInsensitive) == 0 && c.toLatin1() == '(' && expectedFuncParsPHP == parensPHP) {
         expectedFuncNamePHP = "anonymous function";
     } else if (expectedFuncNamePHP.size() > 0 && c.toLatin1() == ';' && expectedFuncParsPHP == parensPHP) {
         expectedFuncNamePHP = "";
@@ -3365,12 +3807,12 @@ void Highlight::parsePHP(const QChar & c, int pos, bool isAlpha, bool isAlnum, b
     // tabs, spaces, semicolons, commas
     if (stringSQOpenedPHP < 0 && stringDQOpenedPHP < 0 && stringBOpened < 0 && commentSLOpenedPHP < 0 && commentMLOpenedPHP < 0 && keywordPHPOpened < 0) {
         if (highlightTabs && c.toLatin1() == '\t') {
-            highlightChar(pos, HW->tabFormat);
+            highlightChar(pos, FORMAT_TAB);
         } else if (highlightSpaces && c.toLatin1() == ' ') {
-            highlightChar(pos, HW->spaceFormat);
+            highlightChar(pos, FORMAT_SPACE);
         }
         if (!isBigFile && (c.toLatin1() == ';' || c.toLatin1() == ',' || c.toLatin1() == '{' || c.toLatin1() == '}' || c.toLatin1() == '(' || c.toLatin1() == ')' || c.toLatin1() == '[' || c.toLatin1() == ']' || c.toLatin1() == '\\' || c.toLatin1() == '@')) {
-            highlightChar(pos, HW->punctuationFormat);
+            highlightChar(pos, FORMAT_PUNCTUATION);
         }
     }
 
@@ -3421,30 +3863,30 @@ void Highlight::parseUnknown(const QChar &c, int pos, bool isAlpha, bool isAlnum
         // string (single quote)
         stringSQchangedUnknown = detectStringSQUnknown(c, pos);
         if ((stringSQOpenedUnknown>=0 && state == STATE_STRING_SQ_UNKNOWN) || stringSQchangedUnknown) {
-            highlightChar(pos, HW->stringFormat);
+            highlightChar(pos, FORMAT_STRING);
         }
 
         // string (double quote)
         stringDQchangedUnknown = detectStringDQUnknown(c, pos);
         if ((stringDQOpenedUnknown>=0 && state == STATE_STRING_DQ_UNKNOWN)|| stringDQchangedUnknown) {
-            highlightChar(pos, HW->stringFormat);
+            highlightChar(pos, FORMAT_STRING);
         }
 
         // comments (single-line)
         commentsSLchangedUnknown = detectSLCommentUnknown(c, pos);
         if (commentSLOpenedUnknown>=0 || commentsSLchangedUnknown) {
-            highlightChar(pos, HW->singleLineCommentFormat);
+            highlightChar(pos, FORMAT_SINGLE_LINE_COMMENT);
             if (commentSLOpenedUnknown>=0 && commentsSLchangedUnknown && pos>0 && c.toLatin1() != '#' && c.toLatin1() != ';') {
-                highlightChar(pos-1, HW->singleLineCommentFormat);
+                highlightChar(pos-1, FORMAT_SINGLE_LINE_COMMENT);
             }
         }
 
         // comments (multi-line)
         commentsMLchangedUnknown = detectMLCommentUnknown(c, pos);
         if ((commentMLOpenedUnknown>=0 && state == STATE_COMMENT_ML_UNKNOWN)|| commentsMLchangedUnknown) {
-            highlightChar(pos, HW->multiLineCommentFormat);
+            highlightChar(pos, FORMAT_MULTI_LINE_COMMENT);
             if (commentMLOpenedUnknown>=0 && state == STATE_COMMENT_ML_UNKNOWN && commentsMLchangedUnknown && pos>0) {
-                highlightChar(pos-1, HW->multiLineCommentFormat);
+                highlightChar(pos-1, FORMAT_MULTI_LINE_COMMENT);
             }
         }
 
@@ -3456,31 +3898,30 @@ void Highlight::parseUnknown(const QChar &c, int pos, bool isAlpha, bool isAlnum
             bool known = false;
             if (keywordStringUnknown.size()>0) {
                 // general keywords
-                HW->generalwordsIterator = HW->generalwords.find(keywordStringUnknown.toLower().toStdString());
-                if (HW->generalwordsIterator != HW->generalwords.end()) {
-                    QTextCharFormat format = HW->generalwordsIterator->second;
-                    highlightString(keywordUnknownStart, keywordUnknownLength, format);
+                int formatId = HW->generalwords.find(keywordStringUnknown);
+                if (formatId != FORMAT_NONE) {
+                    highlightString(keywordUnknownStart, keywordUnknownLength, formatId);
                     keywordUnknownStart = -1;
                     known = true;
                 }
             }
             if (!known && !isBigFile) {
-                if (keywordUnknownprevChar == "@") {
-                    highlightString(keywordUnknownStart, keywordUnknownLength, HW->punctuationFormat);
-                } else if (keywordJSprevChar != "." && c.toLatin1() == ':') {
-                    highlightString(keywordUnknownStart, keywordUnknownLength, HW->propertyFormat);
+                if (keywordUnknownprevChar == QLatin1String("@")) {
+                    highlightString(keywordUnknownStart, keywordUnknownLength, FORMAT_PUNCTUATION);
+                } else if (keywordJSprevChar != QLatin1String(".") && c.toLatin1() == ':') {
+                    highlightString(keywordUnknownStart, keywordUnknownLength, FORMAT_PROPERTY);
                 }
             }
-            if (keywordUnknownprevChar != ".") {
+            if (keywordUnknownprevChar != QLatin1String(".")) {
                 keywordUnknownStartPrev = keywordUnknownStart;
                 keywordUnknownLengthPrev = keywordUnknownLength;
             }
-            keywordUnknownprevChar = c;
+            setChar(keywordUnknownprevChar, c);
         }
         if (keywordUnknownStartPrev>=0 && keywordUnknownLengthPrev>0) {
             // functions
             if (c.toLatin1() == '(') {
-                highlightString(keywordUnknownStartPrev, keywordUnknownLengthPrev, HW->functionFormat);
+                highlightString(keywordUnknownStartPrev, keywordUnknownLengthPrev, FORMAT_FUNCTION);
             }
             if (!isWSpace) {
                 if (!isAlnum && c.toLatin1() != '-') {
@@ -3492,12 +3933,12 @@ void Highlight::parseUnknown(const QChar &c, int pos, bool isAlpha, bool isAlnum
     }
     if (stringSQOpenedUnknown < 0 && stringDQOpenedUnknown < 0 && commentSLOpenedUnknown < 0 && commentMLOpenedUnknown < 0 && !commentsMLchangedUnknown && !commentsSLchangedUnknown && !stringSQchangedUnknown && !stringDQchangedUnknown) {
         if (highlightTabs && c.toLatin1() == '\t') {
-            highlightChar(pos, HW->tabFormat);
+            highlightChar(pos, FORMAT_TAB);
         } else if (highlightSpaces && c.toLatin1() == ' ') {
-            highlightChar(pos, HW->spaceFormat);
+            highlightChar(pos, FORMAT_SPACE);
         }
         if (!isTextMode() && !isBigFile && (c.toLatin1() == ';' || c.toLatin1() == ',' || c.toLatin1() == '{' || c.toLatin1() == '}' || c.toLatin1() == '(' || c.toLatin1() == ')' || c.toLatin1() == '[' || c.toLatin1() == ']' || c.toLatin1() == '\\' || c.toLatin1() == '@' || c.toLatin1() == '&' || c.toLatin1() == '<' || c.toLatin1() == '>' || c.toLatin1() == '.' || c.toLatin1() == '?' || c.toLatin1() == ':' || c.toLatin1() == '%' || c.toLatin1() == '$' || c.toLatin1() == '^' || c.toLatin1() == '#' || c.toLatin1() == '@' || c.toLatin1() == '!' || c.toLatin1() == '\'' || c.toLatin1() == '"' || c.toLatin1() == '|' || c.toLatin1() == '~' || c.toLatin1() == '`')) {
-            highlightChar(pos, HW->punctuationFormat);
+            highlightChar(pos, FORMAT_PUNCTUATION);
         }
     }
 }
@@ -3537,6 +3978,114 @@ void Highlight::updateState(const QChar & c, int pos, int & pState)
     pState = state;
 }
 
+// Skips chars inside comments, strings and html text that cannot change the parser state.
+// Last two chars before the next stop char and the last non-space char are left
+// to the parser, so lookbehind chars get the same values as without skipping.
+int Highlight::skipInertChars(const QString & text, int pos, int modeId, int pState, int keywordCSSStartPrev, int keywordJSStartPrev, int keywordPHPStartPrev, int keywordUnknownStartPrev)
+{
+    if (state != pState || state < 0 || state >= INERT_CHARS_RUNS_COUNT) return pos;
+    const InertCharsRun & run = INERT_CHARS_RUNS[state];
+    if (run.stops == nullptr || run.modeId != modeId || modeStringC.size() > 0) return pos;
+    // "<?=" and tags that switch the mode are detected at the next char
+    if (modeString.size() > 0 && (modeId != MODE_ID_HTML || !modeSkip || modeExpect.size() > 0 || modeString.size() > 8 ||
+        modeString.at(modeString.size()-1) == '>' || modeString == QLatin1String("<?="))
+    ) {
+        return pos;
+    }
+    bool inert = false;
+    bool heredoc = state == STATE_STRING_HEREDOC || state == STATE_STRING_NOWDOC;
+    if (modeId == MODE_ID_PHP) {
+        if (keywordPHPOpened >= 0 || keywordPHPStartPrev >= 0 || keywordPHPScoped || keywordPHPScopedOpened >= 0 ||
+            expectedNsNamePHP.size() > 0 || stringEscVariablePHP.size() > 0 || stringEscStringPHP.size() > 0 ||
+            (!heredoc && (stringBOpened >= 0 || stringBstring.size() > 0 || stringBlock.size() > 0)) || stringBStart >= 0 || stringBExpect >= 0 ||
+            exprOpenedPHP >= 0 || keywordPHPprevChar == QLatin1String("$")
+        ) {
+            return pos;
+        }
+        if (state == STATE_COMMENT_ML_PHP) {
+            inert = commentMLOpenedPHP >= 0 && commentPHPStringML.size() == 0 && commentSLOpenedPHP < 0 && stringSQOpenedPHP < 0 && stringDQOpenedPHP < 0;
+        } else if (state == STATE_COMMENT_SL_PHP) {
+            inert = commentSLOpenedPHP >= 0 && commentPHPStringSL.size() == 0 && commentMLOpenedPHP < 0 && stringSQOpenedPHP < 0 && stringDQOpenedPHP < 0;
+        } else if (state == STATE_STRING_SQ_PHP) {
+            inert = stringSQOpenedPHP >= 0 && commentSLOpenedPHP < 0 && commentMLOpenedPHP < 0 && stringDQOpenedPHP < 0;
+        } else if (state == STATE_STRING_DQ_PHP) {
+            inert = stringDQOpenedPHP >= 0 && commentSLOpenedPHP < 0 && commentMLOpenedPHP < 0 && stringSQOpenedPHP < 0;
+        } else if (heredoc) {
+            inert = stringBOpened >= 0 && stringBlock.size() > 0 && commentSLOpenedPHP < 0 && commentMLOpenedPHP < 0 && stringSQOpenedPHP < 0 && stringDQOpenedPHP < 0;
+        }
+    } else if (modeId == MODE_ID_JS) {
+        if (keywordJSOpened >= 0 || keywordJSStartPrev >= 0 || keywordJSScoped || keywordJSScopedOpened >= 0 ||
+            expectVarInit || prevIsKeyword || expectedFuncNameJS.size() > 0 || expectedClsNameJS.size() > 0 || expectedFuncVarJS.size() > 0 ||
+            stringEscVariableJS.size() > 0 || stringEscStringJS.size() > 0 ||
+            regexpOpenedJS >= 0 || exprOpenedJS >= 0
+        ) {
+            return pos;
+        }
+        if (state == STATE_COMMENT_ML_JS) {
+            inert = commentMLOpenedJS >= 0 && commentJSStringML.size() == 0 && commentSLOpenedJS < 0 && stringSQOpenedJS < 0 && stringDQOpenedJS < 0;
+        } else if (state == STATE_COMMENT_SL_JS) {
+            inert = commentSLOpenedJS >= 0 && commentJSStringSL.size() == 0 && commentMLOpenedJS < 0 && stringSQOpenedJS < 0 && stringDQOpenedJS < 0;
+        } else if (state == STATE_STRING_SQ_JS) {
+            inert = stringSQOpenedJS >= 0 && commentSLOpenedJS < 0 && commentMLOpenedJS < 0 && stringDQOpenedJS < 0;
+        } else if (state == STATE_STRING_DQ_JS) {
+            inert = stringDQOpenedJS >= 0 && commentSLOpenedJS < 0 && commentMLOpenedJS < 0 && stringSQOpenedJS < 0;
+        }
+    } else if (modeId == MODE_ID_CSS) {
+        if (keywordCSSOpened >= 0 || keywordCSSStartPrev >= 0 || stringEscStringCSS.size() > 0 ||
+            expectedMediaNameCSS.size() > 0 || expectedMediaParsCSS >= 0
+        ) {
+            return pos;
+        }
+        if (state == STATE_COMMENT_ML_CSS) {
+            inert = commentMLOpenedCSS >= 0 && commentCSSStringML.size() == 0 && stringSQOpenedCSS < 0 && stringDQOpenedCSS < 0;
+        } else if (state == STATE_STRING_SQ_CSS) {
+            inert = stringSQOpenedCSS >= 0 && commentMLOpenedCSS < 0 && stringDQOpenedCSS < 0;
+        } else if (state == STATE_STRING_DQ_CSS) {
+            inert = stringDQOpenedCSS >= 0 && commentMLOpenedCSS < 0 && stringSQOpenedCSS < 0;
+        }
+    } else if (modeId == MODE_ID_HTML) {
+        if (keywordHTMLOpened >= 0) return pos;
+        if (state == STATE_NONE) {
+            // words of the text are never tag names, unless they follow "<" or "</"
+            inert = tagOpened < 0 && commentHTMLOpened < 0 && stringSQOpenedHTML < 0 && stringDQOpenedHTML < 0 &&
+                    commentHTMLString.size() == 0 && keywordHTMLprevChar != QLatin1String("<") && keywordHTMLprevPrevChar != QLatin1String("<") &&
+                    !highlightTabs && !highlightSpaces;
+        } else if (state == STATE_COMMENT_ML_HTML) {
+            inert = commentHTMLOpened >= 0 && commentHTMLString.size() == 0 && stringSQOpenedHTML < 0 && stringDQOpenedHTML < 0;
+        } else if (state == STATE_STRING_SQ_HTML) {
+            inert = stringSQOpenedHTML >= 0 && commentHTMLString.size() > 4 && commentHTMLOpened < 0 && stringDQOpenedHTML < 0;
+        } else if (state == STATE_STRING_DQ_HTML) {
+            inert = stringDQOpenedHTML >= 0 && commentHTMLString.size() > 4 && commentHTMLOpened < 0 && stringSQOpenedHTML < 0;
+        }
+    } else if (modeId == MODE_ID_UNKNOWN) {
+        if (keywordUnknownOpened >= 0 || keywordUnknownStartPrev >= 0 || stringEscStringUnknown.size() > 0 ||
+            commentUnknownStringSL.size() > 0 || commentUnknownStringML.size() > 0
+        ) {
+            return pos;
+        }
+        if (state == STATE_COMMENT_SL_UNKNOWN) {
+            inert = commentSLOpenedUnknown >= 0 && commentMLOpenedUnknown < 0 && stringSQOpenedUnknown < 0 && stringDQOpenedUnknown < 0;
+        } else if (state == STATE_COMMENT_ML_UNKNOWN) {
+            inert = commentMLOpenedUnknown >= 0 && commentSLOpenedUnknown < 0 && stringSQOpenedUnknown < 0 && stringDQOpenedUnknown < 0;
+        } else if (state == STATE_STRING_SQ_UNKNOWN) {
+            inert = stringSQOpenedUnknown >= 0 && commentSLOpenedUnknown < 0 && commentMLOpenedUnknown < 0 && stringDQOpenedUnknown < 0;
+        } else if (state == STATE_STRING_DQ_UNKNOWN) {
+            inert = stringDQOpenedUnknown >= 0 && commentSLOpenedUnknown < 0 && commentMLOpenedUnknown < 0 && stringSQOpenedUnknown < 0;
+        }
+    }
+    if (!inert) return pos;
+    // last char is always parsed
+    int stop = findStopChar(text.utf16(), pos + 1, text.size() - 1, run.stops);
+    int end = stop;
+    while (end > pos + 1 && text[end - 1].isSpace()) end--;
+    int count = qMin(stop - 2, end - 1) - (pos + 1);
+    if (count < SKIP_INERT_CHARS_MIN_COUNT) return pos;
+    if (run.formatId != FORMAT_NONE) highlightString(pos + 1, count, run.formatId);
+    // closing identifier of heredoc is compared with the whole line
+    if (heredoc) stringBstring.append(text.constData() + pos + 1, count);
+    return pos + count;
+}
+
 void Highlight::openBlockDataLists()
 {
     if (modeType == MODE_MIXED && mode != MODE_HTML) {
@@ -3659,11 +4208,11 @@ void Highlight::rehighlight()
     do {
         dirty = true;
         highlightBlock(block, false);
-        if (highlightVarsMode || firstRunMode) {
+        if (firstRunMode) {
             int percent = (block.blockNumber()+1)*100 / blocksCount;
             if (percent - progressPercent > 10) {
                 progressPercent = percent;
-                if (Helper::isQtVersionLessThan(5, 15, 0) || highlightVarsMode) {
+                if (Helper::isQtVersionLessThan(5, 15, 0)) {
                     doc->markContentsDirty(startPos, block.position() - startPos + block.length());
                     startPos = block.position() + block.length();
                     dirty = false;
@@ -3676,12 +4225,120 @@ void Highlight::rehighlight()
     if (!block.isValid()) block = block.previous();
     doc->markContentsDirty(startPos, block.position() - startPos + block.length());
     dirty = false;
-    if (highlightVarsMode || firstRunMode) {
+    if (firstRunMode) {
         emit progressChanged(100);
     }
     rehighlightBlockMode = false;
 }
 
+// applies the current palette to the formats of all blocks without parsing,
+// formats that are not in the palette are left as they are
+void Highlight::remapFormats()
+{
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        HighlightData * data = dynamic_cast<HighlightData *>(block.userData());
+        QTextLayout * layout = block.layout();
+        if (data != nullptr && layout != nullptr && !data->formatRangeIds.isEmpty()) {
+            QVector<QTextLayout::FormatRange> ranges = layout->formats();
+            if (ranges.size() == data->formatRangeIds.size()) {
+                const ushort * ids = data->formatRangeIds.constData();
+                for (int i=0; i<ranges.size(); i++) {
+                    if (ids[i] < FORMATS_COUNT) ranges[i].format = HW->getFormat(ids[i]);
+                }
+                layout->setFormats(ranges);
+            }
+        }
+        block = block.next();
+    }
+    doc->markContentsDirty(0, doc->characterCount());
+}
+
+// writes the end state and the format ranges of all blocks, see Editor::saveHighlightCache
+void Highlight::exportResult(QDataStream & out)
+{
+    QHash<const HighlightScope *, int> scopeIndexes;
+    QHash<const HighlightStrings *, int> stringsIndexes;
+    out << static_cast<quint32>(doc->blockCount());
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        HighlightData * data = dynamic_cast<HighlightData *>(block.userData());
+        QTextLayout * layout = block.layout();
+        QVector<QTextLayout::FormatRange> ranges;
+        QVector<ushort> rangeIds;
+        if (data != nullptr && layout != nullptr && data->formatRangeIds.size() == layout->formats().size()) {
+            ranges = layout->formats();
+            rangeIds = data->formatRangeIds;
+        }
+        out << static_cast<qint32>(block.userState());
+        out << (data != nullptr);
+        if (data != nullptr) data->write(out, scopeIndexes, stringsIndexes);
+        out << static_cast<quint32>(ranges.size());
+        for (int i=0; i<ranges.size(); i++) {
+            const QTextLayout::FormatRange & r = ranges.at(i);
+            out << static_cast<qint32>(r.start) << static_cast<qint32>(r.length) << rangeIds.at(i);
+            if (rangeIds.at(i) >= FORMATS_COUNT) out << r.format;
+        }
+        block = block.next();
+    }
+    out << changedVarsKeys << foundModes;
+    out << static_cast<quint32>(knownFunctions.size());
+    for (const auto &it : knownFunctions) {
+        out << QByteArray::fromStdString(it.first) << QByteArray::fromStdString(it.second);
+    }
+}
+
+// reads the result written by exportResult, it is applied like a result of the background worker
+SharedHighlightResult Highlight::importResult(QDataStream & in)
+{
+    quint32 blocksCount = 0;
+    in >> blocksCount;
+    if (in.status() != QDataStream::Ok || static_cast<int>(blocksCount) != doc->blockCount()) return SharedHighlightResult();
+    SharedHighlightResult result = SharedHighlightResult(new HighlightResult());
+    result->blocks.resize(doc->blockCount());
+    QVector<QExplicitlySharedDataPointer<HighlightScope>> scopes;
+    QVector<QExplicitlySharedDataPointer<HighlightStrings>> strings;
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        HighlightBlockResult & blockResult = result->blocks[block.blockNumber()];
+        qint32 userState = -1;
+        bool hasData = false;
+        in >> userState >> hasData;
+        blockResult.userState = userState;
+        blockResult.textHash = qHash(block.text());
+        if (hasData) {
+            blockResult.data = QSharedPointer<HighlightData>(new HighlightData());
+            if (!blockResult.data->read(in, scopes, strings)) return SharedHighlightResult();
+        }
+        quint32 count = 0;
+        in >> count;
+        for (quint32 i=0; i<count && in.status() == QDataStream::Ok; i++) {
+            qint32 start = 0, length = 0;
+            ushort id = FORMAT_NONE;
+            in >> start >> length >> id;
+            blockResult.rangeStarts.append(start);
+            blockResult.rangeLengths.append(length);
+            blockResult.rangeIds.append(id);
+            if (id < FORMATS_COUNT) continue;
+            QTextCharFormat format;
+            in >> format;
+            blockResult.extraFormats.append(format);
+        }
+        if (in.status() != QDataStream::Ok) return SharedHighlightResult();
+        block = block.next();
+    }
+    in >> result->changedVarsKeys >> result->foundModes;
+    quint32 functionsCount = 0;
+    in >> functionsCount;
+    for (quint32 i=0; i<functionsCount && in.status() == QDataStream::Ok; i++) {
+        QByteArray key, value;
+        in >> key >> value;
+        result->knownFunctions[key.toStdString()] = value.toStdString();
+    }
+    if (in.status() != QDataStream::Ok) return SharedHighlightResult();
+    return result;
+}
+
 void Highlight::resetHighlightBlock(QTextBlock & block)
 {
     HighlightData * blockData = dynamic_cast<HighlightData *>(block.userData());
@@ -3714,17 +4371,235 @@ void Highlight::highlightChanges(QTextCursor curs)
 
 void Highlight::highlightBlock(QTextBlock & block, bool markDirty)
 {
-    formatChanges.clear();
-    formatChanges.fill(QTextCharFormat(), block.text().size());
+    highlightedBlocksCount++;
+    QString text = block.text();
     cBlock = block;
     blockData = dynamic_cast<HighlightData *>(block.userData());
-    QString text = block.text();
-    if (parseBlock(text)) {
-        applyFormatChanges(markDirty);
+    QElapsedTimer timer;
+    if (debugStats) timer.start();
+    if (isLongBlock(text)) {
+        int parsedChars = 0;
+        bool parsed = parseLongBlock(text, parsedChars);
+        if (debugStats && parsed) {
+            parsedCharsCount += parsedChars;
+            parseNsecs += timer.nsecsElapsed();
+        }
+        if (parsed) {
+            applyLongBlockFormats(markDirty);
+        }
+    } else {
+        formatChanges.fill(FORMAT_NONE, text.size());
+        extraFormats.clear();
+        bool parsed = parseBlock(text);
+        if (debugStats && parsed) {
+            parsedCharsCount += text.size();
+            parseNsecs += timer.nsecsElapsed();
+        }
+        if (parsed) {
+            applyFormatChanges(markDirty);
+        }
     }
     formatChanges.clear();
 }
 
+// minified scripts and styles are parsed in chunks
+bool Highlight::isLongBlock(const QString & text) const
+{
+    return text.size() >= LONG_LINE_MIN_LENGTH && (modeType == MODE_JS || modeType == MODE_CSS);
+}
+
+// chunks end after a statement or a block, so that tokens are not split
+int Highlight::findLongBlockChunkEnd(const QString & text, int start) const
+{
+    const int textSize = text.size();
+    if (textSize - start <= LONG_LINE_CHUNK_SIZE) return textSize;
+    const int maxEnd = qMin(textSize, start + LONG_LINE_MAX_CHUNK_SIZE);
+    for (int i=start+LONG_LINE_CHUNK_SIZE; i<maxEnd; i++) {
+        const ushort code = text.at(i).unicode();
+        if (code == ';' || code == '}') return i + 1;
+    }
+    return maxEnd;
+}
+
+// Long lines are split into chunks that are parsed as separate lines,
+// each chunk keeps its formats and the state at its end as a checkpoint.
+// Chunks before the first changed one are not parsed again.
+bool Highlight::parseLongBlock(const QString & text, int & parsedChars)
+{
+    if (!enabled) return false;
+
+    bool isNewBlock = false;
+    bool _hasMarkPoint = false; // used by editor
+    bool _isModified = false; // used by editor
+    if (blockData == nullptr) {
+        blockData = new HighlightData();
+        isNewBlock = true;
+        if (!firstRunMode) _isModified = true; // used by editor
+    } else {
+        isNewBlock = blockData->isNewBlock;
+        _hasMarkPoint = blockData->hasMarkPoint;
+        _isModified = blockData->isModified;
+    }
+
+    if (!firstRunMode && !rehighlightBlockMode && lastVisibleBlockNumber >= 0 && cBlock.blockNumber() > lastVisibleBlockNumber + EXTRA_HIGHLIGHT_BLOCKS_COUNT) {
+        blockData->wantUpdate = true;
+        cBlock.setUserData(blockData);
+        return false;
+    }
+
+    // end-of-block state of the previous parse
+    HighlightData _endState;
+    if (!isNewBlock) _endState.copyState(*blockData);
+
+    HighlightData * prevBlockData = previousBlockData();
+    uint prevStateHash = prevBlockData != nullptr ? prevBlockData->stateHash : 0;
+
+    // find the first chunk that was changed, edited blocks are marked as new,
+    // so the text of chunks is compared instead
+    QVector<HighlightChunk> chunks = blockData->chunks;
+    int keepCount = 0;
+    if (blockData->chunksPrevStateHash == prevStateHash && (prevBlockData == nullptr || (!blockData->chunksPrevState.isNull() && blockData->chunksPrevState->isSameState(*prevBlockData)))) {
+        while (keepCount < chunks.size()) {
+            const HighlightChunk & chunk = chunks.at(keepCount);
+            if (chunk.start + chunk.length > text.size()) break;
+            // last chunk is cut at the end of the text
+            if (keepCount == chunks.size() - 1 && chunk.start + chunk.length != text.size()) break;
+            if (qHash(text.midRef(chunk.start, chunk.length)) != chunk.textHash) break;
+            keepCount++;
+        }
+    }
+    chunks.resize(keepCount);
+
+    HighlightData * _blockData = blockData;
+    int start = chunks.size() > 0 ? chunks.last().start + chunks.last().length : 0;
+    longBlockChunkMode = true;
+    while (start < text.size()) {
+        int end = findLongBlockChunkEnd(text, start);
+        HighlightChunk chunk;
+        do {
+            QString chunkText = text.mid(start, end - start);
+            formatChanges.fill(FORMAT_NONE, chunkText.size());
+            extraFormats.clear();
+            chunk.data = QSharedPointer<HighlightData>(new HighlightData());
+            blockData = chunk.data.data();
+            longBlockChunkPrevData = chunks.size() > 0 ? chunks.last().data.data() : prevBlockData;
+            parseBlock(chunkText);
+            parsedChars += chunkText.size();
+            // single line comment is closed only at the end of the line
+            if (end < text.size() && blockData->state == STATE_COMMENT_SL_JS) {
+                end = text.size();
+                continue;
+            }
+            break;
+        } while(true);
+        chunk.start = start;
+        chunk.length = end - start;
+        chunk.textHash = qHash(text.midRef(start, end - start));
+        chunk.formatIds = formatChanges;
+        chunk.extraFormats = extraFormats;
+        chunks.append(chunk);
+        start = end;
+    }
+    longBlockChunkMode = false;
+    longBlockChunkPrevData = nullptr;
+    blockData = _blockData;
+
+    // block keeps the state at the end of the line and data lists of all chunks
+    if (chunks.size() > 0) {
+        *blockData = *chunks.last().data;
+        blockData->mergeChunks(chunks);
+        if (prevBlockData != nullptr && *prevBlockData->scope == *blockData->scope) {
+            blockData->scope = prevBlockData->scope;
+        }
+        if (prevBlockData != nullptr && *prevBlockData->strings == *blockData->strings) {
+            blockData->strings = prevBlockData->strings;
+        }
+    }
+    blockData->chunks = chunks;
+    blockData->chunksPrevStateHash = prevStateHash;
+    blockData->chunksPrevState.clear();
+    if (prevBlockData != nullptr) {
+        blockData->chunksPrevState = QSharedPointer<HighlightData>(new HighlightData());
+        blockData->chunksPrevState->copyState(*prevBlockData);
+    }
+    blockData->isNewBlock = false;
+    blockData->wantUpdate = false;
+    blockData->hasMarkPoint = _hasMarkPoint; // used by editor
+    blockData->isModified = _isModified; // used by editor
+    blockData->updateStateHash();
+    if (isNewBlock || !blockData->isSameState(_endState)) {
+        changeBlockState();
+    }
+    cBlock.setUserData(blockData);
+
+    return true;
+}
+
+// only chunks around the visible columns are formatted
+void Highlight::applyLongBlockFormats(bool markDirty)
+{
+    int from = 0, to = cBlock.length();
+    if (longLineFirstColumn >= 0 && longLineLastColumn >= longLineFirstColumn) {
+        from = longLineFirstColumn - LONG_LINE_CHUNK_SIZE;
+        to = longLineLastColumn + LONG_LINE_CHUNK_SIZE;
+    }
+    QVector<QTextLayout::FormatRange> ranges;
+    QVector<ushort> rangeIds;
+    for (int i=0; i<blockData->chunks.size(); i++) {
+        const HighlightChunk & chunk = blockData->chunks.at(i);
+        if (chunk.start + chunk.length <= from || chunk.start >= to) continue;
+        appendFormatRanges(ranges, rangeIds, chunk.formatIds, chunk.extraFormats, chunk.start);
+    }
+    setFormatRanges(ranges, rangeIds, markDirty);
+}
+
+bool Highlight::setLongLineVisibleColumns(int firstColumn, int lastColumn)
+{
+    // formatted chunks cover the visible range with a margin
+    if (longLineLastColumn >= 0 && lastColumn >= 0 &&
+        qAbs(firstColumn - longLineFirstColumn) < LONG_LINE_CHUNK_SIZE &&
+        qAbs(lastColumn - longLineLastColumn) < LONG_LINE_CHUNK_SIZE
+    ) {
+        return false;
+    }
+    if (firstColumn == longLineFirstColumn && lastColumn == longLineLastColumn) return false;
+    longLineFirstColumn = firstColumn;
+    longLineLastColumn = lastColumn;
+    return true;
+}
+
+// applies formats of long lines for the current visible columns, nothing is parsed
+void Highlight::updateLongBlocks(int firstBlockNumber, int lastBlockNumber)
+{
+    if (!enabled || collectMode) return;
+    QTextBlock block = doc->findBlockByNumber(qMax(0, firstBlockNumber));
+    while (block.isValid() && block.blockNumber() <= lastBlockNumber) {
+        HighlightData * data = dynamic_cast<HighlightData *>(block.userData());
+        if (data != nullptr && data->chunks.size() > 0 && !data->wantUpdate) {
+            cBlock = block;
+            blockData = data;
+            applyLongBlockFormats(true);
+        }
+        block = block.next();
+    }
+}
+
+// the state of the previous block or the old state of the block is kept if it is the same,
+// other states are looked up in the table, so that equal states are stored once
+template<typename T>
+static void shareState(QExplicitlySharedDataPointer<T> & state, const T & blockState, const QExplicitlySharedDataPointer<T> * prevState, const QExplicitlySharedDataPointer<T> & oldState, HighlightStateTable<T> & table)
+{
+    if (prevState != nullptr && **prevState == blockState) {
+        state = *prevState;
+    } else if (*oldState == blockState) {
+        state = oldState;
+    } else {
+        state = new T(blockState);
+        state->updateHash();
+        table.intern(state);
+    }
+}
+
 bool Highlight::parseBlock(const QString & text)
 {
     if (!enabled) return false;
@@ -3735,62 +4610,8 @@ bool Highlight::parseBlock(const QString & text)
     }
 
     bool isNewBlock = false;
-    std::string _mode = mode;
-    std::string _prevMode = prevMode;
-    QString _stringBlock = stringBlock;
-    int _state = state;
-    int _prevState = prevState;
-    int _prevPrevState = prevPrevState;
-    QString _stringEscStringCSS = stringEscStringCSS;
-    QString _stringEscStringJS = stringEscStringJS;
-    QString _regexpEscStringJS = regexpEscStringJS;
-    QString _regexpPrevCharJs = regexpPrevCharJS;
-    int _bracesCSS = bracesCSS;
-    int _bracesJS = bracesJS;
-    int _bracesPHP = bracesPHP;
-    //int _parensCSS = parensCSS;
-    int _parensJS = parensJS;
-    int _parensPHP = parensPHP;
-    bool _keywordPHPScoped = keywordPHPScoped;
-    bool _keywordJSScoped = keywordJSScoped;
-    QString _exprEscStringJS = exprEscStringJS;
-    QString _stringEscVariableJS = stringEscVariableJS;
     bool _hasMarkPoint = false; // used by editor
     bool _isModified = false; // used by editor
-    QString _nsNamePHP = nsNamePHP;
-    QString _nsChainPHP = nsChainPHP;
-    QString _clsNamePHP = clsNamePHP;
-    QString _clsChainPHP = clsChainPHP;
-    QString _funcNamePHP = funcNamePHP;
-    QString _funcChainPHP = funcChainPHP;
-    QString _varsChainPHP = varsChainPHP;
-    QString _usedVarsChainPHP = usedVarsChainPHP;
-    QString _varsGlobChainPHP = varsGlobChainPHP;
-    QString _usedVarsGlobChainPHP = usedVarsGlobChainPHP;
-    QString _varsClsChainPHP = varsClsChainPHP;
-    QString _varsClsOpenChainPHP = varsClsOpenChainPHP;
-    QString _expectedNsNamePHP = expectedNsNamePHP;
-    QString _expectedClsNamePHP = expectedClsNamePHP;
-    QString _expectedFuncNamePHP = expectedFuncNamePHP;
-    QString _expectedFuncArgsPHPChain = expectedFuncArgsPHP.join(",");
-    int _expectedFuncParsPHP = expectedFuncParsPHP;
-    QString _expectedFuncNameJS = expectedFuncNameJS;
-    int _expectedFuncParsJS = expectedFuncParsJS;
-    QString _expectedFuncVarJS = expectedFuncVarJS;
-    QString _varsChainJS = varsChainJS;
-    QString _expectedMediaNameCSS = expectedMediaNameCSS;
-    int _expectedMediaParsCSS = expectedMediaParsCSS;
-    QString _funcNameJS = funcNameJS;
-    QString _funcChainJS = funcChainJS;
-    QString _expectedFuncArgsJSChain = expectedFuncArgsJS.join(",");
-    QString _mediaNameCSS = mediaNameCSS;
-    QString _tagChainHTML = tagChainHTML;
-    QString _cssNamesChain = cssNamesChain;
-    QString _operatorsChainPHP = operatorsChainPHP;
-    QString _operatorsChainJS = operatorsChainJS;
-    QString _expectedClsNameJS = expectedClsNameJS;
-    QString _clsNameJS = clsNameJS;
-    QString _clsChainJS = clsChainJS;
 
     // load current block data
     if (blockData == nullptr) {
@@ -3799,72 +4620,40 @@ bool Highlight::parseBlock(const QString & text)
         if (!firstRunMode) _isModified = true; // used by editor
     } else {
         isNewBlock = blockData->isNewBlock;
-        _mode = blockData->mode.toStdString();
-        _prevMode = blockData->prevMode.toStdString();
-        _stringBlock = blockData->stringBlock;
-        _state = blockData->state;
-        _prevState = blockData->prevState;
-        _prevPrevState = blockData->prevPrevState;
-        _stringEscStringCSS = blockData->stringEscStringCSS;
-        _stringEscStringJS = blockData->stringEscStringJS;
-        _regexpEscStringJS = blockData->regexpEscStringJS;
-        _regexpPrevCharJs = blockData->regexpPrevCharJS;
-        _bracesCSS = blockData->bracesCSS;
-        _bracesJS = blockData->bracesJS;
-        _bracesPHP = blockData->bracesPHP;
-        //_parensCSS = blockData->parensCSS;
-        _parensJS = blockData->parensJS;
-        _parensPHP = blockData->parensPHP;
-        _keywordPHPScoped = blockData->keywordPHPScoped;
-        _keywordJSScoped = blockData->keywordJSScoped;
-        _exprEscStringJS = blockData->exprEscStringJS;
-        _stringEscVariableJS = blockData->stringEscVariableJS;
         _hasMarkPoint = blockData->hasMarkPoint;
         _isModified = blockData->isModified;
-        _nsNamePHP = blockData->nsNamePHP;
-        _nsChainPHP = blockData->nsChainPHP;
-        _clsNamePHP = blockData->clsNamePHP;
-        _clsChainPHP = blockData->clsChainPHP;
-        _funcNamePHP = blockData->funcNamePHP;
-        _funcChainPHP = blockData->funcChainPHP;
-        _varsChainPHP = blockData->varsChainPHP;
-        _usedVarsChainPHP = blockData->usedVarsChainPHP;
-        _varsGlobChainPHP = blockData->varsGlobChainPHP;
-        _usedVarsGlobChainPHP = blockData->usedVarsGlobChainPHP;
-        _varsClsChainPHP = blockData->varsClsChainPHP;
-        _varsClsOpenChainPHP = blockData->varsClsOpenChainPHP;
-        _expectedNsNamePHP = blockData->expectedNsNamePHP;
-        _expectedClsNamePHP = blockData->expectedClsNamePHP;
-        _expectedFuncNamePHP = blockData->expectedFuncNamePHP;
-        _expectedFuncArgsPHPChain = blockData->expectedFuncArgsPHP.join(",");
-        _expectedFuncParsPHP = blockData->expectedFuncParsPHP;
-        _expectedFuncNameJS = blockData->expectedFuncNameJS;
-        _expectedFuncParsJS = blockData->expectedFuncParsJS;
-        _expectedFuncVarJS = blockData->expectedFuncVarJS;
-        _varsChainJS = blockData->varsChainJS;
-        _expectedMediaNameCSS = blockData->expectedMediaNameCSS;
-        _expectedMediaParsCSS = blockData->expectedMediaParsCSS;
-        _funcNameJS = blockData->funcNameJS;
-        _funcChainJS = blockData->funcChainJS;
-        _expectedFuncArgsJSChain = blockData->expectedFuncArgsJS.join(",");
-        _mediaNameCSS = blockData->mediaNameCSS;
-        _tagChainHTML = blockData->tagChainHTML;
-        _cssNamesChain = blockData->cssNamesChain;
-        _operatorsChainPHP = blockData->operatorsChainPHP;
-        _operatorsChainJS = blockData->operatorsChainJS;
-        _expectedClsNameJS = blockData->expectedClsNameJS;
-        _clsNameJS = blockData->clsNameJS;
-        _clsChainJS = blockData->clsChainJS;
-    }
-
-    if (!highlightVarsMode && !firstRunMode && !rehighlightBlockMode && lastVisibleBlockNumber >= 0 && cBlock.blockNumber() > lastVisibleBlockNumber + EXTRA_HIGHLIGHT_BLOCKS_COUNT) {
+    }
+
+    QExplicitlySharedDataPointer<HighlightScope> _scope = blockData->scope;
+    QExplicitlySharedDataPointer<HighlightStrings> _strings = blockData->strings;
+
+    if (!longBlockChunkMode && !firstRunMode && !rehighlightBlockMode && lastVisibleBlockNumber >= 0 && cBlock.blockNumber() > lastVisibleBlockNumber + EXTRA_HIGHLIGHT_BLOCKS_COUNT) {
         blockData->wantUpdate = true;
         cBlock.setUserData(blockData);
         return false;
     }
 
+    // end-of-block state of the previous parse, chunks of long lines start empty
+    HighlightData _endState;
+    if (!isNewBlock && !longBlockChunkMode) _endState.copyState(*blockData);
+
+    // variables found by the previous parse, used to detect changed scopes
+    QVector<QString> _varsKeysPHP, _varsNamesPHP, _usedVarsKeysPHP, _usedVarsNamesPHP;
+    QVector<int> _varsPositionsPHP, _varsBlockOffsetsPHP;
+    _varsKeysPHP.swap(blockData->varsKeysPHP);
+    _varsNamesPHP.swap(blockData->varsNamesPHP);
+    _varsPositionsPHP.swap(blockData->varsPositionsPHP);
+    _varsBlockOffsetsPHP.swap(blockData->varsBlockOffsetsPHP);
+    _usedVarsKeysPHP.swap(blockData->usedVarsKeysPHP);
+    _usedVarsNamesPHP.swap(blockData->usedVarsNamesPHP);
+
     blockData->reset();
-    restoreState();
+    restoreState(longBlockChunkMode ? longBlockChunkPrevData : previousBlockData());
+
+    // removed lines leave no data, so the scope of an edited block is always checked
+    if (modeType == MODE_MIXED && !firstRunMode && !rehighlightBlockMode) {
+        changedVarsKeys.insert(getVarsKeyPHP());
+    }
 
     // open data lists
     openBlockDataLists();
@@ -3873,33 +4662,47 @@ bool Highlight::parseBlock(const QString & text)
     int pState = state;
     int keywordCSSStartPrev = -1, keywordCSSLengthPrev = -1, keywordJSStartPrev = -1, keywordJSLengthPrev = -1, keywordPHPStartPrev = -1, keywordPHPLengthPrev = -1, keywordUnknownStartPrev = -1, keywordUnknownLengthPrev = -1;
     bool cssValuePart = true;
-    for (int i=0; i<text.size(); i++) {
+    bool isMixed = modeType == MODE_MIXED;
+    int modeId = getModeId(mode);
+    const int textSize = text.size();
+    for (int i=0; i<textSize; i++) {
         const QChar & c = text[i];
-        bool isLast = (i == text.size()-1) ? true : false;
-        bool isAlpha = isalpha(c.toLatin1()) > 0 || c.toLatin1() == '_' ? true : false;
-        bool isAlnum = isalnum(c.toLatin1()) > 0 || c.toLatin1() == '_' ? true : false;
-        bool isWSpace = c.isSpace();
+        const ushort code = c.unicode();
+        const unsigned char charCls = code < 128 ? CHAR_CLASSES[code] : 0;
+        bool isLast = (i == textSize-1) ? true : false;
+        bool isAlpha = (charCls & CHAR_CLASS_ALPHA) > 0;
+        bool isAlnum = (charCls & (CHAR_CLASS_ALPHA | CHAR_CLASS_DIGIT)) > 0;
+        bool isWSpace = code < 128 ? (charCls & CHAR_CLASS_SPACE) > 0 : c.isSpace();
 
         // detect highlight mode
-        if (parseMode(c, i, isWSpace, isLast, pMode, pState)) continue;
-
-        // html mode
-        parseHTML(c, (i>0 ? text[i-1] : '\0'), i, isAlpha, isAlnum, isLast);
-
-        // css mode
-        parseCSS(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordCSSStartPrev, keywordCSSLengthPrev, cssValuePart);
-
-        // js mode
-        parseJS(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordJSStartPrev, keywordJSLengthPrev);
-
-        // php mode
-        parsePHP(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordPHPStartPrev, keywordPHPLengthPrev);
+        if (isMixed && parseMode(c, i, isWSpace, isLast, pMode, pState)) {
+            modeId = getModeId(mode);
+            continue;
+        }
 
-        // unknown
-        parseUnknown(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordUnknownStartPrev, keywordUnknownLengthPrev);
+        // mode is changed only by parseMode
+        switch (modeId) {
+        case MODE_ID_HTML:
+            parseHTML(c, (i>0 ? text[i-1] : '\0'), i, isAlpha, isAlnum, isLast);
+            break;
+        case MODE_ID_CSS:
+            parseCSS(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordCSSStartPrev, keywordCSSLengthPrev, cssValuePart);
+            break;
+        case MODE_ID_JS:
+            parseJS(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordJSStartPrev, keywordJSLengthPrev);
+            break;
+        case MODE_ID_PHP:
+            parsePHP(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordPHPStartPrev, keywordPHPLengthPrev);
+            break;
+        default:
+            parseUnknown(c, i, isAlpha, isAlnum, isWSpace, isLast, keywordUnknownStartPrev, keywordUnknownLengthPrev);
+        }
 
         // state changes
         updateState(c, i, pState);
+
+        // jump over comment, string and html text contents
+        if (inertCharsSkipping) i = skipInertChars(text, i, modeId, pState, keywordCSSStartPrev, keywordJSStartPrev, keywordPHPStartPrev, keywordUnknownStartPrev);
     }
 
     // draw spell underline
@@ -3910,87 +4713,31 @@ bool Highlight::parseBlock(const QString & text)
 
     // Helper::log(Helper::intToStr(cBlock.blockNumber())+": "+QString::fromStdString(prevMode)+", "+QString::fromStdString(mode)+" : "+Helper::intToStr(prevState)+", "+Helper::intToStr(state)+"\n");
 
-    if (isNewBlock ||
-        mode != _mode ||
-        prevMode != _prevMode ||
-        state != _state ||
-        prevState != _prevState ||
-        prevPrevState != _prevPrevState ||
-        stringEscStringCSS != _stringEscStringCSS ||
-        stringEscStringJS != _stringEscStringJS ||
-        regexpEscStringJS != _regexpEscStringJS ||
-        regexpPrevCharJS != _regexpPrevCharJs ||
-        stringBlock != _stringBlock ||
-        _bracesCSS != bracesCSS ||
-        _bracesJS != bracesJS ||
-        _bracesPHP != bracesPHP ||
-        //_parensCSS != parensCSS ||
-        _parensJS != parensJS ||
-        _parensPHP != parensPHP ||
-        _keywordPHPScoped != keywordPHPScoped ||
-        _keywordJSScoped != keywordJSScoped ||
-        _exprEscStringJS != exprEscStringJS ||
-        _stringEscVariableJS != stringEscVariableJS ||
-        _nsNamePHP != nsNamePHP ||
-        _nsChainPHP != nsChainPHP ||
-        _clsNamePHP != clsNamePHP ||
-        _clsChainPHP != clsChainPHP ||
-        _funcNamePHP != funcNamePHP ||
-        _funcChainPHP != funcChainPHP ||
-        _varsChainPHP != varsChainPHP ||
-        _usedVarsChainPHP != usedVarsChainPHP ||
-        _varsGlobChainPHP != varsGlobChainPHP ||
-        _usedVarsGlobChainPHP != usedVarsGlobChainPHP ||
-        _varsClsChainPHP != varsClsChainPHP ||
-        _varsClsOpenChainPHP != varsClsOpenChainPHP ||
-        _expectedNsNamePHP != expectedNsNamePHP ||
-        _expectedClsNamePHP != expectedClsNamePHP ||
-        _expectedFuncNamePHP != expectedFuncNamePHP ||
-        _expectedFuncArgsPHPChain != expectedFuncArgsPHP.join(",") ||
-        _expectedFuncParsPHP != expectedFuncParsPHP ||
-        _expectedFuncNameJS != expectedFuncNameJS ||
-        _expectedFuncParsJS != expectedFuncParsJS ||
-        _expectedFuncVarJS != expectedFuncVarJS ||
-        _varsChainJS != varsChainJS ||
-        _expectedFuncArgsJSChain != expectedFuncArgsJS.join(",") ||
-        _expectedMediaNameCSS != expectedMediaNameCSS ||
-        _expectedMediaParsCSS != expectedMediaParsCSS ||
-        _funcNameJS != funcNameJS ||
-        _funcChainJS != funcChainJS ||
-        _mediaNameCSS != mediaNameCSS ||
-        _tagChainHTML != tagChainHTML ||
-        _cssNamesChain != cssNamesChain ||
-        _operatorsChainPHP != operatorsChainPHP ||
-        _operatorsChainJS != operatorsChainJS ||
-        _expectedClsNameJS != expectedClsNameJS ||
-        _clsNameJS != clsNameJS ||
-        _clsChainJS != clsChainJS
-    ) {
-        changeBlockState();
-    }
-
     // save current block data
+    HighlightScope blockScope;
+    HighlightStrings blockStrings;
     blockData->isNewBlock = false;
     blockData->state = state;
     blockData->prevState = prevState;
     blockData->prevPrevState = prevPrevState;
-    blockData->mode = QString::fromStdString(mode);
-    blockData->prevMode = QString::fromStdString(prevMode);
-    blockData->modeExpect = QString::fromStdString(modeExpect);
-    blockData->modeExpectC = QString::fromStdString(modeExpectC);
-    blockData->modeString = modeString;
-    blockData->modeStringC = modeStringC;
-    blockData->prevModeExpect = QString::fromStdString(prevModeExpect);
-    blockData->prevModeString = prevModeString;
-    blockData->prevModeExpectC = QString::fromStdString(prevModeExpectC);
-    blockData->prevModeStringC = prevModeStringC;
+    blockStrings.mode = QString::fromStdString(mode);
+    blockStrings.prevMode = QString::fromStdString(prevMode);
+    blockStrings.modeExpect = QString::fromStdString(modeExpect);
+    blockStrings.modeExpectC = QString::fromStdString(modeExpectC);
+    // mode strings are restored only with the expected modes
+    blockStrings.modeString = modeExpect.size() > 0 ? modeString : QString();
+    blockStrings.modeStringC = modeExpectC.size() > 0 ? modeStringC : QString();
+    blockStrings.prevModeExpect = QString::fromStdString(prevModeExpect);
+    blockStrings.prevModeString = prevModeString;
+    blockStrings.prevModeExpectC = QString::fromStdString(prevModeExpectC);
+    blockStrings.prevModeStringC = prevModeStringC;
     blockData->prevModeSkip = prevModeSkip;
     blockData->prevModeSkipC = prevModeSkipC;
-    blockData->stringBlock = stringBlock;
-    blockData->stringEscStringCSS = stringEscStringCSS;
-    blockData->stringEscStringJS = stringEscStringJS;
-    blockData->regexpEscStringJS = regexpEscStringJS;
-    blockData->regexpPrevCharJS = regexpPrevCharJS;
+    blockStrings.stringBlock = stringBlock;
+    blockStrings.stringEscStringCSS = stringEscStringCSS;
+    blockStrings.stringEscStringJS = stringEscStringJS;
+    blockStrings.regexpEscStringJS = regexpEscStringJS;
+    blockStrings.regexpPrevCharJS = regexpPrevCharJS;
     blockData->bracesCSS = bracesCSS;
     blockData->bracesJS = bracesJS;
     blockData->bracesPHP = bracesPHP;
@@ -4000,102 +4747,119 @@ bool Highlight::parseBlock(const QString & text)
     blockData->cssMediaScope = cssMediaScope;
     blockData->keywordPHPScoped = keywordPHPScoped;
     blockData->keywordJSScoped = keywordJSScoped;
-    blockData->exprEscStringJS = exprEscStringJS;
-    blockData->stringEscVariableJS = stringEscVariableJS;
+    blockStrings.exprEscStringJS = exprEscStringJS;
+    blockStrings.stringEscVariableJS = stringEscVariableJS;
     blockData->specialChars = specialChars;
     blockData->specialCharsPos = specialCharsPos;
     blockData->specialWords = specialWords;
     blockData->specialWordsPos = specialWordsPos;
-    blockData->modeStarts = modeStarts;
-    blockData->modeEnds = modeEnds;
+    blockData->setIntervals(INTERVALS_MODE, modeStarts, modeEnds);
     blockData->modeTags = modeTags;
-    blockData->stateStarts = stateStarts;
-    blockData->stateEnds = stateEnds;
+    blockData->setIntervals(INTERVALS_STATE, stateStarts, stateEnds);
     blockData->stateIds = stateIds;
     blockData->hasMarkPoint = _hasMarkPoint; // used by editor
     blockData->isModified = _isModified; // used by editor
-    blockData->nsNamePHP = nsNamePHP;
-    blockData->nsChainPHP = nsChainPHP;
-    blockData->nsScopeChainPHP = nsScopeChainPHP;
-    blockData->nsStartsPHP = nsStartsPHP;
-    blockData->nsEndsPHP = nsEndsPHP;
+    blockScope.nsNamePHP = nsNamePHP;
+    blockScope.nsChainPHP = nsChainPHP;
+    blockScope.nsScopeChainPHP = nsScopeChainPHP;
+    blockData->setIntervals(INTERVALS_NS_PHP, nsStartsPHP, nsEndsPHP);
     blockData->nsNamesPHP = nsNamesPHP;
-    blockData->clsNamePHP = clsNamePHP;
-    blockData->clsChainPHP = clsChainPHP;
-    blockData->clsScopeChainPHP = clsScopeChainPHP;
-    blockData->clsStartsPHP = clsStartsPHP;
-    blockData->clsEndsPHP = clsEndsPHP;
+    blockScope.clsNamePHP = clsNamePHP;
+    blockScope.clsChainPHP = clsChainPHP;
+    blockScope.clsScopeChainPHP = clsScopeChainPHP;
+    blockData->setIntervals(INTERVALS_CLS_PHP, clsStartsPHP, clsEndsPHP);
     blockData->clsNamesPHP = clsNamesPHP;
-    blockData->funcNamePHP = funcNamePHP;
-    blockData->funcChainPHP = funcChainPHP;
-    blockData->funcScopeChainPHP = funcScopeChainPHP;
-    blockData->funcStartsPHP = funcStartsPHP;
-    blockData->funcEndsPHP = funcEndsPHP;
+    blockScope.funcNamePHP = funcNamePHP;
+    blockScope.funcChainPHP = funcChainPHP;
+    blockScope.funcScopeChainPHP = funcScopeChainPHP;
+    blockData->setIntervals(INTERVALS_FUNC_PHP, funcStartsPHP, funcEndsPHP);
     blockData->funcNamesPHP = funcNamesPHP;
-    blockData->expectedNsNamePHP = expectedNsNamePHP;
-    blockData->expectedClsNamePHP = expectedClsNamePHP;
-    blockData->expectedFuncNamePHP = expectedFuncNamePHP;
+    if (varsKeysPHP != _varsKeysPHP || varsNamesPHP != _varsNamesPHP ||
+        varsPositionsPHP != _varsPositionsPHP || varsBlockOffsetsPHP != _varsBlockOffsetsPHP ||
+        usedVarsKeysPHP != _usedVarsKeysPHP || usedVarsNamesPHP != _usedVarsNamesPHP
+    ) {
+        for (int i=0; i<_varsKeysPHP.size(); i++) changedVarsKeys.insert(_varsKeysPHP.at(i));
+        for (int i=0; i<_usedVarsKeysPHP.size(); i++) changedVarsKeys.insert(_usedVarsKeysPHP.at(i));
+        for (int i=0; i<varsKeysPHP.size(); i++) changedVarsKeys.insert(varsKeysPHP.at(i));
+        for (int i=0; i<usedVarsKeysPHP.size(); i++) changedVarsKeys.insert(usedVarsKeysPHP.at(i));
+    }
+    blockData->varsKeysPHP = varsKeysPHP;
+    blockData->varsNamesPHP = varsNamesPHP;
+    blockData->varsPositionsPHP = varsPositionsPHP;
+    blockData->varsBlockOffsetsPHP = varsBlockOffsetsPHP;
+    blockData->usedVarsKeysPHP = usedVarsKeysPHP;
+    blockData->usedVarsNamesPHP = usedVarsNamesPHP;
+    blockScope.expectedNsNamePHP = expectedNsNamePHP;
+    blockScope.expectedClsNamePHP = expectedClsNamePHP;
+    blockScope.expectedFuncNamePHP = expectedFuncNamePHP;
     blockData->expectedFuncParsPHP = expectedFuncParsPHP;
-    blockData->expectedFuncArgsPHP = expectedFuncArgsPHP;
-    blockData->expectedFuncArgsPHPPositions = expectedFuncArgsPHPPositions;
-    blockData->expectedFuncArgsPHPBlocks = expectedFuncArgsPHPBlocks;
+    blockScope.expectedFuncArgsPHP = expectedFuncArgsPHP;
+    blockScope.expectedFuncArgsPHPPositions = expectedFuncArgsPHPPositions;
+    blockScope.expectedFuncArgsPHPBlocks = expectedFuncArgsPHPBlocks;
     blockData->nsScopePHP = nsScopePHP;
     blockData->clsScopePHP = clsScopePHP;
     blockData->funcScopePHP = funcScopePHP;
-    blockData->varsChainsPHP = varsChainsPHP;
-    blockData->usedVarsChainsPHP = usedVarsChainsPHP;
-    blockData->varsGlobChainPHP = varsGlobChainPHP;
-    blockData->usedVarsGlobChainPHP = usedVarsGlobChainPHP;
-    blockData->varsClsChainPHP = varsClsChainPHP;
-    blockData->varsChainPHP = varsChainPHP;
-    blockData->usedVarsChainPHP = usedVarsChainPHP;
+    blockScope.varsChainsPHP = varsChainsPHP;
+    blockScope.usedVarsChainsPHP = usedVarsChainsPHP;
+    blockScope.varsGlobChainPHP = varsGlobChainPHP;
+    blockScope.usedVarsGlobChainPHP = usedVarsGlobChainPHP;
+    blockScope.varsClsChainPHP = varsClsChainPHP;
+    blockScope.varsChainPHP = varsChainPHP;
+    blockScope.usedVarsChainPHP = usedVarsChainPHP;
     blockData->clsOpenPHP = clsOpenPHP;
-    blockData->clsOpensPHP = clsOpensPHP;
-    blockData->varsClsOpenChainPHP = varsClsOpenChainPHP;
-    blockData->clsPropsChainPHP = clsPropsChainPHP;
+    blockScope.clsOpensPHP = clsOpensPHP;
+    blockScope.varsClsOpenChainPHP = varsClsOpenChainPHP;
+    blockScope.clsPropsChainPHP = clsPropsChainPHP;
     blockData->isGlobalPHP = isGlobalPHP;
-    blockData->funcNameJS = funcNameJS;
-    blockData->funcScopeChainJS = funcScopeChainJS;
-    blockData->funcChainJS = funcChainJS;
-    blockData->funcStartsJS= funcStartsJS;
-    blockData->funcEndsJS = funcEndsJS;
+    blockScope.funcNameJS = funcNameJS;
+    blockScope.funcScopeChainJS = funcScopeChainJS;
+    blockScope.funcChainJS = funcChainJS;
+    blockData->setIntervals(INTERVALS_FUNC_JS, funcStartsJS, funcEndsJS);
     blockData->funcNamesJS = funcNamesJS;
-    blockData->expectedFuncArgsJS = expectedFuncArgsJS;
-    blockData->expectedFuncNameJS = expectedFuncNameJS;
-    blockData->expectedFuncVarJS = expectedFuncVarJS;
+    blockScope.expectedFuncArgsJS = expectedFuncArgsJS;
+    blockScope.expectedFuncNameJS = expectedFuncNameJS;
+    blockScope.expectedFuncVarJS = expectedFuncVarJS;
     blockData->expectedFuncParsJS = expectedFuncParsJS;
     blockData->funcScopeJS = funcScopeJS;
-    blockData->varsChainJS = varsChainJS;
-    blockData->mediaNameCSS = mediaNameCSS;
-    blockData->mediaStartsCSS = mediaStartsCSS;
-    blockData->mediaEndsCSS = mediaEndsCSS;
+    blockScope.varsChainJS = varsChainJS;
+    blockScope.mediaNameCSS = mediaNameCSS;
+    blockData->setIntervals(INTERVALS_MEDIA_CSS, mediaStartsCSS, mediaEndsCSS);
     blockData->mediaNamesCSS = mediaNamesCSS;
-    blockData->expectedMediaNameCSS = expectedMediaNameCSS;
+    blockScope.expectedMediaNameCSS = expectedMediaNameCSS;
     blockData->expectedMediaParsCSS = expectedMediaParsCSS;
     blockData->mediaScopeCSS = mediaScopeCSS;
-    blockData->tagChainHTML = tagChainHTML;
-    blockData->tagChainStartsHTML = tagChainStartsHTML;
-    blockData->tagChainEndsHTML = tagChainEndsHTML;
+    blockScope.tagChainHTML = tagChainHTML;
+    blockData->setIntervals(INTERVALS_TAG_CHAIN_HTML, tagChainStartsHTML, tagChainEndsHTML);
     blockData->tagChainsHTML = tagChainsHTML;
-    blockData->keywordPHPprevString = keywordPHPprevString;
-    blockData->keywordPHPprevStringPrevChar = keywordPHPprevStringPrevChar;
-    blockData->keywordJSprevString = keywordJSprevString;
-    blockData->keywordJSprevStringPrevChar = keywordJSprevStringPrevChar;
-    blockData->cssNamesChain = cssNamesChain;
-    blockData->operatorsChainPHP = operatorsChainPHP;
-    blockData->operatorsPHP = operatorsPHP;
-    blockData->operatorsChainJS = operatorsChainJS;
-    blockData->operatorsJS = operatorsJS;
-    blockData->expectedClsNameJS = expectedClsNameJS;
-    blockData->clsNameJS = clsNameJS;
+    blockStrings.keywordPHPprevString = keywordPHPprevString;
+    blockStrings.keywordPHPprevStringPrevChar = keywordPHPprevStringPrevChar;
+    blockStrings.keywordJSprevString = keywordJSprevString;
+    blockStrings.keywordJSprevStringPrevChar = keywordJSprevStringPrevChar;
+    blockScope.cssNamesChain = cssNamesChain;
+    blockScope.operatorsChainPHP = operatorsChainPHP;
+    blockScope.operatorsPHP = operatorsPHP;
+    blockScope.operatorsChainJS = operatorsChainJS;
+    blockScope.operatorsJS = operatorsJS;
+    blockScope.expectedClsNameJS = expectedClsNameJS;
+    blockScope.clsNameJS = clsNameJS;
     blockData->clsScopeJS = clsScopeJS;
-    blockData->clsChainJS = clsChainJS;
+    blockScope.clsChainJS = clsChainJS;
     blockData->clsNamesJS = clsNamesJS;
-    blockData->clsStartsJS = clsStartsJS;
-    blockData->clsEndsJS = clsEndsJS;
-    blockData->clsScopeChainJS = clsScopeChainJS;
-    blockData->clsOpensJS = clsOpensJS;
+    blockData->setIntervals(INTERVALS_CLS_JS, clsStartsJS, clsEndsJS);
+    blockScope.clsScopeChainJS = clsScopeChainJS;
+    blockScope.clsOpensJS = clsOpensJS;
     blockData->clsOpenJS = clsOpenJS;
+    // share scope and strings with previous block if they were not changed
+    HighlightData * prevBlockData = longBlockChunkMode ? longBlockChunkPrevData : previousBlockData();
+    shareState(blockData->scope, blockScope, prevBlockData != nullptr ? &prevBlockData->scope : nullptr, _scope, scopeTable);
+    shareState(blockData->strings, blockStrings, prevBlockData != nullptr ? &prevBlockData->strings : nullptr, _strings, stringsTable);
+    // next block should be rehighlighted if end-of-block state was changed
+    blockData->updateStateHash();
+    // chunks of long lines are merged into the block by parseLongBlock
+    if (longBlockChunkMode) return true;
+    if (isNewBlock || !blockData->isSameState(_endState)) {
+        changeBlockState();
+    }
     cBlock.setUserData(blockData);
 
     return true;
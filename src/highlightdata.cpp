@@ -5,6 +5,122 @@
  *******************************************/
 
 #include "highlightdata.h"
+#include <QHash>
+
+static int stringMemoryUsage(const QString & str)
+{
+    if (str.isEmpty()) return 0;
+    return str.capacity() * static_cast<int>(sizeof(QChar));
+}
+
+static int stringsMemoryUsage(const QList<QString> & list)
+{
+    int bytes = list.size() * static_cast<int>(sizeof(void *));
+    for (int i=0; i<list.size(); i++) {
+        bytes += stringMemoryUsage(list.at(i));
+    }
+    return bytes;
+}
+
+static int stringsMemoryUsage(const QVector<QString> & list)
+{
+    int bytes = list.capacity() * static_cast<int>(sizeof(QString));
+    for (int i=0; i<list.size(); i++) {
+        bytes += stringMemoryUsage(list.at(i));
+    }
+    return bytes;
+}
+
+template<typename T>
+static int vectorMemoryUsage(const QVector<T> & vector)
+{
+    return vector.capacity() * static_cast<int>(sizeof(T));
+}
+
+template<typename T>
+static int vectorMemoryUsage(const QList<T> & list)
+{
+    return list.size() * static_cast<int>(sizeof(void *));
+}
+
+static int mapMemoryUsage(const std::unordered_map<int, std::string> & map)
+{
+    int bytes = static_cast<int>(map.bucket_count() * sizeof(void *));
+    for (const auto &it : map) {
+        bytes += static_cast<int>(sizeof(it) + sizeof(void *) + it.second.capacity());
+    }
+    return bytes;
+}
+
+static QExplicitlySharedDataPointer<HighlightScope> createEmptyScope()
+{
+    QExplicitlySharedDataPointer<HighlightScope> scope(new HighlightScope());
+    scope->updateHash();
+    return scope;
+}
+
+static QExplicitlySharedDataPointer<HighlightStrings> createEmptyStrings()
+{
+    QExplicitlySharedDataPointer<HighlightStrings> strings(new HighlightStrings());
+    strings->updateHash();
+    return strings;
+}
+
+static uint hashCombine(uint seed, uint hash)
+{
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+static uint hashMap(const std::unordered_map<int, std::string> & map)
+{
+    // unordered, so entries are combined independently of their order
+    uint hash = 0;
+    for (const auto &it : map) {
+        hash += hashCombine(qHash(it.first), qHash(QLatin1String(it.second.c_str(), static_cast<int>(it.second.size()))));
+    }
+    return hash;
+}
+
+static void writeMap(QDataStream & out, const std::unordered_map<int, std::string> & map)
+{
+    out << static_cast<quint32>(map.size());
+    for (const auto &it : map) {
+        out << static_cast<qint32>(it.first) << QByteArray(it.second.c_str(), static_cast<int>(it.second.size()));
+    }
+}
+
+static void readMap(QDataStream & in, std::unordered_map<int, std::string> & map)
+{
+    map.clear();
+    quint32 count = 0;
+    in >> count;
+    for (quint32 i=0; i<count && in.status() == QDataStream::Ok; i++) {
+        qint32 key = 0;
+        QByteArray value;
+        in >> key >> value;
+        map[key] = value.toStdString();
+    }
+}
+
+static void writeStrings(QDataStream & out, const QVector<std::string> & list)
+{
+    out << static_cast<quint32>(list.size());
+    for (int i=0; i<list.size(); i++) {
+        out << QByteArray(list.at(i).c_str(), static_cast<int>(list.at(i).size()));
+    }
+}
+
+static void readStrings(QDataStream & in, QVector<std::string> & list)
+{
+    list.clear();
+    quint32 count = 0;
+    in >> count;
+    for (quint32 i=0; i<count && in.status() == QDataStream::Ok; i++) {
+        QByteArray value;
+        in >> value;
+        list.append(value.toStdString());
+    }
+}
 
 HighlightData::HighlightData()
 {
@@ -13,26 +129,16 @@ HighlightData::HighlightData()
 
 void HighlightData::reset()
 {
-    stringBlock = "";
-    mode = "";
-    prevMode = "";
-    modeExpect = "";
-    modeExpectC = "";
-    modeString = "";
-    modeStringC = "";
-    prevModeExpect = "";
-    prevModeString = "";
-    prevModeExpectC = "";
-    prevModeStringC = "";
+    static const QExplicitlySharedDataPointer<HighlightScope> emptyScope = createEmptyScope();
+    static const QExplicitlySharedDataPointer<HighlightStrings> emptyStrings = createEmptyStrings();
+    scope = emptyScope;
+    strings = emptyStrings;
+    stateHash = 0;
     prevModeSkip = false;
     prevModeSkipC = false;
     state = -1;
     prevState = -1;
     prevPrevState = -1;
-    stringEscStringCSS = "";
-    stringEscStringJS = "";
-    regexpEscStringJS = "";
-    regexpPrevCharJS = "";
     bracesCSS = 0;
     bracesJS = 0;
     bracesPHP = 0;
@@ -42,102 +148,648 @@ void HighlightData::reset()
     cssMediaScope = false;
     keywordPHPScoped = false;
     keywordJSScoped = false;
-    exprEscStringJS = "";
-    stringEscVariableJS = "";
     specialChars.clear();
     specialCharsPos.clear();
     specialWords.clear();
     specialWordsPos.clear();
-    modeStarts.clear();
-    modeEnds.clear();
     modeTags.clear();
-    stateStarts.clear();
-    stateEnds.clear();
     stateIds.clear();
     hasMarkPoint = false;
     isModified = false;
-    nsNamePHP = "";
-    nsChainPHP = "";
-    nsScopeChainPHP.clear();
-    nsStartsPHP.clear();
-    nsEndsPHP.clear();
     nsNamesPHP.clear();
-    clsNamePHP = "";
-    clsScopeChainPHP.clear();
-    clsChainPHP = "";
-    clsStartsPHP.clear();
-    clsEndsPHP.clear();
     clsNamesPHP.clear();
-    funcNamePHP = "";
-    funcScopeChainPHP.clear();
-    funcChainPHP = "";
-    funcStartsPHP.clear();
-    funcEndsPHP.clear();
     funcNamesPHP.clear();
-    expectedNsNamePHP = "";
-    expectedClsNamePHP = "";
-    expectedFuncNamePHP = "";
+    varsKeysPHP.clear();
+    varsNamesPHP.clear();
+    varsPositionsPHP.clear();
+    varsBlockOffsetsPHP.clear();
+    usedVarsKeysPHP.clear();
+    usedVarsNamesPHP.clear();
     expectedFuncParsPHP = -1;
-    expectedFuncArgsPHP.clear();
-    expectedFuncArgsPHPPositions.clear();
-    expectedFuncArgsPHPBlocks.clear();
     nsScopePHP = -1;
     clsScopePHP = -1;
     funcScopePHP = -1;
-    varsChainsPHP.clear();
-    usedVarsChainsPHP.clear();
-    varsGlobChainPHP = "";
-    usedVarsGlobChainPHP = "";
-    varsClsChainPHP = "";
-    varsChainPHP = "";
-    usedVarsChainPHP = "";
     clsOpenPHP = false;
-    clsOpensPHP.clear();
-    varsClsOpenChainPHP = "";
-    clsPropsChainPHP.clear();
     isGlobalPHP = false;
-    funcNameJS = "";
-    funcScopeChainJS.clear();
-    funcChainJS = "";
-    funcStartsJS.clear();
-    funcEndsJS.clear();
     funcNamesJS.clear();
-    expectedFuncNameJS = "";
-    expectedFuncVarJS = "";
     expectedFuncParsJS = -1;
     funcScopeJS = -1;
-    varsChainJS = "";
-    expectedFuncArgsJS.clear();
-    mediaNameCSS = "";
-    mediaStartsCSS.clear();
-    mediaEndsCSS.clear();
     mediaNamesCSS.clear();
-    expectedMediaNameCSS = "";
-    cssNamesChain = "";
     expectedMediaParsCSS = -1;
     mediaScopeCSS = -1;
-    tagChainHTML = "";
-    tagChainStartsHTML.clear();
-    tagChainEndsHTML.clear();
     tagChainsHTML.clear();
-    keywordPHPprevString = "";
-    keywordPHPprevStringPrevChar = "";
-    keywordJSprevString = "";
-    keywordJSprevStringPrevChar = "";
-    operatorsChainPHP = "";
-    operatorsPHP.clear();
-    operatorsChainJS = "";
-    operatorsJS.clear();
     wantUpdate = false;
-    expectedClsNameJS = "";
-    clsNameJS = "";
     clsScopeJS = -1;
-    clsChainJS = "";
     clsNamesJS.clear();
-    clsStartsJS.clear();
-    clsEndsJS.clear();
-    clsScopeChainJS.clear();
-    clsOpensJS.clear();
     clsOpenJS = false;
     isNewBlock = true;
+    intervals.clear();
+    chunks.clear();
+    chunksPrevStateHash = 0;
+    chunksPrevState.clear();
+}
+
+void HighlightData::setIntervals(int kind, const QVector<int> & starts, const QVector<int> & ends)
+{
+    if (kind < 0 || kind >= INTERVALS_COUNT) return;
+    if (intervals.size() == 0) {
+        if (starts.size() == 0 || starts.size() != ends.size()) return;
+        intervals.fill(0, INTERVALS_COUNT * 2);
+    }
+    bool sorted = true;
+    int count = starts.size() == ends.size() ? starts.size() : 0;
+    intervals[kind * 2] = intervals.size();
+    for (int i=0; i<count; i++) {
+        if (i > 0 && (starts.at(i) < starts.at(i-1) || ends.at(i) < ends.at(i-1))) sorted = false;
+        intervals.append(starts.at(i));
+        intervals.append(ends.at(i));
+    }
+    intervals[kind * 2 + 1] = sorted ? count : -count;
+}
+
+// collects data lists of long line chunks with positions relative to the line
+void HighlightData::mergeChunks(const QVector<HighlightChunk> & chunks)
+{
+    specialChars.clear();
+    specialCharsPos.clear();
+    specialWords.clear();
+    specialWordsPos.clear();
+    modeTags.clear();
+    stateIds.clear();
+    nsNamesPHP.clear();
+    clsNamesPHP.clear();
+    funcNamesPHP.clear();
+    varsKeysPHP.clear();
+    varsNamesPHP.clear();
+    varsPositionsPHP.clear();
+    varsBlockOffsetsPHP.clear();
+    usedVarsKeysPHP.clear();
+    usedVarsNamesPHP.clear();
+    funcNamesJS.clear();
+    mediaNamesCSS.clear();
+    tagChainsHTML.clear();
+    clsNamesJS.clear();
+    spellStarts.clear();
+    spellLengths.clear();
+    intervals.clear();
+    QVector<int> starts[INTERVALS_COUNT], ends[INTERVALS_COUNT];
+    for (int c=0; c<chunks.size(); c++) {
+        const HighlightChunk & chunk = chunks.at(c);
+        const HighlightData * data = chunk.data.data();
+        if (data == nullptr) continue;
+        specialChars += data->specialChars;
+        for (int i=0; i<data->specialCharsPos.size(); i++) specialCharsPos.append(chunk.start + data->specialCharsPos.at(i));
+        specialWords += data->specialWords;
+        for (int i=0; i<data->specialWordsPos.size(); i++) specialWordsPos.append(chunk.start + data->specialWordsPos.at(i));
+        modeTags += data->modeTags;
+        stateIds += data->stateIds;
+        nsNamesPHP += data->nsNamesPHP;
+        clsNamesPHP += data->clsNamesPHP;
+        funcNamesPHP += data->funcNamesPHP;
+        varsKeysPHP += data->varsKeysPHP;
+        varsNamesPHP += data->varsNamesPHP;
+        for (int i=0; i<data->varsPositionsPHP.size(); i++) {
+            int pos = data->varsPositionsPHP.at(i);
+            varsPositionsPHP.append(pos >= 0 ? chunk.start + pos : pos);
+        }
+        varsBlockOffsetsPHP += data->varsBlockOffsetsPHP;
+        usedVarsKeysPHP += data->usedVarsKeysPHP;
+        usedVarsNamesPHP += data->usedVarsNamesPHP;
+        funcNamesJS += data->funcNamesJS;
+        mediaNamesCSS += data->mediaNamesCSS;
+        tagChainsHTML += data->tagChainsHTML;
+        clsNamesJS += data->clsNamesJS;
+        if (data->intervals.size() == 0) continue;
+        for (int kind=0; kind<INTERVALS_COUNT; kind++) {
+            const int * pairs = data->intervals.constData() + data->intervals.at(kind * 2);
+            int count = qAbs(data->intervals.at(kind * 2 + 1));
+            for (int i=0; i<count; i++) {
+                starts[kind].append(chunk.start + pairs[i*2]);
+                ends[kind].append(chunk.start + pairs[i*2+1]);
+            }
+        }
+    }
+    for (int kind=0; kind<INTERVALS_COUNT; kind++) {
+        setIntervals(kind, starts[kind], ends[kind]);
+    }
+}
+
+int HighlightData::getIntervalsCount(int kind) const
+{
+    if (intervals.size() == 0 || kind < 0 || kind >= INTERVALS_COUNT) return 0;
+    return qAbs(intervals.at(kind * 2 + 1));
+}
+
+// returns index of the first interval containing pos or -1
+int HighlightData::findInterval(int kind, int pos) const
+{
+    if (intervals.size() == 0 || kind < 0 || kind >= INTERVALS_COUNT) return -1;
+    const int * data = intervals.constData() + intervals.at(kind * 2);
+    int count = intervals.at(kind * 2 + 1);
+    if (count < 0) {
+        for (int i=0; i<-count; i++) {
+            if (data[i*2] <= pos && data[i*2+1] >= pos) return i;
+        }
+        return -1;
+    }
+    // first interval that ends at or after pos
+    int from = 0, to = count;
+    while (from < to) {
+        int i = (from + to) / 2;
+        if (data[i*2+1] < pos) from = i + 1;
+        else to = i;
+    }
+    if (from < count && data[from*2] <= pos) return from;
+    return -1;
+}
+
+// fingerprint of the state restored by the next block, see isSameState
+void HighlightData::updateStateHash()
+{
+    uint hash = hashCombine(scope->hash, strings->hash);
+    hash = hashCombine(hash, qHash(state));
+    hash = hashCombine(hash, qHash(prevState));
+    hash = hashCombine(hash, qHash(prevPrevState));
+    hash = hashCombine(hash, qHash(static_cast<int>(prevModeSkip)));
+    hash = hashCombine(hash, qHash(static_cast<int>(prevModeSkipC)));
+    hash = hashCombine(hash, qHash(bracesCSS));
+    hash = hashCombine(hash, qHash(bracesJS));
+    hash = hashCombine(hash, qHash(bracesPHP));
+    hash = hashCombine(hash, qHash(parensCSS));
+    hash = hashCombine(hash, qHash(parensJS));
+    hash = hashCombine(hash, qHash(parensPHP));
+    hash = hashCombine(hash, qHash(static_cast<int>(cssMediaScope)));
+    hash = hashCombine(hash, qHash(static_cast<int>(keywordPHPScoped)));
+    hash = hashCombine(hash, qHash(static_cast<int>(keywordJSScoped)));
+    hash = hashCombine(hash, qHash(expectedFuncParsPHP));
+    hash = hashCombine(hash, qHash(nsScopePHP));
+    hash = hashCombine(hash, qHash(clsScopePHP));
+    hash = hashCombine(hash, qHash(funcScopePHP));
+    hash = hashCombine(hash, qHash(static_cast<int>(clsOpenPHP)));
+    hash = hashCombine(hash, qHash(static_cast<int>(isGlobalPHP)));
+    hash = hashCombine(hash, qHash(expectedFuncParsJS));
+    hash = hashCombine(hash, qHash(funcScopeJS));
+    hash = hashCombine(hash, qHash(expectedMediaParsCSS));
+    hash = hashCombine(hash, qHash(mediaScopeCSS));
+    hash = hashCombine(hash, qHash(clsScopeJS));
+    hash = hashCombine(hash, qHash(static_cast<int>(clsOpenJS)));
+    stateHash = hash;
+}
+
+// copies the state restored by the next block
+void HighlightData::copyState(const HighlightData & other)
+{
+    scope = other.scope;
+    strings = other.strings;
+    stateHash = other.stateHash;
+    state = other.state;
+    prevState = other.prevState;
+    prevPrevState = other.prevPrevState;
+    prevModeSkip = other.prevModeSkip;
+    prevModeSkipC = other.prevModeSkipC;
+    bracesCSS = other.bracesCSS;
+    bracesJS = other.bracesJS;
+    bracesPHP = other.bracesPHP;
+    parensCSS = other.parensCSS;
+    parensJS = other.parensJS;
+    parensPHP = other.parensPHP;
+    cssMediaScope = other.cssMediaScope;
+    keywordPHPScoped = other.keywordPHPScoped;
+    keywordJSScoped = other.keywordJSScoped;
+    expectedFuncParsPHP = other.expectedFuncParsPHP;
+    nsScopePHP = other.nsScopePHP;
+    clsScopePHP = other.clsScopePHP;
+    funcScopePHP = other.funcScopePHP;
+    clsOpenPHP = other.clsOpenPHP;
+    isGlobalPHP = other.isGlobalPHP;
+    expectedFuncParsJS = other.expectedFuncParsJS;
+    funcScopeJS = other.funcScopeJS;
+    expectedMediaParsCSS = other.expectedMediaParsCSS;
+    mediaScopeCSS = other.mediaScopeCSS;
+    clsScopeJS = other.clsScopeJS;
+    clsOpenJS = other.clsOpenJS;
+}
+
+// equal state hashes do not prove the same state, the state itself is compared
+bool HighlightData::isSameState(const HighlightData & other) const
+{
+    return stateHash == other.stateHash &&
+        (scope == other.scope || *scope == *other.scope) &&
+        (strings == other.strings || *strings == *other.strings) &&
+        state == other.state &&
+        prevState == other.prevState &&
+        prevPrevState == other.prevPrevState &&
+        prevModeSkip == other.prevModeSkip &&
+        prevModeSkipC == other.prevModeSkipC &&
+        bracesCSS == other.bracesCSS &&
+        bracesJS == other.bracesJS &&
+        bracesPHP == other.bracesPHP &&
+        parensCSS == other.parensCSS &&
+        parensJS == other.parensJS &&
+        parensPHP == other.parensPHP &&
+        cssMediaScope == other.cssMediaScope &&
+        keywordPHPScoped == other.keywordPHPScoped &&
+        keywordJSScoped == other.keywordJSScoped &&
+        expectedFuncParsPHP == other.expectedFuncParsPHP &&
+        nsScopePHP == other.nsScopePHP &&
+        clsScopePHP == other.clsScopePHP &&
+        funcScopePHP == other.funcScopePHP &&
+        clsOpenPHP == other.clsOpenPHP &&
+        isGlobalPHP == other.isGlobalPHP &&
+        expectedFuncParsJS == other.expectedFuncParsJS &&
+        funcScopeJS == other.funcScopeJS &&
+        expectedMediaParsCSS == other.expectedMediaParsCSS &&
+        mediaScopeCSS == other.mediaScopeCSS &&
+        clsScopeJS == other.clsScopeJS &&
+        clsOpenJS == other.clsOpenJS;
+}
+
+int HighlightData::getMemoryUsage() const
+{
+    int bytes = static_cast<int>(sizeof(HighlightData));
+    bytes += vectorMemoryUsage(specialChars) + vectorMemoryUsage(specialCharsPos) + vectorMemoryUsage(specialWordsPos);
+    bytes += stringsMemoryUsage(specialWords);
+    bytes += vectorMemoryUsage(intervals) + vectorMemoryUsage(modeTags) + vectorMemoryUsage(stateIds);
+    bytes += stringsMemoryUsage(nsNamesPHP) + stringsMemoryUsage(clsNamesPHP) + stringsMemoryUsage(funcNamesPHP);
+    bytes += stringsMemoryUsage(varsKeysPHP) + stringsMemoryUsage(varsNamesPHP) + vectorMemoryUsage(varsPositionsPHP) + vectorMemoryUsage(varsBlockOffsetsPHP);
+    bytes += stringsMemoryUsage(usedVarsKeysPHP) + stringsMemoryUsage(usedVarsNamesPHP);
+    bytes += stringsMemoryUsage(clsNamesJS) + stringsMemoryUsage(funcNamesJS);
+    bytes += stringsMemoryUsage(mediaNamesCSS) + stringsMemoryUsage(tagChainsHTML);
+    bytes += vectorMemoryUsage(spellStarts) + vectorMemoryUsage(spellLengths);
+    bytes += vectorMemoryUsage(chunks) + vectorMemoryUsage(formatRangeIds);
+    if (!chunksPrevState.isNull()) bytes += static_cast<int>(sizeof(HighlightData));
+    for (int i=0; i<chunks.size(); i++) {
+        const HighlightChunk & chunk = chunks.at(i);
+        if (chunk.data != nullptr) bytes += chunk.data->getMemoryUsage();
+        bytes += vectorMemoryUsage(chunk.formatIds) + vectorMemoryUsage(chunk.extraFormats);
+    }
+    return bytes;
+}
+
+HighlightScope::HighlightScope()
+{
+    hash = 0;
+}
+
+void HighlightScope::updateHash()
+{
+    uint hash = 0;
+    hash = hashCombine(hash, qHash(nsNamePHP));
+    hash = hashCombine(hash, qHash(nsScopeChainPHP));
+    hash = hashCombine(hash, qHash(nsChainPHP));
+    hash = hashCombine(hash, qHash(clsNamePHP));
+    hash = hashCombine(hash, qHash(clsScopeChainPHP));
+    hash = hashCombine(hash, qHash(clsChainPHP));
+    hash = hashCombine(hash, qHash(funcNamePHP));
+    hash = hashCombine(hash, qHash(funcScopeChainPHP));
+    hash = hashCombine(hash, qHash(funcChainPHP));
+    hash = hashCombine(hash, qHash(expectedNsNamePHP));
+    hash = hashCombine(hash, qHash(expectedClsNamePHP));
+    hash = hashCombine(hash, qHash(expectedFuncNamePHP));
+    hash = hashCombine(hash, qHash(expectedFuncArgsPHP));
+    hash = hashCombine(hash, qHash(expectedFuncArgsPHPPositions));
+    hash = hashCombine(hash, qHash(expectedFuncArgsPHPBlocks));
+    hash = hashCombine(hash, qHash(varsChainsPHP));
+    hash = hashCombine(hash, qHash(usedVarsChainsPHP));
+    hash = hashCombine(hash, qHash(varsGlobChainPHP));
+    hash = hashCombine(hash, qHash(usedVarsGlobChainPHP));
+    hash = hashCombine(hash, qHash(varsClsChainPHP));
+    hash = hashCombine(hash, qHash(varsChainPHP));
+    hash = hashCombine(hash, qHash(usedVarsChainPHP));
+    hash = hashCombine(hash, qHash(clsOpensPHP));
+    hash = hashCombine(hash, qHash(varsClsOpenChainPHP));
+    hash = hashCombine(hash, qHash(clsPropsChainPHP));
+    hash = hashCombine(hash, qHash(funcNameJS));
+    hash = hashCombine(hash, qHash(funcScopeChainJS));
+    hash = hashCombine(hash, qHash(funcChainJS));
+    hash = hashCombine(hash, qHash(expectedFuncNameJS));
+    hash = hashCombine(hash, qHash(expectedFuncVarJS));
+    hash = hashCombine(hash, qHash(varsChainJS));
+    hash = hashCombine(hash, qHash(expectedFuncArgsJS));
+    hash = hashCombine(hash, qHash(mediaNameCSS));
+    hash = hashCombine(hash, qHash(expectedMediaNameCSS));
+    hash = hashCombine(hash, qHash(cssNamesChain));
+    hash = hashCombine(hash, qHash(tagChainHTML));
+    hash = hashCombine(hash, qHash(operatorsChainPHP));
+    hash = hashCombine(hash, hashMap(operatorsPHP));
+    hash = hashCombine(hash, qHash(operatorsChainJS));
+    hash = hashCombine(hash, hashMap(operatorsJS));
+    hash = hashCombine(hash, qHash(expectedClsNameJS));
+    hash = hashCombine(hash, qHash(clsNameJS));
+    hash = hashCombine(hash, qHash(clsChainJS));
+    hash = hashCombine(hash, qHash(clsScopeChainJS));
+    hash = hashCombine(hash, qHash(clsOpensJS));
+    this->hash = hash;
+}
+
+bool HighlightScope::operator==(const HighlightScope & other) const
+{
+    return nsNamePHP == other.nsNamePHP &&
+        nsScopeChainPHP == other.nsScopeChainPHP &&
+        nsChainPHP == other.nsChainPHP &&
+        clsNamePHP == other.clsNamePHP &&
+        clsScopeChainPHP == other.clsScopeChainPHP &&
+        clsChainPHP == other.clsChainPHP &&
+        funcNamePHP == other.funcNamePHP &&
+        funcScopeChainPHP == other.funcScopeChainPHP &&
+        funcChainPHP == other.funcChainPHP &&
+        expectedNsNamePHP == other.expectedNsNamePHP &&
+        expectedClsNamePHP == other.expectedClsNamePHP &&
+        expectedFuncNamePHP == other.expectedFuncNamePHP &&
+        expectedFuncArgsPHP == other.expectedFuncArgsPHP &&
+        expectedFuncArgsPHPPositions == other.expectedFuncArgsPHPPositions &&
+        expectedFuncArgsPHPBlocks == other.expectedFuncArgsPHPBlocks &&
+        varsChainsPHP == other.varsChainsPHP &&
+        usedVarsChainsPHP == other.usedVarsChainsPHP &&
+        varsGlobChainPHP == other.varsGlobChainPHP &&
+        usedVarsGlobChainPHP == other.usedVarsGlobChainPHP &&
+        varsClsChainPHP == other.varsClsChainPHP &&
+        varsChainPHP == other.varsChainPHP &&
+        usedVarsChainPHP == other.usedVarsChainPHP &&
+        clsOpensPHP == other.clsOpensPHP &&
+        varsClsOpenChainPHP == other.varsClsOpenChainPHP &&
+        clsPropsChainPHP == other.clsPropsChainPHP &&
+        funcNameJS == other.funcNameJS &&
+        funcScopeChainJS == other.funcScopeChainJS &&
+        funcChainJS == other.funcChainJS &&
+        expectedFuncNameJS == other.expectedFuncNameJS &&
+        expectedFuncVarJS == other.expectedFuncVarJS &&
+        varsChainJS == other.varsChainJS &&
+        expectedFuncArgsJS == other.expectedFuncArgsJS &&
+        mediaNameCSS == other.mediaNameCSS &&
+        expectedMediaNameCSS == other.expectedMediaNameCSS &&
+        cssNamesChain == other.cssNamesChain &&
+        tagChainHTML == other.tagChainHTML &&
+        operatorsChainPHP == other.operatorsChainPHP &&
+        operatorsPHP == other.operatorsPHP &&
+        operatorsChainJS == other.operatorsChainJS &&
+        operatorsJS == other.operatorsJS &&
+        expectedClsNameJS == other.expectedClsNameJS &&
+        clsNameJS == other.clsNameJS &&
+        clsChainJS == other.clsChainJS &&
+        clsScopeChainJS == other.clsScopeChainJS &&
+        clsOpensJS == other.clsOpensJS;
+}
+
+int HighlightScope::getMemoryUsage() const
+{
+    int bytes = static_cast<int>(sizeof(HighlightScope));
+    bytes += stringMemoryUsage(nsNamePHP) + vectorMemoryUsage(nsScopeChainPHP) + stringMemoryUsage(nsChainPHP);
+    bytes += stringMemoryUsage(clsNamePHP) + vectorMemoryUsage(clsScopeChainPHP) + stringMemoryUsage(clsChainPHP);
+    bytes += stringMemoryUsage(funcNamePHP) + vectorMemoryUsage(funcScopeChainPHP) + stringMemoryUsage(funcChainPHP);
+    bytes += stringMemoryUsage(expectedNsNamePHP) + stringMemoryUsage(expectedClsNamePHP) + stringMemoryUsage(expectedFuncNamePHP);
+    bytes += stringsMemoryUsage(expectedFuncArgsPHP) + vectorMemoryUsage(expectedFuncArgsPHPPositions) + vectorMemoryUsage(expectedFuncArgsPHPBlocks);
+    bytes += stringsMemoryUsage(varsChainsPHP) + stringsMemoryUsage(usedVarsChainsPHP) + stringMemoryUsage(varsGlobChainPHP);
+    bytes += stringMemoryUsage(usedVarsGlobChainPHP) + stringMemoryUsage(varsClsChainPHP) + stringMemoryUsage(varsChainPHP);
+    bytes += stringMemoryUsage(usedVarsChainPHP) + vectorMemoryUsage(clsOpensPHP) + stringMemoryUsage(varsClsOpenChainPHP);
+    bytes += stringsMemoryUsage(clsPropsChainPHP) + stringMemoryUsage(funcNameJS) + vectorMemoryUsage(funcScopeChainJS);
+    bytes += stringMemoryUsage(funcChainJS) + stringMemoryUsage(expectedFuncNameJS) + stringMemoryUsage(expectedFuncVarJS);
+    bytes += stringMemoryUsage(varsChainJS) + stringsMemoryUsage(expectedFuncArgsJS) + stringMemoryUsage(mediaNameCSS);
+    bytes += stringMemoryUsage(expectedMediaNameCSS) + stringMemoryUsage(cssNamesChain) + stringMemoryUsage(tagChainHTML);
+    bytes += stringMemoryUsage(operatorsChainPHP) + mapMemoryUsage(operatorsPHP) + stringMemoryUsage(operatorsChainJS);
+    bytes += mapMemoryUsage(operatorsJS) + stringMemoryUsage(expectedClsNameJS) + stringMemoryUsage(clsNameJS);
+    bytes += stringMemoryUsage(clsChainJS) + vectorMemoryUsage(clsScopeChainJS) + vectorMemoryUsage(clsOpensJS);
+    return bytes;
+}
+
+void HighlightScope::write(QDataStream & out) const
+{
+    out << nsNamePHP << nsScopeChainPHP << nsChainPHP;
+    out << clsNamePHP << clsScopeChainPHP << clsChainPHP;
+    out << funcNamePHP << funcScopeChainPHP << funcChainPHP;
+    out << expectedNsNamePHP << expectedClsNamePHP << expectedFuncNamePHP;
+    out << expectedFuncArgsPHP << expectedFuncArgsPHPPositions << expectedFuncArgsPHPBlocks;
+    out << varsChainsPHP << usedVarsChainsPHP << varsGlobChainPHP << usedVarsGlobChainPHP;
+    out << varsClsChainPHP << varsChainPHP << usedVarsChainPHP;
+    out << clsOpensPHP << varsClsOpenChainPHP << clsPropsChainPHP;
+    out << funcNameJS << funcScopeChainJS << funcChainJS;
+    out << expectedFuncNameJS << expectedFuncVarJS << varsChainJS << expectedFuncArgsJS;
+    out << mediaNameCSS << expectedMediaNameCSS << cssNamesChain << tagChainHTML;
+    out << operatorsChainPHP;
+    writeMap(out, operatorsPHP);
+    out << operatorsChainJS;
+    writeMap(out, operatorsJS);
+    out << expectedClsNameJS << clsNameJS << clsChainJS << clsScopeChainJS << clsOpensJS;
+}
+
+// hashes are seeded per process, so they are computed again
+void HighlightScope::read(QDataStream & in)
+{
+    in >> nsNamePHP >> nsScopeChainPHP >> nsChainPHP;
+    in >> clsNamePHP >> clsScopeChainPHP >> clsChainPHP;
+    in >> funcNamePHP >> funcScopeChainPHP >> funcChainPHP;
+    in >> expectedNsNamePHP >> expectedClsNamePHP >> expectedFuncNamePHP;
+    in >> expectedFuncArgsPHP >> expectedFuncArgsPHPPositions >> expectedFuncArgsPHPBlocks;
+    in >> varsChainsPHP >> usedVarsChainsPHP >> varsGlobChainPHP >> usedVarsGlobChainPHP;
+    in >> varsClsChainPHP >> varsChainPHP >> usedVarsChainPHP;
+    in >> clsOpensPHP >> varsClsOpenChainPHP >> clsPropsChainPHP;
+    in >> funcNameJS >> funcScopeChainJS >> funcChainJS;
+    in >> expectedFuncNameJS >> expectedFuncVarJS >> varsChainJS >> expectedFuncArgsJS;
+    in >> mediaNameCSS >> expectedMediaNameCSS >> cssNamesChain >> tagChainHTML;
+    in >> operatorsChainPHP;
+    readMap(in, operatorsPHP);
+    in >> operatorsChainJS;
+    readMap(in, operatorsJS);
+    in >> expectedClsNameJS >> clsNameJS >> clsChainJS >> clsScopeChainJS >> clsOpensJS;
+    updateHash();
+}
+
+HighlightStrings::HighlightStrings()
+{
+    hash = 0;
+}
+
+void HighlightStrings::updateHash()
+{
+    uint hash = 0;
+    hash = hashCombine(hash, qHash(stringBlock));
+    hash = hashCombine(hash, qHash(mode));
+    hash = hashCombine(hash, qHash(prevMode));
+    hash = hashCombine(hash, qHash(modeExpect));
+    hash = hashCombine(hash, qHash(modeExpectC));
+    hash = hashCombine(hash, qHash(modeString));
+    hash = hashCombine(hash, qHash(modeStringC));
+    hash = hashCombine(hash, qHash(prevModeExpect));
+    hash = hashCombine(hash, qHash(prevModeString));
+    hash = hashCombine(hash, qHash(prevModeExpectC));
+    hash = hashCombine(hash, qHash(prevModeStringC));
+    hash = hashCombine(hash, qHash(stringEscStringCSS));
+    hash = hashCombine(hash, qHash(stringEscStringJS));
+    hash = hashCombine(hash, qHash(regexpEscStringJS));
+    hash = hashCombine(hash, qHash(regexpPrevCharJS));
+    hash = hashCombine(hash, qHash(exprEscStringJS));
+    hash = hashCombine(hash, qHash(stringEscVariableJS));
+    hash = hashCombine(hash, qHash(keywordPHPprevString));
+    hash = hashCombine(hash, qHash(keywordPHPprevStringPrevChar));
+    hash = hashCombine(hash, qHash(keywordJSprevString));
+    hash = hashCombine(hash, qHash(keywordJSprevStringPrevChar));
+    this->hash = hash;
+}
+
+bool HighlightStrings::operator==(const HighlightStrings & other) const
+{
+    return stringBlock == other.stringBlock &&
+        mode == other.mode &&
+        prevMode == other.prevMode &&
+        modeExpect == other.modeExpect &&
+        modeExpectC == other.modeExpectC &&
+        modeString == other.modeString &&
+        modeStringC == other.modeStringC &&
+        prevModeExpect == other.prevModeExpect &&
+        prevModeString == other.prevModeString &&
+        prevModeExpectC == other.prevModeExpectC &&
+        prevModeStringC == other.prevModeStringC &&
+        stringEscStringCSS == other.stringEscStringCSS &&
+        stringEscStringJS == other.stringEscStringJS &&
+        regexpEscStringJS == other.regexpEscStringJS &&
+        regexpPrevCharJS == other.regexpPrevCharJS &&
+        exprEscStringJS == other.exprEscStringJS &&
+        stringEscVariableJS == other.stringEscVariableJS &&
+        keywordPHPprevString == other.keywordPHPprevString &&
+        keywordPHPprevStringPrevChar == other.keywordPHPprevStringPrevChar &&
+        keywordJSprevString == other.keywordJSprevString &&
+        keywordJSprevStringPrevChar == other.keywordJSprevStringPrevChar;
+}
+
+int HighlightStrings::getMemoryUsage() const
+{
+    int bytes = static_cast<int>(sizeof(HighlightStrings));
+    bytes += stringMemoryUsage(stringBlock) + stringMemoryUsage(mode) + stringMemoryUsage(prevMode);
+    bytes += stringMemoryUsage(modeExpect) + stringMemoryUsage(modeExpectC) + stringMemoryUsage(modeString) + stringMemoryUsage(modeStringC);
+    bytes += stringMemoryUsage(prevModeExpect) + stringMemoryUsage(prevModeString) + stringMemoryUsage(prevModeExpectC) + stringMemoryUsage(prevModeStringC);
+    bytes += stringMemoryUsage(stringEscStringCSS) + stringMemoryUsage(stringEscStringJS) + stringMemoryUsage(regexpEscStringJS) + stringMemoryUsage(regexpPrevCharJS);
+    bytes += stringMemoryUsage(exprEscStringJS) + stringMemoryUsage(stringEscVariableJS);
+    bytes += stringMemoryUsage(keywordPHPprevString) + stringMemoryUsage(keywordPHPprevStringPrevChar);
+    bytes += stringMemoryUsage(keywordJSprevString) + stringMemoryUsage(keywordJSprevStringPrevChar);
+    return bytes;
+}
+
+void HighlightStrings::write(QDataStream & out) const
+{
+    out << stringBlock << mode << prevMode;
+    out << modeExpect << modeExpectC << modeString << modeStringC;
+    out << prevModeExpect << prevModeString << prevModeExpectC << prevModeStringC;
+    out << stringEscStringCSS << stringEscStringJS << regexpEscStringJS << regexpPrevCharJS;
+    out << exprEscStringJS << stringEscVariableJS;
+    out << keywordPHPprevString << keywordPHPprevStringPrevChar;
+    out << keywordJSprevString << keywordJSprevStringPrevChar;
+}
+
+void HighlightStrings::read(QDataStream & in)
+{
+    in >> stringBlock >> mode >> prevMode;
+    in >> modeExpect >> modeExpectC >> modeString >> modeStringC;
+    in >> prevModeExpect >> prevModeString >> prevModeExpectC >> prevModeStringC;
+    in >> stringEscStringCSS >> stringEscStringJS >> regexpEscStringJS >> regexpPrevCharJS;
+    in >> exprEscStringJS >> stringEscVariableJS;
+    in >> keywordPHPprevString >> keywordPHPprevStringPrevChar;
+    in >> keywordJSprevString >> keywordJSprevStringPrevChar;
+    updateHash();
+}
+
+// a shared state is written once, the next blocks refer to it by index
+template<typename T>
+static void writeShared(QDataStream & out, const QExplicitlySharedDataPointer<T> & shared, QHash<const T *, int> & indexes)
+{
+    typename QHash<const T *, int>::const_iterator it = indexes.constFind(shared.data());
+    if (it != indexes.constEnd()) {
+        out << static_cast<qint32>(it.value());
+    } else {
+        int index = indexes.size();
+        indexes.insert(shared.data(), index);
+        out << static_cast<qint32>(index);
+        shared->write(out);
+    }
+}
+
+template<typename T>
+static bool readShared(QDataStream & in, QExplicitlySharedDataPointer<T> & shared, QVector<QExplicitlySharedDataPointer<T>> & list)
+{
+    qint32 index = -1;
+    in >> index;
+    if (in.status() != QDataStream::Ok || index < 0 || index > list.size()) return false;
+    if (index == list.size()) {
+        QExplicitlySharedDataPointer<T> newShared(new T());
+        newShared->read(in);
+        list.append(newShared);
+    }
+    shared = list.at(index);
+    return true;
+}
+
+// Editor marks and spell check results are not written.
+void HighlightData::write(QDataStream & out, QHash<const HighlightScope *, int> & scopeIndexes, QHash<const HighlightStrings *, int> & stringsIndexes) const
+{
+    writeShared(out, scope, scopeIndexes);
+    writeShared(out, strings, stringsIndexes);
+    out << prevModeSkip << prevModeSkipC;
+    out << state << prevState << prevPrevState;
+    out << bracesCSS << bracesJS << bracesPHP << parensCSS << parensJS << parensPHP;
+    out << cssMediaScope << keywordPHPScoped << keywordJSScoped;
+    out << specialChars << specialCharsPos << specialWords << specialWordsPos;
+    writeStrings(out, modeTags);
+    out << stateIds;
+    out << nsNamesPHP << clsNamesPHP << funcNamesPHP;
+    out << varsKeysPHP << varsNamesPHP << varsPositionsPHP << varsBlockOffsetsPHP;
+    out << usedVarsKeysPHP << usedVarsNamesPHP;
+    out << expectedFuncParsPHP << nsScopePHP << clsScopePHP << funcScopePHP << clsOpenPHP << isGlobalPHP;
+    out << funcNamesJS << expectedFuncParsJS << funcScopeJS;
+    out << mediaNamesCSS << expectedMediaParsCSS << mediaScopeCSS;
+    out << tagChainsHTML;
+    out << clsScopeJS << clsNamesJS << clsOpenJS;
+    out << intervals << formatRangeIds;
+    out << static_cast<quint32>(chunks.size());
+    for (int i=0; i<chunks.size(); i++) {
+        const HighlightChunk & chunk = chunks.at(i);
+        out << static_cast<qint32>(chunk.start) << static_cast<qint32>(chunk.length);
+        out << chunk.formatIds << chunk.extraFormats;
+        out << !chunk.data.isNull();
+        if (!chunk.data.isNull()) chunk.data->write(out, scopeIndexes, stringsIndexes);
+    }
+}
+
+// text hashes of chunks are not kept, so chunks of a restored line are parsed again when it is changed
+bool HighlightData::read(QDataStream & in, QVector<QExplicitlySharedDataPointer<HighlightScope>> & scopes, QVector<QExplicitlySharedDataPointer<HighlightStrings>> & stringsList)
+{
+    reset();
+    if (!readShared(in, scope, scopes)) return false;
+    if (!readShared(in, strings, stringsList)) return false;
+    in >> prevModeSkip >> prevModeSkipC;
+    in >> state >> prevState >> prevPrevState;
+    in >> bracesCSS >> bracesJS >> bracesPHP >> parensCSS >> parensJS >> parensPHP;
+    in >> cssMediaScope >> keywordPHPScoped >> keywordJSScoped;
+    in >> specialChars >> specialCharsPos >> specialWords >> specialWordsPos;
+    readStrings(in, modeTags);
+    in >> stateIds;
+    in >> nsNamesPHP >> clsNamesPHP >> funcNamesPHP;
+    in >> varsKeysPHP >> varsNamesPHP >> varsPositionsPHP >> varsBlockOffsetsPHP;
+    in >> usedVarsKeysPHP >> usedVarsNamesPHP;
+    in >> expectedFuncParsPHP >> nsScopePHP >> clsScopePHP >> funcScopePHP >> clsOpenPHP >> isGlobalPHP;
+    in >> funcNamesJS >> expectedFuncParsJS >> funcScopeJS;
+    in >> mediaNamesCSS >> expectedMediaParsCSS >> mediaScopeCSS;
+    in >> tagChainsHTML;
+    in >> clsScopeJS >> clsNamesJS >> clsOpenJS;
+    in >> intervals >> formatRangeIds;
+    quint32 chunksCount = 0;
+    in >> chunksCount;
+    for (quint32 i=0; i<chunksCount && in.status() == QDataStream::Ok; i++) {
+        HighlightChunk chunk;
+        qint32 start = 0, length = 0;
+        bool hasData = false;
+        in >> start >> length;
+        in >> chunk.formatIds >> chunk.extraFormats;
+        in >> hasData;
+        chunk.start = start;
+        chunk.length = length;
+        chunk.textHash = 0;
+        if (hasData) {
+            chunk.data = QSharedPointer<HighlightData>(new HighlightData());
+            if (!chunk.data->read(in, scopes, stringsList)) return false;
+        }
+        chunks.append(chunk);
+    }
+    if (in.status() != QDataStream::Ok) return false;
+    isNewBlock = false;
+    updateStateHash();
+    return true;
 }
@@ -6,13 +6,46 @@
 
 #include "highlightwords.h"
 #include <QString>
-#include <QFile>
-#include <QTextStream>
-#include <QTimer>
-
-const int LOAD_DELAY = 250; // should not be less then PROJECT_LOAD_DELAY
-
-HighlightWords::HighlightWords(){}
+#include <QWriteLocker>
+
+HighlightWords::HighlightWords():
+    phpwords(true, &HIGHLIGHT_PHP_WORDS),
+    phpwordsCS(false, &HIGHLIGHT_PHP_WORDS_CS),
+    phpClassWordsCS(false),
+    jswordsCS(false, &HIGHLIGHT_JS_WORDS_CS),
+    jsExtDartWordsCS(false),
+    csswords(true, &HIGHLIGHT_CSS_WORDS),
+    htmlwords(true),
+    htmlshorts(true),
+    generalwords(true, &HIGHLIGHT_GENERAL_WORDS)
+{
+    palette[FORMAT_NONE] = &noFormat;
+    palette[FORMAT_KEYWORD] = &keywordFormat;
+    palette[FORMAT_CLASS] = &classFormat;
+    palette[FORMAT_KNOWN_FUNCTION] = &knownFunctionFormat;
+    palette[FORMAT_KNOWN_VARIABLE] = &knownVariableFormat;
+    palette[FORMAT_CONST] = &constFormat;
+    palette[FORMAT_KNOWN] = &knownFormat;
+    palette[FORMAT_CSS_SPECIAL] = &cssSpecialFormat;
+    palette[FORMAT_PSEUDO_CLASS] = &pseudoClassFormat;
+    palette[FORMAT_VARIABLE] = &variableFormat;
+    palette[FORMAT_UNUSED_VARIABLE] = &unusedVariableFormat;
+    palette[FORMAT_SINGLE_LINE_COMMENT] = &singleLineCommentFormat;
+    palette[FORMAT_MULTI_LINE_COMMENT] = &multiLineCommentFormat;
+    palette[FORMAT_STRING] = &stringFormat;
+    palette[FORMAT_FUNCTION] = &functionFormat;
+    palette[FORMAT_PHP_TAG] = &phpTagFormat;
+    palette[FORMAT_TAG] = &tagFormat;
+    palette[FORMAT_TAG_NAME] = &tagNameFormat;
+    palette[FORMAT_SELECTOR] = &selectorFormat;
+    palette[FORMAT_SELECTOR_TAG] = &selectorTagFormat;
+    palette[FORMAT_PROPERTY] = &propertyFormat;
+    palette[FORMAT_EXPRESSION] = &expressionFormat;
+    palette[FORMAT_SPACE] = &spaceFormat;
+    palette[FORMAT_TAB] = &tabFormat;
+    palette[FORMAT_COLOR] = &colorFormat;
+    palette[FORMAT_PUNCTUATION] = &punctuationFormat;
+}
 
 HighlightWords& HighlightWords::instance()
 {
@@ -20,40 +53,6 @@ HighlightWords& HighlightWords::instance()
     return _instance;
 }
 
-void HighlightWords::loadDelayed()
-{
-    instance()._loadDelayed();
-}
-
-void HighlightWords::_loadDelayed()
-{
-    QTimer::singleShot(LOAD_DELAY, this, SLOT(load()));
-}
-
-void HighlightWords::load()
-{
-    instance()._load();
-}
-
-void HighlightWords::_load()
-{
-    loadPHPWords();
-    loadJSWords();
-    loadCSSWords();
-    loadGeneralWords();
-}
-
-void HighlightWords::reload()
-{
-    instance()._reload();
-}
-
-void HighlightWords::_reload()
-{
-    reset();
-    load();
-}
-
 void HighlightWords::reset()
 {
     instance()._reset();
@@ -61,6 +60,8 @@ void HighlightWords::reset()
 
 void HighlightWords::_reset()
 {
+    // built-in words are compiled in, only the words added at runtime are cleared
+    QWriteLocker locker(&lock);
     phpwords.clear();
     phpwordsCS.clear();
     phpClassWordsCS.clear();
@@ -77,6 +78,7 @@ void HighlightWords::setColors()
 
 void HighlightWords::_setColors()
 {
+    QWriteLocker locker(&lock);
     // highlight colors
     std::string keywordColorStr = Settings::get("highlight_keyword_color");
     QColor keywordColor(keywordColorStr.c_str());
@@ -178,125 +180,6 @@ void HighlightWords::_setColors()
     punctuationFormat.setFontWeight(QFont::Bold);
 }
 
-void HighlightWords::loadPHPWords()
-{
-    QString k;
-
-    // keywords
-    QFile kf(":/highlight/php_keys");
-    kf.open(QIODevice::ReadOnly);
-    QTextStream kin(&kf);
-    while (!kin.atEnd()) {
-        k = kin.readLine();
-        if (k == "") continue;
-        phpwords[k.toStdString()] = keywordFormat;
-    }
-    kf.close();
-
-    // consts
-    QFile cf(":/highlight/php_consts");
-    cf.open(QIODevice::ReadOnly);
-    QTextStream cin(&cf);
-    while (!cin.atEnd()) {
-        k = cin.readLine();
-        if (k == "") continue;
-        phpwordsCS[k.toStdString()] = keywordFormat;
-    }
-    cf.close();
-
-    // types
-    QFile tf(":/highlight/php_types");
-    tf.open(QIODevice::ReadOnly);
-    QTextStream tin(&tf);
-    while (!tin.atEnd()) {
-        k = tin.readLine();
-        if (k == "") continue;
-        phpwords[k.toStdString()] = knownFormat;
-    }
-    tf.close();
-
-    // classes
-    QFile clf(":/highlight/php_classes");
-    clf.open(QIODevice::ReadOnly);
-    QTextStream clin(&clf);
-    while (!clin.atEnd()) {
-        k = clin.readLine();
-        if (k == "") continue;
-        phpwords[k.toStdString()] = knownFormat;
-    }
-    clf.close();
-}
-
-void HighlightWords::loadJSWords()
-{
-    QString k;
-
-    // keywords
-    QFile kf(":/highlight/js_keys");
-    kf.open(QIODevice::ReadOnly);
-    QTextStream kin(&kf);
-    while (!kin.atEnd()) {
-        k = kin.readLine();
-        if (k == "") continue;
-        jswordsCS[k.toStdString()] = keywordFormat;
-    }
-    kf.close();
-}
-
-void HighlightWords::loadCSSWords()
-{
-    QString k;
-
-    // keywords
-    QFile kf(":/highlight/css_keys");
-    kf.open(QIODevice::ReadOnly);
-    QTextStream kin(&kf);
-    while (!kin.atEnd()) {
-        k = kin.readLine();
-        if (k == "") continue;
-        csswords[k.toStdString()] = keywordFormat;
-    }
-    kf.close();
-
-    // special
-    QFile sf(":/highlight/css_spec");
-    sf.open(QIODevice::ReadOnly);
-    QTextStream sin(&sf);
-    while (!sin.atEnd()) {
-        k = sin.readLine();
-        if (k == "") continue;
-        csswords[k.toStdString()] = cssSpecialFormat;
-    }
-    sf.close();
-
-    // types
-    QFile tf(":/highlight/css_pseudo");
-    tf.open(QIODevice::ReadOnly);
-    QTextStream tin(&tf);
-    while (!tin.atEnd()) {
-        k = tin.readLine();
-        if (k == "") continue;
-        csswords[k.toStdString()] = pseudoClassFormat;
-    }
-    tf.close();
-}
-
-void HighlightWords::loadGeneralWords()
-{
-    QString k;
-
-    // keywords
-    QFile kf(":/highlight/general_keys");
-    kf.open(QIODevice::ReadOnly);
-    QTextStream kin(&kf);
-    while (!kin.atEnd()) {
-        k = kin.readLine();
-        if (k == "") continue;
-        generalwords[k.toStdString()] = keywordFormat;
-    }
-    kf.close();
-}
-
 void HighlightWords::addPHPClass(QString k)
 {
     instance()._addPHPClass(k);
@@ -304,7 +187,8 @@ void HighlightWords::addPHPClass(QString k)
 
 void HighlightWords::_addPHPClass(QString k)
 {
-    phpwords[k.toLower().toStdString()] = classFormat;
+    QWriteLocker locker(&lock);
+    phpwords.insert(k, FORMAT_CLASS);
 }
 
 void HighlightWords::addPHPFunction(QString k)
@@ -314,7 +198,8 @@ void HighlightWords::addPHPFunction(QString k)
 
 void HighlightWords::_addPHPFunction(QString k)
 {
-    phpwords[k.toLower().toStdString()] = knownFunctionFormat;
+    QWriteLocker locker(&lock);
+    phpwords.insert(k, FORMAT_KNOWN_FUNCTION);
 }
 
 void HighlightWords::addPHPVariable(QString k)
@@ -324,7 +209,8 @@ void HighlightWords::addPHPVariable(QString k)
 
 void HighlightWords::_addPHPVariable(QString k)
 {
-    phpwordsCS[k.toStdString()] = knownVariableFormat;
+    QWriteLocker locker(&lock);
+    phpwordsCS.insert(k, FORMAT_KNOWN_VARIABLE);
 }
 
 void HighlightWords::addPHPConstant(QString k)
@@ -334,7 +220,8 @@ void HighlightWords::addPHPConstant(QString k)
 
 void HighlightWords::_addPHPConstant(QString k)
 {
-    phpwordsCS[k.toStdString()] = constFormat;
+    QWriteLocker locker(&lock);
+    phpwordsCS.insert(k, FORMAT_CONST);
 }
 
 void HighlightWords::addPHPClassConstant(QString cls, QString c)
@@ -344,9 +231,10 @@ void HighlightWords::addPHPClassConstant(QString cls, QString c)
 
 void HighlightWords::_addPHPClassConstant(QString cls, QString c)
 {
+    QWriteLocker locker(&lock);
     if (cls.indexOf("\\") >= 0) cls = cls.mid(cls.lastIndexOf("\\")+1);
     QString k = cls.toLower() + "::" + c;
-    phpClassWordsCS[k.toStdString()] = constFormat;
+    phpClassWordsCS.insert(k, FORMAT_CONST);
 }
 
 void HighlightWords::addJSFunction(QString k)
@@ -356,7 +244,8 @@ void HighlightWords::addJSFunction(QString k)
 
 void HighlightWords::_addJSFunction(QString k)
 {
-    jswordsCS[k.toStdString()] = knownFunctionFormat;
+    QWriteLocker locker(&lock);
+    jswordsCS.insert(k, FORMAT_KNOWN_FUNCTION);
 }
 
 void HighlightWords::addJSInterface(QString k)
@@ -366,7 +255,8 @@ void HighlightWords::addJSInterface(QString k)
 
 void HighlightWords::_addJSInterface(QString k)
 {
-    jswordsCS[k.toStdString()] = classFormat;
+    QWriteLocker locker(&lock);
+    jswordsCS.insert(k, FORMAT_CLASS);
 }
 
 void HighlightWords::addJSObject(QString k)
@@ -376,7 +266,8 @@ void HighlightWords::addJSObject(QString k)
 
 void HighlightWords::_addJSObject(QString k)
 {
-    jswordsCS[k.toStdString()] = classFormat;
+    QWriteLocker locker(&lock);
+    jswordsCS.insert(k, FORMAT_CLASS);
 }
 
 void HighlightWords::addJSExtDartObject(QString k)
@@ -386,7 +277,8 @@ void HighlightWords::addJSExtDartObject(QString k)
 
 void HighlightWords::_addJSExtDartObject(QString k)
 {
-    jsExtDartWordsCS[k.toStdString()] = classFormat;
+    QWriteLocker locker(&lock);
+    jsExtDartWordsCS.insert(k, FORMAT_CLASS);
 }
 
 void HighlightWords::addJSExtDartFunction(QString k)
@@ -396,7 +288,8 @@ void HighlightWords::addJSExtDartFunction(QString k)
 
 void HighlightWords::_addJSExtDartFunction(QString k)
 {
-    jsExtDartWordsCS[k.toStdString()] = knownFunctionFormat;
+    QWriteLocker locker(&lock);
+    jsExtDartWordsCS.insert(k, FORMAT_KNOWN_FUNCTION);
 }
 
 void HighlightWords::addCSSProperty(QString k)
@@ -406,7 +299,8 @@ void HighlightWords::addCSSProperty(QString k)
 
 void HighlightWords::_addCSSProperty(QString k)
 {
-    csswords[k.toStdString()] = knownFormat;
+    QWriteLocker locker(&lock);
+    csswords.insert(k, FORMAT_KNOWN);
 }
 
 void HighlightWords::addHTMLTag(QString k)
@@ -416,7 +310,8 @@ void HighlightWords::addHTMLTag(QString k)
 
 void HighlightWords::_addHTMLTag(QString k)
 {
-    htmlwords[k.toStdString()] = knownFormat;
+    QWriteLocker locker(&lock);
+    htmlwords.insert(k, FORMAT_KNOWN);
 }
 
 void HighlightWords::addHTMLShortTag(QString k)
@@ -426,5 +321,6 @@ void HighlightWords::addHTMLShortTag(QString k)
 
 void HighlightWords::_addHTMLShortTag(QString k)
 {
-    htmlshorts[k.toStdString()] = knownFormat;
+    QWriteLocker locker(&lock);
+    htmlshorts.insert(k, FORMAT_KNOWN);
 }
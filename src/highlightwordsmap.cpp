@@ -0,0 +1,133 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include "highlightwordsmap.h"
+
+const int WORDS_MAP_MIN_CAPACITY = 64;
+const uint WORDS_TABLE_HASH_PRIME = 0x01000193; // should match tools/highlightwords.py
+
+HighlightWordsMap::HighlightWordsMap(bool caseInsensitive, const HighlightWordsTable * table):
+    caseInsensitive(caseInsensitive),
+    table(table),
+    count(0),
+    mask(0)
+{
+}
+
+ushort HighlightWordsMap::fold(ushort c) const
+{
+    if (!caseInsensitive) return c;
+    if (c < 128) return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+    return QChar::toLower(c);
+}
+
+uint HighlightWordsMap::hashKey(const QChar * data, int length) const
+{
+    // FNV-1a
+    uint hash = 2166136261u;
+    for (int i=0; i<length; i++) {
+        hash ^= fold(data[i].unicode());
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint HighlightWordsMap::tableHash(uint seed, const QChar * data, int length) const
+{
+    uint hash = seed != 0 ? seed : WORDS_TABLE_HASH_PRIME;
+    for (int i=0; i<length; i++) {
+        hash = (hash * WORDS_TABLE_HASH_PRIME) ^ fold(data[i].unicode());
+    }
+    return hash;
+}
+
+int HighlightWordsMap::findInTable(const QChar * data, int length) const
+{
+    uint size = static_cast<uint>(table->size);
+    if (size == 0) return FORMAT_NONE;
+    int seed = table->seeds[tableHash(0, data, length) % size];
+    uint slot = seed < 0 ? static_cast<uint>(-seed-1) : tableHash(static_cast<uint>(seed), data, length) % size;
+    // words in compiled tables are ASCII
+    const char * word = table->words[slot];
+    for (int i=0; i<length; i++) {
+        if (word[i] == '\0' || static_cast<uchar>(word[i]) != fold(data[i].unicode())) return FORMAT_NONE;
+    }
+    if (word[length] != '\0') return FORMAT_NONE;
+    return table->formats[slot];
+}
+
+int HighlightWordsMap::findSlot(const QChar * data, int length, uint hash) const
+{
+    int i = static_cast<int>(hash) & mask;
+    for (;;) {
+        const Entry & entry = entries[i];
+        if (entry.keyOffset < 0) return i;
+        if (entry.hash == hash && entry.keyLength == length) {
+            const ushort * key = keys.data() + entry.keyOffset;
+            int k = 0;
+            while (k < length && key[k] == fold(data[k].unicode())) k++;
+            if (k == length) return i;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+void HighlightWordsMap::rehash(int capacity)
+{
+    std::vector<Entry> oldEntries;
+    oldEntries.swap(entries);
+    Entry empty = {0, -1, 0, FORMAT_NONE};
+    entries.assign(capacity, empty);
+    mask = capacity - 1;
+    for (const Entry & entry : oldEntries) {
+        if (entry.keyOffset < 0) continue;
+        int i = static_cast<int>(entry.hash) & mask;
+        while (entries[i].keyOffset >= 0) i = (i + 1) & mask;
+        entries[i] = entry;
+    }
+}
+
+void HighlightWordsMap::insert(const QString & key, int formatId)
+{
+    // keep the load factor at or below one half
+    if ((count + 1) * 2 > static_cast<int>(entries.size())) {
+        int capacity = qMax(WORDS_MAP_MIN_CAPACITY, static_cast<int>(entries.size()) * 2);
+        rehash(capacity);
+    }
+    uint hash = hashKey(key.constData(), key.size());
+    int i = findSlot(key.constData(), key.size(), hash);
+    Entry & entry = entries[i];
+    if (entry.keyOffset >= 0) {
+        entry.formatId = formatId;
+        return;
+    }
+    entry.hash = hash;
+    entry.keyOffset = static_cast<int>(keys.size());
+    entry.keyLength = key.size();
+    entry.formatId = formatId;
+    for (int k=0; k<key.size(); k++) {
+        keys.push_back(fold(key.at(k).unicode()));
+    }
+    count++;
+}
+
+int HighlightWordsMap::find(const QChar * data, int length) const
+{
+    if (count > 0) {
+        const Entry & entry = entries[findSlot(data, length, hashKey(data, length))];
+        if (entry.keyOffset >= 0) return entry.formatId;
+    }
+    if (table != nullptr) return findInTable(data, length);
+    return FORMAT_NONE;
+}
+
+void HighlightWordsMap::clear()
+{
+    std::vector<Entry>().swap(entries);
+    std::vector<ushort>().swap(keys);
+    count = 0;
+    mask = 0;
+}
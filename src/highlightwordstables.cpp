@@ -0,0 +1,2184 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+// generated by tools/highlightwords.py, do not edit
+
+#include "highlightwordsmap.h"
+
+static const int TABLE_PHP_WORDS_SEEDS[] = {
+    -101, -100, -99, -98, 0, 0, 3, 7, 2, -96, 0, -91, -90, 2, 0, -87,
+    -85, 1, 0, 0, -84, 0, 1, -83, 0, 0, -81, -80, 0, -78, 0, -75,
+    0, 0, 4, 0, -73, -71, 0, 0, 1, 1, -69, 0, 2, 2, 0, 0,
+    1, -67, -66, -65, 0, -62, 4, -58, -57, -54, 0, -50, 3, -46, 4, 3,
+    9, 0, 0, -37, 7, -32, 0, 0, 0, 1, -27, -22, -18, -16, 2, 0,
+    5, 0, 0, 0, 3, -14, 0, 0, -10, -7, 0, -6, -4, 0, 12, 1,
+    0, 0, -3, -1, 4
+};
+
+static const char * const TABLE_PHP_WORDS_WORDS[] = {
+    "clone", "protected", "catch", "continue",
+    "instanceof", "typeerror", "public", "if",
+    "assertionerror", "float", "const", "iterable",
+    "mixed", "endif", "trait", "endwhile",
+    "unset", "closure", "integer", "directory",
+    "var", "callable", "list", "declare",
+    "implements", "default", "void", "interface",
+    "false", "bool", "endswitch", "boolean",
+    "exception", "extends", "exit", "for",
+    "divisionbyzeroerror", "print", "__php_incomplete_class", "stdclass",
+    "case", "object", "array", "xor",
+    "elseif", "php_user_filter", "class", "include",
+    "generator", "and", "final", "error",
+    "abstract", "as", "die", "throw",
+    "int", "__halt_compiler", "return", "while",
+    "numeric", "true", "include_once", "try",
+    "parent", "use", "arithmeticerror", "require_once",
+    "require", "yield", "private", "endfor",
+    "static", "break", "foreach", "real",
+    "or", "errorexception", "self", "endforeach",
+    "resource", "eval", "throwable", "function",
+    "global", "null", "insteadof", "new",
+    "empty", "switch", "string", "enddeclare",
+    "isset", "else", "echo", "finally",
+    "double", "parseerror", "namespace", "goto",
+    "do"
+};
+
+static const unsigned char TABLE_PHP_WORDS_FORMATS[] = {
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KNOWN,
+    FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KNOWN, FORMAT_KNOWN,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KNOWN,
+    FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KNOWN,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KNOWN, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KNOWN,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KNOWN,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KNOWN, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KNOWN, FORMAT_KNOWN, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD
+};
+
+const HighlightWordsTable HIGHLIGHT_PHP_WORDS = {
+    101, TABLE_PHP_WORDS_SEEDS, TABLE_PHP_WORDS_WORDS, TABLE_PHP_WORDS_FORMATS
+};
+
+static const int TABLE_PHP_WORDS_CS_SEEDS[] = {
+    0, 1, 0, -3402, 1, -3399, -3398, 0, 0, 0, 0, 2, 0, 0, -3396, 1,
+    0, 0, -3392, 2, 2, 3, 0, 1, 0, 0, 0, -3391, -3389, 1, 2, -3386,
+    0, 0, 2, -3384, 0, 0, 1, 0, -3382, -3381, 0, -3379, 1, 1, 0, 1,
+    6, -3376, -3369, -3365, 0, 1, -3363, 1, 3, 1, 0, 0, 0, 0, 1, 5,
+    0, -3362, -3361, 0, -3358, 1, 1, 0, 0, -3354, -3353, -3352, 1, 0, -3351, 0,
+    0, -3349, 1, 1, -3348, -3344, 2, 1, 3, 0, 0, 0, 0, 0, -3341, -3338,
+    -3336, 0, 0, 1, -3335, 1, 0, -3334, -3332, 1, 1, 1, 0, 0, 1, 0,
+    -3331, 0, 0, 0, 1, 2, -3327, 0, 0, 2, -3326, -3325, -3324, 0, 0, 0,
+    2, 0, 0, 1, 0, 3, 0, -3319, 1, 0, 2, -3317, 0, 1, 0, 1,
+    1, 1, 2, -3314, -3311, 0, 1, 0, 0, 1, 3, -3310, -3308, -3307, 0, -3306,
+    -3303, -3299, 2, 0, 0, -3298, -3293, 1, 0, 1, 1, 0, 0, -3292, -3291, -3286,
+    0, 0, 1, 5, 6, -3285, -3283, -3278, 1, -3277, -3270, 0, 0, -3269, -3267, 0,
+    2, -3265, 1, -3263, 0, -3262, 2, 0, 0, -3259, 0, -3257, -3255, -3254, 0, -3253,
+    0, 0, -3250, 1, 0, 0, 2, 0, 0, 0, 1, 0, -3249, 0, 2, 0,
+    2, 0, 2, 0, 1, 2, 0, 0, 1, 0, -3243, 2, -3242, 0, -3241, -3240,
+    0, -3238, 0, 0, 0, 1, 0, 2, 1, 5, 1, 1, 1, -3237, 4, -3234,
+    0, 1, -3230, -3229, 0, 1, 0, 0, 0, 1, 1, 7, 0, 0, 0, 0,
+    1, -3225, 0, 0, 0, -3223, -3222, 1, -3221, 1, 0, 0, 0, 0, 4, -3218,
+    -3217, 1, 1, -3213, 0, -3211, -3208, -3206, 0, -3204, -3199, -3197, 0, -3195, -3194, 2,
+    0, -3191, -3190, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3187, 0, 1, 0,
+    0, 1, 0, 0, 0, 0, 0, -3186, -3182, 0, -3179, -3176, 1, 0, 2, 0,
+    1, 0, 0, 6, 1, 1, 0, 4, 3, -3173, 2, -3172, 1, -3170, -3167, 0,
+    -3165, 2, -3164, -3163, 0, 0, 0, 1, -3161, 0, -3158, 0, 0, 0, -3157, 0,
+    0, 1, 0, 1, -3156, 0, 0, 0, 0, 0, 0, -3155, -3150, 1, 0, 0,
+    -3148, 1, 0, 0, 0, -3147, 0, 0, -3145, 2, -3139, 0, -3138, 0, -3136, -3133,
+    -3132, -3131, 0, -3130, 0, 3, -3128, -3127, -3123, 0, 0, 0, 0, -3121, 0, -3116,
+    3, 0, -3115, -3114, -3109, 0, -3108, 4, -3107, 0, -3100, -3098, 0, 0, -3097, 1,
+    0, -3095, -3093, -3090, 0, 0, 1, 1, -3086, -3082, -3081, 1, -3078, -3075, 0, -3074,
+    -3071, 3, 0, 1, -3070, -3069, -3068, -3066, 0, 0, -3065, 2, 3, 3, 2, -3060,
+    0, -3059, -3051, -3049, 0, 6, 0, 1, 2, -3048, -3047, 0, 0, 0, 0, -3046,
+    0, 0, -3045, 0, 3, 1, 0, -3044, 0, 2, 2, 2, 0, 1, -3041, 0,
+    0, -3036, -3033, -3031, -3025, 0, 1, 3, 0, 2, 0, 4, 2, -3015, 0, 0,
+    1, -3011, -3010, 4, -3005, 0, 0, 2, -3004, 3, 0, 0, 0, 0, -3001, 0,
+    0, 2, -2992, 0, 1, 0, -2991, 1, 1, 1, 0, 0, 0, 0, 1, -2990,
+    -2989, 2, 0, 0, -2987, 0, 2, -2983, -2982, -2979, 0, 1, 0, 2, 0, -2977,
+    0, 0, 0, -2975, 1, 2, 1, 10, 2, 0, 0, 0, -2974, 0, 0, -2972,
+    -2959, 1, 0, 2, 1, -2958, 1, -2952, -2951, -2947, 0, 1, -2944, 0, 0, -2942,
+    -2941, -2932, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2918, 0, -2917, 0, 3,
+    1, -2914, -2913, 0, -2909, 3, -2907, 3, -2905, 0, -2904, 0, 0, 0, 1, 0,
+    3, 0, 0, 0, 0, -2899, -2898, 1, 0, 1, -2897, 0, -2894, 0, 0, 0,
+    -2889, 2, 0, -2887, -2885, 2, -2877, 2, 1, 3, 2, -2875, 1, 0, 2, -2872,
+    0, 0, 2, -2871, 0, 0, -2868, -2865, 0, -2863, -2860, -2858, 0, 0, 0, -2857,
+    1, -2854, -2848, 0, 0, 1, 0, -2847, 1, 1, -2846, 0, -2845, -2841, 1, 2,
+    4, -2838, -2831, 0, 0, 1, -2827, 3, 0, -2822, -2821, 0, 2, 1, -2816, 0,
+    -2814, 5, 1, 0, 0, 2, 0, -2810, 0, -2809, 0, 1, 3, 1, 0, 2,
+    1, -2807, -2801, 0, 3, 1, 0, -2800, 8, 0, 0, 0, 0, 0, 3, 1,
+    -2798, 0, 2, 0, 0, 2, 3, 1, 1, -2797, -2796, 1, -2791, 0, -2790, -2789,
+    0, 0, 0, 6, 0, 2, 0, 0, 0, -2779, -2773, 1, 1, 1, 1, -2771,
+    1, 0, -2769, 1, -2765, 1, -2763, -2761, 1, 1, -2756, 0, -2755, 0, 0, 1,
+    0, -2752, -2748, -2743, 0, 0, 0, 1, 1, 3, 1, 1, -2742, -2737, -2736, 1,
+    0, -2735, 2, -2730, -2729, 0, 2, -2728, 4, 0, 0, -2727, 4, 0, 0, 0,
+    -2726, 0, -2718, 0, 0, 0, -2714, 2, 0, 3, 2, 0, 0, 2, 1, 0,
+    1, -2713, 1, 0, 1, 1, -2712, 0, -2711, -2707, 0, -2703, -2700, 1, 3, 0,
+    -2699, 0, -2697, -2696, 1, 0, 1, 1, 0, -2689, -2687, -2685, -2683, 0, -2679, 1,
+    1, 3, 0, 3, 3, 0, -2678, 1, 0, 1, 0, 3, 0, 0, 0, -2676,
+    2, -2673, -2669, 0, -2668, -2665, 0, -2660, -2659, 1, 2, 5, 0, 4, -2655, 0,
+    -2654, 0, 0, -2652, 0, -2644, 0, -2643, 4, 4, -2642, 0, 0, 0, 1, 1,
+    1, 1, 0, -2640, -2638, 1, 0, 2, 0, -2637, -2634, -2631, -2628, -2626, 1, 0,
+    7, -2625, -2619, -2618, 0, 2, -2615, -2614, 3, 0, -2609, 3, 2, -2606, 4, 3,
+    1, -2604, 0, 0, 0, 1, -2600, -2597, -2596, 0, 3, 1, 0, 3, -2595, 1,
+    1, 1, -2588, 1, 0, -2587, -2580, 0, -2577, 1, 0, 0, 0, 2, 0, -2576,
+    1, -2574, 1, 0, 2, 0, -2573, 3, 0, -2570, 1, -2568, -2564, 1, -2563, -2562,
+    0, 2, 0, 0, 6, 3, 0, -2560, 0, 0, -2557, -2554, 5, 0, -2552, 0,
+    1, -2551, 0, 0, 1, 2, 0, 0, -2549, -2544, -2543, 0, 0, -2539, -2538, 0,
+    -2535, -2533, 1, 1, 2, 0, 0, 0, 0, -2528, 1, 1, 5, 2, 1, 0,
+    0, -2525, 5, 0, -2524, 0, 0, 1, 1, -2522, 1, 0, 2, -2521, 0, -2518,
+    0, 1, -2517, -2515, -2511, 2, 6, 0, 0, 1, -2507, -2499, 0, -2496, 0, 0,
+    -2495, 0, 1, -2491, 2, 3, -2490, 2, 5, -2489, 0, 0, 0, -2488, 3, 0,
+    3, 0, 0, 0, 0, -2484, 0, 0, 2, 2, -2482, 1, 0, 0, -2481, 0,
+    -2476, 0, -2474, 0, -2471, 2, -2470, -2459, -2458, -2455, -2454, 1, 1, 1, 1, 0,
+    2, 0, 0, 1, 0, 1, 0, 0, -2453, 0, -2451, -2448, 2, 0, 2, 0,
+    -2447, -2444, -2442, 3, 2, 0, -2437, 1, -2436, 0, 1, -2432, 0, 0, 0, 0,
+    0, -2431, 0, 0, -2422, 0, -2418, -2416, 1, -2414, 0, -2413, -2410, -2409, 0, 0,
+    1, 0, -2408, -2406, -2405, 0, 0, -2404, 4, 2, 5, -2402, -2401, -2396, 0, -2375,
+    0, -2372, 4, -2371, -2368, -2367, -2366, 0, 1, 3, 0, 0, -2361, -2357, 2, 1,
+    0, 0, 1, 1, 0, -2356, -2354, -2352, -2350, 0, 0, -2348, -2347, 0, 0, 3,
+    -2346, 0, 0, -2342, 6, -2341, 0, -2340, 0, -2332, 0, 2, 0, 5, -2331, -2330,
+    -2326, -2325, 6, -2321, -2319, 0, -2317, -2310, -2302, -2300, 1, 0, 0, 0, 0, 1,
+    0, 1, -2296, -2295, 0, 0, 0, 0, -2294, -2292, -2286, -2285, -2280, 0, 1, 0,
+    0, 2, -2277, 1, 2, 0, 0, -2273, -2272, 3, 0, 0, -2271, 4, 1, -2266,
+    0, 0, -2264, 3, -2262, -2260, 2, 0, -2258, 1, -2257, 0, -2255, -2253, -2252, 1,
+    0, 0, -2251, 1, -2242, -2237, -2235, -2233, 3, -2232, -2230, -2223, 0, 4, 0, 0,
+    0, -2222, 0, -2219, 0, 0, 0, 0, -2218, 0, 0, 1, 5, 1, 0, 0,
+    0, 0, 1, -2217, -2215, -2214, 0, 0, 0, 1, -2213, 0, 1, 2, 5, 0,
+    -2211, 6, 1, -2205, 0, 8, 0, -2204, 0, -2198, 0, 0, 0, 0, 2, 0,
+    0, 2, 1, 0, 0, 3, 0, -2197, -2196, -2193, 0, 2, -2192, 4, 0, -2191,
+    0, 6, 1, 7, 0, 2, -2187, -2179, 0, 1, 0, 3, 4, 1, 0, -2175,
+    0, 1, 0, -2168, 0, -2167, -2166, 0, -2156, -2155, 0, 0, 0, 4, 1, 0,
+    -2154, 0, -2152, -2150, 4, 0, 2, -2138, -2137, 9, 1, 4, 0, 7, 3, -2136,
+    4, -2135, 1, 0, 2, -2134, 1, -2132, -2131, -2126, 2, -2122, 0, -2118, -2115, 0,
+    -2112, 2, 7, -2111, 4, 1, 0, 0, 0, 0, -2110, 0, 0, -2109, -2103, 0,
+    1, -2101, 0, 1, 0, -2098, 0, 0, -2096, -2095, 0, 1, -2092, 0, 0, -2091,
+    0, 7, 0, 4, 1, 0, -2089, -2084, 0, -2080, 0, 0, -2077, 0, 0, 3,
+    5, 1, 5, -2076, -2073, 0, 0, 2, 6, 1, 0, 4, 0, -2069, -2065, 0,
+    0, -2060, -2059, -2058, 3, 0, 0, 0, -2052, -2041, 0, 2, 0, -2040, 0, 0,
+    -2039, -2037, 1, 0, 0, -2036, 0, 0, 0, -2033, -2031, -2027, 1, 0, -2026, 0,
+    0, 1, 6, 0, 0, -2024, -2023, 0, 5, -2020, -2018, 0, -2015, 5, -2014, 1,
+    0, -2013, 0, -1999, -1995, 0, -1994, 0, 0, -1991, 6, 0, 2, 0, 0, 0,
+    0, 2, 1, -1989, 1, -1988, 1, 0, 1, 0, -1987, -1982, -1977, 0, 0, -1976,
+    0, 0, 0, 0, 1, 1, 0, -1974, -1973, 0, 5, -1972, 0, 0, 0, 2,
+    0, 0, -1965, -1964, -1963, -1960, 1, -1958, 0, -1957, -1953, 0, -1949, 1, 0, 5,
+    -1948, -1946, 3, 0, 0, 0, 0, -1945, 3, 0, -1944, -1943, 3, -1941, 1, 0,
+    -1938, 5, -1937, 0, -1934, -1927, 0, 0, 0, -1923, 0, 3, -1914, 0, -1910, 2,
+    -1909, -1907, 0, -1905, 3, 0, -1904, 1, -1898, -1894, 0, -1891, -1889, -1885, 0, 0,
+    -1884, -1882, 2, 9, 2, 0, 0, 0, -1878, 0, -1875, -1874, -1872, -1869, 5, 3,
+    3, -1868, 1, 0, 0, -1864, 1, -1863, -1861, 0, 0, 2, 0, 0, -1858, 0,
+    -1857, 0, 0, -1856, -1855, 9, 0, -1851, 2, -1847, 0, 0, -1846, 5, 0, 3,
+    1, 0, 0, 2, -1844, 2, 0, 3, -1843, -1841, -1837, -1835, -1834, -1833, 1, 0,
+    -1826, -1825, 0, -1823, -1818, 2, 0, -1815, -1813, 7, 0, 1, 0, 0, 1, 5,
+    -1808, 0, 0, 0, 0, -1807, 2, 0, -1803, 0, -1802, 0, -1800, 1, -1799, 3,
+    -1798, 2, -1797, -1791, -1789, 0, 0, 0, -1788, -1785, -1784, 0, 1, 1, 0, 0,
+    0, -1783, -1781, 2, -1775, 0, 3, -1769, -1763, 0, -1756, -1755, -1754, -1751, 2, 0,
+    0, 0, 0, 5, 2, -1746, 0, 0, -1741, 1, 0, 5, -1735, -1728, 0, 0,
+    0, 3, 2, -1726, -1721, 3, 1, 0, 0, 1, -1719, 0, 0, 1, 0, -1718,
+    0, -1716, 0, -1714, -1710, 0, -1709, 4, 0, -1707, -1702, 1, 0, 12, 3, 0,
+    0, 0, -1701, -1699, 3, -1696, -1693, 2, -1687, 0, -1684, -1683, -1682, 0, 0, 1,
+    0, 0, -1681, 0, -1679, 0, 0, 0, -1677, 1, -1674, -1671, -1667, 0, 0, 2,
+    -1662, 0, 0, 5, -1660, 4, -1657, 1, 9, -1655, -1651, 0, -1649, -1647, 0, 0,
+    1, -1645, 2, 3, -1644, 1, -1636, 0, 5, 0, 0, -1633, 0, 2, 0, 0,
+    0, 0, 6, -1628, 5, 3, -1622, 1, -1621, 4, -1619, -1614, 0, 0, 13, 2,
+    -1610, -1609, 0, -1608, -1601, -1600, 0, 0, 0, 6, 0, -1599, 1, -1598, -1590, -1584,
+    -1582, -1578, 0, -1577, 0, -1575, -1574, -1573, 0, 2, 0, 2, 1, -1570, 4, 0,
+    -1564, 0, 0, 0, 8, -1558, -1557, 0, -1556, -1554, 0, 0, -1553, 5, 0, 0,
+    0, -1552, -1548, 0, 0, 0, 0, -1546, 1, 0, 0, -1545, -1544, 0, 0, -1541,
+    -1540, 0, -1539, 0, 0, 0, 0, -1535, -1527, -1524, -1521, 0, -1520, -1519, 2, 0,
+    0, 0, 0, 0, -1517, -1512, 1, 0, 5, -1507, 0, -1504, 6, 0, 3, 0,
+    -1503, 6, -1500, 1, 0, 1, -1498, 2, -1491, 0, -1483, 0, 6, -1479, 4, 0,
+    0, 0, -1477, 1, -1474, 0, 0, 0, 1, 0, -1473, 6, -1469, 17, -1464, 2,
+    0, -1463, -1458, 1, 0, 23, -1449, -1447, 0, -1444, 0, 0, 0, -1441, 0, 2,
+    0, 0, 0, 1, -1431, -1429, 0, 0, -1425, 8, 0, -1424, 0, -1422, 1, -1417,
+    -1415, 0, 0, -1414, 0, -1409, 0, 8, 0, -1406, -1404, -1402, 1, 0, -1401, -1398,
+    -1397, 2, 5, -1395, -1379, -1375, -1373, -1372, -1370, -1362, 0, 9, 0, 6, -1355, 1,
+    -1354, -1353, 1, 0, 0, 0, 0, 1, -1350, 0, -1349, 1, -1348, -1347, 0, -1346,
+    0, -1338, -1336, -1335, 0, 4, -1334, 0, -1331, 1, -1329, 2, -1328, -1326, 0, -1324,
+    -1317, 0, 3, 1, 0, 1, 0, 0, -1312, -1309, 0, -1306, 0, -1303, 0, -1297,
+    -1295, 0, 0, 0, -1289, 0, 2, 1, 1, 0, 3, 0, 0, -1284, 2, 2,
+    -1283, 0, 0, 0, 0, 0, 1, 4, -1278, 0, 2, -1271, -1262, -1258, 0, 1,
+    -1257, 0, -1254, 0, 0, 1, 1, -1253, -1252, 5, 1, -1249, -1246, 0, -1245, -1243,
+    -1240, -1233, -1231, 0, 1, 1, 12, -1230, 15, 0, -1221, 0, 2, -1220, -1206, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 3, 1, -1204, 0, 0, 6, 4, 0,
+    -1198, 0, 3, 1, -1186, -1179, -1178, 0, -1177, 0, -1175, 0, 0, 2, 2, -1172,
+    -1170, -1169, -1165, 1, -1163, 0, 8, 0, 0, 1, 1, 0, 1, -1162, 3, 6,
+    1, 4, -1157, 0, 1, 0, 3, -1154, 0, 3, 0, -1152, 1, -1149, 0, -1148,
+    0, 0, 0, -1145, 4, 9, 1, 4, 0, -1144, -1143, 0, -1141, 0, -1134, 0,
+    1, -1132, 0, -1130, -1128, 0, -1125, 0, 0, 1, 1, 1, -1124, -1123, 0, 0,
+    4, -1122, -1121, 2, -1119, -1118, 0, 3, -1112, -1109, -1106, 0, -1105, 16, 2, 3,
+    0, 2, 0, 0, 0, -1103, -1100, -1099, 1, -1098, 0, 0, 0, -1096, -1093, 0,
+    0, 2, 0, 2, 2, 0, -1090, 0, -1081, -1079, -1078, -1075, 0, 0, -1073, -1071,
+    0, 1, -1070, 0, 6, -1067, 0, 0, -1062, 0, -1060, -1059, 1, -1058, 0, 1,
+    -1057, 0, 0, -1054, -1050, 0, 0, 0, 0, 3, 0, 1, -1045, 2, -1044, -1042,
+    4, -1041, 4, -1034, -1031, -1024, -1022, 7, 1, -1020, 2, 0, 0, 8, 0, -1016,
+    -1008, 0, 1, 13, 0, -1006, 0, -1003, 1, 2, -997, -993, -986, 0, 0, -985,
+    0, 0, -983, 0, 0, -976, -975, -974, 1, -973, 1, -969, 3, 0, -965, -962,
+    1, 0, 0, 0, 0, 6, 0, 1, 1, 0, -958, -955, 0, -953, 4, 0,
+    -950, 1, 1, -945, 0, 0, 0, -944, 0, 3, -943, 0, -941, -940, -937, 0,
+    2, -928, -926, -919, 1, 2, -918, 2, -917, -914, 0, -912, 2, 3, -911, 0,
+    -910, 0, 1, 1, 0, 0, -903, -900, 0, -899, 3, 2, -896, 2, -893, -891,
+    0, -890, 1, 0, 0, 0, 0, -886, -885, 1, 0, 8, 0, 5, -881, 0,
+    -880, -879, 0, -872, 4, 7, 0, -865, -861, 7, 0, 7, 0, 3, 0, -859,
+    1, -858, 7, 13, 0, -856, 6, -855, 2, 0, -851, 1, -849, 1, -844, -843,
+    0, 0, -841, 0, 0, 0, 0, 1, 3, 9, -838, -836, 1, -835, -834, 0,
+    -829, 0, 0, -828, 0, -827, -826, 2, 1, 1, -825, -823, -821, 1, 1, -820,
+    0, 2, -819, -818, 2, 1, -812, 0, 9, 0, 2, 0, 5, -810, 0, -807,
+    6, -805, 0, -801, 3, -795, 1, 0, 4, -794, 1, 0, 1, 0, 0, -790,
+    -788, -787, 0, 1, -786, 0, 22, -785, -779, 0, 8, 1, 3, 1, -775, 0,
+    0, 0, 0, -773, 0, -771, 0, 0, -770, 0, -769, -767, 0, 12, 13, 0,
+    4, 0, 1, -766, 0, -763, 0, 0, -760, 0, 0, 1, 0, 0, 0, 3,
+    0, 0, -759, 3, 0, -757, 0, 0, 7, -755, 0, -754, 8, -750, -749, 0,
+    -745, -742, 5, 2, -740, 0, 0, -737, 11, -735, -734, -733, -731, 10, 0, -728,
+    -727, 0, 0, 3, -721, -720, 0, 1, 3, -719, 0, -718, -715, 0, -714, 0,
+    0, 0, 0, 0, -712, 2, -711, -710, -709, 0, 9, 7, -708, 0, 0, 2,
+    -705, 6, 0, -703, 0, 0, -702, 2, 2, -701, 0, 2, 8, -699, -695, 7,
+    -691, -686, 1, -685, -684, -676, 1, -674, -673, 6, -667, 5, 0, -664, 3, -655,
+    10, 31, -654, 0, -651, 0, -649, -648, 0, 0, 6, 0, -647, -645, 0, 5,
+    -644, 0, -643, 3, 4, -640, 1, -638, 2, 0, 0, -637, 2, 0, 6, 3,
+    -635, 0, 0, -634, 0, 1, 8, -633, 4, 2, -631, 1, 0, -629, -627, -625,
+    0, 0, 4, 0, 0, 2, 5, 0, 0, -620, -617, -614, 0, -613, 0, 2,
+    4, -612, 1, -611, 0, -604, 0, 0, 1, 0, 0, 0, 1, -603, 0, 3,
+    -599, -597, -595, -590, -589, 0, 0, -588, -586, -583, -580, 15, 2, 0, -579, -577,
+    0, -576, 4, 0, -573, -566, 5, -565, 0, -555, 5, -551, 0, -548, -547, 0,
+    -538, 2, 12, 0, 0, -535, 0, 0, 0, 0, -534, 0, 10, 2, 0, -527,
+    0, -526, -522, -518, 0, 0, 0, -515, 1, -510, -509, -506, -504, 0, -499, 0,
+    0, -497, 0, 6, -493, 6, 0, 2, -489, -488, -484, 0, 0, -483, 0, 1,
+    0, 8, 0, 6, 5, 0, 6, -481, -477, 12, 0, -476, -474, 1, 0, 1,
+    -472, 0, -468, -467, -461, 0, 0, 0, -459, 0, 4, 0, -457, 0, 0, 0,
+    -448, 4, 4, -445, 6, 0, 0, 5, 0, 0, -444, 4, 0, 0, -441, 0,
+    -440, 0, 1, 0, 1, 0, 1, 0, 0, -439, -438, 0, -436, 4, -435, 0,
+    0, -434, 0, 1, -431, -428, 5, 0, 0, 0, 0, 0, 0, -427, 2, 0,
+    -426, 1, 0, -425, 1, 0, 0, 0, 1, 0, 1, 0, -424, -423, 0, -418,
+    0, -412, -411, 0, 1, 0, -407, 1, 2, 0, 19, -404, 1, -402, 12, 0,
+    0, 0, -401, -400, 1, 0, -397, -395, 15, -389, 1, 5, 0, -387, -386, 5,
+    4, 0, -385, -383, -379, 3, -371, 0, -362, 32, 0, -358, -357, -353, 0, -351,
+    -349, 3, -348, 0, -345, 0, 4, 0, 2, 6, -343, -342, 2, -341, 0, -340,
+    -334, 0, -332, 0, 0, -331, 1, 0, 0, -330, 5, 0, 5, 0, 5, 0,
+    3, -329, 3, 3, -321, -319, 0, 5, -318, 7, -315, 2, 1, 0, 0, 17,
+    0, 0, 0, 15, 0, 0, 0, 1, 0, 1, 1, -311, 0, 17, 3, 0,
+    -305, 6, 0, 5, 0, -299, -297, 0, 1, 0, 1, 0, 0, 1, -294, -286,
+    -285, 0, 6, 0, 2, -284, 0, -283, 0, 2, 0, 0, 0, -282, 0, -280,
+    0, 0, -278, 8, 2, -276, -274, -273, 0, -272, 2, 0, 3, 0, 11, -268,
+    0, -266, -265, -255, 0, 0, 0, 0, -253, 0, 0, 0, -252, 0, -239, 0,
+    0, 0, 1, 0, 9, 0, 0, 2, 3, 1, -238, 0, 0, -235, 18, 6,
+    2, -228, -225, 0, 6, 4, 0, -222, 0, -221, -220, -215, -211, -210, -209, 0,
+    0, 1, 0, 0, -206, -201, -200, -199, -197, -196, 22, -188, 0, 0, 0, -182,
+    0, 3, 0, 0, -174, 1, 6, -164, 1, 0, 0, 1, 0, -158, -154, 0,
+    0, 13, 0, 4, 2, 0, -152, 0, 0, 6, -145, 1, -144, -140, 8, 0,
+    0, 2, 0, 0, -137, -133, 14, 0, 0, -128, -124, -122, -119, 0, -117, -116,
+    0, -112, 2, 43, 0, -103, -102, -98, 0, -96, 3, 10, 0, -94, 0, 7,
+    4, 0, 0, 0, 0, 0, -93, 0, 0, -91, -89, 0, 0, 0, 0, 0,
+    0, 0, 0, -88, 3, -82, -76, 0, -73, 2, 0, -72, 0, 0, -69, 0,
+    -68, 2, -67, 0, 23, -66, 4, -60, -59, 1, 0, -54, 12, 9, -51, 14,
+    0, 7, 0, 0, -50, -47, 20, 0, -46, -43, 1, 7, -40, -36, -35, 3,
+    6, -32, 0, 0, 6, -31, 4, 2, -29, -28, -27, -26, 1, -22, 0, 0,
+    0, 1, 0, -21, -13, 0, -6, -5, 0, 0
+};
+
+static const char * const TABLE_PHP_WORDS_CS_WORDS[] = {
+    "PARSEKIT_ZEND_ASSIGN_DIM", "IMG_BOX", "SOCKET_EXDEV", "RPMREADER_CACHEPKGPATH",
+    "FANN_GAUSSIAN_STEPWISE", "FBSQL_ISO_REPEATABLE_READ", "SOCKET_ENFILE", "__COMPILER_HALT_OFFSET__",
+    "RPMREADER_CONFLICTFLAGS", "TRAP_BRKPT", "IBASE_RPR_MEND_DB", "FILTER_FLAG_ALLOW_THOUSAND",
+    "SWOOLE_SOCK_UNIX_DGRAM", "PARSEKIT_ZEND_FETCH_OBJ_FUNC_ARG", "SWOOLE_SOCK_UDP6", "IMAGETYPE_JB2",
+    "YPERR_BADARGS", "RPMREADER_FILEMODES", "LATT_MARKED", "AL_PAUSED",
+    "OP_SHORTCACHE", "YAML_ANY_BREAK", "FRIBIDI_LTR", "GEARMAN_DEFAULT_SOCKET_TIMEOUT",
+    "PARSEKIT_ZEND_IS_NOT_EQUAL", "IMAP_WRITETIMEOUT", "PSPELL_RUN_TOGETHER", "PHPDBG_VERSION",
+    "SPH_FILTER_VALUES", "FILTER_FLAG_EMAIL_UNICODE", "FRIBIDI_CHARSET_CAP_RTL", "MONGO_STREAM_NOTIFY_TYPE_IO_INIT",
+    "SNMP_OID_OUTPUT_MODULE", "SQL_TYPE_DATE", "SQL_BEST_ROWID", "GEARMAN_DEFAULT_TCP_HOST",
+    "MYSQLND_UH_MYSQLND_COM_DEBUG", "CURL_SSLVERSION_DEFAULT", "PTHREADS_INHERIT_COMMENTS", "LIBXML_PARSEHUGE",
+    "MYSQLND_UH_MYSQLND_PROT_ROW_PACKET", "IIS_STARTING", "LDAP_CONTROL_PASSWORDPOLICYREQUEST", "ID3_V2_4",
+    "GUPNP_CONTROL_ERROR_ACTION_FAILED", "SO_NOSERVER", "SQLSRV_SQLTYPE_BIT", "MYSQLX_TYPE_INT",
+    "XML_ERROR_JUNK_AFTER_DOC_ELEMENT", "SQLSRV_SQLTYPE_REAL", "APC_ITER_FILENAME", "PHP_QUERY_RFC1738",
+    "INTL_MAX_LOCALE_LEN", "ZEND_EXIT", "SOCKET_ENETDOWN", "MYSQLND_UH_MYSQLND_COM_PROCESS_INFO",
+    "YAML_UTF16BE_ENCODING", "SUNFUNCS_RET_TIMESTAMP", "PARSEKIT_ZEND_FETCH_R", "SQL_SCOPE_TRANSACTION",
+    "XML_ERROR_UNKNOWN_ENCODING", "CAIRO_HINT_STYLE_MEDIUM", "MYSQLI_REFRESH_SLAVE", "PHP_OUTPUT_HANDLER_STDFLAGS",
+    "MYSQLND_UH_MYSQLND_PROT_CMD_PACKET", "PARSEKIT_ZEND_FETCH_W", "LIBXML_DTDVALID", "UDM_ISPELL_TYPE_SERVER",
+    "PNG_FILTER_SUB", "RPMREADER_FILESTATES", "SODIUM_CRYPTO_SECRETBOX_KEYBYTES", "MYSQLI_TYPE_TIME",
+    "SOCKET_ENOTUNIQ", "MONGO_SUPPORTS_AUTH_MECHANISM_PLAIN", "SE_FREE", "OAUTH_REQENGINE_CURL",
+    "CAIRO_CONTENT_COLOR_ALPHA", "UDM_PARAM_MIN_WORD_LEN", "MYSQLND_UH_MYSQLND_READ_DEFAULT_FILE", "CURLE_TOO_MANY_REDIRECTS",
+    "FILTER_FLAG_NO_PRIV_RANGE", "OAUTH_VERIFIER_INVALID", "SORTSIZE", "RPMREADER_FILELANGS",
+    "JSON_NUMERIC_CHECK", "ILL_PRVREG", "SODIUM_CRYPTO_PWHASH_MEMLIMIT_SENSITIVE", "PHP_URL_SCHEME",
+    "RPMREADER_PREIN", "ENT_XML1", "CURLINFO_FILETIME", "GEOIP_ORG_EDITION",
+    "UDM_FIELD_TEXT", "IMG_FILTER_BRIGHTNESS", "UDM_PARAM_CROSS_WORDS", "MONGODB_STABILITY",
+    "IBASE_BKP_OLD_DESCRIPTIONS", "RPMREADER_REQUIREVERSION", "CAL_MONTH_GREGORIAN_LONG", "GEOIP_DIALUP_SPEED",
+    "SWOOLE_RWLOCK", "TRADER_ERR_INVALID_PARAM_HOLDER", "UDM_PARAM_PAGE_SIZE", "FNM_PATHNAME",
+    "LDAP_OPT_ERROR_NUMBER", "UDM_PARAM_SYNONYM", "PARSEKIT_ZEND_FETCH_OBJ_UNSET", "SSH2_DEFAULT_TERMINAL",
+    "PHP_LIBDIR", "CAIRO_ANTIALIAS_NONE", "SEASLOG_ALL", "SIGTSTP",
+    "YAF_ERR_NOTFOUND_MODULE", "PARSEKIT_ZEND_IS_IDENTICAL", "SQLSRV_TXN_READ_UNCOMMITTED", "FANN_E_CANT_OPEN_CONFIG_W",
+    "RPMREADER_POLICIES", "MYSQLI_TYPE_LONG_BLOB", "UDM_CROSSWORDS_DISABLED", "PATHINFO_DIRNAME",
+    "IIS_RUNNING", "SEASLOG_CRITICAL", "RPMREADER_FILEFLAGS", "LIBXML_NSCLEAN",
+    "GEARMAN_ARGS_BUFFER_SIZE", "PGSQL_DIAG_SOURCE_FUNCTION", "CAL_EASTER_DEFAULT", "IN_CLOSE_WRITE",
+    "MYSQLI_TRANS_COR_AND_CHAIN", "XML_ERROR_PARAM_ENTITY_REF", "MYSQLND_MS_VERSION", "IBASE_PRP_SWEEP_INTERVAL",
+    "PARSEKIT_ZEND_HANDLE_EXCEPTION", "CAIRO_STATUS_NO_CURRENT_POINT", "FILEINFO_COMPRESS", "SIGIO",
+    "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_IETF_NPUBBYTES", "GD_EXTRA_VERSION", "CURLOPT_PINNEDPUBLICKEY", "SODIUM_CRYPTO_AEAD_AES256GCM_ABYTES",
+    "SPH_MATCH_PHRASE", "CAIRO_SURFACE_TYPE_GLITZ", "GMP_ROUND_MINUSINF", "RPMREADER_FILELINKTOS",
+    "GNUPG_SIGSUM_VALID", "IBASE_RES_NO_SHADOW", "IBASE_SVC_SVR_DB_INFO", "RPMREADER_FILEDEVICES",
+    "EXTR_PREFIX_SAME", "RPMREADER_RPMVERSION", "GEARMAN_OPTION_SIZE", "IMG_FILTER_PIXELATE",
+    "SAM_DOUBLE", "MYSQLI_SET_CHARSET_NAME", "GD_BUNDLED", "APC_ITER_ATIME",
+    "MYSQLND_UH_MYSQLND_OPT_SSL_VERIFY_SERVER_CERT", "CAL_JEWISH_ADD_GERESHAYIM", "SOCKET_EISNAM", "SIGCHLD",
+    "RPMREADER_VERIFYSCRIPT", "E_COMPILE_WARNING", "EXTR_REFS", "OAUTH_REQENGINE_STREAMS",
+    "GUPNP_TYPE_LONG", "PARSEKIT_ZEND_FETCH_OBJ_W", "E_CORE_ERROR", "SWOOLE_IPC_PREEMPTIVE",
+    "PARSEKIT_ZEND_FETCH_OBJ_R", "MYSQLX_TYPE_LONG_BLOB", "CURLOPT_SOCKS5_AUTH", "CURLE_READ_ERROR",
+    "SOCKET_EHOSTUNREACH", "RPMREADER_DISTRIBUTION", "CURL_SSLVERSION_TLSv1_1", "INTL_IDNA_VARIANT_2003",
+    "CURL_SSLVERSION_SSLv3", "CURL_SSLVERSION_SSLv2", "ODBC_BINMODE_PASSTHRU", "FANN_E_CANT_USE_TRAIN_ALG",
+    "CURLE_FTP_WEIRD_SERVER_REPLY", "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_KEYBYTES", "UDM_PARAM_REMOTE_ADDR", "CURLFTPSSL_NONE",
+    "IN_MOVE", "PARSEKIT_ZEND_DECLARE_FUNCTION", "CLASSKIT_VERSION", "YAR_ERR_OUTPUT",
+    "OAUTH_TOKEN_REJECTED", "APC_ITER_TYPE", "XML_SAX_IMPL", "IMG_BMP",
+    "CAIRO_HINT_STYLE_FULL", "MSG_WAITALL", "CURLE_MALFORMAT_USER", "CAL_MONTH_FRENCH",
+    "MYSQLI_DEBUG_TRACE_ENABLED", "APC_ITER_DEVICE", "SQLSRV_SQLTYPE_BIGINT", "MYSQLI_SET_FLAG",
+    "EXTR_PREFIX_ALL", "PASSWORD_ARGON2I", "UDM_PARAM_ISPELL_PREFIXES", "IMAGETYPE_JPX",
+    "FANN_GAUSSIAN_SYMMETRIC", "SOCKET_EMULTIHOP", "TRADER_FUNC_UNST_DX", "PARSEKIT_ZEND_BOOL",
+    "FDFDownAP", "UDM_MATCH_SUBSTR", "STR_PAD_LEFT", "SOCK_STREAM",
+    "CAIRO_FILL_RULE_EVEN_ODD", "FBSQL_NUM", "MYSQLI_TYPE_NEWDECIMAL", "ENCHANT_MYSPELL",
+    "CURLPAUSE_RECV_CONT", "PGSQL_DIAG_SQLSTATE", "SIGIOT", "ZLIB_FINISH",
+    "PARSEKIT_IS_VAR", "SODIUM_CRYPTO_PWHASH_SCRYPTSALSA208SHA256_SALTBYTES", "UDM_FIELD_SIZE", "XSL_SECPREF_READ_NETWORK",
+    "JSON_UNESCAPED_UNICODE", "XSL_SECPREF_WRITE_FILE", "CAIRO_EXTEND_REPEAT", "SI_NOINFO",
+    "IBASE_STS_SYS_RELATIONS", "PARSEKIT_ZEND_INTERNAL_FUNCTION", "MYSQLI_NUM_FLAG", "MYSQLND_QC_CONDITION_META_SCHEMA_PATTERN",
+    "EIO_DT_MAX", "IBASE_RPR_VALIDATE_DB", "XATTR_DONTFOLLOW", "CAIRO_SURFACE_TYPE_WIN32_PRINTING",
+    "OP_ANONYMOUS", "FANN_TRAIN_INCREMENTAL", "TRADER_FUNC_UNST_HT_TRENDLINE", "RPMREADER_VENDOR",
+    "CURL_HTTP_VERSION_1_0", "FDFSetF", "SQLSRV_LOG_SYSTEM_INIT", "MYSQLND_UH_MYSQLND_COM_DELAYED_INSERT",
+    "OP_DEBUG", "CAIRO_FONT_WEIGHT_BOLD", "FDFClrF", "CAIRO_STATUS_INVALID_CONTENT",
+    "CURL_VERSION_LIBZ", "IN_DONT_FOLLOW", "FILTER_VALIDATE_REGEXP", "MYSQLX_TYPE_ENUM",
+    "LC_ALL", "PARSEKIT_ZEND_PRE_INC", "CURLOPT_PROXY_SSL_CIPHER_LIST", "EIO_SYNC_FILE_RANGE_WRITE",
+    "BBCODE_FLAGS_ONE_OPEN_PER_LEVEL", "CURLINFO_CONTENT_LENGTH_DOWNLOAD_T", "MYSQLND_UH_MYSQLND_OPT_NET_CMD_BUFFER_SIZE", "LIBXML_NOBLANKS",
+    "O_WRONLY", "CURLE_SSL_ENGINE_NOTFOUND", "SORTTO", "MONGO_STREAM_NOTIFY_LOG_BATCHINSERT",
+    "GEARMAN_DEFAULT_TCP_PORT", "RPMREADER_RECONTEXTS", "CURLE_FILE_COULDNT_READ_FILE", "GEARMAN_NO_SERVERS",
+    "PARSEKIT_ZEND_JMPZNZ", "CURLOPT_COOKIE", "SQLSRV_ENC_CHAR", "CURLOPT_SSH_PUBLIC_KEYFILE",
+    "MYSQLI_TYPE_VAR_STRING", "UDM_PARAM_ISPELL_PREFIX", "CAIRO_HINT_STYLE_SLIGHT", "MYSQLND_UH_MYSQLND_COM_SET_OPTION",
+    "VARNISH_STATUS_CANT", "GEOIP_CABLEDSL_SPEED", "O_ASYNC", "TRADER_FUNC_UNST_ADX",
+    "YPERR_DOMAIN", "FILTER_FLAG_NO_ENCODE_QUOTES", "STR_PAD_RIGHT", "VARNISH_STATUS_UNIMPL",
+    "SQL_ENSURE", "SQLSRV_LOG_SEVERITY_ALL", "GMP_LITTLE_ENDIAN", "UDM_PARAM_DATADIR",
+    "CURLMOPT_CONTENT_LENGTH_PENALTY_SIZE", "GEARMAN_UNEXPECTED_PACKET", "ODBC_TYPE", "IMG_AFFINE_TRANSLATE",
+    "SWOOLE_PROCESS", "SQLSRV_PHPTYPE_FLOAT", "CHAR_MAX", "GUPNP_CONTROL_ERROR_OUT_OF_SYNC",
+    "CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE", "SQLITE_NOMEM", "GUPNP_SIGNAL_SERVICE_PROXY_AVAILABLE", "SODIUM_CRYPTO_SIGN_SECRETKEYBYTES",
+    "PGSQL_COPY_IN", "SQLITE3_INTEGER", "IMG_BLACKMAN", "TRADER_MA_TYPE_EMA",
+    "PHP_SHLIB_SUFFIX", "PGSQL_POLLING_READING", "CURLE_FTP_COULDNT_SET_ASCII", "EIO_S_IROTH",
+    "SOCKET_ENOLINK", "ST_SILENT", "RPMREADER_CONFLICTNAME", "SEASLOG_REQUEST_VARIABLE_REQUEST_URI",
+    "APC_ITER_KEY", "ILL_PRVOPC", "SOCKET_ENOCSI", "GLOB_BRACE",
+    "WEBSOCKET_STATUS_CONNECTION", "LDAP_CONTROL_VLVREQUEST", "SAM_BOOLEAN", "SQL_ODBC_CURSORS",
+    "SQLSRV_SQLTYPE_SMALLDATETIME", "SCANDIR_SORT_DESCENDING", "SIGTTOU", "UDM_MODE_ANY",
+    "MYSQLND_UH_MYSQLND_COM_TIME", "CURL_TIMECOND_LASTMOD", "TRADER_FUNC_UNST_PLUS_DI", "UDM_PARAM_STOP_FILE",
+    "PHP_EXTENSION_DIR", "UDM_FIELD_CRC", "CURLSSH_AUTH_PUBLICKEY", "E_USER_DEPRECATED",
+    "GUPNP_SIGNAL_ACTION_INVOKED", "INGRES_DATE_FINNISH", "MYSQLI_SERVER_QUERY_NO_INDEX_USED", "PASSWORD_ARGON2ID",
+    "SQLITE_OK", "MYSQLI_ENUM_FLAG", "FTP_TIMEOUT_SEC", "OAUTH_INVALID_SIGNATURE",
+    "FORCE_GZIP", "FILE_BINARY", "SQLITE_CANTOPEN", "PARSEKIT_ZEND_FETCH_DIM_RW",
+    "CAIRO_FONT_SLANT_OBLIQUE", "PGSQL_TRANSACTION_INERROR", "MYSQLI_ZEROFILL_FLAG", "GUPNP_SIGNAL_SERVICE_PROXY_UNAVAILABLE",
+    "CURLOPT_COOKIEJAR", "CAIRO_FONT_TYPE_QUARTZ", "MONGO_SUPPORTS_AUTH_MECHANISM_MONGODB_X509", "CURLINFO_LOCAL_IP",
+    "LDAP_OPT_CLIENT_CONTROLS", "FANN_NETTYPE_SHORTCUT", "EIO_DT_UNKNOWN", "SODIUM_CRYPTO_SIGN_PUBLICKEYBYTES",
+    "MYSQLND_UH_MYSQLND_COM_CREATE_DB", "LDAP_EXOP_TURN", "FILEINFO_SYMLINK", "CURLAUTH_NTLM",
+    "SOCKET_ENOTTY", "PARSEKIT_ZEND_FETCH_CONSTANT", "SPH_GROUPBY_WEEK", "YAR_ERR_EXCEPTION",
+    "SQL_SCOPE_SESSION", "TRADER_ERR_SUCCESS", "FBSQL_ISO_SERIALIZABLE", "DB2_CASE_UPPER",
+    "YAML_ANY_SCALAR_STYLE", "MYSQLX_TYPE_TIME", "RUNKIT_IMPORT_CLASS_METHODS", "PASSWORD_BCRYPT",
+    "CURLE_BAD_PASSWORD_ENTERED", "IMAP_CLOSETIMEOUT", "FDFFormat", "MB_CASE_TITLE",
+    "EV_TIMEOUT", "SQL_SCOPE_CURROW", "SQLSRV_SCROLL_ABSOLUTE", "BBCODE_FORCE_SMILEYS_OFF",
+    "PARSEKIT_ZEND_SUB", "SWOOLE_KEEP", "RPMREADER_RHNPLATFORM", "RPMREADER_CHANGELOGNAME",
+    "FANN_E_CANT_READ_NEURON", "SQLSRV_TXN_READ_SERIALIZABLE", "EIO_FALLOC_FL_KEEP_SIZE", "SQL_SMALLINT",
+    "ID3_V2_2", "JSON_THROW_ON_ERROR", "MONGO_STREAM_NOTIFY_IO_WRITE", "CURLINFO_SPEED_DOWNLOAD",
+    "GEARMAN_LOST_CONNECTION", "SPH_SORT_ATTR_DESC", "RAR_HOST_BEOS", "MYSQLX_TYPE_DATE",
+    "SVN_PROP_REVISION_AUTHOR", "XML_ERROR_BAD_CHAR_REF", "AL_CONE_OUTER_ANGLE", "FDFFile",
+    "GNUPG_SIGSUM_CRL_TOO_OLD", "CAIRO_FONT_TYPE_FT", "MYSQLND_MUX_VERSION", "FILEINFO_MIME_TYPE",
+    "CURLOPT_VERBOSE", "SWFBUTTON_UP", "MONGO_STREAM_NOTIFY_IO_READ", "OP_SILENT",
+    "SORT_REGULAR", "F_SETLK", "YAML_FLOAT_TAG", "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_NSECBYTES",
+    "PARSEKIT_ZEND_INIT_STRING", "EIO_READDIR_DENTS", "SO_SNDTIMEO", "SQLITE_IOERR",
+    "FILTER_VALIDATE_URL", "FANN_STOPFUNC_BIT", "YAR_ERR_PACKAGER", "TYPEIMAGE",
+    "SOLR_MINOR_VERSION", "PARSEKIT_ZEND_JMPNZ_EX", "LDAP_OPT_SERVER_CONTROLS", "IBASE_STS_HDR_PAGES",
+    "FANN_E_CANT_OPEN_TD_W", "SVN_FS_TYPE_BDB", "IDNA_CHECK_BIDI", "CAIRO_LINE_JOIN_MITER",
+    "ENT_HTML401", "CAIRO_HINT_METRICS_OFF", "ZEND_USER_OPCODE_DISPATCH", "YPERR_NODOM",
+    "IMG_FILTER_GAUSSIAN_BLUR", "SVN_PROP_REVISION_DATE", "PARSEKIT_ZEND_INCLUDE_OR_EVAL", "CURLOPT_CONNECTTIMEOUT",
+    "IBASE_SVC_USER_DBPATH", "MB_CASE_UPPER", "MYSQLND_MS_SLAVE_SWITCH", "UDM_ISPELL_PREFIXES_ENABLED",
+    "RPMREADER_FILECONTEXTS", "BBCODE_SET_FLAGS_REMOVE", "GEARMAN_SEND_BUFFER_TOO_SMALL", "LDAP_CONTROL_SYNC",
+    "CAIRO_STATUS_SURFACE_FINISHED", "CAIRO_FILTER_BEST", "EIO_S_IWGRP", "CURLE_SSL_ENGINE_SETFAILED",
+    "SQL_CONCUR_ROWVER", "CURLOPT_FTP_USE_EPRT", "UDM_CACHE_ENABLED", "JSON_ERROR_UTF16",
+    "NULL", "SIGXFSZ", "EXIF_USE_MBSTRING", "MYSQLX_CLIENT_SSL",
+    "SQLSRV_LOG_SEVERITY_NOTICE", "SSH2_DEFAULT_TERM_UNIT", "RPMREADER_BUILDHOST", "PHP_CONFIG_FILE_PATH",
+    "MYSQLI_TYPE_TIMESTAMP", "CURLOPT_PROGRESSFUNCTION", "LATT_HASNOCHILDREN", "SQLSRV_SQLTYPE_XML",
+    "TRADER_FUNC_UNST_MFI", "IMG_FLIP_VERTICAL", "OAUTH_AUTH_TYPE_NONE", "CAIRO_OPERATOR_IN",
+    "SVN_AUTH_PARAM_CONFIG_DIR", "SQLBIT", "MYSQLI_TYPE_LONGLONG", "SQLVARCHAR",
+    "YPERR_BUSY", "SOCKET_HOST_NOT_FOUND", "MYSQLND_UH_SERVER_OPTION_MULTI_STATEMENTS_ON", "SQL_TINYINT",
+    "IIS_NTLM", "DB2_PARAM_INOUT", "ZLIB_FULL_FLUSH", "SOCKET_EHOSTDOWN",
+    "GNUPG_SIGSUM_RED", "FANN_ERRORFUNC_TANH", "FILTER_FORCE_ARRAY", "PHP_SVN_AUTH_PARAM_IGNORE_SSL_VERIFY_ERRORS",
+    "CURLINFO_SIZE_DOWNLOAD", "HASH_HMAC", "TRADER_MA_TYPE_MAMA", "FILTER_UNSAFE_RAW",
+    "PHP_OS", "SOCK_RDM", "SQL_CURSOR_STATIC", "MYSQLX_TYPE_SMALLINT",
+    "CURLOPT_PIPEWAIT", "MYSQLND_UH_SERVER_OPTION_MULTI_STATEMENTS_OFF", "FDFAction", "LIBXML_COMPACT",
+    "MYSQLI_AUTO_INCREMENT_FLAG", "LIBXML_PEDANTIC", "PARSEKIT_RESULT_OPLINE", "LIBEXSLT_VERSION",
+    "PARSEKIT_ZEND_INIT_ARRAY", "CAIRO_PATTERN_TYPE_LINEAR", "PTHREADS_INHERIT_INCLUDES", "CURLE_ABORTED_BY_CALLBACK",
+    "SWFACTION_DATA", "GMP_NATIVE_ENDIAN", "YPERR_YPBIND", "XSL_SECPREF_READ_FILE",
+    "UDM_PARAM_NUM_ROWS", "CURLOPT_SSLENGINE_DEFAULT", "MYSQLX_TYPE_MEDIUM_BLOB", "SORT_NATURAL",
+    "GNUPG_ERROR_EXCEPTION", "IBASE_RES_CREATE", "SODIUM_LIBRARY_MINOR_VERSION", "SOCKET_EMFILE",
+    "FANN_E_CANT_TRAIN_ACTIVATION", "SNMP_OCTET_STR", "FILTER_SANITIZE_STRIPPED", "SQLSRV_ERR_ERRORS",
+    "FDFValue", "TRADER_ERR_LIB_NOT_INITIALIZE", "APC_LIST_DELETED", "PARSEKIT_ZEND_ASSIGN_OBJ",
+    "SNMP_OID_OUTPUT_SUFFIX", "SODIUM_CRYPTO_SHORTHASH_BYTES", "IMAP_GC_ELT", "MYSQLND_UH_MYSQLND_OPT_GUESS_CONNECTION",
+    "SVN_AUTH_PARAM_NON_INTERACTIVE", "IBASE_RPR_KILL_SHADOWS", "SQLITE_PERM", "GEARMAN_CLIENT_GENERATE_UNIQUE",
+    "PATH_SEPARATOR", "SQLSRV_SQLTYPE_SMALLINT", "UDM_FIELD_CATEGORY", "AL_FORMAT_MONO16",
+    "CURLVERSION_NOW", "ODBC_BINMODE_CONVERT", "CAL_GREGORIAN", "CRYPT_SALT_LENGTH",
+    "CURLOPT_RANDOM_FILE", "SOL_SOCKET", "FILTER_FLAG_STRIP_HIGH", "SODIUM_CRYPTO_PWHASH_OPSLIMIT_MODERATE",
+    "SOCKET_EMSGSIZE", "FDFFf", "IBASE_PRP_RESERVE_SPACE", "LDAP_OPT_ERROR_STRING",
+    "MYSQLI_TYPE_DECIMAL", "CURLE_SSL_CONNECT_ERROR", "GEARMAN_PAUSE", "MYSQLX_TYPE_FLOAT",
+    "INPUT_POST", "RPMREADER_BUILDARCHS", "CAIRO_FILTER_BILINEAR", "SOCKET_EEXIST",
+    "ALC_SYNC", "IMG_HERMITE", "PARSEKIT_ZEND_USER_FUNCTION", "FT_INTERNAL",
+    "LDAP_CONTROL_SYNC_STATE", "YAR_ERR_TRANSPORT", "FTP_ASCII", "SOCKET_EBUSY",
+    "UDM_FIELD_KEYWORDS", "RPMREADER_FILEDEPENDSN", "MYSQLI_TYPE_SET", "GEARMAN_IO_WAIT",
+    "CURLCLOSEPOLICY_CALLBACK", "PHPDBG_METHOD", "SEASLOG_APPENDER_UDP", "ZLIB_PARTIAL_FLUSH",
+    "RPMREADER_PROVIDES", "SVN_WC_STATUS_CONFLICTED", "SAM_DELIVERYMODE", "SIGQUIT",
+    "PGSQL_DIAG_SEVERITY_NONLOCALIZED", "CYRUS_CALLBACK_NOLITERAL", "LDAP_CONTROL_SORTRESPONSE", "XML_ERROR_ASYNC_ENTITY",
+    "SOCKET_EBADSLT", "PGSQL_ASSOC", "SAM_BYTE", "PHP_PREFIX",
+    "CRYPT_MD5", "SQLITE_MISUSE", "PARSEKIT_ZEND_INSTANCEOF", "SWFACTION_UNLOAD",
+    "SIGVTALRM", "FDFExit", "SQL_NUMERIC", "CURLCLOSEPOLICY_OLDEST",
+    "IBASE_RPR_CHECK_DB", "SOCKET_EAFNOSUPPORT", "SQLITE_PROTOCOL", "PARSEKIT_ZEND_ASSIGN_CONCAT",
+    "CURLSSH_AUTH_HOST", "CAL_JEWISH_ADD_ALAFIM", "SQL_INDEX_ALL", "SODIUM_CRYPTO_STREAM_NONCEBYTES",
+    "CAIRO_STATUS_INVALID_STRING", "IBASE_RES_ONE_AT_A_TIME", "PARSEKIT_ZEND_FE_FETCH", "SQLITE_BUSY",
+    "UDM_FIELD_DESCRIPTION", "SWOOLE_THREAD", "OP_HALFOPEN", "SIGCLD",
+    "PGSQL_DIAG_INTERNAL_POSITION", "CURLE_URL_MALFORMAT_USER", "SQLSRV_SCROLL_PRIOR", "MYSQLX_TYPE_SET",
+    "YAML_SINGLE_QUOTED_SCALAR_STYLE", "SI_KERNEL", "GEARMAN_CLIENT_UNBUFFERED_RESULT", "TRADER_ERR_INVALID_PARAM_HOLDER_TYPE",
+    "SQLITE_LOCKED", "SQL_BIT", "CURLOPT_BUFFERSIZE", "LDAP_EXOP_REFRESH",
+    "CAIRO_SURFACE_TYPE_BEOS", "BBCODE_FLAGS_SMILEYS_OFF", "LDAP_CONTROL_SORTREQUEST", "CURLE_FTP_QUOTE_ERROR",
+    "TRADER_ERR_OUT_OF_RANGE_END_INDEX", "FPE_FLTINV", "CURLOPT_PUT", "SQLSRV_TXN_REPEATABLE_READ",
+    "SOCK_SEQPACKET", "UDM_PARAM_FIRST_DOC", "VARNISH_STATUS_UNKNOWN", "AL_MAX_DISTANCE",
+    "SIG_DFL", "MYSQLND_UH_MYSQLND_COM_PROCESS_KILL", "SIGBUS", "UDM_PHRASE_DISABLED",
+    "CAL_EASTER_ALWAYS_GREGORIAN", "SODIUM_CRYPTO_PWHASH_SCRYPTSALSA208SHA256_MEMLIMIT_INTERACTIVE", "LDAP_CONTROL_X_PERMISSIVE_MODIFY", "SNMP_UNSIGNED",
+    "CAIRO_STATUS_INVALID_POP_GROUP", "GEOIP_REGION_EDITION_REV0", "SEEK_SET", "GMP_ROUND_PLUSINF",
+    "CURLOPT_FILE", "IFX_LO_APPEND", "RADIUS_MPPE_KEY_LEN", "MSG_OOB",
+    "UDM_PARAM_QSTRING", "EXP_EOF", "RPMREADER_COOKIE", "CAIRO_LINE_CAP_ROUND",
+    "JSON_OBJECT_AS_ARRAY", "SOCKET_EALREADY", "MB_CASE_LOWER", "CURLOPT_SSLKEY",
+    "GD_MINOR_VERSION", "PGSQL_NOTICE_CLEAR", "SQLSRV_NULLABLE_UNKNOWN", "SODIUM_LIBRARY_MAJOR_VERSION",
+    "GNUPG_VALIDITY_UNKNOWN", "SO_DEBUG", "IFX_HOLD", "CAIRO_HINT_STYLE_DEFAULT",
+    "SOCKET_ENOPROTOOPT", "CURLE_UNKNOWN_TELNET_OPTION", "SNMP_OID_OUTPUT_FULL", "SORT_FLAG_CASE",
+    "MYSQLI_TYPE_TINY", "CURLINFO_REQUEST_SIZE", "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_IETF_ABYTES", "SOCKET_ECONNREFUSED",
+    "SOCKET_EIDRM", "FILTER_SANITIZE_MAGIC_QUOTES", "MYSQLI_CURSOR_TYPE_FOR_UPDATE", "PHP_INT_SIZE",
+    "CP_MOVE", "IBASE_RES_NO_VALIDITY", "MYSQLI_BOTH", "IBASE_SVC_GET_USERS",
+    "YPERR_RESRC", "SQLSRV_SCROLL_RELATIVE", "INI_SCANNER_RAW", "CAIRO_STATUS_CLIP_NOT_REPRESENTABLE",
+    "CURL_HTTP_VERSION_1_1", "SNMP_OBJECT_ID", "CURLINFO_PROXY_SSL_VERIFYRESULT", "FILTER_CALLBACK",
+    "GEARMAN_WORK_EXCEPTION", "SWOOLE_UNIX_DGRAM", "RUNKIT_IMPORT_CLASS_PROPS", "E_PARSE",
+    "CAIRO_FORMAT_RGB24", "LDAP_OPT_MATCHED_DN", "SOCKET_EREMCHG", "MYSQLND_UH_SERVER_OPTION_PLUGIN_DIR",
+    "JSON_HEX_QUOT", "GEOIP_NETSPEED_EDITION", "XML_OPTION_CASE_FOLDING", "IMG_ARC_CHORD",
+    "UDM_FIELD_TITLE", "CURLINFO_HEADER_OUT", "SSH2_FINGERPRINT_MD5", "IBASE_SVC_GET_ENV_LOCK",
+    "SVN_AUTH_PARAM_DEFAULT_USERNAME", "SQLITE_EMPTY", "CAIRO_FORMAT_A1", "MYSQLND_UH_MYSQLND_CLOSE_EXPLICIT",
+    "LIBXML_SCHEMA_CREATE", "CAIRO_SURFACE_TYPE_SVG", "SWOOLE_IPC_MSGQUEUE", "SQL_INTEGER",
+    "PARSEKIT_ZEND_FETCH_DIM_W", "SOCKET_ESOCKTNOSUPPORT", "SWOOLE_SYNC", "SWOOLE_SOCK_ASYNC",
+    "UDM_CROSS_WORDS_DISABLED", "SO_BROADCAST", "JSON_ERROR_RECURSION", "MYSQLND_UH_MYSQLND_COM_PING",
+    "JSON_HEX_AMP", "IMG_EFFECT_ALPHABLEND", "PGSQL_DIAG_CONTEXT", "PGSQL_STATUS_STRING",
+    "RPMREADER_EXCLUSIVEARCH", "FILEINFO_MIME_ENCODING", "SOCKET_EAGAIN", "OAUTH_OK",
+    "YPERR_YPERR", "CURLOPT_CONNECTTIMEOUT_MS", "FANN_TRAIN_BATCH", "TRUE",
+    "UDM_ISPELL_PREFIX_DISABLED", "PARSEKIT_ZEND_BRK", "FBSQL_ISO_READ_COMMITTED", "CURLE_FTP_COULDNT_RETR_FILE",
+    "CURL_SSLVERSION_MAX_DEFAULT", "SQL_DOUBLE", "WEBSOCKET_STATUS_ACTIVE", "VARNISH_STATUS_OK",
+    "CAIRO_SURFACE_TYPE_XCB", "EIO_PRI_MIN", "PGSQL_LIBPQ_VERSION", "CAIRO_CONTENT_COLOR",
+    "MYSQLI_USE_RESULT", "XATTR_ROOT", "LOCK_EX", "FPE_FLTDIV",
+    "XHPROF_FLAGS_MEMORY", "EXTR_PREFIX_INVALID", "E_WARNING", "OAUTH_SIG_METHOD_HMACSHA1",
+    "RPMREADER_PREUN", "SWFTEXTFIELD_ALIGN_JUSTIFY", "WEBSOCKET_STATUS_FRAME", "RPMREADER_SIZE",
+    "O_RDONLY", "EIO_DT_MPC", "CURL_VERSION_KERBEROS4", "LATT_UNMARKED",
+    "SQLITE_ABORT", "FILTER_SANITIZE_SPECIAL_CHARS", "SEGV_ACCERR", "IIS_STOPPED",
+    "RPMREADER_DIRINDEXES", "CURLOPT_PASSWDFUNCTION", "FTP_FAILED", "MYSQLI_TYPE_NULL",
+    "LC_MONETARY", "SSH2_DEFAULT_TERM_HEIGHT", "CURLOPT_HTTPPROXYTUNNEL", "GMP_MSW_FIRST",
+    "SOCKET_EBADFD", "FANN_E_CANT_READ_CONFIG", "AL_FORMAT_STEREO16", "DB2_CONVERT",
+    "PARSEKIT_ZEND_SEND_REF", "GUPNP_TYPE_FLOAT", "E_DEPRECATED", "SORTSUBJECT",
+    "BBCODE_DISABLE_TREE_BUILD", "SVN_AUTH_PARAM_SSL_SERVER_CERT_INFO", "SA_UIDVALIDITY", "MYSQLX_TYPE_LONG",
+    "MYSQLI_STMT_ATTR_PREFETCH_ROWS", "CURLSSLOPT_ALLOW_BEAST", "SIGPROF", "CURLINFO_SIZE_UPLOAD_T",
+    "IMG_AFFINE_SHEAR_HORIZONTAL", "CURLMOPT_MAX_TOTAL_CONNECTIONS", "SOL_TCP", "TRADER_REAL_MAX",
+    "CURLE_FUNCTION_NOT_FOUND", "IN_MOVED_FROM", "YAF_ERR_ROUTE_FAILED", "OAUTH_SIGNATURE_METHOD_REJECTED",
+    "SWOOLE_SEM", "IDNA_CHECK_CONTEXTJ", "SODIUM_CRYPTO_BOX_SEALBYTES", "SIGBABY",
+    "PARSEKIT_ZEND_QM_ASSIGN", "E_COMPILE_ERROR", "INGRES_ASSOC", "MYSQLI_READ_DEFAULT_GROUP",
+    "FT_NOT", "CURL_SSLVERSION_TLSv1_2", "MYSQLND_UH_MYSQLND_SET_CLIENT_IP", "LIBXML_NOWARNING",
+    "PGSQL_CONNECT_ASYNC", "MYSQLI_REFRESH_LOG", "FBSQL_LOB_DIRECT", "RPMREADER_SOURCERPM",
+    "IMG_FILTER_COLORIZE", "IMAGETYPE_PSD", "PTHREADS_INHERIT_ALL", "MYSQLND_UH_MYSQLND_CLOSE_LAST",
+    "CURLOPT_REFERER", "MYSQLI_TYPE_INT24", "PATHINFO_FILENAME", "SWFTEXTFIELD_ALIGN_RIGHT",
+    "GUPNP_CONTROL_ERROR_INVALID_ARGS", "SOCKET_ENOTSOCK", "CP_UID", "SWOOLE_UNIX_STREAM",
+    "MYSQLND_UH_MYSQLND_COM_SLEEP", "O_NDELAY", "PARSEKIT_ZEND_RECV", "SAM_FLOAT",
+    "SWOOLE_UDP", "CURLOPT_MAX_RECV_SPEED_LARGE", "SQL_NO_NULLS", "PHPDBG_LINENO",
+    "CURLE_OBSOLETE", "PSPELL_FAST", "AL_CHANNELS", "SQLFLT8",
+    "SOCKET_EINPROGRESS", "XML_ERROR_NONE", "IBASE_PRP_DENY_NEW_ATTACHMENTS", "MYSQLND_UH_MYSQLND_OPT_USE_REMOTE_CONNECTION",
+    "IBASE_PRP_WRITE_MODE", "MYSQLND_MEMCACHE_DEFAULT_REGEXP", "SQLFLT4", "LIBXML_NOENT",
+    "SPH_MATCH_FULLSCAN", "RPMREADER_URL", "CURLE_FTP_CANT_GET_HOST", "SOCKET_EISDIR",
+    "MYSQLI_REFRESH_HOSTS", "CURLOPT_PROXY_PINNEDPUBLICKEY", "CAIRO_SVG_VERSION_1_2", "ZLIB_NO_FLUSH",
+    "SOCKET_EADDRNOTAVAIL", "PARSEKIT_ZEND_CAST", "PARSEKIT_ZEND_FETCH_DIM_R", "FANN_E_CANT_ALLOCATE_MEM",
+    "SOCKET_ENETUNREACH", "PARSEKIT_ZEND_IS_SMALLER_OR_EQUAL", "FDFAA", "MYSQLND_UH_MYSQLND_SET_CHARSET_DIR",
+    "RPMREADER_REQUIRENAME", "AL_INITIAL", "SOCKET_ESHUTDOWN", "WEBSOCKET_OPCODE_BINARY",
+    "RPMREADER_POSTIN", "E_USER_WARNING", "ID3_BEST", "SQL_CURSOR_KEYSET_DRIVEN",
+    "PARSEKIT_ZEND_CASE", "INGRES_NUM", "CURLINFO_REDIRECT_COUNT", "CAIRO_SUBPIXEL_ORDER_VRGB",
+    "EIO_O_TRUNC", "PHP_MANDIR", "PGSQL_DML_NO_CONV", "MYSQLI_CLIENT_IGNORE_SPACE",
+    "IBASE_BKP_METADATA_ONLY", "MYSQLI_REFRESH_MASTER", "IMAGETYPE_JPEG2000", "S_IRUSR",
+    "FDFAP", "PHP_CONFIG_FILE_SCAN_DIR", "SQLITE_ROW", "FILTER_REQUIRE_ARRAY",
+    "SQLITE_NOTADB", "PARSEKIT_ZEND_PRE_DEC_OBJ", "MYSQLX_TYPE_VAR_STRING", "YAR_PACKAGER_PHP",
+    "SIGKILL", "GLOB_NOCHECK", "XDIFF_PATCH_NORMAL", "FILE_TEXT",
+    "RPMREADER_FILEGROUPNAME", "MYSQLND_UH_MYSQLND_CHG_USER_RESP_PACKET", "PARSEKIT_ZEND_ASSIGN_REF", "CURLE_HTTP_RANGE_ERROR",
+    "FILTER_VALIDATE_EMAIL", "CAIRO_SURFACE_TYPE_WIN32", "VARNISH_STATUS_SYNTAX", "PARSEKIT_ZEND_FETCH_FUNC_ARG",
+    "CURL_SSLVERSION_MAX_TLSv1_1", "CURL_SSLVERSION_MAX_TLSv1_0", "SSH2_FINGERPRINT_HEX", "CURLOPT_NOSIGNAL",
+    "SORT_LOCALE_STRING", "CURLOPT_SSH_HOST_PUBLIC_KEY_MD5", "EIO_DT_NWK", "SOCKET_ENOTDIR",
+    "MYSQLI_TRANS_COR_AND_NO_CHAIN", "GNUPG_SIGSUM_BAD_POLICY", "IBASE_BKP_NO_GARBAGE_COLLECT", "PTHREADS_INHERIT_NONE",
+    "PARSEKIT_ZEND_ISSET_ISEMPTY_DIM_OBJ", "IMG_ARC_EDGED", "F_DUPFD", "PHP_EXTRA_VERSION",
+    "TRADER_FUNC_UNST_MAMA", "SQLITE_NOLFS", "PARSEKIT_ZEND_PRE_DEC", "FDFDown",
+    "MYSQLI_TYPE_GEOMETRY", "PHP_FLOAT_DIG", "SOLR_EXTENSION_VERSION", "MYSQLND_UH_MYSQLND_COM_STMT_FETCH",
+    "CURLCLOSEPOLICY_LEAST_RECENTLY_USED", "PGSQL_ERRORS_DEFAULT", "PHP_URL_PORT", "GEARMAN_SERVER_ERROR",
+    "EIO_O_APPEND", "PARSEKIT_ZEND_SEND_VAL", "MCRYPT_ENCRYPT", "IN_MOVE_SELF",
+    "FDFFlags", "YAR_PACKAGER_JSON", "RPMREADER_INSTALLCOLOR", "SOCKET_EREMOTE",
+    "ZLIB_ENCODING_DEFLATE", "CAIRO_FILTER_FAST", "IDNA_NONTRANSITIONAL_TO_UNICODE", "PHP_URL_PASS",
+    "GEARMAN_INVALID_WORKER_FUNCTION", "IBASE_RPR_IGNORE_CHECKSUM", "PHP_QUERY_RFC3986", "EIO_DT_DIR",
+    "UDM_CROSSWORDS_ENABLED", "SEASLOG_AUTHOR", "PARSEKIT_ZEND_INIT_METHOD_CALL", "SQLSRV_CURSOR_KEYSET",
+    "PGSQL_CONNECTION_OK", "CURLOPT_SSL_ENABLE_NPN", "YPERR_PMAP", "PHP_SESSION_ACTIVE",
+    "CAIRO_OPERATOR_OUT", "ZLIB_FILTERED", "SQL_CURSOR_TYPE", "UDM_FIELD_RATING",
+    "SOCKET_EPROTOTYPE", "RPMREADER_DESCRIPTION", "SQL_BINARY", "TYPETEXT",
+    "PGSQL_SEEK_CUR", "CASE_LOWER", "XATTR_CREATE", "EIO_DT_CHR",
+    "SODIUM_CRYPTO_PWHASH_STRPREFIX", "FANN_E_CANT_OPEN_TD_R", "CURL_HTTP_VERSION_2", "PHP_SYSCONFDIR",
+    "INPUT_SERVER", "RPMREADER_SERIAL", "SAM_WAIT", "PGSQL_DIAG_SOURCE_LINE",
+    "CURLFTPAUTH_DEFAULT", "CURLE_GOT_NOTHING", "DB2_PARAM_OUT", "GEARMAN_WORK_DATA",
+    "LDAP_OPT_X_KEEPALIVE_PROBES", "SIGABRT", "SPH_FILTER_RANGE", "SODIUM_CRYPTO_GENERICHASH_KEYBYTES_MAX",
+    "CAIRO_STATUS_READ_ERROR", "FANN_TRAIN_QUICKPROP", "MYSQLND_UH_MYSQLND_OPT_SSL_PASSPHRASE", "YPERR_KEY",
+    "MSG_DONTROUTE", "SQL_TIMESTAMP", "SVN_AUTH_PARAM_DONT_STORE_PASSWORDS", "MYSQLI_PART_KEY_FLAG",
+    "COUNT_RECURSIVE", "CAIRO_ANTIALIAS_DEFAULT", "MYSQLI_TRANS_START_READ_ONLY", "PHP_INT_MIN",
+    "CAIRO_PATTERN_TYPE_RADIAL", "UDM_PARAM_FOUND", "IBASE_RES_REPLACE", "E_USER_ERROR",
+    "RPMREADER_VERIFYSCRIPTPROG", "UDM_PARAM_LOCAL_CHARSET", "SE_UID", "TRADER_MA_TYPE_DEMA",
+    "YAR_OPT_CONNECT_TIMEOUT", "CURL_VERSION_PSL", "SIGUSR1", "EIO_S_IFREG",
+    "CURLOPT_PROXY_CAINFO", "MYSQLND_MS_VERSION_ID", "MYSQLND_UH_MYSQLND_PREPARE_RESP_PACKET", "PARSEKIT_ZEND_POST_INC_OBJ",
+    "PARSEKIT_ZEND_FREE", "CURLOPT_NETRC", "ZLIB_SYNC_FLUSH", "IMG_COLOR_TILED",
+    "EIO_S_IFCHR", "MYSQLI_GROUP_FLAG", "EVLOOP_ONCE", "SOCKET_EBADRQC",
+    "PARSEKIT_RESULT_EA_TYPE", "SNMP_IPADDRESS", "SQL_VARBINARY", "SQLITE3_DETERMINISTIC",
+    "IMG_GAUSSIAN", "EXP_FULLBUFFER", "LOCK_SH", "CAIRO_STATUS_INVALID_PATH_DATA",
+    "MYSQLND_UH_MYSQLND_OPT_NET_READ_BUFFER_SIZE", "SODIUM_CRYPTO_AEAD_AES256GCM_KEYBYTES", "CAL_MONTH_JULIAN_SHORT", "GEARMAN_PACKET_HEADER_SIZE",
+    "FILTER_FLAG_IPV4", "SIGSEGV", "MCRYPT_DECRYPT", "GEARMAN_DEFAULT_SOCKET_SEND_SIZE",
+    "PARSEKIT_RESULT_OPARRAY", "FANN_E_INDEX_OUT_OF_BOUND", "LDAP_CONTROL_PAGEDRESULTS", "SSH2_STREAM_STDIO",
+    "CYRUS_CALLBACK_NUMBERED", "CURLOPT_LOGIN_OPTIONS", "FILE_APPEND", "FBSQL_ASSOC",
+    "SQLSRV_CURSOR_BUFFERED", "FANN_ERRORFUNC_LINEAR", "SQLINT4", "PARSEKIT_ZEND_ASSIGN_BW_XOR",
+    "RPMREADER_PREINPROG", "CURLAUTH_NEGOTIATE", "IDNA_ERROR_HYPHEN_3_4", "SQLINT1",
+    "CURLOPT_SSL_CIPHER_LIST", "SQLSRV_LOG_SEVERITY_WARNING", "MYSQLX_TYPE_LONGLONG", "SOCKET_ESTRPIPE",
+    "CURLOPT_FTP_CREATE_MISSING_DIRS", "PEAR_INSTALL_DIR", "SO_SNDLOWAT", "MYSQLND_MS_QOS_OPTION_GTID",
+    "SWOOLE_FILELOCK", "SA_ALL", "__CLASS__", "MYSQLND_UH_MYSQLND_OPT_WRITE_TIMEOUT",
+    "PHP_VERSION", "LDAP_CONTROL_AUTHZID_RESPONSE", "SPH_SORT_TIME_SEGMENTS", "ZEND_USER_OPCODE_LEAVE",
+    "MB_OVERLOAD_STRING", "WEBSOCKET_STATUS_HANDSHAKE", "ALC_REFRESH", "FILTER_SANITIZE_URL",
+    "SQLSRV_SQLTYPE_VARBINARY", "PARSEKIT_ZEND_DECLARE_CLASS", "OP_READONLY", "SOCKET_ENAMETOOLONG",
+    "PARSEKIT_ZEND_FETCH_IS", "FBSQL_LOCK_DEFERRED", "PGSQL_POLLING_ACTIVE", "RAR_HOST_MSDOS",
+    "ENCHANT_ISPELL", "FILTER_NULL_ON_FAILURE", "MYSQLND_UH_MYSQLND_PROT_GREET_PACKET", "LIBXML_NOEMPTYTAG",
+    "EIO_DT_REG", "OP_PROTOTYPE", "CURLSSH_AUTH_AGENT", "PARSEKIT_USAGE_UNKNOWN",
+    "Parle\\INTERNAL_UTF32", "MB_OVERLOAD_REGEX", "__LINE__", "ZEND_ACC_CLASS",
+    "LIBXML_HTML_NOIMPLIED", "RPMREADER_EXCLUDEOS", "LIBXML_NOERROR", "SWFTEXTFIELD_WORDWRAP",
+    "CURLOPT_PROXY_TLSAUTH_TYPE", "FANN_ELLIOT", "SORTDATE", "CURLOPT_PROXY_TLSAUTH_PASSWORD",
+    "CURLAUTH_GSSAPI", "UDM_PHRASE_ENABLED", "__TRAIT__", "SODIUM_CRYPTO_BOX_PUBLICKEYBYTES",
+    "EIO_O_FSYNC", "PARSEKIT_ZEND_NOP", "IMG_FILTER_GRAYSCALE", "CURLOPT_HTTP_VERSION",
+    "XML_OPTION_SKIP_WHITE", "UDM_PARAM_CHARSET", "CURLE_LDAP_CANNOT_BIND", "PHP_OUTPUT_HANDLER_FLUSH",
+    "PARSEKIT_ZEND_ASSIGN_MOD", "INGRES_DATE_GERMAN", "SOCKET_EIO", "CURLPROTO_SMB",
+    "IN_MOVED_TO", "SOCKET_EXFULL", "ILL_ILLADR", "CURLOPT_PROXYUSERPWD",
+    "PARSEKIT_ZEND_ASSIGN_SL", "ENT_HTML5", "SQLSRV_NULLABLE_YES", "PHPDBG_COLOR_PROMPT",
+    "CURL_SSLVERSION_TLSv1_0", "CURL_SSLVERSION_TLSv1_3", "MYSQLI_UNIQUE_KEY_FLAG", "OP_SECURE",
+    "MYSQLI_TYPE_FLOAT", "SQLITE_BOTH", "CURLOPT_DEFAULT_PROTOCOL", "LIBXML_NONET",
+    "PHP_OUTPUT_HANDLER_END", "CAIRO_SUBPIXEL_ORDER_VBGR", "MYSQLND_MEMCACHE_VERSION", "RAR_HOST_WIN32",
+    "PARSEKIT_RESULT_VAR", "RPMREADER_MINIMUM", "S_IWGRP", "CURLE_SSL_CIPHER",
+    "MYSQLND_UH_MYSQLND_SHARED_MEMORY_BASE_NAME", "TRADER_FUNC_UNST_MINUS_DI", "TRADER_ERR_OUTPUT_NOT_ALL_INITIALIZE", "PHP_SAPI",
+    "MONGO_STREAM_NOTIFY_LOG_WRITE_BATCH", "SQLSRV_SQLTYPE_BINARY", "CURLE_FTP_CANT_RECONNECT", "CURLAUTH_GSSNEGOTIATE",
+    "CURLOPT_INFILESIZE", "SQLITE3_OPEN_READWRITE", "CURLOPT_HTTPHEADER", "CURL_VERSION_SSL",
+    "CURLINFO_SCHEME", "SQLITE3_ASSOC", "IBASE_BKP_NON_TRANSPORTABLE", "CURL_VERSION_HTTPS_PROXY",
+    "GEARMAN_TIMEOUT", "PARSEKIT_ZEND_CONCAT", "SNMP_INTEGER", "CURLOPT_SSLKEYTYPE",
+    "CURLE_SHARE_IN_USE", "MYSQLI_TYPE_YEAR", "PARSEKIT_ZEND_JMPZ", "FANN_E_SCALE_NOT_PRESENT",
+    "SOCKET_ENXIO", "CURLPROTO_SMBS", "CURLPROXY_SOCKS5_HOSTNAME", "MYSQLI_STORE_RESULT",
+    "PHP_URL_QUERY", "CURLOPT_PORT", "PTHREADS_INHERIT_FUNCTIONS", "FILE_USE_INCLUDE_PATH",
+    "PHP_OUTPUT_HANDLER_CONT", "SQLITE_READONLY", "GNUPG_SIGSUM_CRL_MISSING", "MYSQLND_MS_QUERY_USE_SLAVE",
+    "FANN_E_TRAIN_DATA_MISMATCH", "ID3_V1_1", "MYSQLI_TYPE_SHORT", "RPMREADER_ICON",
+    "JSON_BIGINT_AS_STRING", "PARSEKIT_ZEND_FETCH_CLASS", "YAML_INT_TAG", "PARSEKIT_ZEND_IMPORT_FUNCTION",
+    "CURLOPT_HEADEROPT", "CURL_VERSION_HTTP2", "MYSQLX_TYPE_BLOB", "IMG_EFFECT_OVERLAY",
+    "CURL_VERSION_IPV6", "FNM_CASEFOLD", "EIO_S_IXUSR", "INGRES_MONEY_LEADING",
+    "PARSEKIT_ZEND_ASSIGN_SUB", "UDM_PARAM_HLEND", "UDM_MODE_BOOL", "CURLOPT_FAILONERROR",
+    "SWFFILL_LINEAR_GRADIENT", "XML_OPTION_SKIP_TAGSTART", "IBASE_PRP_AM_READONLY", "YAF_ERR_NOTFOUND_ACTION",
+    "IN_ISDIR", "MYSQLND_QC_TTL_SWITCH", "E_CORE_WARNING", "CURLE_FAILED_INIT",
+    "MYSQLX_TYPE_TIMESTAMP", "EXP_EXACT", "CURLOPT_MAX_SEND_SPEED_LARGE", "PARSEKIT_ZEND_SWITCH_FREE",
+    "CLD_TRAPPED", "PATHINFO_EXTENSION", "PGSQL_TRANSACTION_IDLE", "PARSEKIT_ZEND_FE_RESET",
+    "FILTER_VALIDATE_INT", "SSH2_DEFAULT_TERM_WIDTH", "SODIUM_CRYPTO_PWHASH_SCRYPTSALSA208SHA256_OPSLIMIT_INTERACTIVE", "SODIUM_CRYPTO_AUTH_BYTES",
+    "MONGO_STREAM_NOTIFY_LOG_WRITE_REPLY", "UDM_PARAM_SEARCH_MODE", "F_GETOWN", "LDAP_OPT_X_TLS_CACERTDIR",
+    "CURLPAUSE_SEND", "CURLOPT_PROXY_SSLKEYTYPE", "WUNTRACED", "UDM_PARAM_TRACK_MODE",
+    "SQL_CUR_USE_IF_NEEDED", "IFX_LO_NOBUFFER", "MYSQLI_REPORT_STRICT", "CURLINFO_SIZE_UPLOAD",
+    "FANN_E_WRONG_CONFIG_VERSION", "CURLOPT_SSLVERSION", "AF_INET", "IMAGETYPE_ICO",
+    "SOCKET_EBADMSG", "CURLM_OK", "VARNISH_STATUS_AUTH", "OAUTH_HTTP_METHOD_DELETE",
+    "CURLINFO_SSL_VERIFYRESULT", "ZEND_ADD_INTERFACE", "CURLOPT_MAXCONNECTS", "SQLSRV_PHPTYPE_STRING",
+    "RPMREADER_TRIGGERINDEX", "LDAP_EXOP_START_TLS", "SIGURG", "MCRYPT_DEV_RANDOM",
+    "RPMREADER_PREFIXES", "IMG_JPG", "AF_INET6", "SQL_TYPE_TIMESTAMP",
+    "PARSEKIT_ZEND_CLONE", "CAIRO_ANTIALIAS_GRAY", "CURLOPT_AUTOREFERER", "CAIRO_FONT_SLANT_ITALIC",
+    "PHP_OUTPUT_HANDLER_FINAL", "FDFAS", "SOCKET_ENOMEM", "CAL_NUM_CALS",
+    "SPH_ATTR_BOOL", "YAML_FOLDED_SCALAR_STYLE", "TRADER_ERR_BAD_PARAM", "CURL_PUSH_DENY",
+    "DB2_AUTOCOMMIT_ON", "RUNKIT_ACC_PROTECTED", "ZLIB_DEFAULT_STRATEGY", "GEARMAN_MAX_COMMAND_ARGS",
+    "POLL_PRI", "VARNISH_STATUS_CLOSE", "YAML_LITERAL_SCALAR_STYLE", "CURLOPT_DNS_CACHE_TIMEOUT",
+    "GSLC_SSL_NO_AUTH", "BLENC_EXT_VERSION", "PARSEKIT_ZEND_ASSIGN", "MONGO_STREAM_NOTIFY_LOG_KILLCURSOR",
+    "INGRES_DATE_YMD", "YPERR_VERS", "JSON_FORCE_OBJECT", "CURLAUTH_NTLM_WB",
+    "CURLINFO_LOCAL_PORT", "SODIUM_CRYPTO_KDF_CONTEXTBYTES", "SI_SIGIO", "MYSQLND_UH_MYSQLND_COM_CHANGE_USER",
+    "TRADER_MA_TYPE_SMA", "STR_PAD_BOTH", "MYSQLND_UH_MYSQLND_COM_INIT_DB", "TRADER_ERR_INPUT_NOT_ALL_INITIALIZE",
+    "UDM_MATCH_END", "CURLMOPT_MAX_HOST_CONNECTIONS", "RPMREADER_PACKAGER", "GMP_LSW_FIRST",
+    "SODIUM_CRYPTO_AUTH_KEYBYTES", "CAIRO_SURFACE_TYPE_XLIB", "EIO_S_IXOTH", "IBASE_PRP_SET_SQL_DIALECT",
+    "CURLE_FTP_COULDNT_SET_BINARY", "CURLPROXY_HTTP", "IMG_CATMULLROM", "APC_ITER_MTIME",
+    "MYSQLI_MULTIPLE_KEY_FLAG", "IMG_BILINEAR_FIXED", "MONGODB_VERSION", "CL_EXPUNGE",
+    "F_UNLCK", "CAL_MONTH_JEWISH", "PARSEKIT_ZEND_IS_EQUAL", "LDAP_OPT_TIMELIMIT",
+    "CAIRO_OPERATOR_DEST_OUT", "CAIRO_OPERATOR_DEST", "PARSEKIT_ZEND_UNSET_DIM_OBJ", "SA_UNSEEN",
+    "FDFID", "ENT_COMPAT", "FDFIF", "GEOIP_COUNTRY_EDITION",
+    "RPMREADER_PLATFORM", "CURLOPT_UNIX_SOCKET_PATH", "PARSEKIT_ZEND_FETCH_DIM_UNSET", "PGSQL_TRANSACTION_ACTIVE",
+    "JSON_PARTIAL_OUTPUT_ON_ERROR", "SODIUM_CRYPTO_KDF_KEYBYTES", "MYSQLX_TYPE_INT24", "PARSEKIT_ZEND_EXT_STMT",
+    "SOCKET_EROFS", "MYSQLND_UH_MYSQLND_OPT_USE_RESULT", "GEARMAN_WORKER_NON_BLOCKING", "SSH2_FINGERPRINT_RAW",
+    "VARNISH_STATUS_TOOFEW", "RPMREADER_INSTALLTIME", "PGSQL_DML_STRING", "SOCKET_EMEDIUMTYPE",
+    "TRADER_ERR_OUT_OF_RANGE_START_INDEX", "CURLE_OK", "SIG_SETMASK", "SOCKET_EINVAL",
+    "AL_SOURCE_STATE", "RPMREADER_BUILDTIME", "RUNKIT_ACC_PRIVATE", "FANN_E_CANT_USE_ACTIVATION",
+    "IMAP_READTIMEOUT", "PARSEKIT_ZEND_UNSET_VAR", "SVN_AUTH_PARAM_NO_AUTH_CACHE", "PGSQL_CONV_IGNORE_DEFAULT",
+    "CURLOPT_SSL_OPTIONS", "AL_FORMAT_STEREO8", "SWOOLE_MUTEX", "EXP_REGEXP",
+    "CURLOPT_TIMECONDITION", "AL_CONE_INNER_ANGLE", "O_NONBLOCK", "PEAR_EXTENSION_DIR",
+    "UDM_PARAM_CACHE_MODE", "FDFRolloverAP", "CURLOPT_TIMEOUT_MS", "CURLOPT_FTPASCII",
+    "MONGO_SUPPORTS_AUTH_MECHANISM_MONGODB_CR", "FILTER_FLAG_ENCODE_HIGH", "CURLE_SSL_PEER_CERTIFICATE", "MYSQLI_TRANS_START_CONSISTENT_SNAPSHOT",
+    "SQLSRV_SQLTYPE_NTEXT", "SQLSRV_NULLABLE_NO", "CURLOPT_SUPPRESS_CONNECT_HEADERS", "PARSEKIT_SIMPLE",
+    "CURL_REDIR_POST_303", "CURLOPT_MAXREDIRS", "CAIRO_OPERATOR_SATURATE", "SODIUM_CRYPTO_AEAD_AES256GCM_NSECBYTES",
+    "SODIUM_CRYPTO_STREAM_KEYBYTES", "GEARMAN_WORKER_WAIT_TIMEOUT", "CURLPAUSE_SEND_CONT", "CAIRO_FONT_WEIGHT_NORMAL",
+    "SQLITE3_BOTH", "LDAP_DEREF_FINDING", "UDM_PARAM_WORDINFO", "MYSQLND_MS_QUERY_USE_MASTER",
+    "CURLFTPSSL_ALL", "CURLE_FILESIZE_EXCEEDED", "CURLOPT_LOW_SPEED_LIMIT", "CURLOPT_QUOTE",
+    "LIBXML_NOXMLDECL", "CAIRO_EXTEND_REFLECT", "FILTER_DEFAULT", "RPMREADER_EPOCH",
+    "SWOOLE_AIO_BASE", "PGSQL_TRANSACTION_INTRANS", "RPMREADER_SOURCEPKGID", "IBASE_RPR_FULL",
+    "CURLOPT_REQUEST_TARGET", "SVN_WC_STATUS_ADDED", "MYSQLI_CLIENT_INTERACTIVE", "CLD_EXITED",
+    "MYSQLI_REFRESH_THREADS", "LATT_NOINFERIORS", "MYSQLI_REFRESH_STATUS", "OAUTH_CONSUMER_KEY_UNKNOWN",
+    "LDAP_OPT_X_TLS_REQUIRE_CERT", "WEBSOCKET_OPCODE_TEXT", "LDAP_CONTROL_VLVRESPONSE", "GNUPG_PROTOCOL_OpenPGP",
+    "EIO_DT_CMP", "PGSQL_TRANSACTION_UNKNOWN", "CURLINFO_STARTTRANSFER_TIME", "LIBXML_HTML_NODEFDTD",
+    "CURLFTP_CREATE_DIR", "XSL_SECPREF_DEFAULT", "INPUT_SESSION", "SVN_AUTH_PARAM_SERVER_GROUP",
+    "UDM_PARAM_PREFIX", "CURLOPT_PROXY", "FBSQL_LOB_HANDLE", "PARSEKIT_ZEND_FETCH_DIM_FUNC_ARG",
+    "SQLITE_DONE", "LDAP_CONTROL_VALUESRETURNFILTER", "SQL_DECIMAL", "SQLSRV_SCROLL_LAST",
+    "CAL_MONTH_JULIAN_LONG", "FILEINFO_EXTENSION", "CURLINFO_PRIMARY_IP", "TRADER_FUNC_UNST_HT_PHASOR",
+    "MYSQLND_UH_VERSION", "FANN_TRAIN_RPROP", "SAM_TEXT", "MYSQLND_UH_MYSQLND_OPT_SSL_KEY",
+    "SOCKET_EPROTOOPT", "SVN_WC_STATUS_MERGED", "SUNFUNCS_RET_STRING", "LDAP_DEREF_ALWAYS",
+    "BBCODE_ARG_QUOTE_ESCAPING", "CURLOPT_TIMEVALUE", "MYSQLI_TYPE_LONG", "SQLSRV_SQLTYPE_UDT",
+    "CAIRO_SURFACE_TYPE_DIRECTFB", "LOCK_NB", "CURLOPT_SSH_AUTH_TYPES", "ILL_ILLOPN",
+    "SAM_WPM", "RPMREADER_DISTURL", "MSQL_ASSOC", "AL_MIN_GAIN",
+    "IMG_FILTER_EMBOSS", "FDFNormalAP", "SOCKET_ENOLCK", "CURLPIPE_NOTHING",
+    "PTHREADS_ALLOW_HEADERS", "CURLE_HTTP_PORT_FAILED", "PARSEKIT_ZEND_INIT_FCALL_BY_NAME", "FANN_SIGMOID",
+    "SQLSRV_TXN_READ_COMMITTED", "CURL_HTTP_VERSION_2TLS", "CAIRO_PATTERN_TYPE_SURFACE", "IMAGETYPE_WEBP",
+    "CURLOPT_SASL_IR", "O_APPEND", "SODIUM_CRYPTO_GENERICHASH_BYTES_MAX", "RPMREADER_INSTPREFIXES",
+    "PARSEKIT_ZEND_BW_OR", "E_ERROR", "RPMREADER_TRIGGERSCRIPTPROG", "MYSQLND_UH_MYSQLND_COM_QUERY",
+    "UDM_CACHE_DISABLED", "SAM_REPLY_TO", "CURLMOPT_PIPELINING", "OAUTH_BAD_NONCE",
+    "EIO_PRI_DEFAULT", "SOCK_RAW", "GEARMAN_WORK_WARNING", "PGSQL_COPY_OUT",
+    "CURLOPT_TIMEOUT", "PHP_DATADIR", "MONGO_STREAM_NOTIFY_IO_PROGRESS", "CAIRO_STATUS_NO_MEMORY",
+    "INGRES_DATE_ISO", "DB2_BINARY", "CURLINFO_NAMELOOKUP_TIME", "CURLOPT_CUSTOMREQUEST",
+    "PARSEKIT_ZEND_JMPZ_EX", "MYSQLND_UH_MYSQLND_PROT_RSET_FLD_PACKET", "FANN_ELLIOT_SYMMETRIC", "IMG_AFFINE_ROTATE",
+    "PARSEKIT_ZEND_BW_NOT", "SWFTEXTFIELD_NOSELECT", "CURLOPT_HTTPAUTH", "OAUTH_AUTH_TYPE_FORM",
+    "SOCKET_EDUOT", "DBASE_TYPE_DBASE", "GEARMAN_NO_REGISTERED_FUNCTIONS", "CURLINFO_SPEED_DOWNLOAD_T",
+    "FT_PREFETCHTEXT", "IMAGETYPE_JPEG", "UDM_PREFIX_ENABLED", "MAILPARSE_EXTRACT_OUTPUT",
+    "UDM_PARAM_MAX_WORDLEN", "CURLINFO_CONTENT_LENGTH_UPLOAD_T", "FPE_FLTUND", "FILTER_FLAG_NONE",
+    "MONGO_STREAM_NOTIFY_LOG_CMD_INSERT", "IMG_BICUBIC_FIXED", "MYSQLND_UH_SERVER_OPTION_DEFAULT_AUTH", "MYSQLI_ASSOC",
+    "LDAP_OPT_PROTOCOL_VERSION", "SPH_ATTR_ORDINAL", "IMG_FILTER_NEGATE", "SIGSTKFLT",
+    "IMAGETYPE_IFF", "SQLITE3_OPEN_READONLY", "CURLINFO_REDIRECT_TIME", "CURLE_FTP_COULDNT_USE_REST",
+    "SWFBUTTON_OVER", "ZEND_ACC_STATIC", "JSON_UNESCAPED_SLASHES", "LDAP_OPT_SIZELIMIT",
+    "SIGUSR2", "PARSEKIT_ZEND_DO_FCALL", "XML_ERROR_SYNTAX", "SODIUM_CRYPTO_PWHASH_OPSLIMIT_SENSITIVE",
+    "LDAP_OPT_X_TLS_CIPHER_SUITE", "LDAP_OPT_NETWORK_TIMEOUT", "SSH2_FINGERPRINT_SHA1", "IDNA_ERROR_LABEL_TOO_LONG",
+    "CURLSSLOPT_NO_REVOKE", "IMG_FLIP_BOTH", "IDNA_ERROR_DOMAIN_NAME_TOO_LONG", "PHP_OUTPUT_HANDLER_CLEANABLE",
+    "JSON_UNESCAPED_LINE_TERMINATORS", "FRIBIDI_AUTO", "SI_TIMER", "FANN_SIGMOID_SYMMETRIC_STEPWISE",
+    "LC_NUMERIC", "VARNISH_CONFIG_COMPAT", "CLD_STOPPED", "CURLCLOSEPOLICY_LEAST_TRAFFIC",
+    "AL_BITS", "MYSQLI_NUM", "MYSQLX_TYPE_STRING", "SQLITE_INTERNAL",
+    "GEARMAN_RECV_BUFFER_SIZE", "MYSQLX_TYPE_DECIMAL", "FILTER_SANITIZE_NUMBER_INT", "PARSEKIT_ZEND_ASSIGN_MUL",
+    "TYPEAUDIO", "CURLOPT_SSLENGINE", "MYSQLI_CLIENT_COMPRESS", "MYSQLI_CLIENT_MULTI_QUERIES",
+    "LIBXSLT_VERSION", "YAML_ANY_ENCODING", "MYSQLI_REFRESH_TABLES", "CURLE_SEND_ERROR",
+    "SQLITE_CONSTRAINT", "LC_COLLATE", "UDM_FIELD_LANG", "BBCODE_SET_FLAGS_SET",
+    "MYSQLND_MS_QOS_CONSISTENCY_STRONG", "YPERR_BADDB", "CURLOPT_HEADERFUNCTION", "TRAP_TRACE",
+    "ARRAY_FILTER_USE_BOTH", "SORT_DESC", "UDM_LIMIT_TAG", "UDM_FIELD_SCORE",
+    "RPMREADER_VERSION", "SVN_AUTH_PARAM_DEFAULT_PASSWORD", "ENT_NOQUOTES", "CAIRO_STATUS_SURFACE_TYPE_MISMATCH",
+    "FILTER_SANITIZE_NUMBER_FLOAT", "SQLSRV_SQLTYPE_SMALLMONEY", "CAL_JEWISH", "CAIRO_STATUS_INVALID_RESTORE",
+    "CURL_REDIR_POST_ALL", "CURLOPT_SSLCERTPASSWD", "IFX_LO_WRONLY", "GNUPG_SIGSUM_SYS_ERROR",
+    "SQLITE_NUM", "OAUTH_BAD_TIMESTAMP", "AL_FORMAT_MONO8", "MYSQLI_REPORT_ALL",
+    "PGSQL_STATUS_LONG", "PSPELL_NORMAL", "F_GETFL", "CURLOPT_SSL_ENABLE_ALPN",
+    "SPH_RANK_WORDCOUNT", "LDAP_OPT_DIAGNOSTIC_MESSAGE", "YAF_ERR_STARTUP_FAILED", "SQLSRV_CURSOR_DYNAMIC",
+    "RPMREADER_FSCONTEXTS", "SA_UIDNEXT", "F_GETFD", "SQLSRV_SQLTYPE_DATETIME2",
+    "IBASE_STS_DB_LOG", "CURLE_FTP_ACCESS_DENIED", "SQLSRV_FETCH_NUMERIC", "LDAP_EXOP_MODIFY_PASSWD",
+    "CAIRO_HINT_METRICS_DEFAULT", "CURLOPT_PROXY_KEYPASSWD", "FILTER_FLAG_QUERY_REQUIRED", "SQLSRV_ERR_ALL",
+    "SWFACTION_MOUSEMOVE", "SVN_WC_STATUS_NORMAL", "SQLSRV_ENC_BINARY", "MB_CASE_FOLD",
+    "UDM_PARAM_STOPFILE", "IMAGETYPE_PNG", "SODIUM_CRYPTO_PWHASH_SCRYPTSALSA208SHA256_OPSLIMIT_SENSITIVE", "MYSQLND_QC_VERSION",
+    "SOCKET_EINTR", "EIO_S_IRGRP", "RUNKIT_ACC_STATIC", "GEOIP_ISP_EDITION",
+    "SAM_BYTES", "IMG_COLOR_STYLEDBRUSHED", "SQLITE3_NULL", "SAM_CORRELID",
+    "INGRES_DATE_MULTINATIONAL4", "CURLM_BAD_HANDLE", "YPERR_RPC", "CAIRO_STATUS_INVALID_VISUAL",
+    "SIGSYS", "PHP_RELEASE_VERSION", "PHP_MAXPATHLEN", "TRADER_ERR_INVALID_HANDLE",
+    "CURLOPT_SSL_FALSESTART", "CAIRO_STATUS_WRITE_ERROR", "CURLOPT_DNS_LOCAL_IP6", "SPH_GROUPBY_YEAR",
+    "SOCKET_NO_DATA", "LDAP_CONTROL_PASSWORDPOLICYRESPONSE", "CURLE_FTP_BAD_DOWNLOAD_RESUME", "CURLE_WEIRD_SERVER_REPLY",
+    "SWFFILL_CLIPPED_BITMAP", "MYSQLND_QC_DISABLE_SWITCH", "IMAP_GC_TEXTS", "GEARMAN_INVALID_FUNCTION_NAME",
+    "XML_OPTION_TARGET_ENCODING", "CURLINFO_RESPONSE_CODE", "CURLFTPAUTH_TLS", "SAM_ENDPOINTS",
+    "INGRES_MONEY_TRAILING", "LIBXML_XINCLUDE", "LDAP_OPT_X_TLS_RANDOM_FILE", "CURLOPT_SERVICE_NAME",
+    "MYSQLND_UH_MYSQLND_OPTION_OPT_COMPRESS", "SIGTTIN", "SVN_NODE_NONE", "CAIRO_EXTEND_PAD",
+    "SI_TKILL", "SNMP_OPAQUE", "ZEND_USER_OPCODE_ENTER", "RPMREADER_SOURCE",
+    "PARSEKIT_ZEND_ADD_VAR", "LDAP_CONTROL_X_TREE_DELETE", "JSON_ERROR_INF_OR_NAN", "CLASSKIT_AGGREGATE_OVERRIDE",
+    "PARSEKIT_ZEND_ISSET_ISEMPTY", "FBSQL_LOCK_PESSIMISTIC", "CURLOPT_TCP_FASTOPEN", "IMAGETYPE_JP2",
+    "SEEK_CUR", "ZEND_THROW", "SWFACTION_KEYUP", "BBCODE_ARG_SINGLE_QUOTE",
+    "MONGO_STREAM_NOTIFY_TYPE_LOG", "XATTR_REPLACE", "SQLSRV_SQLTYPE_INT", "MYSQLND_UH_MYSQLND_COM_DROP_DB",
+    "CURLOPT_CRLF", "SQL_CUR_USE_DRIVER", "CAL_JEWISH_ADD_ALAFIM_GERESH", "XSL_SECPREF_WRITE_NETWORK",
+    "YAR_ERR_OKEY", "SWFBUTTON_DRAGOUT", "GD_MAJOR_VERSION", "SPH_FILTER_FLOATRANGE",
+    "PHP_URL_PATH", "YAML_DOUBLE_QUOTED_SCALAR_STYLE", "IBASE_PRP_SHUTDOWN_DB", "UDM_FIELD_MODIFIED",
+    "MONGO_SUPPORTS_SSL", "SODIUM_CRYPTO_KX_SEEDBYTES", "GEOIP_DOMAIN_EDITION", "SVN_REVISION_HEAD",
+    "YAR_OPT_HEADER", "SOCKET_ENOTEMPTY", "TYPEMESSAGE", "CAL_DOW_DAYNO",
+    "PHP_MAJOR_VERSION", "SOCKET_ENETRESET", "CAIRO_STATUS_FILE_NOT_FOUND", "SQLSRV_SQLTYPE_TINYINT",
+    "LIBXML_ERR_NONE", "SQLSRV_LOG_SYSTEM_STMT", "CURLOPT_FTPLISTONLY", "PSPELL_BAD_SPELLERS",
+    "RPMREADER_OS", "LDAP_CONTROL_ASSERT", "ENCQUOTEDPRINTABLE", "CURLINFO_CONTENT_LENGTH_UPLOAD",
+    "SQLSRV_SQLTYPE_FLOAT", "RPMREADER_XPM", "CURLOPT_CONNECT_TO", "UDM_MATCH_WORD",
+    "PARSEKIT_ZEND_ASSIGN_DIV", "XML_ERROR_UNDEFINED_ENTITY", "GLOB_MARK", "IN_OPEN",
+    "FANN_E_CANT_READ_CONNECTIONS", "FNM_NOESCAPE", "GLOB_ONLYDIR", "TRADER_MA_TYPE_TRIMA",
+    "XSL_SECPREF_CREATE_DIRECTORY", "UDM_FIELD_DESC", "CURLOPT_INFILE", "MYSQLND_UH_MYSQLND_OPT_READ_TIMEOUT",
+    "FILTER_VALIDATE_FLOAT", "GEOIP_CITY_EDITION_REV1", "YAML_STR_TAG", "SIGPWR",
+    "CURLSSH_AUTH_PASSWORD", "PHP_VERSION_ID", "APC_BIN_VERIFY_MD5", "GNUPG_ERROR_WARNING",
+    "AL_PITCH", "RPMREADER_RELEASE", "ENC8BIT", "RPMREADER_PATCHESFLAGS",
+    "SEASLOG_NOTICE", "CURLINFO_CONTENT_LENGTH_DOWNLOAD", "RPMREADER_OPTFLAGS", "TRADER_ERR_UNKNOWN_ERROR",
+    "IMG_FILTER_SMOOTH", "INGRES_STRUCTURE_CHASH", "PARSEKIT_RESULT_JMP_ADDR", "SEASLOG_CLOSE_LOGGER_STREAM_MOD_ASSIGN",
+    "FILTER_VALIDATE_IP", "CAL_DOW_SHORT", "IMAGETYPE_JPC", "SVN_WC_STATUS_MISSING",
+    "IMG_XPM", "PGSQL_CONNECTION_BAD", "SEASLOG_REQUEST_VARIABLE_DOMAIN_PORT", "LDAP_CONTROL_SUBENTRIES",
+    "PARSEKIT_ZEND_EXT_FCALL_END", "SWOOLE_IPC_UNSOCK", "SNMP_COUNTER64", "RPMREADER_TRIGGERFLAGS",
+    "FILTER_SANITIZE_STRING", "SQLSRV_SCROLL_FIRST", "GMP_BIG_ENDIAN", "MYSQLI_TYPE_ENUM",
+    "SVN_WC_STATUS_OBSTRUCTED", "RPMREADER_MAXIMUM", "SQLTEXT", "IIS_PAUSED",
+    "RPMREADER_FILEVERIFYFLAGS", "BBCODE_SET_FLAGS_ADD", "MYSQLI_REFRESH_GRANT", "ODBC_BINMODE_RETURN",
+    "CURL_SSLVERSION_MAX_NONE", "CURLPROXY_SOCKS4A", "CURLOPT_SSL_VERIFYHOST", "MYSQLX_TYPE_NEWDATE",
+    "SVN_NODE_FILE", "PHP_INT_MAX", "IBASE_SVC_SERVER_VERSION", "SEGV_MAPERR",
+    "AL_GAIN", "PGSQL_DIAG_MESSAGE_PRIMARY", "INGRES_STRUCTURE_HEAP", "SODIUM_CRYPTO_PWHASH_ALG_DEFAULT",
+    "PARSEKIT_ZEND_POST_INC", "INGRES_BOTH", "MSQL_BOTH", "PHP_SESSION_NONE",
+    "S_IRWXU", "S_IXUSR", "PHP_OUTPUT_HANDLER_REMOVABLE", "IN_CLOSE",
+    "IMG_BESSEL", "SAM_USERID", "EIO_O_WRONLY", "MONGO_STREAM_NOTIFY_LOG_CMD_DELETE",
+    "CURLOPT_USERNAME", "CURLOPT_RETURNTRANSFER", "XSL_SECPREF_NONE", "RPMREADER_GROUP",
+    "XML_ERROR_NO_MEMORY", "BBCODE_FLAGS_CDATA_NOT_ALLOWED", "YAR_OPT_TIMEOUT", "APC_ITER_MEM_SIZE",
+    "SODIUM_CRYPTO_KX_PUBLICKEYBYTES", "PNG_FILTER_NONE", "CAIRO_STATUS_INVALID_DASH", "PARSEKIT_ZEND_ASSIGN_ADD",
+    "SODIUM_CRYPTO_BOX_SECRETKEYBYTES", "UDM_PARAM_CROSSWORDS", "SOLR_MAJOR_VERSION", "UDM_LIMIT_DATE",
+    "SWFBUTTON_MOUSEUP", "UDM_PARAM_WORD_MATCH", "XML_ERROR_NO_ELEMENTS", "SEASLOG_DEBUG",
+    "CURLOPT_KEYPASSWD", "SWFTEXTFIELD_DRAWBOX", "RAR_HOST_UNIX", "RPMREADER_FILEMTIMES",
+    "EIO_S_IRUSR", "CURLE_FTP_WRITE_ERROR", "MYSQLND_UH_MYSQLND_COM_TABLE_DUMP", "PARSEKIT_ZEND_BW_AND",
+    "ZLIB_RLE", "ZEND_ACC_INTERFACE", "IMG_FILTER_EDGEDETECT", "MYSQLI_UNSIGNED_FLAG",
+    "CAIRO_OPERATOR_DEST_OVER", "INGRES_STRUCTURE_CISAM", "CAIRO_STATUS_INVALID_STATUS", "SQL_FLOAT",
+    "CAIRO_SURFACE_TYPE_QUARTZ", "CURLOPT_CLOSEPOLICY", "GEARMAN_SUCCESS", "CURL_NETRC_OPTIONAL",
+    "IIS_ANONYMOUS", "MYSQLI_CURSOR_TYPE_NO_CURSOR", "UDM_MODE_PHRASE", "EIO_O_EXCL",
+    "IMG_BICUBIC", "CURLOPT_URL", "MYSQLND_MEMCACHE_VERSION_ID", "CURL_WRAPPERS_ENABLED",
+    "OAUTH_PARAMETER_ABSENT", "PARSEKIT_IS_UNUSED", "MYSQLX_TYPE_CHAR", "FRIBIDI_CHARSET_UTF8",
+    "IFX_LO_RDONLY", "CURLINFO_PRETRANSFER_TIME", "CAIRO_FONT_TYPE_WIN32", "FBSQL_ISO_VERSIONED",
+    "FTP_TEXT", "TRADER_FUNC_UNST_EMA", "PARSEKIT_ZEND_FETCH_DIM_IS", "INGRES_EXT_VERSION",
+    "GUPNP_TYPE_BOOLEAN", "MYSQLND_UH_MYSQLND_COM_REFRESH", "IN_ACCESS", "UDM_PARAM_PHRASE_MODE",
+    "MYSQLI_TYPE_CHAR", "RPMREADER_FILEDEPENDSX", "UDM_TRACK_ENABLED", "CURLOPT_SSLCERT",
+    "SWFBUTTON_HIT", "FILEINFO_PRESERVE_ATIME", "SOCKET_ENOSYS", "RPMREADER_OBSOLETENAME",
+    "IBASE_PRP_PAGE_BUFFERS", "SOCKET_NO_RECOVERY", "UDM_ISPELL_TYPE_DB", "MONGO_STREAMS",
+    "BBCODE_TYPE_ARG", "MYSQLND_UH_MYSQLND_COM_STMT_EXECUTE", "FANN_LINEAR_PIECE_SYMMETRIC", "LDAP_CONTROL_X_DOMAIN_SCOPE",
+    "CURLE_SSL_CACERT", "CURLOPT_BINARYTRANSFER", "IN_ONLYDIR", "PARSEKIT_ZEND_EVAL_CODE",
+    "OAUTH_TOKEN_EXPIRED", "CURLOPT_DNS_INTERFACE", "EIO_O_NONBLOCK", "IIS_BASIC",
+    "GEARMAN_UNIQUE_SIZE", "EVLOOP_NONBLOCK", "CAIRO_SURFACE_TYPE_OS2", "SQLITE_CORRUPT",
+    "CAIRO_PS_LEVEL_3", "CAIRO_PS_LEVEL_2", "GLOB_NOESCAPE", "LDAP_OPT_X_TLS_PROTOCOL_MIN",
+    "SWFBUTTON_MOUSEOUT", "FRIBIDI_CHARSET_8859_6", "IMG_COLOR_STYLED", "PASSWORD_ARGON2_DEFAULT_TIME_COST",
+    "FANN_STOPFUNC_MSE", "PHPDBG_FUNC", "LIBXML_VERSION", "SAM_BUS",
+    "XML_ERROR_ATTRIBUTE_EXTERNAL_ENTITY_REF", "IMAGETYPE_XBM", "SO_SNDBUF", "AL_BUFFER",
+    "LATT_REFERRAL", "SWFACTION_ONLOAD", "TRADER_MA_TYPE_KAMA", "GEARMAN_CLIENT_FREE_TASKS",
+    "FANN_TRAIN_SARPROP", "MYSQLI_TYPE_MEDIUM_BLOB", "SQLITE_INTERRUPT", "MB_CASE_TITLE_SIMPLE",
+    "CAIRO_SURFACE_TYPE_QUARTZ_IMAGE", "LIBXML_DOTTED_VERSION", "LDAP_OPT_X_TLS_KEYFILE", "AL_TRUE",
+    "LDAP_OPT_RESTART", "MYSQLND_UH_MYSQLND_OPT_PROTOCOL", "JSON_ERROR_DEPTH", "PGSQL_NOTICE_ALL",
+    "SQLSRV_SQLTYPE_CHAR", "SA_MESSAGES", "FILTER_FLAG_PATH_REQUIRED", "SQL_LONGVARCHAR",
+    "SORT_NUMERIC", "XML_ERROR_UNCLOSED_TOKEN", "SOCKET_ETOOMYREFS", "PGSQL_DIAG_MESSAGE_HINT",
+    "PARSEKIT_ZEND_ADD_ARRAY_ELEMENT", "MYSQLND_UH_MYSQLND_COM_CONNECT", "CAIRO_FILTER_NEAREST", "CURLE_WRITE_ERROR",
+    "RPMREADER_PATCHESVERSION", "COUNT_NORMAL", "SODIUM_CRYPTO_KX_SECRETKEYBYTES", "AL_CONE_OUTER_GAIN",
+    "SAM_MQTT_CLEANSTART", "SWFACTION_MOUSEUP", "ENT_DISALLOWED", "SQLSRV_SQLTYPE_UNIQUEIDENTIFIER",
+    "MAILPARSE_EXTRACT_RETURN", "ENC7BIT", "GUPNP_SIGNAL_SUBSCRIPTION_LOST", "UDM_ISPELL_PREFIX_ENABLED",
+    "LC_CTYPE", "SWOOLE_EVENT_WRITE", "SQLSRV_SQLTYPE_NVARCHAR", "CURL_MAX_READ_SIZE",
+    "__DIR__", "TRADER_FUNC_UNST_RSI", "CURLM_OUT_OF_MEMORY", "XHPROF_FLAGS_CPU",
+    "CURLE_SSH", "LDAP_CONTROL_PRE_READ", "SQLSRV_PARAM_IN", "SORTARRIVAL",
+    "FANN_NETTYPE_LAYER", "SVN_WC_STATUS_EXTERNAL", "SEASLOG_INFO", "ZEND_ACC_PROTECTED",
+    "TRADER_COMPATIBILITY_METASTOCK", "PHP_OUTPUT_HANDLER_CLEAN", "SQL_CONCUR_LOCK", "JSON_ERROR_NONE",
+    "BBCODE_FLAGS_REMOVE_IF_EMPTY", "SQLSRV_SQLTYPE_TEXT", "FRIBIDI_RTL", "CURLPAUSE_CONT",
+    "SODIUM_CRYPTO_SECRETBOX_NONCEBYTES", "INPUT_ENV", "CURLOPT_PROXYTYPE", "FBSQL_STARTING",
+    "CURLOPT_PATH_AS_IS", "CURLFTP_CREATE_DIR_NONE", "CURL_NETRC_REQUIRED", "SQLSRV_CURSOR_STATIC",
+    "SQL_LONGVARBINARY", "EIO_S_IFBLK", "UDM_PARAM_MAX_WORD_LEN", "SAM_HOST",
+    "CAIRO_OPERATOR_OVER", "CURLOPT_LOW_SPEED_TIME", "PHP_URL_HOST", "ZEND_ACC_ABSTRACT",
+    "AL_VELOCITY", "SODIUM_CRYPTO_PWHASH_SALTBYTES", "CAL_EASTER_ROMAN", "SCANDIR_SORT_ASCENDING",
+    "PARSEKIT_ZEND_SL", "PGSQL_DIAG_MESSAGE_DETAIL", "MYSQLX_TYPE_INTERVAL", "SQL_CONCURRENCY",
+    "SORTCC", "GNUPG_ERROR_SILENT", "CURLCLOSEPOLICY_SLOWEST", "FANN_LINEAR_PIECE",
+    "GNUPG_SIG_MODE_NORMAL", "CAIRO_HINT_METRICS_ON", "CURLOPT_PROXY_SSLVERSION", "SOCKET_NO_ADDRESS",
+    "FDFClearFf", "IMAGETYPE_SWF", "RPMREADER_TRIGGERSCRIPTS", "ENCOTHER",
+    "IMAGETYPE_SWC", "FILE_NO_DEFAULT_CONTEXT", "IIS_EXECUTE", "MYSQLI_TYPE_BLOB",
+    "MYSQLI_CLIENT_NO_SCHEMA", "IMAGETYPE_WBMP", "SQL_CHAR", "RUNKIT_IMPORT_OVERRIDE",
+    "CAIRO_STATUS_PATTERN_TYPE_MISMATCH", "XML_ERROR_PARTIAL_CHAR", "APC_ITER_CTIME", "PGSQL_NONFATAL_ERROR",
+    "IBASE_PRP_DENY_NEW_TRANSACTIONS", "BUS_ADRALN", "SUNFUNCS_RET_DOUBLE", "IMAGETYPE_GIF",
+    "SEASLOG_REQUEST_VARIABLE_CLIENT_IP", "FPE_INTDIV", "PHP_BINARY", "MYSQLI_DATA_TRUNCATED",
+    "YAF_VERSION", "UDM_PARAM_SEARCHTIME", "CURLPROXY_SOCKS5", "IMAGETYPE_TIFF_II",
+    "SODIUM_CRYPTO_GENERICHASH_KEYBYTES_MIN", "SEARCHD_RETRY", "RPMREADER_INSTALLTID", "SAM_WMQ_BINDINGS",
+    "MYSQLI_OPT_CONNECT_TIMEOUT", "VARNISH_STATUS_TOOMANY", "CURLOPT_ENCODING", "BBCODE_SMILEYS_CASE_INSENSITIVE",
+    "IDNA_ALLOW_UNASSIGNED", "PARSEKIT_ZEND_CATCH", "BBCODE_ARG_HTML_QUOTE", "EIO_S_IXGRP",
+    "LDAP_OPT_HOST_NAME", "MYSQLI_REPORT_ERROR", "RPMREADER_FILECOLORS", "__FILE__",
+    "SQLITE3_NUM", "ST_SET", "CURLOPT_KEEP_SENDING_ON_ERROR", "CURLOPT_TCP_NODELAY",
+    "SQL_CONCUR_READ_ONLY", "APC_ITER_DTIME", "PGSQL_POLLING_OK", "CAIRO_SVG_VERSION_1_1",
+    "SI_USER", "JSON_HEX_APOS", "CRYPT_BLOWFISH", "SWFFILL_RADIAL_GRADIENT",
+    "PHP_ZTS", "CLD_KILLED", "PARSEKIT_ZEND_FETCH_OBJ_RW", "MYSQLX_TYPE_TINY_BLOB",
+    "RPMREADER_CACHEPKGSIZE", "CURLOPT_SSL_VERIFYPEER", "IMG_PNG", "SO_LINGER",
+    "IMG_GIF", "GUPNP_TYPE_INT", "SOCKET_ENOSTR", "IMG_AFFINE_SHEAR_VERTICAL",
+    "EIO_SEEK_SET", "CURLOPT_WRITEHEADER", "PHP_URL_FRAGMENT", "SODIUM_CRYPTO_PWHASH_ALG_ARGON2I13",
+    "LATT_HASCHILDREN", "CURL_NETRC_IGNORED", "OAUTH_CONSUMER_KEY_REFUSED", "SQLSRV_SQLTYPE_MONEY",
+    "TRADER_MA_TYPE_WMA", "INI_SCANNER_TYPED", "LDAP_EXOP_WHO_AM_I", "MYSQLI_NOT_NULL_FLAG",
+    "POLL_ERR", "SQLSRV_SQLTYPE_VARCHAR", "PTHREADS_INHERIT_CONSTANTS", "SO_REUSEADDR",
+    "ID3_V2_3", "LDAP_OPT_REFERRALS", "IMG_EFFECT_NORMAL", "IMG_ARC_ROUNDED",
+    "SWFTEXTFIELD_NOEDIT", "EIO_DT_FIFO", "CURLOPT_WRITEFUNCTION", "PARSEKIT_ZEND_USER_CLASS",
+    "PGSQL_SEEK_END", "PHPDBG_COLOR_ERROR", "OAUTH_AUTH_TYPE_URI", "CURLOPT_PROXY_TLSAUTH_USERNAME",
+    "PGSQL_POLLING_FAILED", "SAM_PORT", "SOCKET_EWOULDBLOCK", "SQLITE_ASSOC",
+    "CURLE_LDAP_INVALID_URL", "CAIRO_EXTEND_NONE", "SQLSRV_ERR_WARNINGS", "CAIRO_LINE_CAP_BUTT",
+    "PARSEKIT_ZEND_JMPNZ", "SIGSTOP", "EIO_DT_LNK", "TRADER_MA_TYPE_T3",
+    "SAM_WMQ_TARGET_CLIENT", "CAIRO_STATUS_TEMP_FILE_ERROR", "SQL_TYPE_TIME", "FDFUp",
+    "CLD_CONTINUED", "XML_ERROR_UNCLOSED_CDATA_SECTION", "S_IXOTH", "XSL_CLONE_ALWAYS",
+    "MONGO_STREAM_NOTIFY_LOG_INSERT", "GEARMAN_NO_JOBS", "CURLMSG_DONE", "YAR_OPT_PACKAGER",
+    "S_IRGRP", "GEOIP_ASNUM_EDITION", "CAL_EASTER_ALWAYS_JULIAN", "SOCKET_NOTINITIALISED",
+    "CURLE_BAD_FUNCTION_ARGUMENT", "SODIUM_CRYPTO_SIGN_BYTES", "GNUPG_VALIDITY_NEVER", "IN_ONESHOT",
+    "__METHOD__", "EIO_S_IWUSR", "GEOIP_UNKNOWN_SPEED", "MYSQLI_BLOB_FLAG",
+    "TRADER_FUNC_UNST_ALL", "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_IETF_NSECBYTES", "MYSQLND_UH_MYSQLND_COM_BINLOG_DUMP", "CURLE_URL_MALFORMAT",
+    "IN_CLOSE_NOWRITE", "GEARMAN_DEFAULT_SOCKET_RECV_SIZE", "MYSQLND_UH_MYSQLND_COM_FIELD_LIST", "SO_RCVTIMEO",
+    "TRADER_ERR_ALLOC_ERR", "CURLOPT_USERAGENT", "CURLOPT_SSLKEYPASSWD", "RPMREADER_PAYLOADFLAGS",
+    "SPH_ATTR_FLOAT", "E_USER_NOTICE", "IMG_GENERALIZED_CUBIC", "ZEND_USER_OPCODE_RETURN",
+    "CONNECTION_ABORTED", "SPH_MATCH_BOOLEAN", "TRADER_FUNC_UNST_KAMA", "MYSQLND_UH_MYSQLND_PROT_STATS_PACKET",
+    "MYSQLI_REPORT_OFF", "TRADER_FUNC_UNST_CMO", "FILTER_FLAG_STRIP_LOW", "LC_MESSAGES",
+    "LDAP_CONTROL_MANAGEDSAIT", "PHP_OUTPUT_HANDLER_START", "MYSQLI_INIT_COMMAND", "SEASLOG_EMERGENCY",
+    "S_IRWXO", "XHPROF_FLAGS_NO_BUILTINS", "EXTR_PREFIX_IF_EXISTS", "CURLM_BAD_EASY_HANDLE",
+    "ID3_V1_0", "UDM_ISPELL_TYPE_AFFIX", "CURLAUTH_ANYSAFE", "SQLITE_AUTH",
+    "F_SETOWN", "FRIBIDI_CHARSET_ISIRI_3342", "ID3_V2_1", "CURLOPT_CAINFO",
+    "LDAP_OPT_X_TLS_CACERTFILE", "PARSEKIT_ZEND_MOD", "FPE_FLTSUB", "MYSQLI_TRANS_COR_RELEASE",
+    "CURLE_HTTP_POST_ERROR", "S_IRWXG", "SQLITE_FORMAT", "FILTER_FLAG_ENCODE_AMP",
+    "SIGALRM", "FANN_COS_SYMMETRIC", "PHP_LOCALSTATEDIR", "SODIUM_LIBRARY_VERSION",
+    "SO_RCVLOWAT", "SWFBUTTON_MOUSEUPOUTSIDE", "TRADER_FUNC_UNST_NONE", "SWFFILL_TILED_BITMAP",
+    "TRADER_FUNC_UNST_MINUS_DM", "FBSQL_NOEXEC", "SWOOLE_VERSION", "RPMREADER_CHANGELOGTIME",
+    "PARSEKIT_ZEND_FETCH_OBJ_IS", "CURLOPT_DNS_USE_GLOBAL_CACHE", "SEASLOG_REQUEST_VARIABLE_REQUEST_METHOD", "EIO_READDIR_DIRS_FIRST",
+    "SWOOLE_UDP6", "CURLE_SSL_CERTPROBLEM", "SOCKET_ENOTCONN", "DIRECTORY_SEPARATOR",
+    "MSG_PEEK", "CURLOPT_STREAM_WEIGHT", "APC_ITER_MD5", "BBCODE_TYPE_SINGLE",
+    "FILTER_FLAG_ALLOW_OCTAL", "UDM_TRACK_DISABLED", "PGSQL_BOTH", "SQLSRV_FETCH_BOTH",
+    "SQLITE3_TEXT", "RPMREADER_FILEINODES", "FT_UID", "MYSQLI_PRI_KEY_FLAG",
+    "MYSQLND_UH_MYSQLND_COM_REGISTER_SLAVED", "OAUTH_TOKEN_REVOKED", "CURLOPT_RESUME_FROM", "SODIUM_CRYPTO_GENERICHASH_BYTES",
+    "PHP_FLOAT_MAX", "SVN_PROP_REVISION_ORIG_DATE", "SIGTRAP", "PGSQL_SEEK_SET",
+    "UDM_MODE_ALL", "IMG_GD2_RAW", "SPH_GROUPBY_MONTH", "SOCKET_EADV",
+    "LDAP_OPT_X_TLS_DHFILE", "FBSQL_STOPPED", "IN_CREATE", "SIGINT",
+    "SODIUM_CRYPTO_AEAD_AES256GCM_NPUBBYTES", "VARNISH_CONFIG_TIMEOUT", "M_PENDING", "RPMREADER_PREUNPROG",
+    "IMG_SINC", "SNMP_VALUE_LIBRARY", "SQLITE_TOOBIG", "PARSEKIT_ZEND_RAISE_ABSTRACT_ERROR",
+    "CAIRO_STATUS_NULL_POINTER", "SQL_KEYSET_SIZE", "PGSQL_DIAG_STATEMENT_POSITION", "PARSEKIT_ZEND_OP_DATA",
+    "SODIUM_CRYPTO_KDF_BYTES_MAX", "FTP_FINISHED", "PHP_OUTPUT_HANDLER_FLUSHABLE", "SAM_STRING",
+    "VARNISH_STATUS_PARAM", "GNUPG_VALIDITY_MARGINAL", "IMG_EFFECT_MULTIPLY", "GUPNP_SIGNAL_DEVICE_PROXY_UNAVAILABLE",
+    "CURLPROXY_SOCKS4", "TRADER_MA_TYPE_TEMA", "SEARCHD_WARNING", "IDNA_ERROR_DISALLOWED",
+    "APC_ITER_NUM_HITS", "TYPEVIDEO", "PARSEKIT_ZEND_ASSIGN_BW_AND", "SVN_WC_STATUS_INCOMPLETE",
+    "MYSQLND_UH_MYSQLND_OPT_INT_AND_FLOAT_NATIVE", "APC_BIN_VERIFY_CRC32", "CURLOPT_PROXY_SSLCERT", "CURLPIPE_MULTIPLEX",
+    "MYSQLI_CLIENT_SSL", "SVN_WC_STATUS_IGNORED", "YAML_BOOL_TAG", "SAM_TARGETCHAIN",
+    "SQL_CUR_USE_ODBC", "IDNA_ERROR_LEADING_HYPHEN", "E_RECOVERABLE_ERROR", "LDAP_OPT_X_TLS_CRLCHECK",
+    "CURLINFO_TOTAL_TIME", "SSH2_TERM_UNIT_CHARS", "IMG_COLOR_TRANSPARENT", "CURLMOPT_PUSHFUNCTION",
+    "YAML_UTF16LE_ENCODING", "PARSEKIT_ZEND_DO_FCALL_BY_NAME", "PGSQL_DML_ESCAPE", "UDM_PREFIXES_ENABLED",
+    "SORT_ASC", "SQL_CURSOR_FORWARD_ONLY", "CAIRO_STATUS_SUCCESS", "DB2_LONG",
+    "SQLSRV_PHPTYPE_STREAM", "PHP_BINDIR", "CURLINFO_CONTENT_TYPE", "GEARMAN_ERRNO",
+    "SWOOLE_SOCK_TCP6", "IMG_BELL", "INGRES_STRUCTURE_HASH", "FILEINFO_MIME",
+    "CURLINFO_SPEED_UPLOAD", "SOCKET_EDQUOT", "SOCKET_EPERM", "SIGFPE",
+    "XML_ERROR_INCORRECT_ENCODING", "MONGO_STREAM_NOTIFY_LOG_QUERY", "CURLOPT_FRESH_CONNECT", "RPMREADER_GIF",
+    "FTP_BINARY", "SQLSRV_SCROLL_NEXT", "FILEINFO_CONTINUE", "BUS_OBJERR",
+    "RPMREADER_PATCH", "PARSEKIT_ZEND_FETCH_UNSET", "FANN_SIN", "SOCKET_EREMOTEIO",
+    "F_RDLCK", "CURLSSH_AUTH_NONE", "VARNISH_COMPAT_3", "VARNISH_COMPAT_2",
+    "SWFBUTTON_MOUSEOVER", "MYSQLND_UH_MYSQLND_COM_QUIT", "PGSQL_DIAG_SOURCE_FILE", "APC_ITER_VALUE",
+    "GEARMAN_NO_ACTIVE_FDS", "IFX_LO_BUFFER", "GEARMAN_WORKER_GRAB_UNIQ", "SWOOLE_FAST_PACK",
+    "YAR_ERR_REQUEST", "RPMREADER_PROVIDENAME", "MONGO_SUPPORTS_AUTH_MECHANISM_GSSAPI", "SOCKET_E2BIG",
+    "INPUT_COOKIE", "PARSEKIT_ZEND_PRE_INC_OBJ", "IMG_ARC_PIE", "INGRES_API_VERSION",
+    "SQL_QUICK", "CAIRO_LINE_JOIN_ROUND", "O_CREAT", "LDAP_CONTROL_DONTUSECOPY",
+    "FANN_SIGMOID_SYMMETRIC", "TRADER_FUNC_UNST_HT_DCPERIOD", "PNG_FILTER_UP", "ZLIB_HUFFMAN_ONLY",
+    "UTF-8", "SOCKET_ENOANO", "XML_ERROR_TAG_MISMATCH", "EIO_READDIR_FOUND_UNKNOWN",
+    "IMAP_OPENTIMEOUT", "SOCKET_EDISCON", "CAIRO_SURFACE_TYPE_PS", "AL_STOPPED",
+    "M_SUCCESS", "LDAP_CONTROL_X_EXTENDED_DN", "SOCKET_EPFNOSUPPORT", "SOCKET_EL2HLT",
+    "SAM_MQTT", "VARNISH_STATUS_COMMS", "RPMREADER_CHANGELOGTEXT", "RPMREADER_POSTUN",
+    "PTHREADS_INHERIT_INI", "GEARMAN_CLIENT_NON_BLOCKING", "CURLOPT_PROXY_SSL_VERIFYPEER", "TCP_NODELAY",
+    "SPH_MATCH_EXTENDED", "SQLSRV_LOG_SYSTEM_OFF", "SVN_FS_CONFIG_FS_TYPE", "SODIUM_CRYPTO_BOX_MACBYTES",
+    "UDM_FIELD_URLID", "SQLSRV_PARAM_OUT", "FILTER_FLAG_NO_RES_RANGE", "YAML_CR_BREAK",
+    "FILTER_VALIDATE_BOOLEAN", "ZEND_NEW", "IMG_GD2_COMPRESSED", "PARSEKIT_IS_CONST",
+    "PARSEKIT_ZEND_ISSET_ISEMPTY_PROP_OBJ", "SNMP_UINTEGER", "PARSEKIT_ZEND_ECHO", "SAM_INT",
+    "SODIUM_CRYPTO_PWHASH_MEMLIMIT_MODERATE", "FORCE_DEFLATE", "GEARMAN_GETADDRINFO", "SOCKET_EL3HLT",
+    "ZEND_ACC_FINAL", "MYSQLI_TRANS_COR_NO_RELEASE", "ENT_IGNORE", "PGSQL_ERRORS_VERBOSE",
+    "IMG_TRIANGLE", "SOCKET_EOPNOTSUPP", "SWFTEXTFIELD_ALIGN_LEFT", "GNUPG_SIGSUM_SIG_EXPIRED",
+    "PARSEKIT_QUIET", "SO_REUSEPORT", "CAL_FRENCH", "IDNA_ERROR_INVALID_ACE_LABEL",
+    "POLL_MSG", "SNMP_NULL", "SODIUM_CRYPTO_PWHASH_MEMLIMIT_INTERACTIVE", "LDAP_CONTROL_SYNC_DONE",
+    "CURLOPT_TFTP_NO_OPTIONS", "TRADER_COMPATIBILITY_DEFAULT", "SCANDIR_SORT_NONE", "XML_ERROR_DUPLICATE_ATTRIBUTE",
+    "RPMREADER_EXCLUSIVEOS", "CURLOPT_FOLLOWLOCATION", "ZLIB_FIXED", "TRADER_ERR_INVALID_LIST_TYPE",
+    "PGSQL_FATAL_ERROR", "SQLITE_MISMATCH", "LIBXML_BIGLINES", "FRIBIDI_CHARSET_CP1255",
+    "FRIBIDI_CHARSET_CP1256", "SID", "CURLOPT_CAPATH", "PTHREADS_INHERIT_CLASSES",
+    "OAUTH_TOKEN_USED", "CASE_UPPER", "LIBEXSLT_DOTTED_VERSION", "SNMP_OID_OUTPUT_NONE",
+    "CURLINFO_HTTP_CODE", "IDNA_ERROR_TRAILING_HYPHEN", "SPH_MATCH_ANY", "CURLOPT_EXPECT_100_TIMEOUT_MS",
+    "EXTR_OVERWRITE", "CURLPAUSE_ALL", "CURL_PUSH_OK", "IMG_JPEG",
+    "SVN_FS_TYPE_FSFS", "SPH_MATCH_EXTENDED2", "PGSQL_LIBPQ_VERSION_STR", "SQLITE_FULL",
+    "GEOIP_CORPORATE_SPEED", "EIO_S_IWOTH", "GEOIP_REGION_EDITION_REV1", "RPMREADER_ARCHIVESIZE",
+    "LDAP_DEREF_NEVER", "SOCK_DGRAM", "CURLOPT_HEADER", "FILE_SKIP_EMPTY_LINES",
+    "UDM_PARAM_SEARCHD", "YAML_NULL_TAG", "SPH_GROUPBY_DAY", "PARSEKIT_ZEND_VERIFY_ABSTRACT_CLASS",
+    "IMG_MITCHELL", "YPERR_MAP", "YAF_ERR_CALL_FAILED", "SPH_GROUPBY_ATTR",
+    "FPE_INTOVF", "SOCKET_VERNOTSUPPORTED", "CURLOPT_FTPPORT", "SOCKET_ELNRNG",
+    "SOCKET_EPROTONOSUPPORT", "CURLE_RECV_ERROR", "DB2_DEFERRED_PREPARE_ON", "SOCKET_EL2NSYNC",
+    "NIL", "POLL_IN", "PARSEKIT_ZEND_NEW", "SEASLOG_ERROR",
+    "PHP_URL_USER", "CURLFTPAUTH_SSL", "ENT_XHTML", "SOCKET_ETIMEDOUT",
+    "S_IXGRP", "SAM_LONG", "TRADER_REAL_MIN", "SODIUM_CRYPTO_SIGN_KEYPAIRBYTES",
+    "CURLE_FTP_WEIRD_227_FORMAT", "IBASE_RES_DEACTIVATE_IDX", "CURLPAUSE_RECV", "SQLSRV_TXN_SNAPSHOT",
+    "PGSQL_ERRORS_TERSE", "SVN_NODE_DIR", "XSL_CLONE_NEVER", "SQL_NULLABLE",
+    "EIO_DT_DOOR", "EIO_DT_NAM", "SOCKET_EPROCLIM", "SI_QUEUE",
+    "SEASLOG_VERSION", "PARSEKIT_ZEND_RETURN", "TYPEMODEL", "CAIRO_STATUS_INVALID_INDEX",
+    "SWFACTION_KEYDOWN", "SOCKET_ESPIPE", "PARSEKIT_ZEND_BEGIN_SILENCE", "SIG_IGN",
+    "ILL_ILLOPC", "RUNKIT_IMPORT_FUNCTIONS", "CURLOPT_NOPROGRESS", "__FUNCTION__",
+    "RPMREADER_CACHECTIME", "CURLMOPT_CHUNK_LENGTH_PENALTY_SIZE", "MYSQLND_UH_MYSQLND_COM_STMT_PREPARE", "PARSEKIT_ZEND_END_SILENCE",
+    "AL_FALSE", "IMG_FILTER_MEAN_REMOVAL", "CAIRO_FONT_SLANT_NORMAL", "LIBXML_NOCDATA",
+    "SOCKET_EACCES", "MSG_EOR", "PGSQL_CONV_IGNORE_NOT_NULL", "IN_MODIFY",
+    "RPMREADER_FILEUSERNAME", "CURLOPT_NOBODY", "JSON_PRESERVE_ZERO_FRACTION", "SWFTEXTFIELD_HASLENGTH",
+    "CURLOPT_SSH_PRIVATE_KEYFILE", "MYSQLND_MS_QUERY_USE_LAST_USED", "RUNKIT_IMPORT_CLASS_CONSTS", "YAML_UTF8_ENCODING",
+    "SOCKET_EMLINK", "SODIUM_CRYPTO_KX_KEYPAIRBYTES", "IIS_READ", "CURLOPT_PROXY_CRLFILE",
+    "LDAP_DEREF_SEARCHING", "CLASSKIT_ACC_PROTECTED", "MYSQLND_UH_MYSQLND_PROT_RSET_HEADER_PACKET", "UDM_ISPELL_PREFIXES_DISABLED",
+    "MYSQLI_TYPE_TINY_BLOB", "UDM_PARAM_WORD_INFO", "SWFTEXTFIELD_ALIGN_CENTER", "FDFStatus",
+    "FBSQL_RUNNING", "DB2_FORWARD_ONLY", "GNUPG_SIGSUM_GREEN", "TRADER_FUNC_UNST_HT_SINE",
+    "CAIRO_FILTER_GOOD", "VARNISH_CONFIG_PORT", "PARSEKIT_ZEND_ASSIGN_SR", "SPH_SORT_EXPR",
+    "CAIRO_SUBPIXEL_ORDER_DEFAULT", "SQL_INDEX_UNIQUE", "SPH_ATTR_TIMESTAMP", "PNG_FILTER_PAETH",
+    "SQLSRV_SQLTYPE_DATETIME", "LDAP_OPT_DEBUG_LEVEL", "SAM_MANUAL", "UDM_PARAM_PAGE_NUM",
+    "CAIRO_OPERATOR_CLEAR", "MYSQLND_UH_MYSQLND_SECURE_AUTH", "RPMREADER_FILESIZES", "CURLSSH_AUTH_KEYBOARD",
+    "BBCODE_TYPE_ROOT", "IN_DELETE_SELF", "SQLITE_ERROR", "MYSQLI_STMT_ATTR_CURSOR_TYPE",
+    "UDM_PARAM_HLBEG", "ZLIB_ENCODING_GZIP", "IBASE_SVC_GET_ENV", "MYSQLX_TYPE_MEDIUMINT",
+    "CURLINFO_PROTOCOL", "PARSEKIT_ZEND_ADD_CHAR", "MYSQLX_TYPE_NEWDECIMAL", "VARNISH_CONFIG_IDENT",
+    "SQL_CONCUR_VALUES", "PARSEKIT_ZEND_EXIT", "SVN_AUTH_PARAM_SSL_SERVER_FAILURES", "CURLHEADER_SEPARATE",
+    "AL_MAX_GAIN", "SWFTEXTFIELD_PASSWORD", "PARSEKIT_ZEND_IS_SMALLER", "PGSQL_DML_ASYNC",
+    "XML_ERROR_MISPLACED_XML_PI", "GEARMAN_WORK_FAIL", "SWFBUTTON_DRAGOVER", "IN_Q_OVERFLOW",
+    "RPMREADER_PAYLOADFORMAT", "TRADER_ERR_FUNC_NOT_FOUND", "CURLE_BAD_CONTENT_ENCODING", "SOCKET_ENOENT",
+    "MYSQLX_LOCK_SKIP_LOCKED", "GNUPG_VALIDITY_UNDEFINED", "APC_ITER_NONE", "SWOOLE_TCP6",
+    "LATT_NOSELECT", "TYPEAPPLICATION", "YAF_ERR_NOTFOUND_CONTROLLER", "CURLOPT_TRANSFERTEXT",
+    "EXTR_SKIP", "CURLE_LIBRARY_NOT_FOUND", "IMG_FILTER_CONTRAST", "CURLINFO_SPEED_UPLOAD_T",
+    "SOCKET_ENONET", "CAL_JULIAN", "SQLSRV_SQLTYPE_NUMERIC", "UDM_PARAM_PREFIXES",
+    "SOCKET_ENOTBLK", "PGSQL_POLLING_WRITING", "O_RDWR", "EV_READ",
+    "PHP_FD_SETSIZE", "PGSQL_CONNECT_FORCE_NEW", "IMG_WEBP", "SOCKET_ETIME",
+    "PARSEKIT_ZEND_OVERLOADED_FUNCTION", "EXP_GLOB", "SWOOLE_TCP", "MAILPARSE_EXTRACT_STREAM",
+    "E_ALL", "MYSQLND_MS_MASTER_SWITCH", "YPERR_ACCESS", "IBASE_RES_USE_ALL_SPACE",
+    "DBASE_RDONLY", "S_IWUSR", "HTML_ENTITIES", "INGRES_STRUCTURE_BTREE",
+    "JSON_ERROR_INVALID_PROPERTY_NAME", "RPMREADER_DIRNAMES", "CAIRO_LINE_JOIN_BEVEL", "TRADER_FUNC_UNST_STOCHRSI",
+    "SWFBUTTON_DOWN", "OAUTH_HTTP_METHOD_PUT", "XSL_CLONE_AUTO", "F_SETFL",
+    "PHP_DEBUG", "SQL_BIGINT", "PASSWORD_ARGON2_DEFAULT_THREADS", "DB2_SCROLLABLE",
+    "GUPNP_SIGNAL_NOTIFY_FAILED", "SVN_WC_STATUS_NONE", "CURLMOPT_MAXCONNECTS", "SEASLOG_DETAIL_ORDER_ASC",
+    "IBASE_PRP_ACTIVATE", "SOCKET_ERESTART", "LOCK_UN", "INGRES_DATE_MULTINATIONAL",
+    "PARSEKIT_RESULT_CONST", "YAR_CLIENT_PROTOCOL_HTTP", "TRADER_FUNC_UNST_PLUS_DM", "FANN_E_OUTPUT_NO_MATCH",
+    "IDNA_ERROR_EMPTY_LABEL", "YAF_ERR_NOTFOUND_VIEW", "DB2_CASE_LOWER", "SODIUM_CRYPTO_SHORTHASH_KEYBYTES",
+    "RPMREADER_FILEMD5S", "LDAP_OPT_DEREF", "DB2_CASE_NATURAL", "SODIUM_CRYPTO_GENERICHASH_KEYBYTES",
+    "RPMREADER_TRIGGERNAME", "SOCKET_ENOSPC", "PARSEKIT_ZEND_EXT_FCALL_BEGIN", "CURLE_FTP_PORT_FAILED",
+    "FILTER_SANITIZE_ENCODED", "MYSQLND_UH_MYSQLND_OPT_SSL_CA", "CURLE_FTP_USER_PASSWORD_INCORRECT", "SODIUM_CRYPTO_PWHASH_OPSLIMIT_INTERACTIVE",
+    "SNMP_VALUE_OBJECT", "IMAP_GC_ENV", "SEASLOG_ALERT", "MYSQLX_TYPE_GEOMETRY",
+    "CURLE_LDAP_SEARCH_FAILED", "MYSQLND_UH_MYSQLND_OPTION_OPT_NAMED_PIPE", "APC_ITER_ALL", "RPMREADER_REQUIREFLAGS",
+    "LDAP_CONTROL_X_INCREMENTAL_VALUES", "DB2_AUTOCOMMIT_OFF", "MYSQLX_LOCK_NOWAIT", "FILTER_FLAG_EMPTY_STRING_NULL",
+    "CURLOPT_SSL_VERIFYSTATUS", "SODIUM_CRYPTO_SCALARMULT_SCALARBYTES", "CAIRO_STATUS_INVALID_FORMAT", "SAM_NON_PERSISTENT",
+    "RAR_HOST_OS2", "UDM_FIELD_ORDER", "CURLOPT_PRE_PROXY", "PHPDBG_FILE",
+    "SVN_NODE_UNKNOWN", "LIBXML_ERR_WARNING", "PARSEKIT_ZEND_SR", "PGSQL_BAD_RESPONSE",
+    "RPMREADER_REMOVETID", "IDNA_ERROR_LEADING_COMBINING_MARK", "SOCKET_EUNATCH", "SOCKET_ECONNRESET",
+    "PHP_BINARY_READ", "RPMREADER_FILECLASS", "MYSQLI_STMT_ATTR_UPDATE_MAX_LENGTH", "MONGO_STREAM_NOTIFY_LOG_UPDATE",
+    "TRADER_ERR_INTERNAL_ERROR", "SQL_DATE", "SQLSRV_LOG_SYSTEM_UTIL", "CURLOPT_EGDSOCKET",
+    "IBASE_BKP_IGNORE_LIMBO", "GD_RELEASE_VERSION", "__NAMESPACE__", "FBSQL_BOTH",
+    "AL_SIZE", "AL_DIRECTION", "MYSQLND_UH_MYSQLND_COM_STATISTICS", "CAIRO_OPERATOR_DEST_ATOP",
+    "MYSQLI_OPT_LOCAL_INFILE", "CAIRO_STATUS_INVALID_MATRIX", "ZEND_ACC_PUBLIC", "MYSQLX_LOCK_DEFAULT",
+    "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_NPUBBYTES", "CURLOPT_PROXY_SSLKEY", "TRADER_FUNC_UNST_HT_TRENDMODE", "CURLINFO_HTTP_VERSION",
+    "SOCKET_EADDRINUSE", "MONGO_STREAM_NOTIFY_IO_COMPLETED", "DB2_DEFERRED_PREPARE_OFF", "SO_TYPE",
+    "MYSQLND_UH_VERSION_ID", "SQLSRV_FETCH_ASSOC", "SQLSRV_PARAM_INOUT", "CURLOPT_PROXYAUTH",
+    "PARSEKIT_ZEND_SEND_VAR", "UDM_ISPELL_TYPE_SPELL", "LIBXSLT_DOTTED_VERSION", "CURL_SSLVERSION_TLSv1",
+    "ZEND_INSTANCEOF", "CURLE_COULDNT_RESOLVE_PROXY", "EIO_O_RDWR", "SODIUM_CRYPTO_SIGN_SEEDBYTES",
+    "UDM_PARAM_LAST_DOC", "SODIUM_CRYPTO_PWHASH_SCRYPTSALSA208SHA256_MEMLIMIT_SENSITIVE", "PGSQL_DML_EXEC", "SA_RECENT",
+    "MYSQLI_TRANS_START_READ_WRITE", "SAM_RTT", "SQLSRV_SQLTYPE_NCHAR", "CURLFTPSSL_TRY",
+    "AL_ROLLOFF_FACTOR", "CONNECTION_TIMEOUT", "SIG_UNBLOCK", "MYSQLI_TYPE_STRING",
+    "RPMREADER_OBSOLETES", "SOCKET_ENOBUFS", "SE_NOPREFETCH", "FANN_E_TRAIN_DATA_SUBSET",
+    "CURLOPT_DNS_LOCAL_IP4", "MYSQLND_UH_MYSQLND_OPTION_INIT_COMMAND", "PHP_MINOR_VERSION", "CURL_HTTP_VERSION_NONE",
+    "SQLSRV_SQLTYPE_DECIMAL", "IBASE_STS_DATA_PAGES", "SPH_SORT_ATTR_ASC", "E_NOTICE",
+    "GSLC_SSL_ONEWAY_AUTH", "IBASE_PRP_RES_USE_FULL", "CAIRO_SURFACE_TYPE_PDF", "XML_ERROR_INVALID_TOKEN",
+    "UDM_LIMIT_CAT", "YPERR_YPSERV", "PARSEKIT_ZEND_DIV", "CURLE_FTP_COULDNT_GET_SIZE",
+    "SQLITE_SCHEMA", "SOCKET_ENOMEDIUM", "CURLM_INTERNAL_ERROR", "SOCKET_ENOSR",
+    "YAR_ERR_PROTOCOL", "SAM_PERSISTENT", "CAIRO_CONTENT_ALPHA", "SWFACTION_MOUSEDOWN",
+    "SPH_ATTR_MULTI", "LIBXML_ERR_ERROR", "SODIUM_CRYPTO_PWHASH_SCRYPTSALSA208SHA256_STRPREFIX", "PARSEKIT_ZEND_FETCH_DIM_TMP_VAR",
+    "IN_ALL_EVENTS", "IMG_FILTER_SELECTIVE_BLUR", "SQLSRV_LOG_SYSTEM_ALL", "CAIRO_SUBPIXEL_ORDER_BGR",
+    "CAIRO_OPERATOR_ADD", "PARSEKIT_ZEND_INIT_CTOR_CALL", "UDM_PREFIX_DISABLED", "FILE_IGNORE_NEW_LINES",
+    "UDM_PARAM_SEARCH_TIME", "GNUPG_PROTOCOL_CMS", "BBCODE_DEFAULT_SMILEYS_ON", "CURLOPT_PRIVATE",
+    "CURL_SSLVERSION_MAX_TLSv1_2", "CURLOPT_FTPAPPEND", "RPMREADER_ARCH", "FTP_MOREDATA",
+    "RPMREADER_OBSOLETEVERSION", "CURL_SSLVERSION_MAX_TLSv1_3", "MYSQLND_UH_MYSQLND_CLOSE_IMPLICIT", "PGSQL_NUM",
+    "UDM_PARAM_WEIGHT_FACTOR", "CURLOPT_HTTP200ALIASES", "SOCKET_ADDRINUSE", "BBCODE_FLAGS_DENY_REOPEN_CHILD",
+    "CURLOPT_PROXY_SSLCERTTYPE", "SVN_PROP_REVISION_LOG", "UDM_PREFIXES_DISABLED", "MSG_EOF",
+    "JSON_HEX_TAG", "MYSQLX_TYPE_JSON", "PARSEKIT_ZEND_JMP", "ENCBINARY",
+    "IMG_COLOR_BRUSHED", "SPH_ATTR_INTEGER", "MYSQLND_UH_SERVER_OPTION_SET_CLIENT_IP", "MYSQLX_TYPE_DATETIME",
+    "PHP_SESSION_DISABLED", "FILEINFO_DEVICES", "SO_ERROR", "GSLC_SSL_TWOWAY_AUTH",
+    "ZEND_ACC_PRIVATE", "PGSQL_TUPLES_OK", "FANN_SIGMOID_STEPWISE", "FANN_E_INPUT_NO_MATCH",
+    "CURL_VERSION_UNIX_SOCKETS", "EIO_READDIR_STAT_ORDER", "GMP_ROUND_ZERO", "SVN_WC_STATUS_DELETED",
+    "MYSQLND_UH_MYSQLND_REPORT_DATA_TRUNCATION", "SODIUM_CRYPTO_KX_SESSIONKEYBYTES", "MYSQLI_TYPE_DATE", "M_DONE",
+    "CURLE_FTP_SSL_FAILED", "IMAGETYPE_TIFF_MM", "PNG_NO_FILTER", "TRADER_FUNC_UNST_ATR",
+    "FDFAPRef", "LDAP_OPT_X_TLS_CERTFILE", "IDNA_ERROR_CONTEXTJ", "MYSQLND_UH_MYSQLND_COM_STMT_CLOSE",
+    "MYSQLND_MS_QOS_CONSISTENCY_EVENTUAL", "UDM_FIELD_CHARSET", "SO_KEEPALIVE", "IMG_FLIP_HORIZONTAL",
+    "SORTFROM", "RPMREADER_EXCLUDEARCH", "SOCKET_ENODEV", "PATHINFO_BASENAME",
+    "LIBXML_DTDLOAD", "SQL_TIME", "LDAP_OPT_X_KEEPALIVE_INTERVAL", "SOCKET_EBADE",
+    "SOCKET_EBADF", "OAUTH_HTTP_METHOD_HEAD", "SODIUM_CRYPTO_KDF_BYTES_MIN", "CAIRO_FORMAT_A8",
+    "SAM_WMQ_CLIENT", "EIO_PRI_MAX", "WEBSOCKET_OPCODE_PING", "YAF_ENVIRON",
+    "SQLSRV_SQLTYPE_IMAGE", "PARSEKIT_ZEND_ADD_INTERFACE", "EIO_DT_WHT", "FANN_E_CANT_OPEN_CONFIG_R",
+    "CAIRO_SUBPIXEL_ORDER_RGB", "M_FAIL", "SODIUM_CRYPTO_SECRETBOX_MACBYTES", "SOL_UDP",
+    "MYSQLND_MUX_VERSION_ID", "FILTER_REQUIRE_SCALAR", "BBCODE_AUTO_CORRECT", "FANN_LINEAR",
+    "SEARCHD_OK", "RPMREADER_OLDFILENAMES", "MYSQLND_MS_QOS_CONSISTENCY_SESSION", "PGSQL_CONV_FORCE_NULL",
+    "GEARMAN_MEMORY_ALLOCATION_FAILURE", "SNMP_BIT_STR", "FDFSetFf", "BBCODE_TYPE_OPTARG",
+    "RUNKIT_VERSION", "CURLE_TELNET_OPTION_SYNTAX", "MYSQLI_READ_DEFAULT_FILE", "O_TRUNC",
+    "FANN_THRESHOLD_SYMMETRIC", "PARSEKIT_ZEND_ADD", "YAML_MAP_TAG", "IBASE_STS_IDX_PAGES",
+    "FILEINFO_NONE", "O_EXCL", "ZEND_ACC_FETCH", "EIO_SEEK_END",
+    "GUPNP_CONTROL_ERROR_INVALID_ACTION", "FANN_SIN_SYMMETRIC", "ZEND_USER_OPCODE_CONTINUE", "PARSEKIT_ZEND_BOOL_NOT",
+    "AL_PLAYING", "CAIRO_ANTIALIAS_SUBPIXEL", "APC_ITER_INODE", "UDM_PARAM_VARDIR",
+    "MYSQLND_UH_MYSQLND_PROT_EOF_PACKET", "MYSQLND_UH_MYSQLND_COM_STMT_SEND_LONG_DATA", "RPMREADER_POSTINPROG", "OAUTH_SIG_METHOD_RSASHA1",
+    "SNMP_VALUE_PLAIN", "IMG_NEAREST_NEIGHBOUR", "JSON_ERROR_CTRL_CHAR", "BBCODE_FLAGS_ARG_PARSING",
+    "LC_TIME", "CURLFTPSSL_CONTROL", "ZEND_USER_OPCODE_DISPATCH_TO", "PARSEKIT_ZEND_OVERLOADED_FUNCTION_TEMPORARY",
+    "MYSQLND_UH_MYSQLND_COM_DAEMON", "MYSQLND_UH_MYSQLND_OPT_SSL_CIPHER", "YAML_TIMESTAMP_TAG", "MSSQL_NUM",
+    "CURLINFO_EFFECTIVE_URL", "MYSQLND_UH_MYSQLND_OPTION_OPT_CONNECT_TIMEOUT", "CURLE_COULDNT_CONNECT", "LDAP_CONTROL_AUTHZID_REQUEST",
+    "MYSQLND_QC_VERSION_ID", "INGRES_STRUCTURE_CBTREE", "MB_CASE_LOWER_SIMPLE", "PARSEKIT_ZEND_POST_DEC_OBJ",
+    "SPH_RANK_PROXIMITY_BM25", "EIO_DT_BLK", "MYSQLI_NO_DATA", "PARSEKIT_ZEND_INTERNAL_CLASS",
+    "RPMREADER_CACHEPKGMTIME", "SQL_REAL", "MSSQL_BOTH", "SODIUM_CRYPTO_BOX_KEYPAIRBYTES",
+    "FANN_THRESHOLD", "SWOOLE_AIO_LINUX", "SAM_PASSWORD", "IMG_AFFINE_SCALE",
+    "SOCKET_EL3RST", "ST_UID", "SEARCHD_ERROR", "GEARMAN_NEED_WORKLOAD_FN",
+    "FANN_GAUSSIAN", "PARSEKIT_ZEND_JMP_NO_CTOR", "INGRES_CURSOR_READONLY", "DB2_PARAM_IN",
+    "CURLOPT_POSTFIELDS", "SQLCHAR", "PHP_EOL", "CAIRO_PATTERN_TYPE_SOLID",
+    "IMG_HAMMING", "SOCKET_EUSERS", "SWOOLE_SOCK_UDP", "YAF_ERR_TYPE_ERROR",
+    "SO_RCVBUF", "GEOIP_CITY_EDITION_REV0", "MYSQLND_UH_MYSQLND_PROT_LAST", "MYSQLX_TYPE_BIT",
+    "CURLINFO_CONNECT_TIME", "SQLSRV_SQLTYPE_TIME", "CURLE_OUT_OF_MEMORY", "SEASLOG_DETAIL_ORDER_DESC",
+    "MYSQLX_TYPE_YEAR", "MYSQLX_TYPE_BIGINT", "SQLSRV_SQLTYPE_TIMESTAMP", "MCRYPT_DEV_URANDOM",
+    "IMAGETYPE_BMP", "MYSQLND_UH_MYSQLND_SET_CHARSET_NAME", "PHP_FLOAT_MIN", "IN_MASK_ADD",
+    "FNM_PERIOD", "SQLITE3_FLOAT", "PHP_NORMAL_READ", "CURLOPT_PROXYPORT",
+    "F_WRLCK", "ZEND_ACC_TRAIT", "SEASLOG_CLOSE_LOGGER_STREAM_MOD_ALL", "SWFBUTTON_MOUSEDOWN",
+    "CURLE_HTTP_NOT_FOUND", "CURLOPT_USERPWD", "IMG_HANNING", "GNUPG_SIGSUM_KEY_EXPIRED",
+    "CAIRO_OPERATOR_ATOP", "GNUPG_VALIDITY_ULTIMATE", "LDAP_CONTROL_PROXY_AUTHZ", "MCRYPT_RAND",
+    "LIBXML_DTDATTR", "SWOOLE_ASYNC", "CURLOPT_SSLCERTTYPE", "FANN_E_CANT_READ_TD",
+    "MYSQLND_UH_MYSQLND_PROT_OK_PACKET", "OP_EXPUNGE", "LDAP_OPT_X_KEEPALIVE_IDLE", "MYSQLI_REPORT_INDEX",
+    "DBASE_RDWR", "INGRES_DATE_MDY", "EIO_S_IFIFO", "RPMREADER_SUMMARY",
+    "TRADER_ERR_NOT_SUPPORTED", "YAF_ERR_AUTOLOAD_FAILED", "UDM_FIELD_URL", "SOCKET_SYSNOTREADY",
+    "EIO_O_CREAT", "MONGO_SUPPORTS_STREAMS", "CURLE_FTP_COULDNT_STOR_FILE", "ENT_SUBSTITUTE",
+    "CURLAUTH_DIGEST", "SPH_SORT_RELEVANCE", "CAIRO_OPERATOR_SOURCE", "SOCKET_ECONNABORTED",
+    "SODIUM_CRYPTO_BOX_NONCEBYTES", "GEOIP_PROXY_EDITION", "POLL_HUP", "MYSQLND_UH_MYSQLND_OPT_SSL_CAPATH",
+    "PARSEKIT_ZEND_SEND_VAR_NO_REF", "FT_PEEK", "EXP_TIMEOUT", "AL_SOURCE_RELATIVE",
+    "EV_PERSIST", "IMG_EFFECT_REPLACE", "CURLOPT_ABSTRACT_UNIX_SOCKET", "DEFAULT_INCLUDE_PATH",
+    "CURLE_PARTIAL_FILE", "GEARMAN_JOB_HANDLE_SIZE", "GNUPG_SIGSUM_KEY_REVOKED", "CURLOPT_UPLOAD",
+    "RPMREADER_CONFLICTVERSION", "SO_FREE", "SWOOLE_BASE", "ZLIB_ENCODING_RAW",
+    "SVN_WC_STATUS_UNVERSIONED", "LDAP_CONTROL_POST_READ", "CURLINFO_HEADER_SIZE", "BBCODE_DEFAULT_SMILEYS_OFF",
+    "SOCKET_TRY_AGAIN", "UDM_PARAM_BROWSER_CHARSET", "AL_LOOPING", "GUPNP_TYPE_STRING",
+    "JSON_ERROR_UTF8", "CURLOPT_KRB4LEVEL", "PARSEKIT_ZEND_ISSET_ISEMPTY_VAR", "CAL_DOW_LONG",
+    "SQLSRV_LOG_SYSTEM_CONN", "TRADER_FUNC_UNST_NATR", "UDM_CROSS_WORDS_ENABLED", "PARSEKIT_ZEND_IMPORT_CLASS",
+    "INPUT_GET", "YAML_LN_BREAK", "MYSQLI_SERVER_QUERY_NO_GOOD_INDEX_USED", "O_SYNC",
+    "CURLE_COULDNT_RESOLVE_HOST", "OAUTH_AUTH_TYPE_AUTHORIZATION", "IFX_LO_RDWR", "PGSQL_NOTICE_LAST",
+    "EV_WRITE", "F_GETLK", "GEARMAN_WORK_STATUS", "IDNA_ERROR_BIDI",
+    "CURLAUTH_ANY", "SQLSRV_SQLTYPE_DATETIMEOFFSET", "CURLOPT_PROXY_SSL_VERIFYHOST", "PARSEKIT_EXTENDED_VALUE",
+    "SIGPIPE", "CURLOPT_PROXY_SERVICE_NAME", "SEASLOG_WARNING", "TRADER_ERR_BAD_OBJECT",
+    "SPH_RANK_BM25", "CURL_REDIR_POST_301", "CURL_REDIR_POST_302", "FPE_FLTRES",
+    "CURLAUTH_BASIC", "SEASLOG_APPENDER_FILE", "SOCKET_ESTALE", "XML_ERROR_EXTERNAL_ENTITY_HANDLING",
+    "SWFTEXTFIELD_MULTILINE", "EIO_DT_MPB", "OAUTH_HTTP_METHOD_POST", "PARSEKIT_ZEND_INIT_STATIC_METHOD_CALL",
+    "CURL_TIMECOND_IFUNMODSINCE", "AF_UNIX", "GD_VERSION", "CLASSKIT_ACC_PUBLIC",
+    "SNMP_COUNTER", "CURLPIPE_HTTP1", "FBSQL_LOCK_OPTIMISTIC", "SPH_GROUPBY_ATTRPAIR",
+    "YAML_PHP_TAG", "CURLINFO_PRIVATE", "PGSQL_DIAG_INTERNAL_QUERY", "CAL_MONTH_GREGORIAN_SHORT",
+    "CURLINFO_PRIMARY_PORT", "CURLOPT_COOKIEFILE", "CURLE_UNSUPPORTED_PROTOCOL", "CAIRO_STATUS_INVALID_DSC_COMMENT",
+    "CURLOPT_FILETIME", "SOCKET_EFAULT", "M_ERROR", "PARSEKIT_ZEND_CONT",
+    "MONGO_STREAM_NOTIFY_LOG_CMD_UPDATE", "LDAP_CONTROL_X_SEARCH_OPTIONS", "LIBXML_ERR_FATAL", "FDFValidate",
+    "OAUTH_HTTP_METHOD_GET", "SIGPOLL", "IFX_SCROLL", "EXTR_IF_EXISTS",
+    "PARSEKIT_ZEND_MUL", "INTL_IDNA_VARIANT_UTS46", "CURLOPT_RANGE", "SOCKET_ECOMM",
+    "APC_ITER_TTL", "SEEK_END", "MYSQLND_UH_MYSQLND_OPT_SSL_CERT", "SIG_ERR",
+    "IBASE_BKP_IGNORE_CHECKSUMS", "MYSQLND_UH_MYSQLND_COM_END", "PGSQL_EMPTY_QUERY", "RPMREADER_PAYLOADCOMPRESSOR",
+    "HTML_SPECIALCHARS", "SWOOLE_SOCK_UNIX_STREAM", "GNUPG_SIGSUM_KEY_MISSING", "SSH2_TERM_UNIT_PIXELS",
+    "UDM_FIELD_CONTENT", "BBCODE_CORRECT_REOPEN_TAGS", "MYSQLND_MS_QOS_OPTION_AGE", "FILTER_FLAG_ALLOW_HEX",
+    "IBASE_PRP_WM_SYNC", "RPMREADER_FILERDEVS", "CAIRO_HINT_STYLE_NONE", "CURLOPT_READFUNCTION",
+    "SPH_RANK_NONE", "UDM_MATCH_BEGIN", "FRIBIDI_CHARSET_8859_8", "CURLPROXY_HTTP_1_0",
+    "MYSQLI_CURSOR_TYPE_SCROLLABLE", "RPMREADER_PROVIDEFLAGS", "PHPDBG_COLOR_NOTICE", "S_IROTH",
+    "BUS_ADRERR", "PARSEKIT_ZEND_TICKS", "GUPNP_TYPE_DOUBLE", "IBASE_PRP_RES",
+    "TRADER_FUNC_UNST_ADXR", "FPE_FLTOVF", "SODIUM_CRYPTO_BOX_SEEDBYTES", "FTP_AUTOSEEK",
+    "MYSQLND_UH_MYSQLND_COM_CONNECT_OUT", "MSSQL_ASSOC", "CRYPT_EXT_DES", "CAIRO_FILTER_GAUSSIAN",
+    "UDM_PARAM_STOPTABLE", "SOCKET_EDESTADDRREQ", "WNOHANG", "IBASE_BKP_CONVERT",
+    "SAM_AUTO", "PARSEKIT_IS_TMP_VAR", "MYSQLND_UH_MYSQLND_OPT_LOCAL_INFILE", "ENCBASE64",
+    "SAM_MESSAGEID", "INGRES_DATE_DMY", "DBASE_VERSION", "POLL_OUT",
+    "MYSQLND_UH_MYSQLND_READ_DEFAULT_GROUP", "PARSEKIT_ZEND_DECLARE_INHERITED_CLASS", "TRADER_ERR_GROUP_NOT_FOUND", "PNG_FILTER_AVG",
+    "BBCODE_ARG_DOUBLE_QUOTE", "CRYPT_STD_DES", "SIG_BLOCK", "IDNA_ERROR_PUNYCODE",
+    "SIGCONT", "CURLE_OPERATION_TIMEOUTED", "MB_CASE_FOLD_SIMPLE", "AL_FREQUENCY",
+    "CAIRO_SURFACE_TYPE_IMAGE", "MYSQLX_TYPE_DOUBLE", "MYSQLI_CURSOR_TYPE_READ_ONLY", "MYSQLX_TYPE_SHORT",
+    "MYSQLI_TYPE_DATETIME", "RUNKIT_IMPORT_CLASSES", "FBSQL_ISO_READ_UNCOMMITTED", "SOCKET_EPROTO",
+    "FILTER_FLAG_ENCODE_LOW", "IBASE_SVC_IMPLEMENTATION", "CURLOPT_FTPSSLAUTH", "RUNKIT_ACC_PUBLIC",
+    "VARNISH_CONFIG_HOST", "BBCODE_FLAGS_SMILEYS_ON", "SAM_TIMETOLIVE", "RPMREADER_CLASSDICT",
+    "MYSQLND_UH_MYSQLND_OPT_MAX_ALLOWED_PACKET", "AL_POSITION", "RPMREADER_TRIGGERVERSION", "SOCKET_EPIPE",
+    "RPMREADER_OBSOLETEFLAGS", "DB2_PASSTHRU", "IN_DELETE", "OAUTH_SIG_METHOD_HMACSHA256",
+    "SIGTERM", "MYSQLND_UH_MYSQLND_COM_STMT_RESET", "ARRAY_FILTER_USE_KEY", "SQLSRV_CURSOR_FORWARD",
+    "SAM_WMQ", "CURLOPT_POSTQUOTE", "SORT_STRING", "IIS_SCRIPT",
+    "RPMREADER_BASENAMES", "GMP_VERSION", "EV_SIGNAL", "MSQL_NUM",
+    "CYRUS_CONN_NONSYNCLITERAL", "MYSQLI_TYPE_BIT", "CAIRO_OPERATOR_DEST_IN", "MYSQLND_UH_MYSQLND_OPT_AUTH_PROTOCOL",
+    "PARSEKIT_ZEND_PRINT", "MYSQLI_NEED_DATA", "GUPNP_SIGNAL_DEVICE_PROXY_AVAILABLE", "MYSQLND_UH_MYSQLND_CLOSE_DISCONNECTED",
+    "INI_SCANNER_NORMAL", "LDAP_OPT_X_TLS_CRLFILE", "CURLSSH_AUTH_ANY", "MYSQLX_TYPE_NULL",
+    "ENT_QUOTES", "FALSE", "XML_ERROR_RECURSIVE_ENTITY_REF", "SVN_AUTH_PARAM_CONFIG",
+    "SSH2_STREAM_STDERR", "APC_LIST_ACTIVE", "IBASE_RPR_SWEEP_DB", "SAM_PRIORITY",
+    "JSON_ERROR_UNSUPPORTED_TYPE", "YPERR_NOMORE", "MYSQLND_UH_MYSQLND_PROT_AUTH_PACKET", "XML_ERROR_BINARY_ENTITY_REF",
+    "EIO_SEEK_CUR", "PASSWORD_ARGON2_DEFAULT_MEMORY_COST", "IBASE_PRP_WM_ASYNC", "GLOB_NOSORT",
+    "SOCKET_ENOMSG", "YAML_CRLN_BREAK", "CURLINFO_REDIRECT_URL", "SNMP_TIMETICKS",
+    "SOCKET_ECHRNG", "FILTER_FLAG_ALLOW_FRACTION", "IMG_BSPLINE", "TRADER_FUNC_UNST_HT_DCPHASE",
+    "GEARMAN_COULD_NOT_CONNECT", "PARSEKIT_ZEND_BW_XOR", "PGSQL_COMMAND_OK", "JSON_ERROR_SYNTAX",
+    "GEARMAN_MAX_ERROR_SIZE", "YAR_VERSION", "PARSEKIT_ZEND_THROW", "CURLOPT_PROXY_SSL_OPTIONS",
+    "RPMREADER_NAME", "YAML_SEQ_TAG", "DBASE_TYPE_FOXPRO", "SNMP_OID_OUTPUT_NUMERIC",
+    "DB2_CHAR", "TRADER_FUNC_UNST_T3", "SQL_CURSOR_DYNAMIC", "IMG_WBMP",
+    "SAM_TRANSACTIONS", "CAIRO_LINE_CAP_SQUARE", "GNUPG_VALIDITY_FULL", "ZLIB_BLOCK",
+    "CURLFTP_CREATE_DIR_RETRY", "CURLOPT_STDERR", "SNMP_OID_OUTPUT_UCD", "SO_DONTROUTE",
+    "INGRES_STRUCTURE_CHEAP", "GLOB_AVAILABLE_FLAGS", "CURLOPT_PROXYHEADER", "CLASSKIT_ACC_PRIVATE",
+    "FILTER_SANITIZE_EMAIL", "RPMREADER_LICENSE", "CURLE_FTP_WEIRD_USER_REPLY", "MYSQLND_QC_ENABLE_SWITCH",
+    "O_NOCTTY", "PARSEKIT_ZEND_ASSIGN_BW_OR", "UDM_PARAM_STOP_TABLE", "IBASE_PRP_AM_READWRITE",
+    "FDFCalculate", "CURLPROXY_HTTPS", "INGRES_CURSOR_UPDATE", "CURL_VERSION_KERBEROS5",
+    "SO_OOBINLINE", "EIO_DT_SOCK", "E_STRICT", "SWOOLE_SOCK_SYNC",
+    "SIGWINCH", "CURLOPT_PROXY_CAPATH", "CURLOPT_FTP_SSL", "RPMREADER_DEPENDSDICT",
+    "SQL_ROWVER", "AL_ORIENTATION", "CURLOPT_FTP_USE_EPSV", "MYSQLI_BINARY_FLAG",
+    "F_SETLKW", "INGRES_DATE_ISO4", "CAIRO_STATUS_INVALID_STRIDE", "RPMREADER_PATCHESNAME",
+    "EIO_SYNC_FILE_RANGE_WAIT_AFTER", "TYPEMULTIPART", "GNUPG_SIG_MODE_DETACH", "INGRES_STRUCTURE_ISAM",
+    "SWFTEXTFIELD_HTML", "CURLOPT_INTERFACE", "PHP_OUTPUT_HANDLER_WRITE", "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_IETF_KEYBYTES",
+    "INPUT_REQUEST", "SPH_SORT_EXTENDED", "FBSQL_STOPPING", "SVN_WC_STATUS_MODIFIED",
+    "IN_IGNORED", "FANN_E_NO_ERROR", "SI_MSGGQ", "FDFEnter",
+    "PARSEKIT_ZEND_IMPORT_CONST", "CAIRO_FORMAT_ARGB32", "SQLSRV_PHPTYPE_INT", "APC_ITER_REFCOUNT",
+    "RPMREADER_PROVIDEVERSION", "CURLMOPT_MAX_PIPELINE_LENGTH", "XDIFF_PATCH_REVERSE", "SQLINT2",
+    "CURLM_CALL_MULTI_PERFORM", "PARSEKIT_ZEND_ADD_STRING", "SOCKET_EISCONN", "MYSQLND_QC_SERVER_ID_SWITCH",
+    "CURLE_FTP_WEIRD_PASS_REPLY", "PNG_ALL_FILTERS", "MONGO_STREAM_NOTIFY_LOG_RESPONSE_HEADER", "S_IWOTH",
+    "IDNA_DEFAULT", "BBCODE_TYPE_NOARG", "MING_NEW", "EIO_SYNC_FILE_RANGE_WAIT_BEFORE",
+    "CURLINFO_SIZE_DOWNLOAD_T", "MYSQLND_MS_LAST_USED_SWITCH", "SQLITE3_BLOB", "DB2_DOUBLE",
+    "MONGO_STREAM_NOTIFY_LOG_GETMORE", "UDM_LIMIT_URL", "ZEND_FETCH_CLASS", "FTP_IMAGE",
+    "TRADER_ERR_INVALID_PARAM_FUNCTION", "SVN_WC_STATUS_REPLACED", "MYSQLND_UH_MYSQLND_OPT_USE_EMBEDDED_CONNECTION", "MYSQLI_TYPE_DOUBLE",
+    "CURLOPT_UNRESTRICTED_AUTH", "CURLE_FTP_WEIRD_PASV_REPLY", "CYRUS_CONN_INITIALRESPONSE", "YAML_PLAIN_SCALAR_STYLE",
+    "MYSQLX_TYPE_TINY", "PARSEKIT_ZEND_IS_NOT_IDENTICAL", "CAIRO_FILL_RULE_WINDING", "IDNA_USE_STD3_RULES",
+    "JSON_ERROR_STATE_MISMATCH", "IN_ATTRIB", "AL_REFERENCE_DISTANCE", "PHP_FLOAT_EPSILON",
+    "SOCKET_ENODATA", "SIGILL", "CURLOPT_HTTPGET", "ILL_ILLTRP",
+    "TYPEOTHER", "PARSEKIT_ZEND_FETCH_RW", "CLD_DUMPED", "SQLSRV_PHPTYPE_DATETIME",
+    "GEARMAN_SEND_BUFFER_SIZE", "MONGO_STREAM_NOTIFY_LOG_DELETE", "MYSQLI_TIMESTAMP_FLAG", "SODIUM_CRYPTO_AEAD_CHACHA20POLY1305_ABYTES",
+    "IBASE_PRP_ACCESS_MODE", "PARSEKIT_ZEND_BOOL_XOR", "CURLOPT_POST", "IDNA_ERROR_LABEL_HAS_DOT",
+    "MYSQLND_UH_MYSQLND_OPT_RECONNECT", "FTP_AUTORESUME", "MYSQLX_TYPE_BYTES", "EIO_S_IFSOCK",
+    "RPMREADER_COPYRIGHT", "SOCKET_ESRMNT", "FDFKeystroke", "FILTER_FLAG_IPV6",
+    "PARSEKIT_ZEND_EXT_NOP", "CURLOPT_COOKIESESSION", "PASSWORD_DEFAULT", "IIS_WRITE",
+    "CURL_TIMECOND_IFMODSINCE", "CURLHEADER_UNIFIED", "FANN_COS", "UDM_PARAM_MIN_WORDLEN",
+    "IMG_POWER", "RPMREADER_POSTUNPROG", "YAF_ERR_DISPATCH_FAILED", "CURLOPT_XOAUTH2_BEARER",
+    "SI_ASYNCIO", "CAIRO_FONT_TYPE_TOY", "SPH_MATCH_ALL", "EIO_O_RDONLY",
+    "PARSEKIT_ZEND_POST_DEC", "CONNECTION_NORMAL", "SQL_VARCHAR", "CURLOPT_FORBID_REUSE",
+    "IMG_QUADRATIC", "IMG_ARC_NOFILL", "FBSQL_UNKNOWN", "IBASE_SVC_GET_ENV_MSG",
+    "ALC_FREQUENCY", "MB_OVERLOAD_MAIL", "SOCKET_ELOOP", "FILEINFO_RAW",
+    "SQLSRV_LOG_SEVERITY_ERROR", "GNUPG_SIG_MODE_CLEAR", "FILTER_FLAG_ALLOW_SCIENTIFIC", "DB2_PARAM_FILE",
+    "CURLE_BAD_CALLING_ORDER", "IN_UNMOUNT", "CURLSSH_AUTH_DEFAULT", "MYSQLND_UH_MYSQLND_COM_SHUTDOWN",
+    "SODIUM_CRYPTO_SCALARMULT_BYTES", "SWFACTION_ENTERFRAME", "SQLSRV_SQLTYPE_DATE", "SODIUM_CRYPTO_PWHASH_ALG_ARGON2ID13",
+    "SWOOLE_EVENT_READ", "GEARMAN_ECHO_DATA_CORRUPTION", "SOCKET_EBADR", "SOCKET_ETOOMANYREFS",
+    "FILTER_VALIDATE_MAC", "MING_ZLIB", "SIGHUP", "GEARMAN_UNKNOWN_STATE",
+    "IMG_WEIGHTED4", "FANN_E_WRONG_NUM_CONNECTIONS", "ILL_COPROC", "CAIRO_OPERATOR_XOR",
+    "SWOOLE_SOCK_TCP", "SQLITE3_OPEN_CREATE", "VARNISH_CONFIG_SECRET", "IDNA_NONTRANSITIONAL_TO_ASCII",
+    "SODIUM_CRYPTO_GENERICHASH_BYTES_MIN", "MYSQLI_TYPE_INTERVAL", "IBASE_PRP_DB_ONLINE", "RUNKIT_IMPORT_CLASS_STATIC_PROPS",
+    "UDM_LIMIT_LANG", "SOLR_PATCH_VERSION", "ZEND_ADD_TRAIT", "SIGXCPU",
+    "CURLOPT_MUTE", "SEASLOG_APPENDER_TCP", "PGSQL_DIAG_SEVERITY", "PARSEKIT_ZEND_RECV_INIT",
+    "PHP_OS_FAMILY", "JSON_PRETTY_PRINT", "SQLITE_NOTFOUND", "ILL_BADSTK",
+    "MYSQLI_TYPE_NEWDATE", "FTP_USEPASVADDRESS"
+};
+
+static const unsigned char TABLE_PHP_WORDS_CS_FORMATS[] = {
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD
+};
+
+const HighlightWordsTable HIGHLIGHT_PHP_WORDS_CS = {
+    3402, TABLE_PHP_WORDS_CS_SEEDS, TABLE_PHP_WORDS_CS_WORDS, TABLE_PHP_WORDS_CS_FORMATS
+};
+
+static const int TABLE_JS_WORDS_CS_SEEDS[] = {
+    3, -70, 0, -68, -67, -65, -62, -61, 0, -58, 0, -57, -56, 0, 0, -54,
+    1, 6, 0, 0, 0, 0, 1, -49, 0, 1, -48, -47, -46, 3, 1, 0,
+    -43, 0, 0, 0, -42, 0, -41, 0, -40, 1, 0, 1, 1, -34, 4, -33,
+    -32, 0, 0, 3, 3, 0, -30, 0, 17, -24, -23, -16, -12, -10, -7, -3,
+    0, 5, -2, 0, 1, 2, 0, -1
+};
+
+static const char * const TABLE_JS_WORDS_CS_WORDS[] = {
+    "new", "native", "case", "return",
+    "public", "goto", "extends", "class",
+    "yield", "set", "async", "for",
+    "abstract", "long", "crypto", "await",
+    "super", "if", "catch", "__proto__",
+    "instanceof", "export", "delete", "eval",
+    "const", "protected", "package", "final",
+    "try", "in", "clientInformation", "import",
+    "this", "static", "break", "true",
+    "finally", "transient", "throws", "null",
+    "int", "else", "private", "get",
+    "while", "interface", "char", "let",
+    "function", "short", "do", "implements",
+    "debugger", "with", "false", "enum",
+    "float", "void", "double", "boolean",
+    "switch", "var", "continue", "byte",
+    "synchronized", "volatile", "typeof", "parent",
+    "default", "arguments", "throw", "self"
+};
+
+static const unsigned char TABLE_JS_WORDS_CS_FORMATS[] = {
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD
+};
+
+const HighlightWordsTable HIGHLIGHT_JS_WORDS_CS = {
+    72, TABLE_JS_WORDS_CS_SEEDS, TABLE_JS_WORDS_CS_WORDS, TABLE_JS_WORDS_CS_FORMATS
+};
+
+static const int TABLE_CSS_WORDS_SEEDS[] = {
+    2, 0, 0, -95, 0, 0, 0, -88, 0, 0, 0, 2, -86, 3, -78, -74,
+    0, -72, -68, -64, 0, 0, 1, 0, -63, 2, -62, 0, -61, 0, -59, -58,
+    -56, 0, 5, -54, -53, -52, 1, 2, -49, 0, -44, -43, 0, 2, -39, -37,
+    0, -35, -30, 0, 1, 6, -29, -25, 0, 2, 5, 0, -24, -20, 1, 0,
+    1, 0, -18, 0, -10, 4, -9, -8, 4, 0, 0, 0, 0, 1, -6, -5,
+    1, 0, 2, 18, 1, 0, -2, 0, 8, 0, 3, 0, 6, 0, 1
+};
+
+static const char * const TABLE_CSS_WORDS_WORDS[] = {
+    "part", "defined", "target-within", "first-letter",
+    "required", "extend", "first-line", "endcolorstr",
+    "only-child", "optional", "where", "nth-child",
+    "nth-last-col", "enabled", "font-face", "focus-visible",
+    "cue-region", "host-context", "gradienttype", "marker",
+    "valid", "mixin", "default", "checked",
+    "active", "counter-style", "link", "grammar-error",
+    "after", "last-child", "past", "nth-last-of-type",
+    "blank", "host", "placeholder", "empty",
+    "and", "lang", "nth-of-type", "first",
+    "last-of-type", "backdrop", "fullscreen", "progid",
+    "spelling-error", "selection", "scope", "local-link",
+    "disabled", "right", "slotted", "dir",
+    "nth-col", "charset", "cue", "is",
+    "dximagetransform", "only-of-type", "drop", "focus-within",
+    "startcolorstr", "microsoft", "current", "screen",
+    "target", "first-child", "hover", "any-link",
+    "only", "first-of-type", "focus", "before",
+    "print", "root", "import", "opacity",
+    "not", "left", "supports", "future",
+    "has", "media", "important", "out-of-range",
+    "invalid", "indeterminate", "read-only", "visited",
+    "nth-last-child", "placeholder-shown", "read-write", "in-range",
+    "include", "keyframes", "user-invalid"
+};
+
+static const unsigned char TABLE_CSS_WORDS_FORMATS[] = {
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_CSS_SPECIAL,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_CSS_SPECIAL, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_CSS_SPECIAL,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_CSS_SPECIAL, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_CSS_SPECIAL, FORMAT_CSS_SPECIAL, FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_CSS_SPECIAL,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS, FORMAT_PSEUDO_CLASS,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_PSEUDO_CLASS
+};
+
+const HighlightWordsTable HIGHLIGHT_CSS_WORDS = {
+    95, TABLE_CSS_WORDS_SEEDS, TABLE_CSS_WORDS_WORDS, TABLE_CSS_WORDS_FORMATS
+};
+
+static const int TABLE_GENERAL_WORDS_SEEDS[] = {
+    3, -68, 0, -67, 0, -65, -63, -62, -61, 1, 0, -59, -58, 0, 0, -56,
+    1, 2, -55, -54, -53, 0, -47, -46, 0, 1, 0, -45, -43, 3, 1, 0,
+    -42, 0, 0, 0, -41, 0, -39, -38, -36, 4, 0, 1, -33, -30, 3, -24,
+    -20, 0, 0, -18, 3, 0, 1, 0, -16, -12, -10, -7, -6, -3, 4, -2,
+    0, 5, 0, 0, 4, 2, 0, -1
+};
+
+static const char * const TABLE_GENERAL_WORDS_WORDS[] = {
+    "new", "case", "set", "include",
+    "public", "for", "await", "class",
+    "yield", "delete", "self", "eval",
+    "abstract", "long", "goto", "continue",
+    "super", "true", "catch", "import",
+    "instanceof", "export", "if", "this",
+    "const", "protected", "package", "final",
+    "try", "static", "return", "void",
+    "double", "break", "throw", "null",
+    "finally", "endfor", "int", "extends",
+    "else", "private", "interface", "get",
+    "char", "function", "while", "endwhile",
+    "in", "short", "do", "implements",
+    "struct", "endif", "endswitch", "with",
+    "nullptr", "enum", "float", "boolean",
+    "endforeach", "switch", "var", "byte",
+    "synchronized", "volatile", "parent", "arguments",
+    "default", "false", "async", "endfunction"
+};
+
+static const unsigned char TABLE_GENERAL_WORDS_FORMATS[] = {
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD,
+    FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD, FORMAT_KEYWORD
+};
+
+const HighlightWordsTable HIGHLIGHT_GENERAL_WORDS = {
+    72, TABLE_GENERAL_WORDS_SEEDS, TABLE_GENERAL_WORDS_WORDS, TABLE_GENERAL_WORDS_FORMATS
+};
@@ -0,0 +1,69 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include "highlightworker.h"
+#include <QTextBlock>
+#include <QReadLocker>
+
+const int HIGHLIGHT_WORKER_CHUNK_BLOCKS = 100;
+
+HighlightWorker::HighlightWorker(QObject *parent) : QObject(parent)
+{
+    // created in the GUI thread, so that settings are read safely
+    doc = new QTextDocument(this);
+    highlight = new Highlight(doc);
+    highlight->setParent(this);
+    wantStop.storeRelease(0);
+    qRegisterMetaType<SharedHighlightResult>();
+}
+
+void HighlightWorker::cancel()
+{
+    wantStop.storeRelease(1);
+}
+
+void HighlightWorker::highlightText(int job, QString text, QString ext, QString fileName, bool isBigFile)
+{
+    wantStop.storeRelease(0);
+    highlight->resetMode();
+    doc->setPlainText(text);
+    highlight->setFileName(fileName);
+    highlight->setIsBigFile(isBigFile);
+    highlight->initMode(ext, -1);
+    highlight->setFirstRunMode(true);
+    highlight->setCollectMode(true);
+    int blocksCount = doc->blockCount();
+    int progressPercent = 0;
+    QTextBlock block = doc->firstBlock();
+    while (block.isValid()) {
+        if (wantStop.loadAcquire()) {
+            emit highlightFinished(job, SharedHighlightResult());
+            return;
+        }
+        // keywords can be added from the GUI thread in between chunks
+        QReadLocker locker(&HighlightWords::instance().lock);
+        for (int i=0; i<HIGHLIGHT_WORKER_CHUNK_BLOCKS && block.isValid(); i++) {
+            highlight->rehighlightBlock(block);
+            block = block.next();
+        }
+        locker.unlock();
+        int percent = (block.isValid() ? block.blockNumber() : blocksCount) * 100 / blocksCount;
+        if (percent - progressPercent > 10) {
+            progressPercent = percent;
+            emit progressChanged(percent);
+        }
+    }
+    highlight->setFirstRunMode(false);
+    SharedHighlightResult result = highlight->takeCollectedResult();
+    emit progressChanged(100);
+    emit highlightFinished(job, result);
+}
+
+void HighlightWorker::release()
+{
+    highlight->resetMode();
+    doc->clear();
+}
@@ -58,10 +58,10 @@ MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow)
 {
-    qRegisterMetaType<ParsePHP::ParseResult>();
-    qRegisterMetaType<ParseJS::ParseResult>();
-    qRegisterMetaType<ParseCSS::ParseResult>();
-    qRegisterMetaType<WordsMapList>();
+    qRegisterMetaType<ParsePHP::SharedParseResult>();
+    qRegisterMetaType<ParseJS::SharedParseResult>();
+    qRegisterMetaType<ParseCSS::SharedParseResult>();
+    qRegisterMetaType<Parse::TextEdits>();
 
     Settings::load();
     connect(&Settings::instance(), SIGNAL(restartApp()), this, SLOT(restartApp()));
@@ -96,9 +96,7 @@ MainWindow::MainWindow(QWidget *parent) :
         customThemesPath = customThemesPathDir.absolutePath();
         if (!Helper::folderExists(customThemesPath)) customThemesPath = "";
     }
-    if (colorSheme == COLOR_SCHEME_DARK) Settings::applyDarkColors();
-    else if (colorSheme == COLOR_SCHEME_LIGHT || customThemesPath.size() == 0 || !Helper::fileExists(customThemesPath + "/" + colorSheme + "/" + CUSTOM_THEME_COLORS_FILE)) Settings::applyLightColors();
-    else if (customThemesPath.size() > 0 && Helper::fileExists(customThemesPath + "/" + colorSheme + "/" + CUSTOM_THEME_COLORS_FILE)) Settings::applyCustomColors(customThemesPath + "/" + colorSheme + "/" + CUSTOM_THEME_COLORS_FILE);
+    applyColorScheme();
 
     QString schemeType = QString::fromStdString(Settings::get(COLOR_SCHEME_TYPE.toStdString()));
     if (theme != THEME_SYSTEM && theme.indexOf(STYLE_PLUGIN_DISPLAY_NAME_SUFFIX) < 0) {
@@ -159,7 +157,6 @@ MainWindow::MainWindow(QWidget *parent) :
     HighlightWords::setColors();
 
     // load words
-    HighlightWords::loadDelayed();
     CompleteWords::loadDelayed();
     HelpWords::loadDelayed();
     SpellWords::loadDelayed();
@@ -183,9 +180,9 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(editorTabs, SIGNAL(editorReady(int)), this, SLOT(editorReady(int)));
     connect(editorTabs, SIGNAL(editorShowDeclaration(QString)), this, SLOT(editorShowDeclaration(QString)));
     connect(editorTabs, SIGNAL(editorShowHelp(QString)), this, SLOT(editorShowHelp(QString)));
-    connect(editorTabs, SIGNAL(editorParsePHPRequested(int,QString)), this, SLOT(editorParsePHPRequested(int,QString)));
-    connect(editorTabs, SIGNAL(editorParseJSRequested(int,QString)), this, SLOT(editorParseJSRequested(int,QString)));
-    connect(editorTabs, SIGNAL(editorParseCSSRequested(int,QString)), this, SLOT(editorParseCSSRequested(int,QString)));
+    connect(editorTabs, SIGNAL(editorParsePHPRequested(int,Parse::TextEdits)), this, SLOT(editorParsePHPRequested(int,Parse::TextEdits)));
+    connect(editorTabs, SIGNAL(editorParseJSRequested(int,Parse::TextEdits)), this, SLOT(editorParseJSRequested(int,Parse::TextEdits)));
+    connect(editorTabs, SIGNAL(editorParseCSSRequested(int,Parse::TextEdits)), this, SLOT(editorParseCSSRequested(int,Parse::TextEdits)));
     connect(editorTabs, SIGNAL(editorUndoRedoChanged()), this, SLOT(editorUndoRedoChanged()));
     connect(editorTabs, SIGNAL(editorBackForwardChanged()), this, SLOT(editorBackForwardChanged()));
     connect(editorTabs, SIGNAL(editorSearchInFilesRequested(QString)), this, SLOT(editorSearchInFilesRequested(QString)));
@@ -317,6 +314,9 @@ MainWindow::MainWindow(QWidget *parent) :
     parseCSSEnabled = false;
     std::string parseCSSEnabledStr = Settings::get("parser_enable_parse_css");
     if (parseCSSEnabledStr == "yes") parseCSSEnabled = true;
+    watchProjectEnabled = false;
+    std::string watchProjectEnabledStr = Settings::get("parser_watch_project");
+    if (watchProjectEnabledStr == "yes") watchProjectEnabled = true;
     gitCommandsEnabled = false;
     std::string gitCommandsEnabledStr = Settings::get("parser_enable_git");
     if (gitCommandsEnabledStr == "yes") gitCommandsEnabled = true;
@@ -344,23 +344,30 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(this, SIGNAL(parseMixed(int,QString)), parserWorker, SLOT(parseMixed(int,QString)));
     connect(this, SIGNAL(parseJS(int,QString)), parserWorker, SLOT(parseJS(int,QString)));
     connect(this, SIGNAL(parseCSS(int,QString)), parserWorker, SLOT(parseCSS(int,QString)));
+    connect(this, SIGNAL(parseMixedEdits(int,Parse::TextEdits)), parserWorker, SLOT(parseMixedEdits(int,Parse::TextEdits)));
+    connect(this, SIGNAL(parseJSEdits(int,Parse::TextEdits)), parserWorker, SLOT(parseJSEdits(int,Parse::TextEdits)));
+    connect(this, SIGNAL(parseCSSEdits(int,Parse::TextEdits)), parserWorker, SLOT(parseCSSEdits(int,Parse::TextEdits)));
     connect(this, SIGNAL(parseProject(QString)), parserWorker, SLOT(parseProject(QString)));
+    connect(this, SIGNAL(parseProjectFile(int,QString,QString,QString)), parserWorker, SLOT(parseProjectFile(int,QString,QString,QString)));
+    connect(this, SIGNAL(parseProjectFiles(QString,QStringList)), parserWorker, SLOT(parseProjectFiles(QString,QStringList)));
     connect(this, SIGNAL(searchInFiles(QString,QString,QString,bool,bool,bool,QStringList)), parserWorker, SLOT(searchInFiles(QString,QString,QString,bool,bool,bool,QStringList)));
     connect(this, SIGNAL(gitCommand(QString, QString, QStringList, bool, bool)), parserWorker, SLOT(gitCommand(QString, QString, QStringList, bool, bool)));
     connect(this, SIGNAL(serversCommand(QString, QString)), parserWorker, SLOT(serversCommand(QString,QString)));
     connect(this, SIGNAL(sassCommand(QString, QString)), parserWorker, SLOT(sassCommand(QString,QString)));
-    connect(this, SIGNAL(quickFind(QString, QString, WordsMapList, QStringList)), parserWorker, SLOT(quickFind(QString, QString, WordsMapList, QStringList)));
+    connect(this, SIGNAL(quickFind(QString, QString, QString)), parserWorker, SLOT(quickFind(QString, QString, QString)));
     connect(this, SIGNAL(installAndroidPack()), parserWorker, SLOT(installAndroidPack()));
     connect(progressInfo, SIGNAL(cancelTriggered()), parserWorker, SLOT(cancelRequested()));
     connect(parserWorker, SIGNAL(lintFinished(int,QStringList,QStringList,QString)), this, SLOT(parseLintFinished(int,QStringList,QStringList,QString)));
     connect(parserWorker, SIGNAL(execPHPFinished(int,QString)), this, SLOT(execPHPFinished(int,QString)));
     connect(parserWorker, SIGNAL(execPHPWebServerFinished(bool,QString)), this, SLOT(execPHPWebServerFinished(bool,QString)));
     connect(parserWorker, SIGNAL(phpcsFinished(int,QStringList,QStringList)), this, SLOT(parsePHPCSFinished(int,QStringList,QStringList)));
-    connect(parserWorker, SIGNAL(parseMixedFinished(int,ParsePHP::ParseResult)), this, SLOT(parseMixedFinished(int,ParsePHP::ParseResult)));
-    connect(parserWorker, SIGNAL(parseJSFinished(int,ParseJS::ParseResult)), this, SLOT(parseJSFinished(int,ParseJS::ParseResult)));
-    connect(parserWorker, SIGNAL(parseCSSFinished(int,ParseCSS::ParseResult)), this, SLOT(parseCSSFinished(int,ParseCSS::ParseResult)));
+    connect(parserWorker, SIGNAL(parseMixedFinished(int,ParsePHP::SharedParseResult)), this, SLOT(parseMixedFinished(int,ParsePHP::SharedParseResult)));
+    connect(parserWorker, SIGNAL(parseJSFinished(int,ParseJS::SharedParseResult)), this, SLOT(parseJSFinished(int,ParseJS::SharedParseResult)));
+    connect(parserWorker, SIGNAL(parseCSSFinished(int,ParseCSS::SharedParseResult)), this, SLOT(parseCSSFinished(int,ParseCSS::SharedParseResult)));
+    connect(parserWorker, SIGNAL(parseEditsRejected(int,int)), this, SLOT(parseEditsRejected(int,int)));
     connect(parserWorker, SIGNAL(parseProjectFinished(bool,bool)), this, SLOT(parseProjectFinished(bool,bool)));
     connect(parserWorker, SIGNAL(parseProjectProgress(int)), this, SLOT(sidebarProgressChanged(int)));
+    connect(parserWorker, SIGNAL(projectFileUpdated(QStringList,QVariantMap,QVariantMap)), this, SLOT(projectFileUpdated(QStringList,QVariantMap,QVariantMap)));
     connect(parserWorker, SIGNAL(searchInFilesFound(QString,QString,int,int)), this, SLOT(searchInFilesFound(QString,QString,int,int)));
     connect(parserWorker, SIGNAL(searchInFilesFinished()), this, SLOT(searchInFilesFinished()));
     connect(parserWorker, SIGNAL(message(QString)), this, SLOT(workerMessage(QString)));
@@ -374,6 +381,16 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(parserWorker, SIGNAL(deactivateProgressInfo()), this, SLOT(deactivateProgressInfo()));
     connect(parserWorker, SIGNAL(updateProgressInfo(QString)), this, SLOT(updateProgressInfo(QString)));
     connect(parserWorker, SIGNAL(installAndroidPackFinished(QString)), this, SLOT(installAndroidPackFinished(QString)));
+
+    // project files changed outside of the editor
+    projectWatcher = new ProjectWatcher();
+    projectWatcher->moveToThread(&projectWatcherThread);
+    connect(&projectWatcherThread, &QThread::finished, projectWatcher, &QObject::deleteLater);
+    connect(this, SIGNAL(startProjectWatcher(QString)), projectWatcher, SLOT(start(QString)));
+    connect(this, SIGNAL(stopProjectWatcher()), projectWatcher, SLOT(stop()));
+    connect(projectWatcher, SIGNAL(filesChanged(QStringList)), this, SLOT(projectFilesChanged(QStringList)));
+    connect(projectWatcher, SIGNAL(rescanRequested()), this, SLOT(projectRescanRequested()));
+    projectWatcherThread.start();
     parserThread.start();
 
     tmpDisableParser = false;
@@ -691,6 +708,8 @@ MainWindow::~MainWindow()
 {
     parserThread.quit();
     parserThread.wait();
+    projectWatcherThread.quit();
+    projectWatcherThread.wait();
     delete filebrowser;
     delete navigator;
     delete editorTabs;
@@ -732,7 +751,7 @@ void MainWindow::closeEvent(QCloseEvent *event)
 void MainWindow::saveStateBeforeExit()
 {
     // save project
-    project->save(editorTabs->getOpenTabFiles(), editorTabs->getOpenTabLines(), editorTabs->getCurrentTabIndex(), ui->todoEdit->toPlainText());
+    saveProject();
     if (Settings::get("devpack_install_silent") == "no") {
         std::unordered_map<std::string,std::string> sMap;
         sMap["devpack_install_silent"] = "yes";
@@ -1183,9 +1202,26 @@ void MainWindow::on_actionRescanProject_triggered()
     emit parseProject(project->getPath());
 }
 
+void MainWindow::saveProject()
+{
+    if (!project->isOpen()) return;
+    QStringList openTabFiles = editorTabs->getOpenTabFiles();
+    project->save(openTabFiles, editorTabs->getOpenTabLines(), editorTabs->getCurrentTabIndex(), ui->todoEdit->toPlainText());
+    // highlight formats of open files are restored when the project is opened again
+    for (int i=0; i<openTabFiles.size(); i++) {
+        Editor * tabEditor = editorTabs->findTabEditor(openTabFiles.at(i));
+        if (tabEditor == nullptr) continue;
+        QString cacheFile = project->getHighlightCacheFile(openTabFiles.at(i));
+        if (cacheFile.size() > 0) tabEditor->saveHighlightCache(cacheFile);
+    }
+    project->cleanHighlightCache(openTabFiles);
+}
+
 void MainWindow::on_actionCloseProject_triggered()
 {
-    project->save(editorTabs->getOpenTabFiles(), editorTabs->getOpenTabLines(), editorTabs->getCurrentTabIndex(), ui->todoEdit->toPlainText());
+    saveProject();
+    watchedProjectPath = "";
+    emit stopProjectWatcher();
     project->close();
     reloadWords();
     disableActionsForEmptyProject();
@@ -1841,12 +1877,37 @@ void MainWindow::installAndroidPackFinished(QString result)
     }
 }
 
+void MainWindow::applyColorScheme()
+{
+    if (colorSheme == COLOR_SCHEME_DARK) Settings::applyDarkColors();
+    else if (colorSheme == COLOR_SCHEME_LIGHT || customThemesPath.size() == 0 || !Helper::fileExists(customThemesPath + "/" + colorSheme + "/" + CUSTOM_THEME_COLORS_FILE)) Settings::applyLightColors();
+    else if (customThemesPath.size() > 0 && Helper::fileExists(customThemesPath + "/" + colorSheme + "/" + CUSTOM_THEME_COLORS_FILE)) Settings::applyCustomColors(customThemesPath + "/" + colorSheme + "/" + CUSTOM_THEME_COLORS_FILE);
+}
+
 void MainWindow::on_actionSettings_triggered()
 {
     SettingsDialog dialog(this);
     if (dialog.exec() != QDialog::Accepted) return;
-    Settings::change(dialog.getData());
-    restartApp();
+    std::unordered_map<std::string, std::string> data = dialog.getData();
+    // the color scheme is applied without restart
+    bool restartRequired = false;
+    for (auto & it : data) {
+        if (it.first != "color_scheme" && it.second != Settings::get(it.first)) {
+            restartRequired = true;
+            break;
+        }
+    }
+    Settings::change(data);
+    // highlight colors are applied to open files without parsing them again
+    QString changedColorScheme = QString::fromStdString(Settings::get("color_scheme"));
+    if (changedColorScheme != colorSheme) {
+        colorSheme = changedColorScheme;
+        applyColorScheme();
+        HighlightWords::setColors();
+        editorTabs->remapHighlightFormats();
+        editorTabsSplit->remapHighlightFormats();
+    }
+    if (restartRequired) restartApp();
 }
 
 void MainWindow::on_actionHelpShortcuts_triggered()
@@ -2153,18 +2214,12 @@ void MainWindow::quickFindRequested(QString text)
 {
 
     QString dir = filebrowser->getRootPath();
-    if (project->isOpen()) dir = project->getPath();
-    WordsMapList words;
-    QStringList wordPrefixes;
+    QString projectPath = "";
     if (project->isOpen()) {
-        words.push_back(project->phpClassDeclarations);
-        wordPrefixes.append("class: ");
-        words.push_back(project->phpClassMethodDeclarations);
-        wordPrefixes.append("method: ");
-        words.push_back(project->phpFunctionDeclarations);
-        wordPrefixes.append("function: ");
+        dir = project->getPath();
+        projectPath = project->getPath();
     }
-    emit quickFind(dir, text, words, wordPrefixes);
+    emit quickFind(dir, text, projectPath);
 }
 
 void MainWindow::editorFilenameChanged(QString name)
@@ -2275,7 +2330,7 @@ void MainWindow::editorSaved(int index)
         textEditorSplit->setFileIsOutdated();
     }
 
-    parseTab();
+    parseTab(true);
     gitTabRefreshRequested();
     filesHistory[textEditor->getFileName()] = textEditor->getCursorLine();
 }
@@ -2290,7 +2345,7 @@ void MainWindow::editorSplitSaved(int index)
         textEditor->setFileIsOutdated();
     }
 
-    parseTabSplit();
+    parseTabSplit(true);
     gitTabRefreshRequested();
     filesHistory[textEditorSplit->getFileName()] = textEditorSplit->getCursorLine();
 }
@@ -2314,7 +2369,14 @@ QString MainWindow::getTmpDirPath()
     return QDir::tempPath();
 }
 
-void MainWindow::parseTab()
+bool MainWindow::isOpenProjectFile(QString path)
+{
+    if (!project->isOpen() || !parsePHPEnabled) return false;
+    if (!path.startsWith(project->getPath() + "/")) return false;
+    return Project::isProjectFile(path);
+}
+
+void MainWindow::parseTab(bool saved)
 {
     if (tmpDisableParser) return;
     Editor * textEditor = editorTabs->getActiveEditor();
@@ -2326,7 +2388,11 @@ void MainWindow::parseTab()
     //if (modeType == MODE_UNKNOWN) return;
     if (modeType == MODE_MIXED) {
         if ((!project->isOpen() && parsePHPLintEnabled) || (project->isOpen() && project->isPHPLintEnabled())) emit parseLint(tabIndex, path);
-        if (textEditor->isReady() && parsePHPEnabled) emit parseMixed(tabIndex, textEditor->getContent());
+        if (textEditor->isReady() && parsePHPEnabled) {
+            // saved project files are parsed once for the tab and the project index
+            if (saved && isOpenProjectFile(path)) emit parseProjectFile(tabIndex, textEditor->getContent(), project->getPath(), path);
+            else emit parseMixed(tabIndex, textEditor->getContent());
+        }
     }
     if (modeType == MODE_JS && textEditor->isReady() && parseJSEnabled) emit parseJS(tabIndex, textEditor->getContent());
     if (modeType == MODE_CSS && textEditor->isReady() && parseCSSEnabled) emit parseCSS(tabIndex, textEditor->getContent());
@@ -2337,7 +2403,7 @@ void MainWindow::parseTab()
     }
 }
 
-void MainWindow::parseTabSplit()
+void MainWindow::parseTabSplit(bool saved)
 {
     if (tmpDisableParser) return;
     Editor * textEditor = editorTabsSplit->getActiveEditor();
@@ -2348,6 +2414,8 @@ void MainWindow::parseTabSplit()
     //if (modeType == MODE_UNKNOWN) return;
     if (modeType == MODE_MIXED) {
         if ((!project->isOpen() && parsePHPLintEnabled) || (project->isOpen() && project->isPHPLintEnabled())) emit parseLint(tabIndex, path);
+        // split tabs have no parse results, only the project index is updated
+        if (saved && textEditor->isReady() && isOpenProjectFile(path)) emit parseProjectFile(-1, textEditor->getContent(), project->getPath(), path);
     }
     if ((!project->isOpen() && parsePHPCSEnabled) || (project->isOpen() && project->isPHPCSEnabled())) emit parsePHPCS(tabIndex, path);
     if (gitCommandsEnabled && textEditor->isReady()) {
@@ -2409,16 +2477,16 @@ void MainWindow::parsePHPCSFinished(int tabIndex, QStringList errorTexts, QStrin
     if (editorTabs->getActiveEditor() == textEditor) scrollMessagesTabToTop();
 }
 
-void MainWindow::parseMixedFinished(int tabIndex, ParsePHP::ParseResult result)
+void MainWindow::parseMixedFinished(int tabIndex, ParsePHP::SharedParseResult result)
 {
     Editor * textEditor = editorTabs->getActiveEditor();
     if (textEditor == nullptr) return;
     if (tabIndex != textEditor->getTabIndex()) return;
     if (!textEditor->getParseError()) {
         textEditor->clearErrors();
-        if (result.errors.size()) {
-            for (int i=0; i<result.errors.size(); i++) {
-                ParsePHP::ParseResultError error = result.errors.at(i);
+        if (result->errors.size()) {
+            for (int i=0; i<result->errors.size(); i++) {
+                const ParsePHP::ParseResultError & error = result->errors.at(i);
                 textEditor->setError(error.line, error.text);
                 textEditor->highlightError(error.symbol, 1);
             }
@@ -2430,15 +2498,15 @@ void MainWindow::parseMixedFinished(int tabIndex, ParsePHP::ParseResult result)
     qa->setParseResult(result, textEditor->getFileName());
 }
 
-void MainWindow::parseJSFinished(int tabIndex, ParseJS::ParseResult result)
+void MainWindow::parseJSFinished(int tabIndex, ParseJS::SharedParseResult result)
 {
     Editor * textEditor = editorTabs->getActiveEditor();
     if (textEditor == nullptr) return;
     if (tabIndex != textEditor->getTabIndex()) return;
     textEditor->clearErrors();
-    if (result.errors.size()) {
-        for (int i=0; i<result.errors.size(); i++) {
-            ParseJS::ParseResultError error = result.errors.at(i);
+    if (result->errors.size()) {
+        for (int i=0; i<result->errors.size(); i++) {
+            const ParseJS::ParseResultError & error = result->errors.at(i);
             textEditor->setError(error.line, error.text);
             textEditor->highlightError(error.symbol, 1);
         }
@@ -2449,15 +2517,15 @@ void MainWindow::parseJSFinished(int tabIndex, ParseJS::ParseResult result)
     qa->setParseResult(result, textEditor->getFileName());
 }
 
-void MainWindow::parseCSSFinished(int tabIndex, ParseCSS::ParseResult result)
+void MainWindow::parseCSSFinished(int tabIndex, ParseCSS::SharedParseResult result)
 {
     Editor * textEditor = editorTabs->getActiveEditor();
     if (textEditor == nullptr) return;
     if (tabIndex != textEditor->getTabIndex()) return;
     textEditor->clearErrors();
-    if (result.errors.size()) {
-        for (int i=0; i<result.errors.size(); i++) {
-            ParseCSS::ParseResultError error = result.errors.at(i);
+    if (result->errors.size()) {
+        for (int i=0; i<result->errors.size(); i++) {
+            const ParseCSS::ParseResultError & error = result->errors.at(i);
             textEditor->setError(error.line, error.text);
             textEditor->highlightError(error.symbol, 1);
         }
@@ -2468,6 +2536,14 @@ void MainWindow::parseCSSFinished(int tabIndex, ParseCSS::ParseResult result)
     qa->setParseResult(result, textEditor->getFileName());
 }
 
+void MainWindow::parseEditsRejected(int tabIndex, int documentId)
+{
+    Editor * textEditor = editorTabs->getTabEditor(tabIndex);
+    if (textEditor == nullptr) return;
+    if (textEditor->getParseDocumentId() != documentId) return;
+    textEditor->resetParseEdits();
+}
+
 void MainWindow::parseProjectFinished(bool success, bool isModified)
 {
     if (success) {
@@ -2479,6 +2555,46 @@ void MainWindow::parseProjectFinished(bool success, bool isModified)
     if (ui->sidebarProgressBarWrapperWidget->isVisible()) ui->sidebarProgressBarWrapperWidget->hide();
     editorTabs->initHighlighters();
     if (success && isModified) showPopupText(tr("Project '%1' updated").arg(project->getName()));
+    // watching starts after the first scan, when the project index exists
+    if (success && watchProjectEnabled && project->isOpen() && watchedProjectPath != project->getPath()) {
+        watchedProjectPath = project->getPath();
+        emit startProjectWatcher(watchedProjectPath);
+    }
+}
+
+void MainWindow::projectFileUpdated(QStringList files, QVariantMap oldMap, QVariantMap newMap)
+{
+    project->updatePHPWords(files, oldMap, newMap);
+}
+
+void MainWindow::projectFilesChanged(QStringList files)
+{
+    if (!project->isOpen()) return;
+    QStringList phpFiles;
+    for (const QString & file : files) {
+        // the watcher may report a batch of the previous project
+        if (!file.startsWith(project->getPath() + "/")) continue;
+        Editor * textEditor = editorTabs->findTabEditor(file);
+        if (textEditor != nullptr) textEditor->checkFile();
+        Editor * textEditorSplit = editorTabsSplit->findTabEditor(file);
+        if (textEditorSplit != nullptr) textEditorSplit->checkFile();
+        if (Project::isProjectFile(file)) phpFiles.append(file);
+    }
+    if (phpFiles.size() > 0) emit parseProjectFiles(project->getPath(), phpFiles);
+}
+
+void MainWindow::projectRescanRequested()
+{
+    if (!project->isOpen()) return;
+    // too many changes to track, watches are reset and all files are checked
+    watchedProjectPath = project->getPath();
+    emit startProjectWatcher(watchedProjectPath);
+    QStringList openTabFiles = editorTabs->getOpenTabFiles();
+    for (const QString & file : openTabFiles) {
+        Editor * textEditor = editorTabs->findTabEditor(file);
+        if (textEditor != nullptr) textEditor->checkFile();
+    }
+    emit parseProject(project->getPath());
 }
 
 void MainWindow::projectCreateRequested(QString name, QString path, bool lintEnabled, bool csEnabled)
@@ -2517,8 +2633,10 @@ void MainWindow::projectOpenRequested(QString path)
         Helper::showMessage(QObject::tr("Project not found in this directory."));
         return;
     }
-    project->save(editorTabs->getOpenTabFiles(), editorTabs->getOpenTabLines(), editorTabs->getCurrentTabIndex(), ui->todoEdit->toPlainText());
+    saveProject();
     closeAllTabsRequested();
+    watchedProjectPath = "";
+    emit stopProjectWatcher();
     if (!project->open(path)) {
         Helper::showMessage(QObject::tr("Could not open the project."));
         return;
@@ -2541,6 +2659,10 @@ void MainWindow::openTabsRequested(QStringList files, bool initHighlight)
     for (int i=0; i<files.size(); i++) {
         QString file = files.at(i);
         editorTabs->openFile(file, initHighlight);
+        if (initHighlight || !project->isOpen()) continue;
+        Editor * tabEditor = editorTabs->findTabEditor(file);
+        QString cacheFile = project->getHighlightCacheFile(file);
+        if (tabEditor != nullptr && cacheFile.size() > 0) tabEditor->loadHighlightCache(cacheFile);
     }
 }
 
@@ -2572,7 +2694,6 @@ void MainWindow::reloadWords()
     CompleteWords::reset();
     HelpWords::reset();
 
-    HighlightWords::load();
     CompleteWords::load();
     HelpWords::load();
 }
@@ -2637,22 +2758,22 @@ void MainWindow::editorShowHelp(QString name)
     }
 }
 
-void MainWindow::editorParsePHPRequested(int index, QString text)
+void MainWindow::editorParsePHPRequested(int index, Parse::TextEdits edits)
 {
     if (!parsePHPEnabled) return;
-    emit parseMixed(index, text);
+    emit parseMixedEdits(index, edits);
 }
 
-void MainWindow::editorParseJSRequested(int index, QString text)
+void MainWindow::editorParseJSRequested(int index, Parse::TextEdits edits)
 {
     if (!parseJSEnabled) return;
-    emit parseJS(index, text);
+    emit parseJSEdits(index, edits);
 }
 
-void MainWindow::editorParseCSSRequested(int index, QString text)
+void MainWindow::editorParseCSSRequested(int index, Parse::TextEdits edits)
 {
     if (!parseCSSEnabled) return;
-    emit parseCSS(index, text);
+    emit parseCSSEdits(index, edits);
 }
 
 void MainWindow::clearMessagesTabText()
@@ -54,13 +54,14 @@ bool Navigator::isFocused()
     return treeWidget->hasFocus();
 }
 
-void Navigator::build(ParsePHP::ParseResult result)
+void Navigator::build(ParsePHP::SharedParseResult result)
 {
-    clear();
+    QTreeWidgetItem root;
+    QList<QTreeWidgetItem *> expandedItems;
     int total = 0;
     // constants
-    for (int c=0; c<result.constants.size(); c++) {
-        ParsePHP::ParseResultConstant constant = result.constants.at(c);
+    for (int c=0; c<result->constants.size(); c++) {
+        const ParsePHP::ParseResultConstant & constant = result->constants.at(c);
         if (constant.clsName.size() > 0) continue;
         QString name = constant.name;
         int p = constant.name.lastIndexOf("\\");
@@ -69,13 +70,13 @@ void Navigator::build(ParsePHP::ParseResult result)
         item->setText(0, name);
         item->setToolTip(0, constant.name+" = "+constant.value);
         item->setData(0, Qt::UserRole, QVariant(constant.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
     }
     // variables
-    for (int v=0; v<result.variables.size(); v++) {
-        ParsePHP::ParseResultVariable variable = result.variables.at(v);
+    for (int v=0; v<result->variables.size(); v++) {
+        const ParsePHP::ParseResultVariable & variable = result->variables.at(v);
         if (variable.clsName.size() > 0 || variable.funcName.size() > 0) continue;
         QTreeWidgetItem * item = new QTreeWidgetItem();
         item->setText(0, variable.name);
@@ -83,13 +84,13 @@ void Navigator::build(ParsePHP::ParseResult result)
         if (variable.type.size() > 0) varDesc += " : " + variable.type;
         item->setToolTip(0, varDesc);
         item->setData(0, Qt::UserRole, QVariant(variable.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
     }
     // functions
-    for (int f=0; f<result.functions.size(); f++) {
-        ParsePHP::ParseResultFunction func = result.functions.at(f);
+    for (int f=0; f<result->functions.size(); f++) {
+        const ParsePHP::ParseResultFunction & func = result->functions.at(f);
         if (func.clsName.size() > 0) continue;
         QString name = func.name;
         int p = func.name.lastIndexOf("\\");
@@ -106,13 +107,13 @@ void Navigator::build(ParsePHP::ParseResult result)
         if (func.comment.size() > 0) funcDesc += "\n\n"+func.comment;
         item->setToolTip(0, funcDesc);
         item->setData(0, Qt::UserRole, QVariant(func.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
         // function variables
         for (int v=0; v<func.variableIndexes.size(); v++) {
-            if (result.variables.size() <= func.variableIndexes.at(v)) break;
-            ParsePHP::ParseResultVariable variable = result.variables.at(func.variableIndexes.at(v));
+            if (result->variables.size() <= func.variableIndexes.at(v)) break;
+            const ParsePHP::ParseResultVariable & variable = result->variables.at(func.variableIndexes.at(v));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             child->setText(0, variable.name);
             QString varDesc = variable.name;
@@ -125,8 +126,8 @@ void Navigator::build(ParsePHP::ParseResult result)
         }
     }
     // classes
-    for (int i=0; i<result.classes.size(); i++) {
-        ParsePHP::ParseResultClass cls = result.classes.at(i);
+    for (int i=0; i<result->classes.size(); i++) {
+        const ParsePHP::ParseResultClass & cls = result->classes.at(i);
         QString clsPrettyName = cls.name;
         int p = cls.name.lastIndexOf("\\");
         if (p >= 0) clsPrettyName = cls.name.mid(p+1);
@@ -148,13 +149,13 @@ void Navigator::build(ParsePHP::ParseResult result)
         }
         item->setToolTip(0, clsDesc);
         item->setData(0, Qt::UserRole, QVariant(cls.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
         // class constants
         for (int c=0; c<cls.constantIndexes.size(); c++) {
-            if (result.constants.size() <= cls.constantIndexes.at(c)) break;
-            ParsePHP::ParseResultConstant constant = result.constants.at(cls.constantIndexes.at(c));
+            if (result->constants.size() <= cls.constantIndexes.at(c)) break;
+            const ParsePHP::ParseResultConstant & constant = result->constants.at(cls.constantIndexes.at(c));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             child->setText(0, constant.name);
             child->setToolTip(0, clsPrettyName+"::"+constant.name+" = "+constant.value);
@@ -165,8 +166,8 @@ void Navigator::build(ParsePHP::ParseResult result)
         }
         // class variables
         for (int v=0; v<cls.variableIndexes.size(); v++) {
-            if (result.variables.size() <= cls.variableIndexes.at(v)) break;
-            ParsePHP::ParseResultVariable variable = result.variables.at(cls.variableIndexes.at(v));
+            if (result->variables.size() <= cls.variableIndexes.at(v)) break;
+            const ParsePHP::ParseResultVariable & variable = result->variables.at(cls.variableIndexes.at(v));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             child->setText(0, variable.name);
             QString varDesc = "";
@@ -182,8 +183,8 @@ void Navigator::build(ParsePHP::ParseResult result)
         }
         // class methods
         for (int f=0; f<cls.functionIndexes.size(); f++) {
-            if (result.functions.size() <= cls.functionIndexes.at(f)) break;
-            ParsePHP::ParseResultFunction func = result.functions.at(cls.functionIndexes.at(f));
+            if (result->functions.size() <= cls.functionIndexes.at(f)) break;
+            const ParsePHP::ParseResultFunction & func = result->functions.at(cls.functionIndexes.at(f));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             QString funcDesc = func.name;
             if (func.args.size() > 0) funcDesc += "("+QString(".").repeated(func.maxArgs)+")";
@@ -205,8 +206,8 @@ void Navigator::build(ParsePHP::ParseResult result)
             if (total >= LIMIT) break;
             // class method variables
             for (int v=0; v<func.variableIndexes.size(); v++) {
-                if (result.variables.size() <= func.variableIndexes.at(v)) break;
-                ParsePHP::ParseResultVariable variable = result.variables.at(func.variableIndexes.at(v));
+                if (result->variables.size() <= func.variableIndexes.at(v)) break;
+                const ParsePHP::ParseResultVariable & variable = result->variables.at(func.variableIndexes.at(v));
                 QTreeWidgetItem * subchild = new QTreeWidgetItem();
                 subchild->setText(0, variable.name);
                 QString varDesc = variable.name;
@@ -218,17 +219,17 @@ void Navigator::build(ParsePHP::ParseResult result)
                 if (total >= LIMIT) break;
             }
         }
-        treeWidget->expandItem(item);
+        expandedItems.append(item);
     }
     // comments
-    if (result.comments.size() > 0) {
+    if (result->comments.size() > 0) {
         QTreeWidgetItem * parent = new QTreeWidgetItem();
         parent->setText(0, "//"+tr("comments"));
         parent->setToolTip(0, tr("Comments"));
         parent->setData(0, Qt::UserRole, QVariant(0));
-        treeWidget->addTopLevelItem(parent);
-        for (int i=0; i<result.comments.size(); i++) {
-            ParsePHP::ParseResultComment comment = result.comments.at(i);
+        root.addChild(parent);
+        for (int i=0; i<result->comments.size(); i++) {
+            const ParsePHP::ParseResultComment & comment = result->comments.at(i);
             QTreeWidgetItem * item = new QTreeWidgetItem();
             item->setText(0, comment.name);
             item->setToolTip(0, comment.text);
@@ -237,42 +238,43 @@ void Navigator::build(ParsePHP::ParseResult result)
             total++;
             if (total >= LIMIT) break;
         }
-        //treeWidget->expandItem(parent);
+        //expandedItems.append(parent);
     }
-    treeWidget->resizeColumnToContents(0);
+    updateTree(& root, expandedItems);
 }
 
-void Navigator::build(ParseJS::ParseResult result)
+void Navigator::build(ParseJS::SharedParseResult result)
 {
-    clear();
+    QTreeWidgetItem root;
+    QList<QTreeWidgetItem *> expandedItems;
     int total = 0;
     // constants
-    for (int c=0; c<result.constants.size(); c++) {
-        ParseJS::ParseResultConstant constant = result.constants.at(c);
+    for (int c=0; c<result->constants.size(); c++) {
+        const ParseJS::ParseResultConstant & constant = result->constants.at(c);
         if (constant.clsName.size() > 0 || constant.funcName.size() > 0) continue;
         QTreeWidgetItem * item = new QTreeWidgetItem();
         item->setText(0, constant.name);
         item->setToolTip(0, constant.name+" = "+constant.value);
         item->setData(0, Qt::UserRole, QVariant(constant.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
     }
     // variables
-    for (int v=0; v<result.variables.size(); v++) {
-        ParseJS::ParseResultVariable variable = result.variables.at(v);
+    for (int v=0; v<result->variables.size(); v++) {
+        const ParseJS::ParseResultVariable & variable = result->variables.at(v);
         if (variable.clsName.size() > 0 || variable.funcName.size() > 0) continue;
         QTreeWidgetItem * item = new QTreeWidgetItem();
         item->setText(0, variable.name);
         item->setToolTip(0, variable.name);
         item->setData(0, Qt::UserRole, QVariant(variable.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
     }
     // functions
-    for (int f=0; f<result.functions.size(); f++) {
-        ParseJS::ParseResultFunction func = result.functions.at(f);
+    for (int f=0; f<result->functions.size(); f++) {
+        const ParseJS::ParseResultFunction & func = result->functions.at(f);
         if (func.clsName.size() > 0) continue;
         QTreeWidgetItem * item = new QTreeWidgetItem();
         QString funcDesc = func.name;
@@ -286,13 +288,13 @@ void Navigator::build(ParseJS::ParseResult result)
         if (func.comment.size() > 0) funcDesc += "\n\n"+func.comment;
         item->setToolTip(0, funcDesc);
         item->setData(0, Qt::UserRole, QVariant(func.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
         // function constants
         for (int c=0; c<func.constantIndexes.size(); c++) {
-            if (result.constants.size() <= func.constantIndexes.at(c)) break;
-            ParseJS::ParseResultConstant constant = result.constants.at(func.constantIndexes.at(c));
+            if (result->constants.size() <= func.constantIndexes.at(c)) break;
+            const ParseJS::ParseResultConstant & constant = result->constants.at(func.constantIndexes.at(c));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             child->setText(0, constant.name);
             child->setToolTip(0, constant.name+" = "+constant.value);
@@ -303,8 +305,8 @@ void Navigator::build(ParseJS::ParseResult result)
         }
         // function variables
         for (int v=0; v<func.variableIndexes.size(); v++) {
-            if (result.variables.size() <= func.variableIndexes.at(v)) break;
-            ParseJS::ParseResultVariable variable = result.variables.at(func.variableIndexes.at(v));
+            if (result->variables.size() <= func.variableIndexes.at(v)) break;
+            const ParseJS::ParseResultVariable & variable = result->variables.at(func.variableIndexes.at(v));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             child->setText(0, variable.name);
             child->setToolTip(0, variable.name);
@@ -315,8 +317,8 @@ void Navigator::build(ParseJS::ParseResult result)
         }
     }
     // classes
-    for (int i=0; i<result.classes.size(); i++) {
-        ParseJS::ParseResultClass cls = result.classes.at(i);
+    for (int i=0; i<result->classes.size(); i++) {
+        const ParseJS::ParseResultClass & cls = result->classes.at(i);
         QString name = cls.name;
         int p = cls.name.lastIndexOf("\\");
         if (p >= 0) name = cls.name.mid(p+1);
@@ -326,13 +328,13 @@ void Navigator::build(ParseJS::ParseResult result)
         clsDesc += cls.name;
         item->setToolTip(0, clsDesc);
         item->setData(0, Qt::UserRole, QVariant(cls.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
         // class variables
         for (int v=0; v<cls.variableIndexes.size(); v++) {
-            if (result.variables.size() <= cls.variableIndexes.at(v)) break;
-            ParseJS::ParseResultVariable variable = result.variables.at(cls.variableIndexes.at(v));
+            if (result->variables.size() <= cls.variableIndexes.at(v)) break;
+            const ParseJS::ParseResultVariable & variable = result->variables.at(cls.variableIndexes.at(v));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             child->setText(0, variable.name);
             QString varDesc = variable.name;
@@ -344,8 +346,8 @@ void Navigator::build(ParseJS::ParseResult result)
         }
         // class methods
         for (int f=0; f<cls.functionIndexes.size(); f++) {
-            if (result.functions.size() <= cls.functionIndexes.at(f)) break;
-            ParseJS::ParseResultFunction func = result.functions.at(cls.functionIndexes.at(f));
+            if (result->functions.size() <= cls.functionIndexes.at(f)) break;
+            const ParseJS::ParseResultFunction & func = result->functions.at(cls.functionIndexes.at(f));
             QTreeWidgetItem * child = new QTreeWidgetItem();
             QString funcDesc = func.name;
             if (func.args.size() > 0) funcDesc += "("+QString(".").repeated(func.maxArgs)+")";
@@ -363,8 +365,8 @@ void Navigator::build(ParseJS::ParseResult result)
             if (total >= LIMIT) break;
             // class method constants
             for (int c=0; c<func.constantIndexes.size(); c++) {
-                if (result.constants.size() <= func.constantIndexes.at(c)) break;
-                ParseJS::ParseResultConstant constant = result.constants.at(func.constantIndexes.at(c));
+                if (result->constants.size() <= func.constantIndexes.at(c)) break;
+                const ParseJS::ParseResultConstant & constant = result->constants.at(func.constantIndexes.at(c));
                 QTreeWidgetItem * subchild = new QTreeWidgetItem();
                 subchild->setText(0, constant.name);
                 subchild->setToolTip(0, constant.name+" = "+constant.value);
@@ -375,8 +377,8 @@ void Navigator::build(ParseJS::ParseResult result)
             }
             // class method variables
             for (int v=0; v<func.variableIndexes.size(); v++) {
-                if (result.variables.size() <= func.variableIndexes.at(v)) break;
-                ParseJS::ParseResultVariable variable = result.variables.at(func.variableIndexes.at(v));
+                if (result->variables.size() <= func.variableIndexes.at(v)) break;
+                const ParseJS::ParseResultVariable & variable = result->variables.at(func.variableIndexes.at(v));
                 QTreeWidgetItem * subchild = new QTreeWidgetItem();
                 subchild->setText(0, variable.name);
                 subchild->setToolTip(0, variable.name);
@@ -386,17 +388,17 @@ void Navigator::build(ParseJS::ParseResult result)
                 if (total >= LIMIT) break;
             }
         }
-        treeWidget->expandItem(item);
+        expandedItems.append(item);
     }
     // comments
-    if (result.comments.size() > 0) {
+    if (result->comments.size() > 0) {
         QTreeWidgetItem * parent = new QTreeWidgetItem();
         parent->setText(0, "//"+tr("comments"));
         parent->setToolTip(0, tr("Comments"));
         parent->setData(0, Qt::UserRole, QVariant(0));
-        treeWidget->addTopLevelItem(parent);
-        for (int i=0; i<result.comments.size(); i++) {
-            ParseJS::ParseResultComment comment = result.comments.at(i);
+        root.addChild(parent);
+        for (int i=0; i<result->comments.size(); i++) {
+            const ParseJS::ParseResultComment & comment = result->comments.at(i);
             QTreeWidgetItem * item = new QTreeWidgetItem();
             item->setText(0, comment.name);
             item->setToolTip(0, comment.text);
@@ -405,46 +407,47 @@ void Navigator::build(ParseJS::ParseResult result)
             total++;
             if (total >= LIMIT) break;
         }
-        //treeWidget->expandItem(parent);
+        //expandedItems.append(parent);
     }
-    treeWidget->resizeColumnToContents(0);
+    updateTree(& root, expandedItems);
 }
 
-void Navigator::build(ParseCSS::ParseResult result)
+void Navigator::build(ParseCSS::SharedParseResult result)
 {
-    clear();
+    QTreeWidgetItem root;
+    QList<QTreeWidgetItem *> expandedItems;
     int total = 0;
     // selectors
-    for (int i=0; i<result.selectors.size(); i++) {
-        ParseCSS::ParseResultSelector selector = result.selectors.at(i);
+    for (int i=0; i<result->selectors.size(); i++) {
+        const ParseCSS::ParseResultSelector & selector = result->selectors.at(i);
         QTreeWidgetItem * item = new QTreeWidgetItem();
         item->setText(0, selector.name);
         item->setToolTip(0, selector.name);
         item->setData(0, Qt::UserRole, QVariant(selector.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
     }
     // ids & classes
-    for (int i=0; i<result.names.size(); i++) {
-        ParseCSS::ParseResultName nm = result.names.at(i);
+    for (int i=0; i<result->names.size(); i++) {
+        const ParseCSS::ParseResultName & nm = result->names.at(i);
         QTreeWidgetItem * item = new QTreeWidgetItem();
         item->setText(0, nm.name);
         item->setToolTip(0, nm.name);
         item->setData(0, Qt::UserRole, QVariant(nm.line));
-        treeWidget->addTopLevelItem(item);
+        root.addChild(item);
         total++;
         if (total >= LIMIT) break;
     }
     // font-face
-    if (result.fonts.size() > 0) {
+    if (result->fonts.size() > 0) {
         QTreeWidgetItem * parent = new QTreeWidgetItem();
         parent->setText(0, "@font-face");
         parent->setToolTip(0, "@font-face");
         parent->setData(0, Qt::UserRole, QVariant(0));
-        treeWidget->addTopLevelItem(parent);
-        for (int i=0; i<result.fonts.size(); i++) {
-            ParseCSS::ParseResultFont font = result.fonts.at(i);
+        root.addChild(parent);
+        for (int i=0; i<result->fonts.size(); i++) {
+            const ParseCSS::ParseResultFont & font = result->fonts.at(i);
             QTreeWidgetItem * item = new QTreeWidgetItem();
             item->setText(0, font.name);
             item->setToolTip(0, "font-family: "+font.name);
@@ -453,17 +456,17 @@ void Navigator::build(ParseCSS::ParseResult result)
             total++;
             if (total >= LIMIT) break;
         }
-        treeWidget->expandItem(parent);
+        expandedItems.append(parent);
     }
     // media
-    if (result.medias.size() > 0) {
+    if (result->medias.size() > 0) {
         QTreeWidgetItem * parent = new QTreeWidgetItem();
         parent->setText(0, "@media");
         parent->setToolTip(0, "@media");
         parent->setData(0, Qt::UserRole, QVariant(0));
-        treeWidget->addTopLevelItem(parent);
-        for (int i=0; i<result.medias.size(); i++) {
-            ParseCSS::ParseResultMedia media = result.medias.at(i);
+        root.addChild(parent);
+        for (int i=0; i<result->medias.size(); i++) {
+            const ParseCSS::ParseResultMedia & media = result->medias.at(i);
             QTreeWidgetItem * item = new QTreeWidgetItem();
             item->setText(0, media.name);
             item->setToolTip(0, "@media( "+media.name+" )");
@@ -472,17 +475,17 @@ void Navigator::build(ParseCSS::ParseResult result)
             total++;
             if (total >= LIMIT) break;
         }
-        treeWidget->expandItem(parent);
+        expandedItems.append(parent);
     }
     // keyframes
-    if (result.keyframes.size() > 0) {
+    if (result->keyframes.size() > 0) {
         QTreeWidgetItem * parent = new QTreeWidgetItem();
         parent->setText(0, "@keyframes");
         parent->setToolTip(0, "@keyframes");
         parent->setData(0, Qt::UserRole, QVariant(0));
-        treeWidget->addTopLevelItem(parent);
-        for (int i=0; i<result.keyframes.size(); i++) {
-            ParseCSS::ParseResultKeyframe keyframe = result.keyframes.at(i);
+        root.addChild(parent);
+        for (int i=0; i<result->keyframes.size(); i++) {
+            const ParseCSS::ParseResultKeyframe & keyframe = result->keyframes.at(i);
             QTreeWidgetItem * item = new QTreeWidgetItem();
             item->setText(0, keyframe.name);
             item->setToolTip(0, "@keyframes "+keyframe.name);
@@ -491,17 +494,17 @@ void Navigator::build(ParseCSS::ParseResult result)
             total++;
             if (total >= LIMIT) break;
         }
-        treeWidget->expandItem(parent);
+        expandedItems.append(parent);
     }
     // comments
-    if (result.comments.size() > 0) {
+    if (result->comments.size() > 0) {
         QTreeWidgetItem * parent = new QTreeWidgetItem();
         parent->setText(0, "//"+tr("comments"));
         parent->setToolTip(0, tr("Comments"));
         parent->setData(0, Qt::UserRole, QVariant(0));
-        treeWidget->addTopLevelItem(parent);
-        for (int i=0; i<result.comments.size(); i++) {
-            ParseCSS::ParseResultComment comment = result.comments.at(i);
+        root.addChild(parent);
+        for (int i=0; i<result->comments.size(); i++) {
+            const ParseCSS::ParseResultComment & comment = result->comments.at(i);
             QTreeWidgetItem * item = new QTreeWidgetItem();
             item->setText(0, comment.name);
             item->setToolTip(0, comment.text);
@@ -510,11 +513,47 @@ void Navigator::build(ParseCSS::ParseResult result)
             total++;
             if (total >= LIMIT) break;
         }
-        //treeWidget->expandItem(parent);
+        //expandedItems.append(parent);
+    }
+    updateTree(& root, expandedItems);
+}
+
+// replaces the items of the tree with the built ones. If they differ
+// only in their lines, the current items are updated instead,
+// so that the expanded, selected and scrolled items stay.
+void Navigator::updateTree(QTreeWidgetItem * root, QList<QTreeWidgetItem *> expandedItems)
+{
+    QTreeWidgetItem * currentRoot = treeWidget->invisibleRootItem();
+    if (currentRoot->childCount() > 0 && isSameItem(currentRoot, root)) {
+        updateItemLines(currentRoot, root);
+        return;
+    }
+    clear();
+    treeWidget->addTopLevelItems(root->takeChildren());
+    for (int i=0; i<expandedItems.size(); i++) {
+        treeWidget->expandItem(expandedItems.at(i));
     }
     treeWidget->resizeColumnToContents(0);
 }
 
+bool Navigator::isSameItem(QTreeWidgetItem * item, QTreeWidgetItem * newItem)
+{
+    if (item->text(0) != newItem->text(0) || item->toolTip(0) != newItem->toolTip(0)) return false;
+    if (item->childCount() != newItem->childCount()) return false;
+    for (int i=0; i<item->childCount(); i++) {
+        if (!isSameItem(item->child(i), newItem->child(i))) return false;
+    }
+    return true;
+}
+
+void Navigator::updateItemLines(QTreeWidgetItem * item, QTreeWidgetItem * newItem)
+{
+    item->setData(0, Qt::UserRole, newItem->data(0, Qt::UserRole));
+    for (int i=0; i<item->childCount(); i++) {
+        updateItemLines(item->child(i), newItem->child(i));
+    }
+}
+
 void Navigator::navigatorDoubleClicked(QTreeWidgetItem * item, int column)
 {
     if (item == nullptr) return;
@@ -5,15 +5,13 @@
  *******************************************/
 
 #include "parse.h"
-#include "helper.h"
-#include <QVector>
+#include <algorithm>
 
-Parse::Parse()
+Parse::Parse():
+    lineIndexData(nullptr),
+    lineIndexSize(-1)
 {
-    stringDQExpression = QRegularExpression("(?:^|[^\\\\])[\"](.*?[^\\\\])[\"]", QRegularExpression::DotMatchesEverythingOption);
-    stringSQExpression = QRegularExpression("(?:^|[^\\\\])[\'](.*?[^\\\\])[\']", QRegularExpression::DotMatchesEverythingOption);
-    commentMLExpression = QRegularExpression("[/][*](.+?)[*][/]", QRegularExpression::DotMatchesEverythingOption);
-    backtickExpression = QRegularExpression("(?:^|[^\\\\])[`](.*?[^\\\\])[`]", QRegularExpression::DotMatchesEverythingOption);
+
 }
 
 Parse::~Parse()
@@ -21,50 +19,143 @@ Parse::~Parse()
 
 }
 
+// blanks escaped backslashes and empty quoted strings,
+// so that they do not break the lookup of strings and comments
 void Parse::prepare(QString & text)
 {
-    text.replace("\\\\", "  ");
-    text.replace(QRegularExpression("(^|[^\\\\])['][']"), "\\1  ");
-    text.replace(QRegularExpression("(^|[^\\\\])[\"][\"]"), "\\1  ");
-    text.replace(QRegularExpression("(^|[^\\\\])[`][`]"), "\\1  ");
+    QChar * data = text.data();
+    const int size = text.size();
+    for (int i=0; i<size-1; i++) {
+        if (data[i] != '\\' || data[i+1] != '\\') continue;
+        data[i] = ' ';
+        data[i+1] = ' ';
+        i++;
+    }
+    const ushort quotes[] = {'\'', '"', '`'};
+    for (ushort quote : quotes) {
+        int i = 0;
+        if (size >= 2 && data[0].unicode() == quote && data[1].unicode() == quote) {
+            data[0] = ' ';
+            data[1] = ' ';
+            i = 2;
+        }
+        while (i + 2 < size) {
+            if (data[i] != '\\' && data[i+1].unicode() == quote && data[i+2].unicode() == quote) {
+                data[i+1] = ' ';
+                data[i+2] = ' ';
+                i += 3;
+            } else {
+                i++;
+            }
+        }
+    }
+}
+
+// returns the position of the opening quote of the first string
+// found at or after the offset and sets the end to its closing quote.
+// A quote is escaped by a backslash before it, the opening quote can be
+// preceded only by a char inside of the searched part of the text.
+int Parse::findString(const QString & text, int offset, ushort quote, int & end) const
+{
+    const QChar * data = text.constData();
+    const int size = text.size();
+    int start = -1;
+    for (int i=offset; i<size; i++) {
+        if (data[i].unicode() != quote) continue;
+        if (i == 0 || (i > offset && data[i-1] != '\\')) {
+            start = i;
+            break;
+        }
+    }
+    if (start < 0) return -1;
+    // strings are not empty, empty ones are blanked by prepare
+    for (int i=start+2; i<size; i++) {
+        if (data[i].unicode() == quote && data[i-1] != '\\') {
+            end = i;
+            return start;
+        }
+    }
+    // an unclosed string also has no closing quote for any string after it
+    return -1;
+}
+
+// returns the position of the first multi-line comment found
+// at or after the offset and sets the end next to its closing chars
+int Parse::findCommentML(const QString & text, int offset, int & end) const
+{
+    int start = text.indexOf("/*", offset);
+    if (start < 0) return -1;
+    int close = text.indexOf("*/", start + 3);
+    if (close < 0) return -1;
+    end = close + 2;
+    return start;
+}
+
+// a new text can have the data address and the size of the previous one,
+// so the index is built again for each parsed text
+void Parse::resetLineIndex()
+{
+    lineIndexData = nullptr;
+    lineIndexSize = -1;
+}
+
+// returns the shared copy of a name used in the parse result
+QString Parse::intern(const QString & name)
+{
+    QSet<QString>::const_iterator it = resultNames.constFind(name);
+    if (it != resultNames.constEnd()) return * it;
+    resultNames.insert(name);
+    return name;
 }
 
-QString Parse::strip(QRegularExpressionMatch & match, QString & text, int group)
+// parsers only change the text by replacements of the same length that keep
+// line breaks, so the index stays valid while the data and size are the same
+void Parse::updateLineIndex(const QString & text)
 {
-    QString stripped = "";
-    if (match.capturedStart(group) >= 0) {
-        QString r = match.captured(group);
-        r.replace(QRegularExpression("[^\n]"), " ");
-        stripped = text.mid(match.capturedStart(group), match.capturedLength(group));
-        text.replace(match.capturedStart(group), match.capturedLength(group), r);
+    if (text.constData() == lineIndexData && text.size() == lineIndexSize) return;
+    lineIndexData = text.constData();
+    lineIndexSize = text.size();
+    lineOffsets.clear();
+    lineOffsets.append(0);
+    const QChar * data = text.constData();
+    for (int i=0; i<lineIndexSize; i++) {
+        if (data[i] == '\n') lineOffsets.append(i + 1);
     }
-    return stripped;
+}
+
+// returns zero-based index of the line containing the offset
+int Parse::findLineIndex(int offset) const
+{
+    return static_cast<int>(std::upper_bound(lineOffsets.constBegin(), lineOffsets.constEnd(), offset) - lineOffsets.constBegin()) - 1;
 }
 
 int Parse::getLine(QString & text, int offset)
 {
-    QString textPart = text.mid(0, offset);
-    return textPart.count("\n") + 1;
+    if (offset < 0 || offset > text.size()) offset = text.size();
+    updateLineIndex(text);
+    return findLineIndex(offset) + 1;
 }
 
 QString Parse::getLineText(QString & text, int offset)
 {
-    int preP = text.lastIndexOf("\n", offset-text.size());
-    int postP = text.indexOf("\n", offset);
-    if (postP < 0) postP = text.size();
-    return text.mid(preP + 1, postP - preP - 1);
+    if (offset < 0 || offset > text.size()) offset = text.size();
+    updateLineIndex(text);
+    int line = findLineIndex(offset);
+    int start = lineOffsets.at(line);
+    int end = line + 1 < lineOffsets.size() ? lineOffsets.at(line + 1) - 1 : text.size();
+    return text.mid(start, end - start);
 }
 
 int Parse::getFirstNotEmptyLineTo(QString & text, int offset)
 {
-    QString textPart = text.mid(0, offset);
-    int offsetPart = textPart.lastIndexOf("\n");
+    if (offset < 0 || offset > text.size()) offset = text.size();
+    int offsetPart = offset > 0 ? text.lastIndexOf('\n', offset - 1) : -1;
     int line = 0;
     while(offsetPart > 0) {
         offsetPart--;
-        QChar c = textPart[offsetPart];
+        QChar c = text[offsetPart];
         if (!c.isSpace()) {
-            line = getLine(textPart, offsetPart+1);
+            line = getLine(text, offsetPart+1);
             break;
         }
     }
@@ -104,3 +195,65 @@ int Parse::findCloseScope(QVector<int> list)
     }
     return !list.isEmpty() ? list.last() : 0;
 }
+
+// blanks the contents of the outer parentheses and braces
+QString Parse::stripScopedText(QString scopedText)
+{
+    // parenthesis
+    int pars = 0, parsStart = -1;
+    int p = scopedText.indexOf("(");
+    if (p >= 0) {
+        pars++;
+        parsStart = p;
+    }
+    while(p >= 0) {
+        int pO = scopedText.indexOf("(", p+1);
+        int pC = scopedText.indexOf(")", p+1);
+        int pM = -1;
+        if (pO >= 0 && pC >= 0) pM = std::min(pO, pC);
+        else if (pO >= 0 && pC < 0) pM = pO;
+        else if (pO < 0 && pC >= 0) pM = pC;
+        if (pM >= 0) {
+            if (pM == pO) {
+                if (pars == 0) parsStart = pM;
+                pars++;
+            }
+            if (pM == pC) pars--;
+            int start = parsStart + 1;
+            int len = pM-parsStart-1;
+            if (pars == 0 && len > 0) {
+                scopedText.replace(start, len, QString(" ").repeated(len));
+            }
+        }
+        p = pM;
+    }
+    // braces
+    int scope = 0, scopeStart = -1;
+    p = scopedText.indexOf("{");
+    if (p >= 0) {
+        scope++;
+        scopeStart = p;
+    }
+    while(p >= 0) {
+        int pO = scopedText.indexOf("{", p+1);
+        int pC = scopedText.indexOf("}", p+1);
+        int pM = -1;
+        if (pO >= 0 && pC >= 0) pM = std::min(pO, pC);
+        else if (pO >= 0 && pC < 0) pM = pO;
+        else if (pO < 0 && pC >= 0) pM = pC;
+        if (pM >= 0) {
+            if (pM == pO) {
+                if (scope == 0) scopeStart = pM;
+                scope++;
+            }
+            if (pM == pC) scope--;
+            int start = scopeStart + 1;
+            int len = pM-scopeStart-1;
+            if (scope == 0 && len > 0) {
+                scopedText.replace(start, len, QString(" ").repeated(len));
+            }
+        }
+        p = pM;
+    }
+    return scopedText.replace(QRegularExpression("[\\s]+"), " ");
+}
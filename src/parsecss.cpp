@@ -7,7 +7,7 @@
 #include "parsecss.h"
 #include <QFile>
 #include <QTextStream>
-#include "helper.h"
+#include <QObject>
 
 const int EXPECT_SELECTOR = 0;
 const int EXPECT_MEDIA = 1;
@@ -19,7 +19,6 @@ std::unordered_map<std::string, std::string> ParseCSS::mainTags = {};
 
 ParseCSS::ParseCSS()
 {
-    parseExpression = QRegularExpression("([a-zA-Z0-9_\\-]+|[\\$\\(\\)\\{\\}\\[\\]\\.,=;:!@#%^&*+/\\|<>\\?\\\\])", QRegularExpression::DotMatchesEverythingOption);
     nameExpression = QRegularExpression("^[#\\.]?[a-zA-Z_][a-zA-Z0-9_\\-#\\.: ]*$");
     colorExpression = QRegularExpression("^[#](?:[a-fA-F0-9][a-fA-F0-9][a-fA-F0-9])(?:[a-fA-F0-9][a-fA-F0-9][a-fA-F0-9])?(?:[a-fA-F0-9][a-fA-F0-9])?$");
 
@@ -37,57 +36,85 @@ ParseCSS::ParseCSS()
     }
 }
 
-QString ParseCSS::cleanUp(QString text)
+static inline bool isCSSNameChar(ushort c)
 {
-    comments.clear();
-    prepare(text);
-    // strip strings & comments
-    int offset = 0;
-    QList<int> matchesPos;
-    QRegularExpressionMatch stringDQMatch;
-    QRegularExpressionMatch stringSQMatch;
-    QRegularExpressionMatch commentMLMatch;
-    int stringDQPos = -2,
-        stringSQPos = -2,
-        commentMLPos = -2;
-    do {
-        matchesPos.clear();
-        if (stringDQPos != -1 && stringDQPos < offset) {
-            stringDQMatch = stringDQExpression.match(text, offset);
-            stringDQPos = stringDQMatch.capturedStart(1)-1;
-        }
-        if (stringDQPos >= 0) matchesPos.append(stringDQPos);
-        if (stringSQPos != -1 && stringSQPos < offset) {
-            stringSQMatch = stringSQExpression.match(text, offset);
-            stringSQPos = stringSQMatch.capturedStart(1)-1;
-        }
-        if (stringSQPos >= 0) matchesPos.append(stringSQPos);
-        if (commentMLPos != -1 && commentMLPos < offset) {
-            commentMLMatch = commentMLExpression.match(text, offset);
-            commentMLPos = commentMLMatch.capturedStart();
-        }
-        if (commentMLPos >= 0) matchesPos.append(commentMLPos);
-        if (matchesPos.size() == 0) break;
-        std::sort(matchesPos.begin(), matchesPos.end());
-        int pos = matchesPos.at(0);
-        if (stringDQPos == pos) {
-            offset = stringDQMatch.capturedStart() + stringDQMatch.capturedLength();
-            strip(stringDQMatch, text, 1);
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-';
+}
+
+static inline bool isCSSPunctuation(ushort c)
+{
+    switch (c) {
+    case '$': case '(': case ')': case '{': case '}': case '[':
+    case ']': case '.': case ',': case '=': case ';': case ':':
+    case '!': case '@': case '#': case '%': case '^': case '&':
+    case '*': case '+': case '/': case '|': case '<': case '>':
+    case '?': case '\\':
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ParseCSS::appendTokens(const QString & text, int from, int to)
+{
+    const QChar * data = text.constData();
+    int i = from;
+    while (i < to) {
+        ushort c = data[i].unicode();
+        if (isCSSNameChar(c)) {
+            int start = i;
+            while (i < to && isCSSNameChar(data[i].unicode())) i++;
+            tokens.append({start, i - start});
             continue;
         }
-        if (stringSQPos == pos) {
-            offset = stringSQMatch.capturedStart() + stringSQMatch.capturedLength();
-            strip(stringSQMatch, text, 1);
-            continue;
+        if (isCSSPunctuation(c)) tokens.append({i, 1});
+        i++;
+    }
+}
+
+// splits the code into name and punctuation tokens skipping
+// the contents of strings and comments in a single pass.
+// Comments are collected with the lines they end on.
+void ParseCSS::tokenize(QString & text)
+{
+    comments.clear();
+    tokens.clear();
+    QString code = text;
+    prepare(code);
+    int offset = 0, tokensOffset = 0;
+    // each match is kept until the offset passes it
+    int stringDQPos = -2, stringDQEnd = -1,
+        stringSQPos = -2, stringSQEnd = -1,
+        commentMLPos = -2, commentMLEnd = -1;
+    for (;;) {
+        if (stringDQPos != -1 && stringDQPos < offset) stringDQPos = findString(code, offset, '"', stringDQEnd);
+        if (stringSQPos != -1 && stringSQPos < offset) stringSQPos = findString(code, offset, '\'', stringSQEnd);
+        if (commentMLPos != -1 && commentMLPos < offset) commentMLPos = findCommentML(code, offset, commentMLEnd);
+        int pos = -1;
+        const int matchesPos[] = {stringDQPos, stringSQPos, commentMLPos};
+        for (int matchPos : matchesPos) {
+            if (matchPos >= 0 && (pos < 0 || matchPos < pos)) pos = matchPos;
         }
-        if (commentMLPos == pos) {
-            offset = commentMLMatch.capturedStart() + commentMLMatch.capturedLength();
-            QString stripped = strip(commentMLMatch, text, 0); // group 0
-            comments[getLine(text, offset)] = stripped.toStdString();
-            continue;
+        if (pos < 0) break;
+        int skipStart, skipEnd;
+        if (stringDQPos == pos) {
+            skipStart = pos + 1;
+            skipEnd = stringDQEnd;
+            offset = stringDQEnd + 1;
+        } else if (stringSQPos == pos) {
+            skipStart = pos + 1;
+            skipEnd = stringSQEnd;
+            offset = stringSQEnd + 1;
+        } else {
+            skipStart = pos;
+            skipEnd = commentMLEnd;
+            offset = commentMLEnd;
+            comments[getLine(text, offset)] = code.mid(pos, commentMLEnd - pos).toStdString();
         }
-    } while (matchesPos.size() > 0);
-    return text;
+        appendTokens(code, tokensOffset, skipStart);
+        tokensOffset = skipEnd;
+    }
+    appendTokens(code, tokensOffset, code.size());
 }
 
 bool ParseCSS::isValidName(QString name)
@@ -188,7 +215,7 @@ void ParseCSS::addError(QString text, int line, int symbol) {
     result.errors.append(error);
 }
 
-void ParseCSS::parseCode(QString & code, QString & origText)
+void ParseCSS::parseCode(QString & origText)
 {
     // parse data
     QString current_selector = "";
@@ -209,12 +236,9 @@ void ParseCSS::parseCode(QString & code, QString & origText)
     QString prevK = "", prevPrevK = "", prevPrevPrevK = "", prevPrevPrevPrevK = "", prevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevPrevPrevPrevK = "";
     int selectorStart = -1, mediaStart = -1, keyframeStart = -1, fontStart = -1;
 
-    QRegularExpressionMatchIterator mi = parseExpression.globalMatch(code);
-    while(mi.hasNext()){
-        QRegularExpressionMatch m = mi.next();
-        if (m.capturedStart(1) < 0) continue;
-        QString k = m.captured(1).trimmed();
-        if (k.size() == 0) continue;
+    for (int t=0; t<tokens.size(); t++) {
+        const Token & token = tokens.at(t);
+        QString k = origText.mid(token.start, token.length);
 
         // main tags selectors
         if (expect < 0 && scope == 0 && expect != EXPECT_SELECTOR && k.size() > 1 && (prevK.size() == 0 || prevK == "}") && current_selector.size() == 0) {
@@ -222,10 +246,10 @@ void ParseCSS::parseCode(QString & code, QString & origText)
             if (mainTagsIterator != mainTags.end()) {
                 expect = EXPECT_SELECTOR;
                 expectName = k;
-                selectorStart = m.capturedStart(1);
+                selectorStart = token.start;
                 current_selector = "";
             }
-        } else if (expect == EXPECT_SELECTOR && expectName.size() > 0 && prevK == expectName && (k == "#" || k == ".") && m.capturedStart(1) == selectorStart+expectName.size()) {
+        } else if (expect == EXPECT_SELECTOR && expectName.size() > 0 && prevK == expectName && (k == "#" || k == ".") && token.start == selectorStart+expectName.size()) {
             expectName += k;
         } else if (expect == EXPECT_SELECTOR && expectName.size() > 0 && prevPrevK + prevK == expectName && (prevK == "#" || prevK == ".") && k != "," && k != "{") {
             expectName += k;
@@ -241,7 +265,7 @@ void ParseCSS::parseCode(QString & code, QString & origText)
 
         // ids & classes
         if ((prevK == "#" || prevK == ".") && k.size() > 0 && pars == 0) {
-            int line = getLine(origText, m.capturedStart(1));
+            int line = getLine(origText, token.start);
             QString name = prevK + k;
             addName(name, line);
         }
@@ -250,13 +274,13 @@ void ParseCSS::parseCode(QString & code, QString & origText)
         if (expect < 0 && scope == 0 && expect != EXPECT_MEDIA && k.toLower() == "media" && prevK == "@" && current_media.size() == 0) {
             expect = EXPECT_MEDIA;
             expectName = "";
-            mediaStart = m.capturedStart(1);
+            mediaStart = token.start;
             mediaArgPars = -1;
             mediaArgsStart = -1;
             current_media = "";
         } else if (expect == EXPECT_MEDIA && expectName.size() == 0 && k == "(") {
             mediaArgPars = pars;
-            mediaArgsStart = m.capturedStart(1);
+            mediaArgsStart = token.start;
         } else if (expect == EXPECT_MEDIA && expectName.size() > 0 && k == "{" && mediaArgPars < 0) {
             current_media = expectName;
             int line = 0;
@@ -273,7 +297,7 @@ void ParseCSS::parseCode(QString & code, QString & origText)
         if (expect < 0 && scope == 0 && expect != EXPECT_KEYFRAMES && prevK.toLower() == "keyframes" && prevPrevK == "@" && k.size() > 0 && current_keyframe.size() == 0) {
             expect = EXPECT_KEYFRAMES;
             expectName = k;
-            keyframeStart = m.capturedStart(1);
+            keyframeStart = token.start;
             current_keyframe = "";
         } else if (expect == EXPECT_KEYFRAMES && expectName.size() > 0 && k == "{" && mediaArgPars < 0) {
             current_keyframe = expectName;
@@ -289,15 +313,15 @@ void ParseCSS::parseCode(QString & code, QString & origText)
         if (expect < 0 && scope == 0 && expect != EXPECT_FONT_FACE && prevK.toLower() == "font-face" && prevPrevK == "@" && k == "{" && current_font.size() == 0) {
             expect = EXPECT_FONT_FACE;
             expectName = "";
-            fontStart = m.capturedStart(1);
+            fontStart = token.start;
             fontScope = scope;
             fontFamilyStart = -1;
             current_font = "";
         } else if (expect != EXPECT_FONT_FACE && current_font.size() == 0 && fontScope >= 0 && fontFamilyStart < 0 && prevK.toLower() == "font-family" && k == ":") {
             expect = EXPECT_FONT_FAMILY;
-            fontFamilyStart = m.capturedStart(1);
+            fontFamilyStart = token.start;
         } else if (expect == EXPECT_FONT_FAMILY && current_font.size() == 0 && k == ";" && fontFamilyStart >= 0 &&  mediaArgPars < 0) {
-            current_font = origText.mid(fontFamilyStart+1, m.capturedStart(1)-fontFamilyStart-1).trimmed().replace("\"","").replace("'","").replace(QRegularExpression("[\\s]+"), " ");
+            current_font = origText.mid(fontFamilyStart+1, token.start-fontFamilyStart-1).trimmed().replace("\"","").replace("'","").replace(QRegularExpression("[\\s]+"), " ");
             int line = 0;
             if (fontStart >= 0) line = getLine(origText, fontStart);
             addFont(current_font, line);
@@ -313,13 +337,13 @@ void ParseCSS::parseCode(QString & code, QString & origText)
         if (k == "{") {
             scope++;
             curlyBrackets++;
-            curlyBracketsList.append(m.capturedStart(1)+1);
+            curlyBracketsList.append(token.start+1);
         }
         if (k == "}") {
             scope--;
             if (scope < 0) scope = 0;
             curlyBrackets--;
-            curlyBracketsList.append(-1 * (m.capturedStart(1)+1));
+            curlyBracketsList.append(-1 * (token.start+1));
             // selector close
             if (current_selector.size() > 0 && selectorScope >= 0 && selectorScope == scope) {
                 current_selector = "";
@@ -345,16 +369,16 @@ void ParseCSS::parseCode(QString & code, QString & origText)
         if (k == "(") {
             pars++;
             roundBrackets++;
-            roundBracketsList.append(m.capturedStart(1)+1);
+            roundBracketsList.append(token.start+1);
         }
         if (k == ")") {
             pars--;
             if (pars < 0) pars = 0;
             roundBrackets--;
-            roundBracketsList.append(-1 * (m.capturedStart(1)+1));
+            roundBracketsList.append(-1 * (token.start+1));
             // media args
             if (mediaArgPars >= 0 && mediaArgPars == pars && mediaArgsStart >= 0 && expectName.size() == 0) {
-                expectName = origText.mid(mediaArgsStart+1, m.capturedStart(1)-mediaArgsStart-1).trimmed().replace(QRegularExpression("[\\s]+"), " ");
+                expectName = origText.mid(mediaArgsStart+1, token.start-mediaArgsStart-1).trimmed().replace(QRegularExpression("[\\s]+"), " ");
                 mediaArgPars = -1;
                 mediaArgsStart = -1;
             }
@@ -362,11 +386,11 @@ void ParseCSS::parseCode(QString & code, QString & origText)
         // brackets
         if (k == "[") {
             squareBrackets++;
-            squareBracketsList.append(m.capturedStart(1)+1);
+            squareBracketsList.append(token.start+1);
         }
         if (k == "]") {
             squareBrackets--;
-            squareBracketsList.append(-1 * (m.capturedStart(1)+1));
+            squareBracketsList.append(-1 * (token.start+1));
         }
         prevPrevPrevPrevPrevPrevPrevPrevPrevK = prevPrevPrevPrevPrevPrevPrevPrevK;
         prevPrevPrevPrevPrevPrevPrevPrevK = prevPrevPrevPrevPrevPrevPrevK;
@@ -422,16 +446,17 @@ void ParseCSS::reset()
     comments.clear();
 }
 
-ParseCSS::ParseResult ParseCSS::parse(QString text)
+ParseCSS::SharedParseResult ParseCSS::parse(QString text)
 {
+    resetLineIndex();
     result = ParseResult();
     reset();
-    QString cleanText = cleanUp(text);
-    parseCode(cleanText, text);
+    tokenize(text);
+    parseCode(text);
     // comments
     std::map<int, std::string> orderedComments(comments.begin(), comments.end());
     for (auto & commentsIterator : orderedComments) {
         addComment(QString::fromStdString(commentsIterator.second), commentsIterator.first);
     }
-    return result;
+    return SharedParseResult(new ParseResult(std::move(result)));
 }
@@ -6,7 +6,7 @@
 
 #include "parsejs.h"
 #include <QVector>
-#include "helper.h"
+#include <QObject>
 
 const int EXPECT_FUNCTION = 0;
 const int EXPECT_VARIABLE = 1;
@@ -17,100 +17,165 @@ const int EXPECT_CLASS_ES6_EXTENDED = 5;
 
 ParseJS::ParseJS()
 {
-    commentSLExpression = QRegularExpression("[/][/]([^\n]+?)(?:[\n]|$)", QRegularExpression::DotMatchesEverythingOption);
-    regexpExpression = QRegularExpression("(?:[^\\sa-zA-Z0-9_\\$\\)\\]<\\*\\~\\\\][\\s]*)[/](.*?[^\\\\])[/]", QRegularExpression::DotMatchesEverythingOption);
-    parseExpression = QRegularExpression("([a-zA-Z0-9_\\$]+|[\\(\\)\\{\\}\\[\\]\\.,=;:!@#%^&*\\-+/\\|<>\\?\\\\])", QRegularExpression::DotMatchesEverythingOption);
     nameExpression = QRegularExpression("^[a-zA-Z_\\$][a-zA-Z0-9_\\$]*$");
 }
 
-QString ParseJS::cleanUp(QString text)
+static inline bool isJSNameChar(ushort c)
 {
-    comments.clear();
-    prepare(text);
-    // strip strings & comments
-    int offset = 0;
-    QList<int> matchesPos;
-    QRegularExpressionMatch stringDQMatch;
-    QRegularExpressionMatch stringSQMatch;
-    QRegularExpressionMatch commentMLMatch;
-    QRegularExpressionMatch commentSLMatch;
-    QRegularExpressionMatch regexpMatch;
-    QRegularExpressionMatch backtickMatch;
-    int stringDQPos = -2,
-        stringSQPos = -2,
-        commentMLPos = -2,
-        commentSLPos = -2,
-        regexpPos = -2,
-        backtickPos = -2;
-    do {
-        matchesPos.clear();
-        if (stringDQPos != -1 && stringDQPos < offset) {
-            stringDQMatch = stringDQExpression.match(text, offset);
-            stringDQPos = stringDQMatch.capturedStart(1)-1;
-        }
-        if (stringDQPos >= 0) matchesPos.append(stringDQPos);
-        if (stringSQPos != -1 && stringSQPos < offset) {
-            stringSQMatch = stringSQExpression.match(text, offset);
-            stringSQPos = stringSQMatch.capturedStart(1)-1;
-        }
-        if (stringSQPos >= 0) matchesPos.append(stringSQPos);
-        if (commentMLPos != -1 && commentMLPos < offset) {
-            commentMLMatch = commentMLExpression.match(text, offset);
-            commentMLPos = commentMLMatch.capturedStart();
-        }
-        if (commentMLPos >= 0) matchesPos.append(commentMLPos);
-        if (commentSLPos != -1 && commentSLPos < offset) {
-            commentSLMatch = commentSLExpression.match(text, offset);
-            commentSLPos = commentSLMatch.capturedStart();
-        }
-        if (commentSLPos >= 0) matchesPos.append(commentSLPos);
-        if (regexpPos != -1 && regexpPos < offset) {
-            regexpMatch = regexpExpression.match(text, offset);
-            regexpPos = regexpMatch.capturedStart(1)-1;
-        }
-        if (regexpPos >= 0) matchesPos.append(regexpPos);
-        if (backtickPos != -1 && backtickPos < offset) {
-            backtickMatch = backtickExpression.match(text, offset);
-            backtickPos = backtickMatch.capturedStart(1)-1;
-        }
-        if (backtickPos >= 0) matchesPos.append(backtickPos);
-        if (matchesPos.size() == 0) break;
-        std::sort(matchesPos.begin(), matchesPos.end());
-        int pos = matchesPos.at(0);
-        if (stringDQPos == pos) {
-            offset = stringDQMatch.capturedStart() + stringDQMatch.capturedLength();
-            strip(stringDQMatch, text, 1);
-            continue;
-        }
-        if (stringSQPos == pos) {
-            offset = stringSQMatch.capturedStart() + stringSQMatch.capturedLength();
-            strip(stringSQMatch, text, 1);
-            continue;
-        }
-        if (commentMLPos == pos) {
-            offset = commentMLMatch.capturedStart() + commentMLMatch.capturedLength();
-            QString stripped = strip(commentMLMatch, text, 0); // group 0
-            comments[getLine(text, offset)] = stripped.toStdString();
-            continue;
-        }
-        if (commentSLPos == pos) {
-            offset = commentSLMatch.capturedStart(1) + commentSLMatch.capturedLength(1);
-            QString stripped = strip(commentSLMatch, text, 0); // group 0
-            comments[getLine(text, offset)] = stripped.toStdString();
-            continue;
-        }
-        if (regexpPos == pos) {
-            offset = regexpMatch.capturedStart(1) + regexpMatch.capturedLength(1);
-            strip(regexpMatch, text, 1);
-            continue;
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+}
+
+static inline bool isJSPunctuation(ushort c)
+{
+    switch (c) {
+    case '(': case ')': case '{': case '}': case '[': case ']':
+    case '.': case ',': case '=': case ';': case ':': case '!':
+    case '@': case '#': case '%': case '^': case '&': case '*':
+    case '-': case '+': case '/': case '|': case '<': case '>':
+    case '?': case '\\':
+        return true;
+    default:
+        return false;
+    }
+}
+
+static inline bool isJSSpace(ushort c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+// chars that cannot be followed by a regular expression literal
+static inline bool isJSRegexpExcludedPrefix(ushort c)
+{
+    return isJSSpace(c) || isJSNameChar(c) || c == ')' || c == ']' || c == '<' || c == '*' || c == '~' || c == '\\';
+}
+
+// returns the position of the first single-line comment found
+// at or after the offset and sets the end to the end of its line
+int ParseJS::findCommentSL(const QString & text, int offset, int & end) const
+{
+    const QChar * data = text.constData();
+    const int size = text.size();
+    int start = text.indexOf("//", offset);
+    while (start >= 0) {
+        // comments with no text are skipped
+        if (start + 2 < size && data[start+2] != '\n') {
+            end = text.indexOf('\n', start + 2);
+            if (end < 0) end = size;
+            return start;
+        }
+        start = text.indexOf("//", start + 1);
+    }
+    return -1;
+}
+
+// returns the position of the opening slash of the first regular expression
+// literal found at or after the offset and sets the end to its closing slash.
+// The literal should follow a char that cannot end an operand.
+int ParseJS::findRegexp(const QString & text, int offset, int & end) const
+{
+    const QChar * data = text.constData();
+    const int size = text.size();
+    for (int i=offset; i<size; i++) {
+        if (isJSRegexpExcludedPrefix(data[i].unicode())) continue;
+        int start = i + 1;
+        while (start < size && isJSSpace(data[start].unicode())) start++;
+        if (start >= size || data[start] != '/') continue;
+        for (int k=start+2; k<size; k++) {
+            if (data[k] == '/' && data[k-1] != '\\') {
+                end = k;
+                return start;
+            }
         }
-        if (backtickPos == pos) {
-            offset = backtickMatch.capturedStart() + backtickMatch.capturedLength();
-            strip(backtickMatch, text, 1);
+        // no closing slash for this or any later literal
+        return -1;
+    }
+    return -1;
+}
+
+void ParseJS::appendTokens(const QString & text, int from, int to)
+{
+    const QChar * data = text.constData();
+    int i = from;
+    while (i < to) {
+        ushort c = data[i].unicode();
+        if (isJSNameChar(c)) {
+            int start = i;
+            while (i < to && isJSNameChar(data[i].unicode())) i++;
+            tokens.append({start, i - start});
             continue;
         }
-    } while (matchesPos.size() > 0);
-    return text;
+        if (isJSPunctuation(c)) tokens.append({i, 1});
+        i++;
+    }
+}
+
+// splits the code into name and punctuation tokens skipping the contents
+// of strings, comments and regular expressions in a single pass.
+// Comments are collected with the lines they end on.
+void ParseJS::tokenize(QString & text)
+{
+    comments.clear();
+    tokens.clear();
+    QString code = text;
+    prepare(code);
+    const int size = code.size();
+    int offset = 0, tokensOffset = 0;
+    // each match is kept until the offset passes it
+    int stringDQPos = -2, stringDQEnd = -1,
+        stringSQPos = -2, stringSQEnd = -1,
+        commentMLPos = -2, commentMLEnd = -1,
+        commentSLPos = -2, commentSLEnd = -1,
+        regexpPos = -2, regexpEnd = -1,
+        backtickPos = -2, backtickEnd = -1;
+    for (;;) {
+        if (stringDQPos != -1 && stringDQPos < offset) stringDQPos = findString(code, offset, '"', stringDQEnd);
+        if (stringSQPos != -1 && stringSQPos < offset) stringSQPos = findString(code, offset, '\'', stringSQEnd);
+        if (commentMLPos != -1 && commentMLPos < offset) commentMLPos = findCommentML(code, offset, commentMLEnd);
+        if (commentSLPos != -1 && commentSLPos < offset) commentSLPos = findCommentSL(code, offset, commentSLEnd);
+        if (regexpPos != -1 && regexpPos < offset) regexpPos = findRegexp(code, offset, regexpEnd);
+        if (backtickPos != -1 && backtickPos < offset) backtickPos = findString(code, offset, '`', backtickEnd);
+        int pos = -1;
+        const int matchesPos[] = {stringDQPos, stringSQPos, commentMLPos, commentSLPos, regexpPos, backtickPos};
+        for (int matchPos : matchesPos) {
+            if (matchPos >= 0 && (pos < 0 || matchPos < pos)) pos = matchPos;
+        }
+        if (pos < 0) break;
+        int skipStart, skipEnd;
+        if (stringDQPos == pos) {
+            skipStart = pos + 1;
+            skipEnd = stringDQEnd;
+            offset = stringDQEnd + 1;
+        } else if (stringSQPos == pos) {
+            skipStart = pos + 1;
+            skipEnd = stringSQEnd;
+            offset = stringSQEnd + 1;
+        } else if (commentMLPos == pos) {
+            skipStart = pos;
+            skipEnd = commentMLEnd;
+            offset = commentMLEnd;
+            comments[getLine(text, offset)] = code.mid(pos, commentMLEnd - pos).toStdString();
+        } else if (commentSLPos == pos) {
+            skipStart = pos;
+            skipEnd = commentSLEnd;
+            offset = commentSLEnd;
+            // the line break is kept with the comment
+            int commentLength = commentSLEnd - pos + (commentSLEnd < size ? 1 : 0);
+            comments[getLine(text, offset)] = code.mid(pos, commentLength).toStdString();
+        } else if (regexpPos == pos) {
+            // closing slash can precede the next literal
+            skipStart = pos + 1;
+            skipEnd = regexpEnd;
+            offset = regexpEnd;
+        } else {
+            skipStart = pos + 1;
+            skipEnd = backtickEnd;
+            offset = backtickEnd + 1;
+        }
+        appendTokens(code, tokensOffset, skipStart);
+        tokensOffset = skipEnd;
+    }
+    appendTokens(code, tokensOffset, size);
 }
 
 bool ParseJS::isValidName(QString name)
@@ -132,12 +197,12 @@ void ParseJS::addFunction(QString clsName, QString name, QString args, int minAr
     if (!isValidName(name)) return;
     ParseResultFunction func;
     func.name = name;
-    func.clsName = clsName;
+    func.clsName = intern(clsName);
     func.args = args;
     func.minArgs = minArgs;
     func.maxArgs = maxArgs;
     func.isGlobal = isGlobal;
-    func.returnType = returnType;
+    func.returnType = intern(returnType);
     func.comment = comment;
     func.line = line;
     result.functions.append(func);
@@ -162,7 +227,7 @@ void ParseJS::updateFunctionReturnType(QString clsName, QString funcName, QStrin
         int i = functionIndexesIterator->second;
         if (result.functions.size() > i) {
             ParseResultFunction func = result.functions.at(i);
-            func.returnType = returnType;
+            func.returnType = intern(returnType);
             result.functions.replace(i, func);
         }
     }
@@ -175,9 +240,9 @@ void ParseJS::addVariable(QString clsName, QString funcName, QString name, QStri
     if (variableIndexesIterator != variableIndexes.end()) return;
     ParseResultVariable variable;
     variable.name = name;
-    variable.clsName = clsName;
-    variable.funcName = funcName;
-    variable.type = type;
+    variable.clsName = intern(clsName);
+    variable.funcName = intern(funcName);
+    variable.type = intern(type);
     variable.line = line;
     result.variables.append(variable);
     variableIndexes[clsName.toStdString() + "::" + funcName.toStdString() + "::" + name.toStdString()] = result.variables.size() - 1;
@@ -211,7 +276,7 @@ void ParseJS::updateVariableType(QString clsName, QString funcName, QString varN
         int i = variableIndexesIterator->second;
         if (result.variables.size() > i) {
             ParseResultVariable variable = result.variables.at(i);
-            variable.type = type;
+            variable.type = intern(type);
             result.variables.replace(i, variable);
         }
     }
@@ -222,8 +287,8 @@ void ParseJS::addConstant(QString clsName, QString funcName, QString name, QStri
     if (!isValidName(name)) return;
     ParseResultConstant constant;
     constant.name = name;
-    constant.clsName = clsName;
-    constant.funcName = funcName;
+    constant.clsName = intern(clsName);
+    constant.funcName = intern(funcName);
     constant.value = value;
     constant.line = line;
     result.constants.append(constant);
@@ -273,7 +338,7 @@ void ParseJS::addError(QString text, int line, int symbol) {
     result.errors.append(error);
 }
 
-void ParseJS::parseCode(QString & code, QString & origText)
+void ParseJS::parseCode(QString & origText)
 {
     // parse data
     QString current_class = "";
@@ -307,12 +372,9 @@ void ParseJS::parseCode(QString & code, QString & origText)
     QString class_variable = "";
     QString expected_class_es6_name = "";
 
-    QRegularExpressionMatchIterator mi = parseExpression.globalMatch(code);
-    while(mi.hasNext()){
-        QRegularExpressionMatch m = mi.next();
-        if (m.capturedStart(1) < 0) continue;
-        QString k = m.captured(1).trimmed();
-        if (k.size() == 0) continue;
+    for (int t=0; t<tokens.size(); t++) {
+        const Token & token = tokens.at(t);
+        QString k = origText.mid(token.start, token.length);
 
         // classes ES6
         if ((prevPrevK.size() == 0 || prevPrevK == ";" || prevPrevK == "{" || prevPrevK == "}" || prevPrevK == "var" || prevPrevK == "let" || prevPrevK == "const" || prevPrevK == "final") && prevK.size() > 0 && k == "=" && functionArgsStart < 0 && ((prevPrevK != "var" && prevPrevK != "let" && prevPrevK != "const" && prevPrevK != "final") || (current_function.size() == 0 && scope == 0) || (functionScope >= 0 && functionScope == scope - 1))) {
@@ -322,7 +384,7 @@ void ParseJS::parseCode(QString & code, QString & origText)
             expect = EXPECT_CLASS_ES6;
             expectName = "";
             current_class_es6_parent = "";
-            classES6Start =  m.capturedStart(1);
+            classES6Start =  token.start;
             classES6ParsFound = false;
         } else if (expect == EXPECT_CLASS_ES6 && expectName.size() == 0 && k != "{" && !classES6ParsFound) {
             if (k != "(" && k != ")" && k != "{" && k != "extends" && current_class_es6.size() == 0) {
@@ -379,7 +441,7 @@ void ParseJS::parseCode(QString & code, QString & origText)
             functionArgPars = -1;
             functionArgsStart = -1;
             functionParsFound = false;
-            functionStart = m.capturedStart(1);
+            functionStart = token.start;
             expectName = k;
         } else if ((expect < 0 || expect == EXPECT_VARIABLE) && current_function.size() == 0 && k == "function" && functionArgsStart < 0) {
             expect = EXPECT_FUNCTION;
@@ -392,12 +454,12 @@ void ParseJS::parseCode(QString & code, QString & origText)
             functionArgPars = -1;
             functionArgsStart = -1;
             functionParsFound = false;
-            functionStart = m.capturedStart(1);
+            functionStart = token.start;
         } else if (expect == EXPECT_FUNCTION && expectName.size() == 0 && k != "(" && k != ")" && k != "{" && functionArgsStart < 0 && current_function_args.size() == 0 && !functionParsFound) {
             expectName = k;
         } else if (expect == EXPECT_FUNCTION && functionArgPars < 0 && k == "(") {
             functionArgPars = pars;
-            functionArgsStart = m.capturedStart(1);
+            functionArgsStart = token.start;
             functionParsFound = true;
         } else if (expect == EXPECT_FUNCTION && (expectName.size() > 0 || expected_function_name.size() > 0) && k == "{" && functionArgsStart < 0) {
             current_function = expectName.size() > 0 ? expectName : expected_function_name;
@@ -518,7 +580,7 @@ void ParseJS::parseCode(QString & code, QString & origText)
             current_variable = "";
             current_variable_type = "";
             class_variable = "";
-            variableStart = m.capturedStart(1);
+            variableStart = token.start;
         } else if (expect == EXPECT_VARIABLE && expectName.size() > 0 && current_variable.size() == 0 && prevK == "=" && k.size() > 0 && (k != "function" || current_function.size() > 0) && (k != "class" || current_function.size() > 0)) {
             current_variable = expectName;
             int line = 0;
@@ -530,13 +592,13 @@ void ParseJS::parseCode(QString & code, QString & origText)
             class_variable = "";
         } else if (functionScope >= 0 && functionScope == scope - 1 && functionArgPars < 0 && current_function.size() > 0 && prevK == "function" && k.size() > 0 && k != "(" && k != ")" && k != "{") {
             QString cls = current_class_es6.size() > 0 ? current_class_es6 : current_class;
-            addVariable(cls, current_function, k, "", getLine(origText, m.capturedStart(1)));
+            addVariable(cls, current_function, k, "", getLine(origText, token.start));
         } else if (functionScope >= 0 && functionScope == scope - 1 && functionArgPars < 0 && current_function.size() > 0 && prevK == "class" && k.size() > 0 && k != "(" && k != ")" && k != "{") {
             QString cls = current_class_es6.size() > 0 ? current_class_es6 : current_class;
-            addVariable(cls, current_function, k, "", getLine(origText, m.capturedStart(1)));
+            addVariable(cls, current_function, k, "", getLine(origText, token.start));
         } else if (scope == 0 && (prevPrevPrevK.size() == 0 || prevPrevPrevK == ";" || prevPrevPrevK == "{" || prevPrevPrevK == "}") && prevPrevK.size() > 0 && prevK == "=" && k.size() > 0 && k != "function" && k != "class") {
             current_variable = prevPrevK;
-            int line = getLine(origText, m.capturedStart(1));
+            int line = getLine(origText, token.start);
             addVariable("", "", current_variable, "", line);
             expect = -1;
             expectName = "";
@@ -561,7 +623,7 @@ void ParseJS::parseCode(QString & code, QString & origText)
                 class_variable = prevK;
                 current_variable = "";
                 current_variable_type = "";
-                addVariable(current_function, "", class_variable, "", getLine(origText, m.capturedStart(1)));
+                addVariable(current_function, "", class_variable, "", getLine(origText, token.start));
             }
         } else if (class_variable.size() == 0 && functionArgPars < 0 && k == "=" && prevK.size() > 0 && prevPrevK == "." && prevPrevPrevK == "this" && current_class_es6.size() > 0 && current_function.size() > 0 && current_function == "constructor" && functionArgsStart < 0 && functionScope == scope - 1) {
             variableIndexesIterator = variableIndexes.find(current_class_es6.toStdString() + "::" + "::" + prevK.toStdString());
@@ -569,7 +631,7 @@ void ParseJS::parseCode(QString & code, QString & origText)
                 class_variable = prevK;
                 current_variable = "";
                 current_variable_type = "";
-                addVariable(current_class_es6, "", class_variable, "", getLine(origText, m.capturedStart(1)));
+                addVariable(current_class_es6, "", class_variable, "", getLine(origText, token.start));
             }
         }
 
@@ -590,13 +652,13 @@ void ParseJS::parseCode(QString & code, QString & origText)
             current_constant = "";
             current_constant_value = "";
             constantValueStart = -1;
-            constantStart = m.capturedStart(1);
+            constantStart = token.start;
         } else if (expect == EXPECT_CONST && expectName.size() > 0 && k == "=") {
             expect = EXPECT_CONST_VALUE;
-            constantValueStart = m.capturedStart(1) + 1;
+            constantValueStart = token.start + 1;
         } else if (expect == EXPECT_CONST_VALUE && expectName.size() > 0 && k == ";") {
             current_constant = expectName;
-            current_constant_value = origText.mid(constantValueStart, m.capturedStart(1)-constantValueStart).trimmed();
+            current_constant_value = origText.mid(constantValueStart, token.start-constantValueStart).trimmed();
             int line = 0;
             if (constantStart >= 0) line = getLine(origText, constantStart);
             addConstant(current_class, current_function, current_constant, current_constant_value, line);
@@ -622,13 +684,13 @@ void ParseJS::parseCode(QString & code, QString & origText)
         if (k == "{") {
             scope++;
             curlyBrackets++;
-            curlyBracketsList.append(m.capturedStart(1)+1);
+            curlyBracketsList.append(token.start+1);
         }
         if (k == "}") {
             scope--;
             if (scope < 0) scope = 0;
             curlyBrackets--;
-            curlyBracketsList.append(-1 * (m.capturedStart(1)+1));
+            curlyBracketsList.append(-1 * (token.start+1));
             // class ES6 close
             if (current_class_es6.size() > 0 && classES6Scope >= 0 && classES6Scope == scope) {
                 current_class_es6 = "";
@@ -661,17 +723,17 @@ void ParseJS::parseCode(QString & code, QString & origText)
         if (k == "(") {
             pars++;
             roundBrackets++;
-            roundBracketsList.append(m.capturedStart(1)+1);
+            roundBracketsList.append(token.start+1);
         }
         if (k == ")") {
             pars--;
             if (pars < 0) pars = 0;
             roundBrackets--;
-            roundBracketsList.append(-1 * (m.capturedStart(1)+1));
+            roundBracketsList.append(-1 * (token.start+1));
             // function args
             if (functionArgPars >= 0 && functionArgPars == pars && functionArgsStart >= 0) {
-                current_function_args = origText.mid(functionArgsStart+1, m.capturedStart(1)-functionArgsStart-1).trimmed();
-                current_function_args = Helper::stripScopedText(current_function_args);
+                current_function_args = origText.mid(functionArgsStart+1, token.start-functionArgsStart-1).trimmed();
+                current_function_args = stripScopedText(current_function_args);
                 if (current_function_args.size() > 0) {
                     QString current_function_args_cleaned = "";
                     QStringList argsList, argsDefaultsList;
@@ -712,11 +774,11 @@ void ParseJS::parseCode(QString & code, QString & origText)
         // brackets
         if (k == "[") {
             squareBrackets++;
-            squareBracketsList.append(m.capturedStart(1)+1);
+            squareBracketsList.append(token.start+1);
         }
         if (k == "]") {
             squareBrackets--;
-            squareBracketsList.append(-1 * (m.capturedStart(1)+1));
+            squareBracketsList.append(-1 * (token.start+1));
         }
         prevPrevPrevPrevPrevPrevPrevPrevPrevK = prevPrevPrevPrevPrevPrevPrevPrevK;
         prevPrevPrevPrevPrevPrevPrevPrevK = prevPrevPrevPrevPrevPrevPrevK;
@@ -772,16 +834,18 @@ void ParseJS::reset()
     comments.clear();
 }
 
-ParseJS::ParseResult ParseJS::parse(QString text)
+ParseJS::SharedParseResult ParseJS::parse(QString text)
 {
+    resetLineIndex();
     result = ParseResult();
+    resultNames.clear();
     reset();
-    QString cleanText = cleanUp(text);
-    parseCode(cleanText, text);
+    tokenize(text);
+    parseCode(text);
     // comments
     std::map<int, std::string> orderedComments(comments.begin(), comments.end());
     for (auto & commentsIterator : orderedComments) {
         addComment(QString::fromStdString(commentsIterator.second), commentsIterator.first);
     }
-    return result;
+    return SharedParseResult(new ParseResult(std::move(result)));
 }
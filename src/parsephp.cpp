@@ -8,7 +8,9 @@
 #include <QVector>
 #include <QFile>
 #include <QTextStream>
-#include "helper.h"
+#include <QObject>
+#include <cstring>
+#include <algorithm>
 
 const int EXPECT_NAMESPACE = 0;
 const int EXPECT_CLASS = 1;
@@ -33,17 +35,12 @@ const QString IMPORT_TYPE_CONSTANT = "constant";
 
 std::unordered_map<std::string, std::string> ParsePHP::dataTypes = {};
 
-ParsePHP::ParsePHP()
+ParsePHP::ParsePHP():
+    noClosingDQFrom(-1),
+    noClosingSQFrom(-1),
+    noClosingBacktickFrom(-1),
+    classScopeChanged(false)
 {
-    phpExpression = QRegularExpression("[<][?](?:php)?[\\s](.+?)([?][>]|$)", QRegularExpression::DotMatchesEverythingOption);
-    phpStartExpression = QRegularExpression("[<][?](php)?[\\s]", QRegularExpression::DotMatchesEverythingOption);
-    phpEndExpression = QRegularExpression("[?][>]", QRegularExpression::DotMatchesEverythingOption);
-    stringHeredocExpression = QRegularExpression("[<][<][<]([_a-zA-Z][_a-zA-Z0-9]*)[\n](.+?)[\n](\\1)[;]([\n]|$)", QRegularExpression::DotMatchesEverythingOption);
-    stringHeredocDQExpression = QRegularExpression("[<][<][<][\"]([_a-zA-Z][_a-zA-Z0-9]*)[\"][\n](.+?)[\n](\\1)[;]([\n]|$)", QRegularExpression::DotMatchesEverythingOption);
-    stringNowdocExpression = QRegularExpression("[<][<][<][']([_a-zA-Z][_a-zA-Z0-9]*)['][\n](.+?)[\n](\\1)[;]([\n]|$)", QRegularExpression::DotMatchesEverythingOption);
-    commentSLExpression = QRegularExpression("[/][/]([^\n]+?)([?][>]|[\n]|$)", QRegularExpression::DotMatchesEverythingOption);
-    commentSLAExpression = QRegularExpression("[#]([^\n]+?)([?][>]|[\n]|$)", QRegularExpression::DotMatchesEverythingOption);
-    parseExpression = QRegularExpression("([a-zA-Z0-9_\\$\\\\]+|[\\(\\)\\{\\}\\[\\],=;:!@#%^&*\\-+/\\|<>\\?])", QRegularExpression::DotMatchesEverythingOption);
     nameExpression = QRegularExpression("^[\\$\\\\]?[a-zA-Z_][a-zA-Z0-9_\\\\]*$");
 
     if (dataTypes.size() == 0) {
@@ -60,150 +57,269 @@ ParsePHP::ParsePHP()
     }
 }
 
-QString ParsePHP::cleanUp(QString text)
+static inline bool isPHPNameChar(ushort c)
 {
-    comments.clear();
-    prepare(text);
-    // strip strings & comments
-    bool phpOpened = false;
-    int offset = 0;
-    QRegularExpressionMatch phpEndMatch;
-    QRegularExpressionMatch stringDQMatch;
-    QRegularExpressionMatch stringSQMatch;
-    QRegularExpressionMatch stringHeredocMatch;
-    QRegularExpressionMatch stringHeredocDQMatch;
-    QRegularExpressionMatch stringNowdocMatch;
-    QRegularExpressionMatch commentMLMatch;
-    QRegularExpressionMatch commentSLMatch;
-    QRegularExpressionMatch commentSLAMatch;
-    QRegularExpressionMatch backtickMatch;
-    QList<int> matchesPos;
-    int phpEndPos = -2,
-        stringDQPos = -2,
-        stringSQPos = -2,
-        stringHeredocPos = -2,
-        stringHeredocDQPos = -2,
-        stringNowdocPos = -2,
-        commentMLPos = -2,
-        commentSLPos = -2,
-        commentSLAPos = -2,
-        backtickPos = -2;
-    do {
-        if (!phpOpened) {
-            QRegularExpressionMatch match = phpStartExpression.match(text, offset);
-            if (match.capturedStart() < 0) break;
-            offset = match.capturedStart() + match.capturedLength();
-            phpOpened = true;
-        }
-        matchesPos.clear();
-        if (phpEndPos != -1 && phpEndPos < offset) {
-            phpEndMatch = phpEndExpression.match(text, offset);
-            phpEndPos = phpEndMatch.capturedStart();
-        }
-        if (phpEndPos >= 0) matchesPos.append(phpEndPos);
-        if (stringDQPos != -1 && stringDQPos < offset) {
-            stringDQMatch = stringDQExpression.match(text, offset);
-            stringDQPos = stringDQMatch.capturedStart(1)-1;
-        }
-        if (stringDQPos >= 0) matchesPos.append(stringDQPos);
-        if (stringSQPos != -1 && stringSQPos < offset) {
-            stringSQMatch = stringSQExpression.match(text, offset);
-            stringSQPos = stringSQMatch.capturedStart(1)-1;
-        }
-        if (stringSQPos >= 0) matchesPos.append(stringSQPos);
-        if (stringHeredocPos != -1 && stringHeredocPos < offset) {
-            stringHeredocMatch = stringHeredocExpression.match(text, offset);
-            stringHeredocPos = stringHeredocMatch.capturedStart();
-        }
-        if (stringHeredocPos >= 0) matchesPos.append(stringHeredocPos);
-        if (stringHeredocDQPos != -1 && stringHeredocDQPos < offset) {
-            stringHeredocDQMatch = stringHeredocDQExpression.match(text, offset);
-            stringHeredocDQPos = stringHeredocDQMatch.capturedStart();
-        }
-        if (stringHeredocDQPos >= 0) matchesPos.append(stringHeredocDQPos);
-        if (stringNowdocPos != -1 && stringNowdocPos < offset) {
-            stringNowdocMatch = stringNowdocExpression.match(text, offset);
-            stringNowdocPos = stringNowdocMatch.capturedStart();
-        }
-        if (stringNowdocPos >= 0) matchesPos.append(stringNowdocPos);
-        if (commentMLPos != -1 && commentMLPos < offset) {
-            commentMLMatch = commentMLExpression.match(text, offset);
-            commentMLPos = commentMLMatch.capturedStart();
-        }
-        if (commentMLPos >= 0) matchesPos.append(commentMLPos);
-        if (commentSLPos != -1 && commentSLPos < offset) {
-            commentSLMatch = commentSLExpression.match(text, offset);
-            commentSLPos = commentSLMatch.capturedStart();
-        }
-        if (commentSLPos >= 0) matchesPos.append(commentSLPos);
-        if (commentSLAPos != -1 && commentSLAPos < offset) {
-            commentSLAMatch = commentSLAExpression.match(text, offset);
-            commentSLAPos = commentSLAMatch.capturedStart();
-        }
-        if (commentSLAPos >= 0) matchesPos.append(commentSLAPos);
-        if (backtickPos != -1 && backtickPos < offset) {
-            backtickMatch = backtickExpression.match(text, offset);
-            backtickPos = backtickMatch.capturedStart(1)-1;
-        }
-        if (backtickPos >= 0) matchesPos.append(backtickPos);
-        if (matchesPos.size() == 0) break;
-        std::sort(matchesPos.begin(), matchesPos.end());
-        int pos = matchesPos.at(0);
-        if (phpEndPos == pos) {
-            offset = phpEndMatch.capturedStart() + phpEndMatch.capturedLength();
-            phpOpened = false;
-            continue;
-        }
-        if (stringDQPos == pos) {
-            offset = stringDQMatch.capturedStart() + stringDQMatch.capturedLength();
-            strip(stringDQMatch, text, 1);
-            continue;
-        }
-        if (stringSQPos == pos) {
-            offset = stringSQMatch.capturedStart() + stringSQMatch.capturedLength();
-            strip(stringSQMatch, text, 1);
-            continue;
-        }
-        if (stringHeredocPos == pos) {
-            offset = stringHeredocMatch.capturedStart() + stringHeredocMatch.capturedLength();
-            strip(stringHeredocMatch, text, 2);
-            continue;
-        }
-        if (stringHeredocDQPos == pos) {
-            offset = stringHeredocDQMatch.capturedStart() + stringHeredocDQMatch.capturedLength();
-            strip(stringHeredocDQMatch, text, 2);
-            continue;
-        }
-        if (stringNowdocPos == pos) {
-            offset = stringNowdocMatch.capturedStart() + stringNowdocMatch.capturedLength();
-            strip(stringNowdocMatch, text, 2);
-            continue;
-        }
-        if (commentMLPos == pos) {
-            offset = commentMLMatch.capturedStart() + commentMLMatch.capturedLength();
-            QString stripped = strip(commentMLMatch, text, 0); // group 0
-            comments[getLine(text, offset)] = stripped.toStdString();
-            continue;
-        }
-        if (commentSLPos == pos) {
-            offset = commentSLMatch.capturedStart(1) + commentSLMatch.capturedLength(1);
-            QString stripped = strip(commentSLMatch, text, 0); // group 0
-            comments[getLine(text, offset)] = stripped.toStdString();
-            continue;
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$' || c == '\\';
+}
+
+static inline bool isPHPLabelChar(ushort c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static inline bool isPHPPunctuation(ushort c)
+{
+    switch (c) {
+    case '(': case ')': case '{': case '}': case '[': case ']':
+    case ',': case '=': case ';': case ':': case '!': case '@':
+    case '#': case '%': case '^': case '&': case '*': case '-':
+    case '+': case '/': case '|': case '<': case '>': case '?':
+        return true;
+    default:
+        return false;
+    }
+}
+
+// returns offset of the closing quote or -1
+static int findPHPStringEnd(const QChar * data, int size, int start, ushort quote)
+{
+    for (int i=start+1; i<size; i++) {
+        ushort c = data[i].unicode();
+        if (c == '\\') i++;
+        else if (c == quote) return i;
+    }
+    return -1;
+}
+
+// returns offset after the closing label of a heredoc or nowdoc or -1
+static int findPHPHeredocEnd(const QChar * data, int size, int start)
+{
+    int i = start + 3;
+    while (i < size && (data[i] == ' ' || data[i] == '\t')) i++;
+    ushort quote = 0;
+    if (i < size && (data[i] == '"' || data[i] == '\'')) quote = data[i++].unicode();
+    int labelStart = i;
+    if (i >= size || !isPHPLabelChar(data[i].unicode()) || data[i].isDigit()) return -1;
+    while (i < size && isPHPLabelChar(data[i].unicode())) i++;
+    int labelLength = i - labelStart;
+    if (quote != 0) {
+        if (i >= size || data[i].unicode() != quote) return -1;
+        i++;
+    }
+    if (i < size && data[i] == '\r') i++;
+    if (i >= size || data[i] != '\n') return -1;
+    // closing label can be indented since PHP 7.3
+    while (i < size) {
+        i++;
+        while (i < size && (data[i] == ' ' || data[i] == '\t')) i++;
+        if (i + labelLength <= size && std::memcmp(data + i, data + labelStart, static_cast<size_t>(labelLength) * sizeof(QChar)) == 0 &&
+            (i + labelLength == size || !isPHPLabelChar(data[i + labelLength].unicode()))
+        ) {
+            return i + labelLength;
         }
-        if (commentSLAPos == pos) {
-            offset = commentSLAMatch.capturedStart(1) + commentSLAMatch.capturedLength(1);
-            QString stripped = strip(commentSLAMatch, text, 0); // group 0
-            comments[getLine(text, offset)] = stripped.toStdString();
-            continue;
+        while (i < size && data[i] != '\n') i++;
+    }
+    return -1;
+}
+
+// splits code between php tags into names and punctuation in one pass,
+// strings are skipped and comments are collected by the line they end on
+void ParsePHP::tokenize(QString & text)
+{
+    tokens.clear();
+    codeRegions.clear();
+    codeComments.clear();
+    heredocFailures.clear();
+    noClosingDQFrom = -1;
+    noClosingSQFrom = -1;
+    noClosingBacktickFrom = -1;
+    CodeRegion region;
+    region.start = -1;
+    scanTokens(text, 0, region);
+}
+
+// scans the text from the offset, the region with a start is the code region
+// the offset is in. With a rescan the scan stops at the first token of the previous
+// text after the change that is reached in the same state, returns its index
+// and leaves the region open.
+int ParsePHP::scanTokens(QString & text, int offset, CodeRegion & region, const TokensRescan * rescan)
+{
+    const QChar * data = text.constData();
+    const int size = text.size();
+    int heredocEnd = -1;
+    int prevIndex = 0;
+    int i = offset;
+    while (i < size) {
+        if (region.start < 0) {
+            int p = text.indexOf(QLatin1String("<?"), i);
+            if (p < 0) break;
+            int codeStart = p + 2;
+            if (codeStart + 3 < size && data[codeStart] == 'p' && data[codeStart+1] == 'h' && data[codeStart+2] == 'p' && data[codeStart+3].isSpace()) {
+                codeStart += 4;
+            } else if (codeStart < size && data[codeStart].isSpace()) {
+                codeStart++;
+            } else {
+                i = p + 1;
+                continue;
+            }
+            region.start = codeStart;
+            region.tokensFrom = tokens.size();
+            i = codeStart;
         }
-        if (backtickPos == pos) {
-            offset = backtickMatch.capturedStart() + backtickMatch.capturedLength();
-            strip(backtickMatch, text, 1);
-            continue;
+        while (i < size) {
+            // the scan depends only on the text after the offset and the failed lookups
+            if (rescan != nullptr && i > rescan->changeEnd) {
+                int prevOffset = i - rescan->delta;
+                while (prevIndex < rescan->tokens.size() && rescan->tokens.at(prevIndex).start < prevOffset) prevIndex++;
+                if (prevIndex >= rescan->tokens.size()) {
+                    rescan = nullptr;
+                } else if (rescan->tokens.at(prevIndex).start == prevOffset &&
+                    (noClosingDQFrom >= 0) == (rescan->noClosingDQFrom >= 0 && rescan->noClosingDQFrom <= prevIndex) &&
+                    (noClosingSQFrom >= 0) == (rescan->noClosingSQFrom >= 0 && rescan->noClosingSQFrom <= prevIndex) &&
+                    (noClosingBacktickFrom >= 0) == (rescan->noClosingBacktickFrom >= 0 && rescan->noClosingBacktickFrom <= prevIndex)
+                ) {
+                    return prevIndex;
+                }
+            }
+            const ushort c = data[i].unicode();
+            const ushort n = i + 1 < size ? data[i+1].unicode() : 0;
+            if (isPHPNameChar(c)) {
+                int start = i;
+                while (i < size && isPHPNameChar(data[i].unicode())) i++;
+                tokens.append({start, i - start});
+            } else if (c == '?' && n == '>') {
+                i += 2;
+                break;
+            } else if (c == '/' && n == '*') {
+                int start = i;
+                int end = text.indexOf(QLatin1String("*/"), i + 2);
+                i = end >= 0 ? end + 2 : size;
+                if (i - start > 4) codeComments.append({start, i, getLine(text, i)});
+            } else if ((c == '/' && n == '/') || c == '#') {
+                int start = i;
+                i += c == '#' ? 1 : 2;
+                int contentStart = i;
+                while (i < size && data[i] != '\n' && !(data[i] == '?' && i + 1 < size && data[i+1] == '>')) i++;
+                if (i > contentStart) codeComments.append({start, i, getLine(text, i)});
+            } else if (c == '"' || c == '\'' || c == '`') {
+                // an unterminated string has no closing quote for the following strings too
+                int & noClosingFrom = c == '"' ? noClosingDQFrom : (c == '\'' ? noClosingSQFrom : noClosingBacktickFrom);
+                int end = -1;
+                if (noClosingFrom < 0 && (i == 0 || data[i-1] != '\\')) {
+                    end = findPHPStringEnd(data, size, i, c);
+                    if (end < 0) noClosingFrom = tokens.size();
+                }
+                i = end >= 0 ? end + 1 : i + 1;
+            } else if (c == '<' && n == '<' && i + 2 < size && data[i+2] == '<') {
+                heredocEnd = findPHPHeredocEnd(data, size, i);
+                if (heredocEnd >= 0) {
+                    i = heredocEnd;
+                } else {
+                    heredocFailures.append(tokens.size());
+                    tokens.append({i, 1});
+                    i++;
+                }
+            } else {
+                if (isPHPPunctuation(c)) tokens.append({i, 1});
+                i++;
+            }
         }
-    } while (matchesPos.size() > 0);
-    return text;
+        region.tokensTo = tokens.size();
+        if (region.tokensTo > region.tokensFrom) codeRegions.append(region);
+        region.start = -1;
+    }
+    return -1;
+}
+
+// tokenizes the text again from the last token before the change
+// and reuses the tokens of the previously parsed text after it.
+// Returns false if the text needs to be tokenized from the start.
+// The previous index is the first reused token of the previous text
+// and the index delta is the shift of the reused tokens, or -1 and 0.
+bool ParsePHP::retokenize(QString & text, int changeStart, int changeEnd, int & prevIndex, int & indexDelta)
+{
+    prevIndex = -1;
+    indexDelta = 0;
+    if (parsedText.isNull()) return false;
+    const int delta = text.size() - parsedText.size();
+    if (changeStart < 0 || changeEnd < changeStart || changeEnd - delta < changeStart || changeEnd > text.size()) return false;
+    int restartIndex = static_cast<int>(std::partition_point(tokens.begin(), tokens.end(), [changeStart](const Token & token) {
+        return token.start + token.length < changeStart;
+    }) - tokens.begin()) - 1;
+    if (restartIndex < 0) return false;
+    // failed lookups before the change have read the text after it
+    if ((noClosingDQFrom >= 0 && noClosingDQFrom <= restartIndex) ||
+        (noClosingSQFrom >= 0 && noClosingSQFrom <= restartIndex) ||
+        (noClosingBacktickFrom >= 0 && noClosingBacktickFrom <= restartIndex) ||
+        (heredocFailures.size() > 0 && heredocFailures.at(0) <= restartIndex)
+    ) {
+        return false;
+    }
+    int regionIndex = codeRegions.size() - 1;
+    while (regionIndex > 0 && codeRegions.at(regionIndex).tokensFrom > restartIndex) regionIndex--;
+    CodeRegion region = codeRegions.at(regionIndex);
+    int offset = tokens.at(restartIndex).start + tokens.at(restartIndex).length;
+
+    TokensRescan rescan;
+    rescan.changeStart = changeStart;
+    rescan.changeEnd = changeEnd;
+    rescan.delta = delta;
+    rescan.tokens = tokens;
+    rescan.codeRegions = codeRegions;
+    rescan.codeComments = codeComments;
+    rescan.heredocFailures = heredocFailures;
+    rescan.noClosingDQFrom = noClosingDQFrom;
+    rescan.noClosingSQFrom = noClosingSQFrom;
+    rescan.noClosingBacktickFrom = noClosingBacktickFrom;
+
+    tokens.resize(restartIndex + 1);
+    codeRegions.resize(regionIndex);
+    int commentsCount = codeComments.size();
+    while (commentsCount > 0 && codeComments.at(commentsCount - 1).end > offset) commentsCount--;
+    codeComments.resize(commentsCount);
+    heredocFailures.clear();
+    noClosingDQFrom = -1;
+    noClosingSQFrom = -1;
+    noClosingBacktickFrom = -1;
+
+    prevIndex = scanTokens(text, offset, region, &rescan);
+    if (prevIndex < 0) return true;
+
+    // the rest of the text is tokenized the same way as before
+    indexDelta = tokens.size() - prevIndex;
+    const int prevOffset = rescan.tokens.at(prevIndex).start;
+    for (int i=prevIndex; i<rescan.tokens.size(); i++) {
+        Token token = rescan.tokens.at(i);
+        token.start += delta;
+        tokens.append(token);
+    }
+    int prevRegionIndex = 0;
+    while (rescan.codeRegions.at(prevRegionIndex).tokensTo <= prevIndex) prevRegionIndex++;
+    region.tokensTo = rescan.codeRegions.at(prevRegionIndex).tokensTo + indexDelta;
+    codeRegions.append(region);
+    for (int i=prevRegionIndex+1; i<rescan.codeRegions.size(); i++) {
+        CodeRegion nextRegion = rescan.codeRegions.at(i);
+        nextRegion.start += delta;
+        nextRegion.tokensFrom += indexDelta;
+        nextRegion.tokensTo += indexDelta;
+        codeRegions.append(nextRegion);
+    }
+    const int lineDelta = text.midRef(changeStart, changeEnd - changeStart).count('\n') - parsedText.midRef(changeStart, changeEnd - delta - changeStart).count('\n');
+    for (int i=0; i<rescan.codeComments.size(); i++) {
+        CodeComment comment = rescan.codeComments.at(i);
+        if (comment.start < prevOffset) continue;
+        comment.start += delta;
+        comment.end += delta;
+        comment.line += lineDelta;
+        codeComments.append(comment);
+    }
+    for (int i=0; i<rescan.heredocFailures.size(); i++) {
+        if (rescan.heredocFailures.at(i) >= prevIndex) heredocFailures.append(rescan.heredocFailures.at(i) + indexDelta);
+    }
+    if (noClosingDQFrom < 0 && rescan.noClosingDQFrom > prevIndex) noClosingDQFrom = rescan.noClosingDQFrom + indexDelta;
+    if (noClosingSQFrom < 0 && rescan.noClosingSQFrom > prevIndex) noClosingSQFrom = rescan.noClosingSQFrom + indexDelta;
+    if (noClosingBacktickFrom < 0 && rescan.noClosingBacktickFrom > prevIndex) noClosingBacktickFrom = rescan.noClosingBacktickFrom + indexDelta;
+    return true;
 }
 
 bool ParsePHP::isValidName(QString name)
@@ -261,7 +377,7 @@ void ParsePHP::addImport(QString nsName, QString name, QString path, QString typ
     ParseResultImport imp;
     imp.name = name;
     imp.path = path;
-    imp.type = type;
+    imp.type = intern(type);
     imp.line = line;
     result.imports.append(imp);
     importIndexes[name.toStdString()] = result.imports.size() - 1;
@@ -294,7 +410,7 @@ void ParsePHP::addClass(QString name, bool isAbstract, QString extend, QStringLi
     cls.isAbstract = isAbstract;
     cls.isInterface = false;
     cls.isTrait = false;
-    cls.parent = extend;
+    cls.parent = intern(extend);
     cls.interfaces = implements;
     cls.line = line;
     result.classes.append(cls);
@@ -308,7 +424,7 @@ void ParsePHP::addInterface(QString name, QString extend, int line) {
     cls.isAbstract = false;
     cls.isInterface = true;
     cls.isTrait = false;
-    cls.parent = extend;
+    cls.parent = intern(extend);
     cls.interfaces.clear();
     cls.line = line;
     result.classes.append(cls);
@@ -333,14 +449,14 @@ void ParsePHP::addFunction(QString clsName, QString name, QString args, bool isS
     if (!isValidName(name)) return;
     ParseResultFunction func;
     func.name = name;
-    func.clsName = clsName;
+    func.clsName = intern(clsName);
     func.args = args;
     func.isStatic = isStatic;
     func.isAbstract = isAbstract;
-    func.visibility = visibility;
+    func.visibility = intern(visibility);
     func.minArgs = minArgs;
     func.maxArgs = maxArgs;
-    func.returnType = returnType;
+    func.returnType = intern(returnType);
     func.comment = comment;
     func.line = line;
     result.functions.append(func);
@@ -365,7 +481,7 @@ void ParsePHP::updateFunctionReturnType(QString clsName, QString funcName, QStri
         int i = functionIndexesIterator->second;
         if (result.functions.size() > i) {
             ParseResultFunction func = result.functions.at(i);
-            func.returnType = returnType;
+            func.returnType = intern(returnType);
             result.functions.replace(i, func);
         }
     }
@@ -376,13 +492,14 @@ void ParsePHP::addVariable(QString clsName, QString funcName, QString name, bool
     if (!isValidName(name)) return;
     variableIndexesIterator = variableIndexes.find(clsName.toStdString() + "::" + funcName.toStdString() + "::" + name.toStdString());
     if (variableIndexesIterator != variableIndexes.end()) return;
+    if (funcName.size() == 0) classScopeChanged = true;
     ParseResultVariable variable;
     variable.name = name;
-    variable.clsName = clsName;
-    variable.funcName = funcName;
+    variable.clsName = intern(clsName);
+    variable.funcName = intern(funcName);
     variable.isStatic = isStatic;
-    variable.visibility =visibility;
-    variable.type = type;
+    variable.visibility = intern(visibility);
+    variable.type = intern(type);
     variable.line = line;
     result.variables.append(variable);
     variableIndexes[clsName.toStdString() + "::" + funcName.toStdString() + "::" + name.toStdString()] = result.variables.size() - 1;
@@ -415,8 +532,9 @@ void ParsePHP::updateVariableType(QString clsName, QString funcName, QString var
     if (variableIndexesIterator != variableIndexes.end()) {
         int i = variableIndexesIterator->second;
         if (result.variables.size() > i) {
+            if (funcName.size() == 0) classScopeChanged = true;
             ParseResultVariable variable = result.variables.at(i);
-            variable.type = type;
+            variable.type = intern(type);
             result.variables.replace(i, variable);
         }
     }
@@ -427,7 +545,7 @@ void ParsePHP::addConstant(QString clsName, QString name, QString value, int lin
     if (!isValidName(name)) return;
     ParseResultConstant constant;
     constant.name = name;
-    constant.clsName = clsName;
+    constant.clsName = intern(clsName);
     constant.value = value;
     constant.line = line;
     result.constants.append(constant);
@@ -478,66 +596,195 @@ void ParsePHP::addError(QString text, int line, int symbol) {
     result.errors.append(error);
 }
 
-void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
+ParsePHP::CodeState::CodeState():
+    current_class_is_abstract(false),
+    current_function_is_static(false),
+    current_function_is_abstract(false),
+    current_function_min_args(0),
+    current_function_max_args(0),
+    current_variable_is_static(false),
+    scope(0),
+    namespaceScope(-1), classScope(-1), interfaceScope(-1), traitScope(-1), functionScope(-1), anonymFunctionScope(-1), anonymClassScope(-1),
+    pars(0),
+    curlyBrackets(0), roundBrackets(0), squareBrackets(0),
+    functionArgPars(-1),
+    functionArgsStart(-1),
+    constantValueStart(-1),
+    functionParsFound(false), classParsFound(false),
+    expect(-1),
+    useStart(-1), namespaceStart(-1), classStart(-1), interfaceStart(-1), traitStart(-1), functionStart(-1), variableStart(-1), constantStart(-1)
+{
+}
+
+// compares the states without the positions and the bracket lists
+bool ParsePHP::CodeState::isSameScope(const CodeState & other) const
 {
+    return current_namespace == other.current_namespace &&
+        current_class == other.current_class &&
+        current_class_is_abstract == other.current_class_is_abstract &&
+        current_class_parent == other.current_class_parent &&
+        current_class_interfaces == other.current_class_interfaces &&
+        current_interface == other.current_interface &&
+        current_interface_parent == other.current_interface_parent &&
+        current_trait == other.current_trait &&
+        current_function == other.current_function &&
+        current_function_args == other.current_function_args &&
+        current_function_is_static == other.current_function_is_static &&
+        current_function_is_abstract == other.current_function_is_abstract &&
+        current_function_visibility == other.current_function_visibility &&
+        current_function_min_args == other.current_function_min_args &&
+        current_function_max_args == other.current_function_max_args &&
+        current_function_return_type == other.current_function_return_type &&
+        current_variable == other.current_variable &&
+        current_variable_is_static == other.current_variable_is_static &&
+        current_variable_visibility == other.current_variable_visibility &&
+        current_variable_type == other.current_variable_type &&
+        current_constant == other.current_constant &&
+        current_constant_value == other.current_constant_value &&
+        parent_namespaces == other.parent_namespaces &&
+        parent_namespace_scopes == other.parent_namespace_scopes &&
+        expected_function_name == other.expected_function_name &&
+        expected_function_args == other.expected_function_args &&
+        expected_function_arg_types == other.expected_function_arg_types &&
+        expected_class_name == other.expected_class_name &&
+        scope == other.scope &&
+        namespaceScope == other.namespaceScope &&
+        classScope == other.classScope &&
+        interfaceScope == other.interfaceScope &&
+        traitScope == other.traitScope &&
+        functionScope == other.functionScope &&
+        anonymFunctionScope == other.anonymFunctionScope &&
+        anonymClassScope == other.anonymClassScope &&
+        pars == other.pars &&
+        curlyBrackets == other.curlyBrackets &&
+        roundBrackets == other.roundBrackets &&
+        squareBrackets == other.squareBrackets &&
+        functionArgPars == other.functionArgPars &&
+        (functionArgsStart < 0) == (other.functionArgsStart < 0) &&
+        (constantValueStart < 0) == (other.constantValueStart < 0) &&
+        functionParsFound == other.functionParsFound &&
+        classParsFound == other.classParsFound &&
+        expect == other.expect &&
+        expectName == other.expectName &&
+        prevK == other.prevK &&
+        prevPrevK == other.prevPrevK &&
+        prevPrevPrevK == other.prevPrevPrevK &&
+        prevPrevPrevPrevK == other.prevPrevPrevPrevK &&
+        prevPrevPrevPrevPrevK == other.prevPrevPrevPrevPrevK &&
+        prevPrevPrevPrevPrevPrevK == other.prevPrevPrevPrevPrevPrevK &&
+        prevPrevPrevPrevPrevPrevPrevK == other.prevPrevPrevPrevPrevPrevPrevK &&
+        prevPrevPrevPrevPrevPrevPrevPrevK == other.prevPrevPrevPrevPrevPrevPrevPrevK &&
+        (useStart < 0) == (other.useStart < 0) &&
+        (namespaceStart < 0) == (other.namespaceStart < 0) &&
+        (classStart < 0) == (other.classStart < 0) &&
+        (interfaceStart < 0) == (other.interfaceStart < 0) &&
+        (traitStart < 0) == (other.traitStart < 0) &&
+        (functionStart < 0) == (other.functionStart < 0) &&
+        (variableStart < 0) == (other.variableStart < 0) &&
+        (constantStart < 0) == (other.constantStart < 0) &&
+        class_static_variable == other.class_static_variable &&
+        class_variable == other.class_variable &&
+        functionChainList == other.functionChainList &&
+        classChainList == other.classChainList &&
+        traitChainList == other.traitChainList;
+}
+
+// moves the positions after a change made in the region
+void ParsePHP::CodeState::shiftPositions(int from, int delta)
+{
+    int * positions[] = {&functionArgsStart, &constantValueStart, &useStart, &namespaceStart, &classStart, &interfaceStart, &traitStart, &functionStart, &variableStart, &constantStart};
+    for (int * pos : positions) {
+        if (*pos >= from) *pos += delta;
+    }
+}
+
+void ParsePHP::parseCode(QString & origText, const CodeRegion & region, int regionIndex, int tokensFrom, int tokensTo, CodeState & state)
+{
+    const int textOffset = region.start;
     // parse data
-    QString current_namespace = "";
-    QString current_class = "";
-    bool current_class_is_abstract = false;
-    QString current_class_parent = "";
-    QStringList current_class_interfaces;
-    QString current_interface = "";
-    QString current_interface_parent = "";
-    QString current_trait = "";
-    QString current_function = "";
-    QString current_function_args = "";
-    bool current_function_is_static = false;
-    bool current_function_is_abstract = false;
-    QString current_function_visibility = "";
-    int current_function_min_args = 0;
-    int current_function_max_args = 0;
-    QString current_function_return_type = "";
-    QString current_variable = "";
-    bool current_variable_is_static = false;
-    QString current_variable_visibility = "";
-    QString current_variable_type = "";
-    QString current_constant = "";
-    QString current_constant_value = "";
-
-    QStringList parent_namespaces;
-    QVector<int> parent_namespace_scopes;
-    QString expected_function_name = "";
-    QStringList expected_function_args;
-    QStringList expected_function_arg_types;
-    QString expected_class_name = "";
-    int scope = 0;
-    int namespaceScope = -1, classScope = -1, interfaceScope = -1, traitScope = -1, functionScope = -1, anonymFunctionScope = -1, anonymClassScope = -1;
-    int pars = 0;
-    int curlyBrackets = 0, roundBrackets = 0, squareBrackets = 0;
-    QVector<int> curlyBracketsList, roundBracketsList, squareBracketsList;
-    int functionArgPars = -1;
-    int functionArgsStart = -1;
-    int constantValueStart = -1;
-    bool functionParsFound = false, classParsFound = false;
-    int expect = -1;
-    QString expectName = "";
-    QString prevK = "", prevPrevK = "", prevPrevPrevK = "", prevPrevPrevPrevK = "", prevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevPrevK = "", prevPrevPrevPrevPrevPrevPrevPrevK = "";
-    int useStart = -1, namespaceStart = -1, classStart = -1, interfaceStart = -1, traitStart = -1, functionStart = -1, variableStart = -1, constantStart = -1;
-    QString class_static_variable = "", class_variable = "";
-    QStringList functionChainList, classChainList, traitChainList;
-
-    QRegularExpressionMatchIterator mi = parseExpression.globalMatch(code);
-    while(mi.hasNext()){
-        QRegularExpressionMatch m = mi.next();
-        if (m.capturedStart(1) < 0) continue;
-        QString k = m.captured(1).trimmed();
-        if (k.size() == 0) continue;
+    QString & current_namespace = state.current_namespace;
+    QString & current_class = state.current_class;
+    bool & current_class_is_abstract = state.current_class_is_abstract;
+    QString & current_class_parent = state.current_class_parent;
+    QStringList & current_class_interfaces = state.current_class_interfaces;
+    QString & current_interface = state.current_interface;
+    QString & current_interface_parent = state.current_interface_parent;
+    QString & current_trait = state.current_trait;
+    QString & current_function = state.current_function;
+    QString & current_function_args = state.current_function_args;
+    bool & current_function_is_static = state.current_function_is_static;
+    bool & current_function_is_abstract = state.current_function_is_abstract;
+    QString & current_function_visibility = state.current_function_visibility;
+    int & current_function_min_args = state.current_function_min_args;
+    int & current_function_max_args = state.current_function_max_args;
+    QString & current_function_return_type = state.current_function_return_type;
+    QString & current_variable = state.current_variable;
+    bool & current_variable_is_static = state.current_variable_is_static;
+    QString & current_variable_visibility = state.current_variable_visibility;
+    QString & current_variable_type = state.current_variable_type;
+    QString & current_constant = state.current_constant;
+    QString & current_constant_value = state.current_constant_value;
+    QStringList & parent_namespaces = state.parent_namespaces;
+    QVector<int> & parent_namespace_scopes = state.parent_namespace_scopes;
+    QString & expected_function_name = state.expected_function_name;
+    QStringList & expected_function_args = state.expected_function_args;
+    QStringList & expected_function_arg_types = state.expected_function_arg_types;
+    QString & expected_class_name = state.expected_class_name;
+    int & scope = state.scope;
+    int & namespaceScope = state.namespaceScope;
+    int & classScope = state.classScope;
+    int & interfaceScope = state.interfaceScope;
+    int & traitScope = state.traitScope;
+    int & functionScope = state.functionScope;
+    int & anonymFunctionScope = state.anonymFunctionScope;
+    int & anonymClassScope = state.anonymClassScope;
+    int & pars = state.pars;
+    int & curlyBrackets = state.curlyBrackets;
+    int & roundBrackets = state.roundBrackets;
+    int & squareBrackets = state.squareBrackets;
+    QVector<int> & curlyBracketsList = state.curlyBracketsList;
+    QVector<int> & roundBracketsList = state.roundBracketsList;
+    QVector<int> & squareBracketsList = state.squareBracketsList;
+    int & functionArgPars = state.functionArgPars;
+    int & functionArgsStart = state.functionArgsStart;
+    int & constantValueStart = state.constantValueStart;
+    bool & functionParsFound = state.functionParsFound;
+    bool & classParsFound = state.classParsFound;
+    int & expect = state.expect;
+    QString & expectName = state.expectName;
+    QString & prevK = state.prevK;
+    QString & prevPrevK = state.prevPrevK;
+    QString & prevPrevPrevK = state.prevPrevPrevK;
+    QString & prevPrevPrevPrevK = state.prevPrevPrevPrevK;
+    QString & prevPrevPrevPrevPrevK = state.prevPrevPrevPrevPrevK;
+    QString & prevPrevPrevPrevPrevPrevK = state.prevPrevPrevPrevPrevPrevK;
+    QString & prevPrevPrevPrevPrevPrevPrevK = state.prevPrevPrevPrevPrevPrevPrevK;
+    QString & prevPrevPrevPrevPrevPrevPrevPrevK = state.prevPrevPrevPrevPrevPrevPrevPrevK;
+    int & useStart = state.useStart;
+    int & namespaceStart = state.namespaceStart;
+    int & classStart = state.classStart;
+    int & interfaceStart = state.interfaceStart;
+    int & traitStart = state.traitStart;
+    int & functionStart = state.functionStart;
+    int & variableStart = state.variableStart;
+    int & constantStart = state.constantStart;
+    QString & class_static_variable = state.class_static_variable;
+    QString & class_variable = state.class_variable;
+    QStringList & functionChainList = state.functionChainList;
+    QStringList & classChainList = state.classChainList;
+    QStringList & traitChainList = state.traitChainList;
+
+    for (int t=tokensFrom; t<tokensTo; t++) {
+        const Token & token = tokens.at(t);
+        const int tokenStart = token.start - textOffset;
+        QString k = origText.mid(token.start, token.length);
+        const int prevFunctionScope = functionScope;
 
         // uses
         if (expect < 0 && (((namespaceScope < 0 && scope == 0) || scope == namespaceScope+1) && (prevK == ";" || prevK == "{" || prevK == "}" || prevK.size() == 0)) && k.toLower() == "use" && current_class.size() == 0 && current_interface.size() == 0 && current_trait.size() == 0 && current_function.size() == 0 && anonymFunctionScope < 0) {
             expect = EXPECT_USE;
             expectName = "";
-            useStart = m.capturedStart(1);
+            useStart = tokenStart;
         } else if (expect == EXPECT_USE && expectName.size() == 0 && k.toLower() == "function") {
             expect = EXPECT_USE_FUNCTION;
         } else if (expect == EXPECT_USE && expectName.size() == 0 && k.toLower() == "const") {
@@ -592,7 +839,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
                     }
                     int line = 0;
                     //if (useStart >= 0) line = getLine(origText, textOffset + useStart);
-                    if (useStart >= 0) line = getLine(origText, textOffset + m.capturedStart(1)); // line at end
+                    if (useStart >= 0) line = getLine(origText, textOffset + tokenStart); // line at end
                     addImport(current_namespace, useName, usePath, useType, line);
                 }
             }
@@ -604,7 +851,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
         if (expect < 0 && k.toLower() == "namespace") {
             expect = EXPECT_NAMESPACE;
             expectName = "";
-            namespaceStart = m.capturedStart(1);
+            namespaceStart = tokenStart;
         } else if (expect == EXPECT_NAMESPACE && expectName.size() == 0) {
             expectName = k;
         } else if (expect == EXPECT_NAMESPACE && expectName.size() > 0 && (k == ";" || k == "{")) {
@@ -619,7 +866,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
             if (current_namespace[0] == "\\") current_namespace = current_namespace.mid(1);
             int line = 0;
             //if (namespaceStart >= 0) line = getLine(origText, textOffset + namespaceStart);
-            if (namespaceStart >= 0) line = getLine(origText, textOffset + m.capturedStart(1)); // line at end
+            if (namespaceStart >= 0) line = getLine(origText, textOffset + tokenStart); // line at end
             addNamespace(current_namespace, line);
             expect = -1;
             expectName = "";
@@ -644,7 +891,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
             current_class_is_abstract = (prevK.toLower() == "abstract");
             current_class_parent = "";
             current_class_interfaces.clear();
-            classStart =  m.capturedStart(1);
+            classStart =  tokenStart;
             classParsFound = false;
         } else if (expect == EXPECT_CLASS && expectName.size() == 0 && k != "{" && !classParsFound) {
             if (k != "(" && k != ")" && k != "{" && k != "extends" && k != "implements" && k.indexOf("$") < 0 && (current_class.size() == 0 && current_interface.size() == 0 && current_trait.size() == 0)) {
@@ -693,7 +940,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
             expect = EXPECT_INTERFACE;
             expectName = "";
             current_interface_parent = "";
-            interfaceStart = m.capturedStart(1);
+            interfaceStart = tokenStart;
         } else if (expect == EXPECT_INTERFACE && expectName.size() == 0) {
             expectName = k;
         } else if (expect == EXPECT_INTERFACE && expectName.size() > 0 && k.toLower() == "extends") {
@@ -718,7 +965,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
         if (expect < 0 && k.toLower() == "trait" && (current_class.size() == 0 && current_interface.size() == 0 && current_trait.size() == 0) && anonymClassScope < 0) {
             expect = EXPECT_TRAIT;
             expectName = "";
-            traitStart = m.capturedStart(1);
+            traitStart = tokenStart;
         } else if (expect == EXPECT_TRAIT && expectName.size() == 0) {
             expectName = k;
         } else if (expect == EXPECT_TRAIT && expectName.size() > 0 && k == "{") {
@@ -757,12 +1004,12 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
             functionArgPars = -1;
             functionArgsStart = -1;
             functionParsFound = false;
-            functionStart = m.capturedStart(1);
+            functionStart = tokenStart;
         } else if (expect == EXPECT_FUNCTION && expectName.size() == 0 && k != "&" && k != "(" && k != ")" && k != "{" && k != "use" && functionArgsStart < 0 && current_function_args.size() == 0 && !functionParsFound) {
             expectName = k;
         } else if (expect == EXPECT_FUNCTION && functionArgPars < 0 && k == "(" && !functionParsFound) {
             functionArgPars = pars;
-            functionArgsStart = m.capturedStart(1);
+            functionArgsStart = tokenStart;
             functionParsFound = true;
         } else if (expect == EXPECT_FUNCTION && expectName.size() > 0 && functionArgPars < 0 && k == ":") {
             expect = EXPECT_FUNCTION_RETURN_TYPE;
@@ -1076,7 +1323,7 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
                 current_variable_is_static = false;
                 current_variable_visibility = "";
             }
-            variableStart = m.capturedStart(1);
+            variableStart = tokenStart;
         } else if (expect == EXPECT_VARIABLE && expectName.size() > 0 && current_variable.size() == 0 && (k == "=" || (k == ";" && (current_class.size() > 0 || current_interface.size() > 0 || current_trait.size() > 0) && current_function.size() == 0))) {
             current_variable = expectName;
             QString clsName = "";
@@ -1186,15 +1433,15 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
             current_constant = "";
             current_constant_value = "";
             constantValueStart = -1;
-            constantStart = m.capturedStart(1);
+            constantStart = tokenStart;
         } else if (expect == EXPECT_CONST && expectName.size() == 0 && k.size() > 0) {
             expectName = k;
         } else if (expect == EXPECT_CONST && expectName.size() > 0 && k == "=") {
             expect = EXPECT_CONST_VALUE;
-            constantValueStart = m.capturedStart(1) + 1;
+            constantValueStart = tokenStart + 1;
         } else if (expect == EXPECT_CONST_VALUE && expectName.size() > 0 && k == ";") {
             current_constant = expectName;
-            current_constant_value = origText.mid(textOffset+constantValueStart, m.capturedStart(1)-constantValueStart).trimmed();
+            current_constant_value = origText.mid(textOffset+constantValueStart, tokenStart-constantValueStart).trimmed();
             QString clsName = "";
             if (current_class.size() > 0) clsName = current_class;
             else if (current_interface.size() > 0) clsName = current_interface;
@@ -1244,13 +1491,13 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
         if (k == "{") {
             scope++;
             curlyBrackets++;
-            curlyBracketsList.append(m.capturedStart(1)+1);
+            curlyBracketsList.append(tokenStart+1);
         }
         if (k == "}") {
             scope--;
             if (scope < 0) scope = 0;
             curlyBrackets--;
-            curlyBracketsList.append(-1 * (m.capturedStart(1)+1));
+            curlyBracketsList.append(-1 * (tokenStart+1));
             // namespace close
             if (current_namespace.size() > 0 && namespaceScope >= 0 && namespaceScope == scope) {
                 current_namespace = "";
@@ -1330,17 +1577,17 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
         if (k == "(") {
             pars++;
             roundBrackets++;
-            roundBracketsList.append(m.capturedStart(1)+1);
+            roundBracketsList.append(tokenStart+1);
         }
         if (k == ")") {
             pars--;
             if (pars < 0) pars = 0;
             roundBrackets--;
-            roundBracketsList.append(-1 * (m.capturedStart(1)+1));
+            roundBracketsList.append(-1 * (tokenStart+1));
             // function args
             if (functionArgPars >= 0 && functionArgPars == pars && functionArgsStart >= 0) {
-                current_function_args = origText.mid(textOffset+functionArgsStart+1, m.capturedStart(1)-functionArgsStart-1).trimmed();
-                current_function_args = Helper::stripScopedText(current_function_args);
+                current_function_args = origText.mid(textOffset+functionArgsStart+1, tokenStart-functionArgsStart-1).trimmed();
+                current_function_args = stripScopedText(current_function_args);
                 if (current_function_args.size() > 0) {
                     QString current_function_args_cleaned = "";
                     QStringList argsList, argsDefaultsList, argsTypeList;
@@ -1400,11 +1647,11 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
         // brackets
         if (k == "[") {
             squareBrackets++;
-            squareBracketsList.append(m.capturedStart(1)+1);
+            squareBracketsList.append(tokenStart+1);
         }
         if (k == "]") {
             squareBrackets--;
-            squareBracketsList.append(-1 * (m.capturedStart(1)+1));
+            squareBracketsList.append(-1 * (tokenStart+1));
         }
         prevPrevPrevPrevPrevPrevPrevPrevK = prevPrevPrevPrevPrevPrevPrevK;
         prevPrevPrevPrevPrevPrevPrevK = prevPrevPrevPrevPrevPrevK;
@@ -1414,7 +1661,23 @@ void ParsePHP::parseCode(QString & code, QString & origText, int textOffset)
         prevPrevPrevK = prevPrevK;
         prevPrevK = prevK;
         prevK = k;
+        // bodies of named functions are kept to parse them again, see reparseFunctionBody
+        if (regionIndex >= 0 && k == "{" && prevFunctionScope < 0 && functionScope >= 0 && current_function.size() > 0) {
+            openFunctionBody(regionIndex, t, state);
+        } else if (regionIndex >= 0 && k == "}" && prevFunctionScope >= 0 && functionScope < 0 && functionBodies.size() > 0 && functionBodies.last().regionIndex == regionIndex && functionBodies.last().closeToken < 0) {
+            closeFunctionBody(t, state);
+        }
     }
+}
+
+void ParsePHP::addBracketErrors(QString & origText, int textOffset, const CodeState & state)
+{
+    const int & curlyBrackets = state.curlyBrackets;
+    const int & roundBrackets = state.roundBrackets;
+    const int & squareBrackets = state.squareBrackets;
+    const QVector<int> & curlyBracketsList = state.curlyBracketsList;
+    const QVector<int> & roundBracketsList = state.roundBracketsList;
+    const QVector<int> & squareBracketsList = state.squareBracketsList;
     if (curlyBrackets > 0) {
         int offset = findOpenScope(curlyBracketsList);
         if (offset != 0) offset = abs(offset) - 1;
@@ -1464,23 +1727,351 @@ void ParsePHP::reset()
     comments.clear();
 }
 
-ParsePHP::ParseResult ParsePHP::parse(QString text)
+ParsePHP::SharedParseResult ParsePHP::parse(QString text)
+{
+    resetLineIndex();
+    tokenize(text);
+    parseTokens(text, false);
+    parsedResult.reset();
+    return SharedParseResult(new ParseResult(std::move(result)));
+}
+
+// parses the text that differs from the previously parsed text
+// only between the change start and end
+ParsePHP::SharedParseResult ParsePHP::parse(QString text, int changeStart, int changeEnd)
+{
+    resetLineIndex();
+    int prevIndex = -1, indexDelta = 0;
+    if (!retokenize(text, changeStart, changeEnd, prevIndex, indexDelta)) {
+        tokenize(text);
+        prevIndex = -1;
+    }
+    if (prevIndex < 0 || !reparseFunctionBody(text, changeStart, changeEnd, prevIndex, indexDelta)) {
+        parseTokens(text, true);
+    }
+    parsedResult = SharedParseResult(new ParseResult(std::move(result)));
+    return parsedResult;
+}
+
+void ParsePHP::parseTokens(QString & text, bool keepFunctionBodies)
 {
     result = ParseResult();
+    resultNames.clear();
     reset();
-    QString cleanText = cleanUp(text);
-    QRegularExpressionMatchIterator mi = phpExpression.globalMatch(cleanText);
-    while(mi.hasNext()){
-        QRegularExpressionMatch m = mi.next();
-        if (m.capturedStart(1) < 0) continue;
-        if (m.captured(1).trimmed().size() == 0) continue;
-        QString code = m.captured(1);
-        parseCode(code, text, m.capturedStart(1));
+    functionBodies.clear();
+    regionStates.clear();
+    regionErrors.clear();
+    collectComments(text);
+    for (int i=0; i<codeRegions.size(); i++) {
+        const CodeRegion & region = codeRegions.at(i);
+        CodeState state;
+        if (keepFunctionBodies) regionErrors.append(result.errors.size());
+        parseCode(text, region, keepFunctionBodies ? i : -1, region.tokensFrom, region.tokensTo, state);
+        addBracketErrors(text, region.start, state);
+        if (keepFunctionBodies) regionStates.append(state);
     }
-    // comments
+    addComments();
+    parsedText = text;
+}
+
+void ParsePHP::collectComments(QString & text)
+{
+    comments.clear();
+    for (int i=0; i<codeComments.size(); i++) {
+        const CodeComment & comment = codeComments.at(i);
+        comments[comment.line] = text.mid(comment.start, comment.end - comment.start).toStdString();
+    }
+}
+
+void ParsePHP::addComments()
+{
     std::map<int, std::string> orderedComments(comments.begin(), comments.end());
     for (auto & commentsIterator : orderedComments) {
         addComment(QString::fromStdString(commentsIterator.second), commentsIterator.first);
     }
-    return result;
+}
+
+void ParsePHP::openFunctionBody(int regionIndex, int token, const CodeState & state)
+{
+    FunctionBody body;
+    body.regionIndex = regionIndex;
+    body.openToken = token;
+    body.closeToken = -1;
+    body.start = tokens.at(token).start;
+    body.end = -1;
+    body.openState = state;
+    body.openState.curlyBracketsList.clear();
+    body.openState.roundBracketsList.clear();
+    body.openState.squareBracketsList.clear();
+    body.openCurlyBrackets = state.curlyBracketsList.size();
+    body.openRoundBrackets = state.roundBracketsList.size();
+    body.openSquareBrackets = state.squareBracketsList.size();
+    body.closeCurlyBrackets = -1;
+    body.closeRoundBrackets = -1;
+    body.closeSquareBrackets = -1;
+    body.classAliases = classAliases;
+    body.functionAliases = functionAliases;
+    body.constantAliases = constantAliases;
+    body.functionsCount = result.functions.size();
+    body.classesCount = result.classes.size();
+    body.constantsCount = result.constants.size();
+    body.namespacesCount = result.namespaces.size();
+    body.importsCount = result.imports.size();
+    body.variablesCount = result.variables.size();
+    body.closeVariablesCount = -1;
+    // the function is not in the results if its name is not valid
+    body.hasSideEffects = body.functionsCount == 0 || result.functions.last().name != state.current_function;
+    if (!body.hasSideEffects) {
+        body.argIndexes = result.functions.last().variableIndexes;
+        for (int i=0; i<body.argIndexes.size(); i++) {
+            body.args.append(result.variables.at(body.argIndexes.at(i)));
+        }
+    }
+    classScopeChanged = false;
+    functionBodies.append(body);
+}
+
+// a body that adds symbols or changes the class properties cannot be parsed alone
+void ParsePHP::closeFunctionBody(int token, const CodeState & state)
+{
+    FunctionBody & body = functionBodies.last();
+    body.closeToken = token;
+    body.end = tokens.at(token).start;
+    body.closeState = state;
+    body.closeState.curlyBracketsList.clear();
+    body.closeState.roundBracketsList.clear();
+    body.closeState.squareBracketsList.clear();
+    body.closeCurlyBrackets = state.curlyBracketsList.size();
+    body.closeRoundBrackets = state.roundBracketsList.size();
+    body.closeSquareBrackets = state.squareBracketsList.size();
+    body.closeVariablesCount = result.variables.size();
+    if (classScopeChanged ||
+        result.functions.size() != body.functionsCount ||
+        result.classes.size() != body.classesCount ||
+        result.constants.size() != body.constantsCount ||
+        result.namespaces.size() != body.namespacesCount ||
+        result.imports.size() != body.importsCount
+    ) {
+        body.hasSideEffects = true;
+    }
+}
+
+static QVector<int> shiftBrackets(const QVector<int> & list, int delta)
+{
+    QVector<int> shifted;
+    shifted.reserve(list.size());
+    for (int i=0; i<list.size(); i++) {
+        int pos = list.at(i);
+        shifted.append(pos > 0 ? pos + delta : pos - delta);
+    }
+    return shifted;
+}
+
+static void shiftIndexes(QVector<int> & indexes, int from, int delta)
+{
+    for (int i=0; i<indexes.size(); i++) {
+        if (indexes.at(i) >= from) indexes[i] += delta;
+    }
+}
+
+// parses only the tokens of a function body if the change does not leave it.
+// The symbols before the body are the same, the symbols after it are taken
+// from the previous result if the body ends in the same state.
+bool ParsePHP::reparseFunctionBody(QString & text, int changeStart, int changeEnd, int prevIndex, int indexDelta)
+{
+    if (parsedResult.isNull()) return false;
+    const int delta = text.size() - parsedText.size();
+    const int prevChangeEnd = changeEnd - delta;
+    int bodyIndex = -1;
+    for (int i=0; i<functionBodies.size(); i++) {
+        const FunctionBody & body = functionBodies.at(i);
+        if (body.closeToken < 0 || body.hasSideEffects) continue;
+        if (body.start >= changeStart || body.end < prevChangeEnd) continue;
+        bodyIndex = i;
+        break;
+    }
+    if (bodyIndex < 0) return false;
+    FunctionBody & body = functionBodies[bodyIndex];
+    // the closing brace is reused from the previous text
+    if (prevIndex > body.closeToken) return false;
+    const int closeToken = body.closeToken + indexDelta;
+    if (body.openToken >= tokens.size() || tokens.at(body.openToken).start != body.start) return false;
+    if (closeToken >= tokens.size() || tokens.at(closeToken).start != body.end + delta) return false;
+    // the change has opened or closed a code region
+    if (codeRegions.size() != regionStates.size()) return false;
+    const CodeRegion & region = codeRegions.at(body.regionIndex);
+    if (body.openToken < region.tokensFrom || closeToken >= region.tokensTo) return false;
+    const ParseResult & prevResult = *parsedResult;
+    const int functionIndex = body.functionsCount - 1;
+    const ParseResultFunction & prevFunc = prevResult.functions.at(functionIndex);
+    // variables of a function with the same name defined later depend on the body
+    for (int i=body.functionsCount; i<prevResult.functions.size(); i++) {
+        const ParseResultFunction & nextFunc = prevResult.functions.at(i);
+        if (nextFunc.name == prevFunc.name && nextFunc.clsName == prevFunc.clsName) return false;
+    }
+    // the docblock of a function after the body is looked up from the line
+    // of the closing brace, or inside the body if it starts on that line
+    const int lineDelta = text.midRef(changeStart, changeEnd - changeStart).count('\n') - parsedText.midRef(changeStart, prevChangeEnd - changeStart).count('\n');
+    const int prevCloseLine = getLine(text, body.end + delta) - lineDelta;
+    if (comments.find(prevCloseLine) != comments.end()) return false;
+    for (int i=functionIndex+1; i<prevResult.functions.size(); i++) {
+        const int line = prevResult.functions.at(i).line;
+        if (line == prevCloseLine) return false;
+        if (line > prevCloseLine) break;
+    }
+
+    CodeState & regionState = regionStates[body.regionIndex];
+    CodeState state = body.openState;
+    state.curlyBracketsList = regionState.curlyBracketsList.mid(0, body.openCurlyBrackets);
+    state.roundBracketsList = regionState.roundBracketsList.mid(0, body.openRoundBrackets);
+    state.squareBracketsList = regionState.squareBracketsList.mid(0, body.openSquareBrackets);
+    classAliases = body.classAliases;
+    functionAliases = body.functionAliases;
+    constantAliases = body.constantAliases;
+
+    // symbols found before the body
+    result = prevResult;
+    functionIndexes.clear();
+    for (int i=0; i<body.functionsCount; i++) {
+        const ParseResultFunction & func = result.functions.at(i);
+        functionIndexes[func.clsName.toStdString() + "::" + func.name.toStdString()] = i;
+    }
+    variableIndexes.clear();
+    for (int i=0; i<body.variablesCount; i++) {
+        const ParseResultVariable & variable = result.variables.at(i);
+        variableIndexes.emplace(variable.clsName.toStdString() + "::" + variable.funcName.toStdString() + "::" + variable.name.toStdString(), i);
+    }
+    classIndexes.clear();
+    for (int i=0; i<body.classesCount; i++) {
+        classIndexes[result.classes.at(i).name.toStdString()] = i;
+    }
+    constantIndexes.clear();
+    for (int i=0; i<body.constantsCount; i++) {
+        const ParseResultConstant & constant = result.constants.at(i);
+        constantIndexes[constant.clsName.toStdString() + "::" + constant.name.toStdString()] = i;
+    }
+    namespaceIndexes.clear();
+    for (int i=0; i<body.namespacesCount; i++) {
+        namespaceIndexes[result.namespaces.at(i).name.toStdString()] = i;
+    }
+    importIndexes.clear();
+    for (int i=0; i<body.importsCount; i++) {
+        importIndexes[result.imports.at(i).name.toStdString()] = i;
+    }
+    ParseResultFunction bodyFunc = result.functions.at(functionIndex);
+    bodyFunc.returnType = intern(body.openState.current_function_return_type);
+    bodyFunc.variableIndexes = body.argIndexes;
+    result.functions.replace(functionIndex, bodyFunc);
+    for (int i=0; i<body.argIndexes.size(); i++) {
+        result.variables.replace(body.argIndexes.at(i), body.args.at(i));
+    }
+    QVector<ParseResultVariable> tailVariables = result.variables.mid(body.closeVariablesCount);
+    result.variables.resize(body.variablesCount);
+
+    collectComments(text);
+    classScopeChanged = false;
+    parseCode(text, region, -1, body.openToken + 1, closeToken + 1, state);
+    if (classScopeChanged ||
+        result.functions.size() != prevResult.functions.size() ||
+        result.classes.size() != prevResult.classes.size() ||
+        result.constants.size() != prevResult.constants.size() ||
+        result.namespaces.size() != prevResult.namespaces.size() ||
+        result.imports.size() != prevResult.imports.size() ||
+        result.functions.at(functionIndex).returnType != prevFunc.returnType ||
+        !state.isSameScope(body.closeState) ||
+        comments.find(prevCloseLine + lineDelta) != comments.end()
+    ) {
+        return false;
+    }
+
+    // symbols after the body are moved by the changed lines and variables
+    const int closeVariablesCount = result.variables.size();
+    const int variablesDelta = closeVariablesCount - body.closeVariablesCount;
+    for (int i=0; i<tailVariables.size(); i++) {
+        ParseResultVariable variable = tailVariables.at(i);
+        variable.line += lineDelta;
+        result.variables.append(variable);
+    }
+    for (int i=functionIndex+1; i<result.functions.size(); i++) {
+        ParseResultFunction & func = result.functions[i];
+        func.line += lineDelta;
+        shiftIndexes(func.variableIndexes, body.closeVariablesCount, variablesDelta);
+    }
+    for (int i=0; i<result.classes.size(); i++) {
+        ParseResultClass & cls = result.classes[i];
+        if (i >= body.classesCount) cls.line += lineDelta;
+        shiftIndexes(cls.variableIndexes, body.closeVariablesCount, variablesDelta);
+    }
+    for (int i=body.constantsCount; i<result.constants.size(); i++) {
+        result.constants[i].line += lineDelta;
+    }
+    for (int i=body.namespacesCount; i<result.namespaces.size(); i++) {
+        result.namespaces[i].line += lineDelta;
+    }
+    for (int i=body.importsCount; i<result.imports.size(); i++) {
+        result.imports[i].line += lineDelta;
+    }
+
+    // bracket errors of the region are found again
+    const int regionChangeStart = changeStart - region.start;
+    const int curlyDelta = state.curlyBracketsList.size() - body.closeCurlyBrackets;
+    const int roundDelta = state.roundBracketsList.size() - body.closeRoundBrackets;
+    const int squareDelta = state.squareBracketsList.size() - body.closeSquareBrackets;
+    regionState.curlyBracketsList = state.curlyBracketsList + shiftBrackets(regionState.curlyBracketsList.mid(body.closeCurlyBrackets), delta);
+    regionState.roundBracketsList = state.roundBracketsList + shiftBrackets(regionState.roundBracketsList.mid(body.closeRoundBrackets), delta);
+    regionState.squareBracketsList = state.squareBracketsList + shiftBrackets(regionState.squareBracketsList.mid(body.closeSquareBrackets), delta);
+    regionState.shiftPositions(regionChangeStart, delta);
+    const int errorsFrom = regionErrors.at(body.regionIndex);
+    const int errorsTo = body.regionIndex + 1 < regionErrors.size() ? regionErrors.at(body.regionIndex + 1) : prevResult.errors.size();
+    result.errors.resize(errorsFrom);
+    addBracketErrors(text, region.start, regionState);
+    const int errorsDelta = result.errors.size() - errorsTo;
+    for (int i=errorsTo; i<prevResult.errors.size(); i++) {
+        ParseResultError error = prevResult.errors.at(i);
+        error.line += lineDelta;
+        error.symbol += delta;
+        result.errors.append(error);
+    }
+    for (int i=body.regionIndex+1; i<regionErrors.size(); i++) {
+        regionErrors[i] += errorsDelta;
+    }
+    result.comments.clear();
+    addComments();
+
+    // the kept bodies after the changed one are moved too
+    for (int i=bodyIndex+1; i<functionBodies.size(); i++) {
+        FunctionBody & nextBody = functionBodies[i];
+        nextBody.openToken += indexDelta;
+        if (nextBody.closeToken >= 0) nextBody.closeToken += indexDelta;
+        nextBody.start += delta;
+        if (nextBody.end >= 0) nextBody.end += delta;
+        nextBody.variablesCount += variablesDelta;
+        if (nextBody.closeVariablesCount >= 0) nextBody.closeVariablesCount += variablesDelta;
+        shiftIndexes(nextBody.argIndexes, body.closeVariablesCount, variablesDelta);
+        for (int a=0; a<nextBody.args.size(); a++) {
+            nextBody.args[a].line += lineDelta;
+        }
+        if (nextBody.regionIndex != body.regionIndex) continue;
+        nextBody.openState.shiftPositions(regionChangeStart, delta);
+        nextBody.closeState.shiftPositions(regionChangeStart, delta);
+        nextBody.openCurlyBrackets += curlyDelta;
+        nextBody.openRoundBrackets += roundDelta;
+        nextBody.openSquareBrackets += squareDelta;
+        if (nextBody.closeToken < 0) continue;
+        nextBody.closeCurlyBrackets += curlyDelta;
+        nextBody.closeRoundBrackets += roundDelta;
+        nextBody.closeSquareBrackets += squareDelta;
+    }
+    body.closeToken = closeToken;
+    body.end += delta;
+    body.closeState = state;
+    body.closeState.curlyBracketsList.clear();
+    body.closeState.roundBracketsList.clear();
+    body.closeState.squareBracketsList.clear();
+    body.closeCurlyBrackets = state.curlyBracketsList.size();
+    body.closeRoundBrackets = state.roundBracketsList.size();
+    body.closeSquareBrackets = state.squareBracketsList.size();
+    body.closeVariablesCount = closeVariablesCount;
+    parsedText = text;
+    return true;
 }
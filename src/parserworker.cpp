@@ -12,6 +12,10 @@
 #include <QCoreApplication>
 #include <QStandardPaths>
 #include <QSettings>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
 #include "helper.h"
 #include "project.h"
 #include "servers.h"
@@ -25,8 +29,54 @@ const QString ANDROID_PHP_TMP_DIR = "tmp";
 const QString ANDROID_INSTALL_RESULT_LINE_TEMPLATE = "<p>%1</p>";
 const QString PHP_WEBSERVER_URI = "127.0.0.1:8000";
 
+const int PARSED_DOCUMENTS_LIMIT = 8;
+const int PROJECT_PARSE_WAIT_MILLISECONDS = 10;
+const int PROJECT_PARSE_FILES_LIMIT = 100;
+
 const QString ZIRA_DEV_PACK_PATH = "/data/data/com.github.ziracms.devpack/files/bin";
 
+// project files shared by the parsing threads,
+// each file is taken by the first free thread
+struct ProjectParseJob {
+    QStringList files;
+    QVector<ParsePHP::SharedParseResult> results;
+    QVector<QVariantMap> states;
+    QVector<QAtomicInt> ready;
+    QAtomicInt next;
+    QAtomicInt stop;
+    std::string encoding;
+    std::string encodingFallback;
+};
+
+class ProjectParseTask : public QRunnable
+{
+public:
+    explicit ProjectParseTask(ProjectParseJob * job): job(job) {}
+    void run() override {
+        for (;;) {
+            if (job->stop.loadAcquire() != 0) break;
+            int i = job->next.fetchAndAddRelaxed(1);
+            if (i >= job->files.size()) break;
+            QString file = job->files.at(i);
+            QFile f(file);
+            if (f.open(QIODevice::ReadOnly)) {
+                // file is read once for the parser and the content hash,
+                // the hash is taken from the bytes on disk like the size
+                QByteArray data = f.readAll();
+                f.close();
+                QString content = Helper::decodeTextData(data, job->encoding, job->encodingFallback, true);
+                content.replace("\r\n", "\n");
+                job->results[i] = parser.parse(content);
+                job->states[i] = Project::createPHPFileState(file, data);
+            }
+            job->ready[i].storeRelease(1);
+        }
+    }
+private:
+    ProjectParseJob * job;
+    ParsePHP parser;
+};
+
 ParserWorker::ParserWorker(QObject *parent) : QObject(parent){
     phpcsStandard = QString::fromStdString(Settings::get("parser_phpcs_standard"));
     if (phpcsStandard.size() == 0) phpcsStandard = "PEAR";
@@ -37,6 +87,8 @@ ParserWorker::ParserWorker(QObject *parent) : QObject(parent){
     encoding = Settings::get("editor_encoding");
     encodingFallback = Settings::get("editor_fallback_encoding");
     enabled = true;
+    debugStats = Settings::get("parser_debug_stats") == "yes";
+    parsedDocumentsUsage = 0;
     searchResultsCount = 0;
     searchBreaked = false;
     isBusy = false;
@@ -321,27 +373,138 @@ void ParserWorker::phpcs(int tabIndex, QString path)
     emit phpcsFinished(tabIndex, errorTexts, errorLines);
 }
 
+static void logParseStats(QString name, const QString & text, qint64 nsecs)
+{
+    int linesCount = text.count('\n') + 1;
+    Helper::log("Parse "+name+": "+Helper::intToStr(static_cast<int>(nsecs / 1000000))+" ms, "+Helper::intToStr(linesCount)+" lines\n");
+}
+
 void ParserWorker::parseMixed(int tabIndex, QString text)
 {
+    QElapsedTimer timer;
+    if (debugStats) timer.start();
     ParsePHP parser;
-    ParsePHP::ParseResult result = parser.parse(text);
+    ParsePHP::SharedParseResult result = parser.parse(text);
+    if (debugStats) logParseStats("PHP", text, timer.nsecsElapsed());
     emit parseMixedFinished(tabIndex, result);
 }
 
 void ParserWorker::parseJS(int tabIndex, QString text)
 {
+    QElapsedTimer timer;
+    if (debugStats) timer.start();
     ParseJS parser;
-    ParseJS::ParseResult result = parser.parse(text);
+    ParseJS::SharedParseResult result = parser.parse(text);
+    if (debugStats) logParseStats("JS", text, timer.nsecsElapsed());
     emit parseJSFinished(tabIndex, result);
 }
 
 void ParserWorker::parseCSS(int tabIndex, QString text)
 {
+    QElapsedTimer timer;
+    if (debugStats) timer.start();
     ParseCSS parser;
-    ParseCSS::ParseResult result = parser.parse(text);
+    ParseCSS::SharedParseResult result = parser.parse(text);
+    if (debugStats) logParseStats("CSS", text, timer.nsecsElapsed());
     emit parseCSSFinished(tabIndex, result);
 }
 
+// applies the edits to the kept text of the document and sets the changed part of it,
+// the change start is -1 if the whole text is changed. Returns nullptr and asks
+// for the whole text if the edits do not apply to the kept text.
+ParserWorker::ParsedDocument * ParserWorker::applyEdits(int tabIndex, Parse::TextEdits & edits, int & changeStart, int & changeEnd)
+{
+    changeStart = -1;
+    changeEnd = -1;
+    std::unordered_map<int, ParsedDocument>::iterator documentIterator = parsedDocuments.find(edits.documentId);
+    bool replaced = edits.edits.size() > 0 && edits.edits.at(0).removed < 0;
+    if (!replaced && (documentIterator == parsedDocuments.end() || documentIterator->second.revision != edits.baseRevision)) {
+        emit parseEditsRejected(tabIndex, edits.documentId);
+        return nullptr;
+    }
+    if (documentIterator == parsedDocuments.end()) {
+        if (static_cast<int>(parsedDocuments.size()) >= PARSED_DOCUMENTS_LIMIT) {
+            std::unordered_map<int, ParsedDocument>::iterator oldestIterator = parsedDocuments.begin();
+            for (auto it = parsedDocuments.begin(); it != parsedDocuments.end(); it++) {
+                if (it->second.usedAt < oldestIterator->second.usedAt) oldestIterator = it;
+            }
+            parsedDocuments.erase(oldestIterator);
+        }
+        documentIterator = parsedDocuments.emplace(edits.documentId, ParsedDocument()).first;
+        documentIterator->second.parsedPHPRevision = -1;
+    }
+    ParsedDocument & document = documentIterator->second;
+    document.usedAt = ++parsedDocumentsUsage;
+    QString & text = document.text;
+    // unchanged chars at the start and at the end of the text
+    int prefix = text.size(), suffix = text.size();
+    bool applied = true;
+    for (int i=0; i<edits.edits.size(); i++) {
+        const Parse::TextEdit & edit = edits.edits.at(i);
+        if (edit.removed < 0) {
+            text = edit.added;
+            prefix = -1;
+            continue;
+        }
+        if (edit.position < 0 || edit.position + edit.removed > text.size()) {
+            applied = false;
+            break;
+        }
+        if (prefix >= 0) {
+            prefix = qMin(prefix, edit.position);
+            suffix = qMin(suffix, text.size() - edit.position - edit.removed);
+        }
+        text.replace(edit.position, edit.removed, edit.added);
+    }
+    if (!applied || text.size() != edits.size) {
+        parsedDocuments.erase(documentIterator);
+        emit parseEditsRejected(tabIndex, edits.documentId);
+        return nullptr;
+    }
+    document.revision = edits.revision;
+    if (prefix >= 0) {
+        changeStart = prefix;
+        changeEnd = text.size() - qMin(suffix, text.size() - prefix);
+    }
+    return & document;
+}
+
+void ParserWorker::parseMixedEdits(int tabIndex, Parse::TextEdits edits)
+{
+    int changeStart, changeEnd;
+    int baseRevision = edits.baseRevision;
+    ParsedDocument * document = applyEdits(tabIndex, edits, changeStart, changeEnd);
+    if (document == nullptr) return;
+    QElapsedTimer timer;
+    if (debugStats) timer.start();
+    ParsePHP::SharedParseResult result;
+    // the parser keeps the tokens of the text it parsed last
+    if (changeStart >= 0 && document->parsedPHPRevision == baseRevision) {
+        result = document->parserPHP.parse(document->text, changeStart, changeEnd);
+    } else {
+        result = document->parserPHP.parse(document->text);
+    }
+    document->parsedPHPRevision = document->revision;
+    if (debugStats) logParseStats("PHP", document->text, timer.nsecsElapsed());
+    emit parseMixedFinished(tabIndex, result);
+}
+
+void ParserWorker::parseJSEdits(int tabIndex, Parse::TextEdits edits)
+{
+    int changeStart, changeEnd;
+    ParsedDocument * document = applyEdits(tabIndex, edits, changeStart, changeEnd);
+    if (document == nullptr) return;
+    parseJS(tabIndex, document->text);
+}
+
+void ParserWorker::parseCSSEdits(int tabIndex, Parse::TextEdits edits)
+{
+    int changeStart, changeEnd;
+    ParsedDocument * document = applyEdits(tabIndex, edits, changeStart, changeEnd);
+    if (document == nullptr) return;
+    parseCSS(tabIndex, document->text);
+}
+
 void ParserWorker::parseProject(QString path)
 {
     if (isBusy) {
@@ -353,37 +516,173 @@ void ParserWorker::parseProject(QString path)
     QStringList files;
     emit activateProgress();
     emit activateProgressInfo(tr("Scanning")+": "+path);
-    parseProjectDir(path, files);
+    // links to the project directory are not followed
+    QSet<QString> linkedDirs;
+    linkedDirs.insert(QFileInfo(path).canonicalFilePath());
+    parseProjectDir(path, files, linkedDirs);
     QVariantMap map = Project::createPHPResultMap();
-    QVariantMap data = Project::loadPHPDataMap(path);
-    Project::checkParsePHPFilesModified(files, data, map);
+    ProjectSymbols symbols;
+    Project::openPHPSymbols(path, symbols);
+    bool isTouched = Project::checkParsePHPFilesModified(files, symbols, map);
+    symbols.close();
+    bool isOutdated = Project::isPHPWordsOutdated(path);
     bool isBreaked = false;
     bool isModified = files.count() > 0;
-    for (int i=0; i<files.size(); i++) {
+    // files are parsed on all cores and merged here in their order
+    ProjectParseJob job;
+    job.files = files;
+    job.results.resize(files.size());
+    job.states.resize(files.size());
+    job.ready.resize(files.size());
+    job.encoding = encoding;
+    job.encodingFallback = encodingFallback;
+    QThreadPool pool;
+    int threadsCount = qBound(1, QThread::idealThreadCount(), qMax(1, files.size()));
+    pool.setMaxThreadCount(threadsCount);
+    // parsers are created here, so that shared parser data is loaded once
+    for (int t=0; t<threadsCount; t++) pool.start(new ProjectParseTask(& job));
+    int progress = -1;
+    for (int i=0; i<files.size();) {
+        QCoreApplication::processEvents();
         if (!enabled || wantStop) {
             isBreaked = true;
             break;
         }
-        QString file = files.at(i);
-        parseProjectFile(file, map);
-        int v = (i + 1) * 100 / files.size();
-        emit parseProjectProgress(v);
+        if (job.ready[i].loadAcquire() == 0) {
+            pool.waitForDone(PROJECT_PARSE_WAIT_MILLISECONDS);
+            continue;
+        }
+        for (; i<files.size() && job.ready[i].loadAcquire() != 0; i++) {
+            if (job.results.at(i).isNull()) continue;
+            Project::parsePHPResult(job.results.at(i), map, files.at(i), job.states.at(i));
+            job.results[i].reset();
+        }
+        emit updateProgressInfo(tr("Scanning")+": "+files.at(i-1));
+        int v = i * 100 / files.size();
+        if (v != progress) emit parseProjectProgress(v);
+        progress = v;
     }
-    if (!isBreaked && isModified) {
+    job.stop.storeRelease(1);
+    pool.waitForDone();
+    if (!isBreaked && (isModified || isTouched || isOutdated)) {
         emit updateProgressInfo(tr("Updating project")+"...");
         Project::savePHPResults(path, map);
     }
     map.clear();
-    data.clear();
     files.clear();
     emit parseProjectFinished(!isBreaked, isModified);
     emit deactivateProgress();
     emit deactivateProgressInfo();
     isBusy = false;
     wantStop = false;
+    if (pendingProjectFiles.size() > 0) parseProjectFiles(pendingProjectPath, QStringList());
+}
+
+// parses a saved project file, the result is sent to its tab (if any)
+// and replaces the old symbols of the file in the project index
+void ParserWorker::parseProjectFile(int tabIndex, QString text, QString projectPath, QString path)
+{
+    QElapsedTimer timer;
+    if (debugStats) timer.start();
+    ParsePHP parser;
+    ParsePHP::SharedParseResult result = parser.parse(text);
+    if (debugStats) logParseStats("PHP", text, timer.nsecsElapsed());
+    if (tabIndex >= 0) emit parseMixedFinished(tabIndex, result);
+    QVariantMap state = Project::readPHPFileState(path);
+    updateProjectFiles(projectPath, QStringList() << path, QVector<ParsePHP::SharedParseResult>() << result, QVector<QVariantMap>() << state, QVariantMap());
+}
+
+// reparses the project files that were changed outside of the editor
+void ParserWorker::parseProjectFiles(QString projectPath, QStringList files)
+{
+    if (pendingProjectPath != projectPath) pendingProjectFiles.clear();
+    pendingProjectPath = projectPath;
+    for (const QString & file : files) {
+        if (!pendingProjectFiles.contains(file)) pendingProjectFiles.append(file);
+    }
+    if (isBusy || pendingProjectFiles.size() == 0) return;
+    files = pendingProjectFiles;
+    pendingProjectFiles.clear();
+    // large batches (checkouts, installs) are left to the parallel project scan
+    if (files.size() > PROJECT_PARSE_FILES_LIMIT) {
+        parseProject(projectPath);
+        return;
+    }
+    ProjectSymbols symbols;
+    if (!Project::openPHPSymbols(projectPath, symbols)) return;
+    // unchanged files keep their symbols, but get the new modification time and size
+    QVariantMap touchedStates;
+    int i=0;
+    while (i<files.size()) {
+        QString file = files.at(i);
+        int fileIndex = symbols.findFile(file);
+        bool exists = Helper::fileExists(file);
+        if (!exists && fileIndex < 0) {
+            files.removeAt(i);
+            continue;
+        }
+        if (exists && fileIndex >= 0) {
+            QVariantMap state = symbols.getFileState(fileIndex);
+            QVariantMap newState;
+            if (!Project::isPHPFileChanged(file, state, newState)) {
+                if (newState != state) touchedStates.insert(file, QVariant(newState));
+                files.removeAt(i);
+                continue;
+            }
+        }
+        i++;
+    }
+    symbols.close();
+    if (files.size() == 0 && touchedStates.size() == 0) return;
+    QVector<ParsePHP::SharedParseResult> results;
+    QVector<QVariantMap> states;
+    ParsePHP parser;
+    for (const QString & file : files) {
+        ParsePHP::SharedParseResult result;
+        QVariantMap state;
+        QFile f(file);
+        if (f.open(QIODevice::ReadOnly)) {
+            QByteArray data = f.readAll();
+            f.close();
+            QString content = Helper::decodeTextData(data, encoding, encodingFallback, true);
+            content.replace("\r\n", "\n");
+            result = parser.parse(content);
+            state = Project::createPHPFileState(file, data);
+        }
+        results.append(result);
+        states.append(state);
+    }
+    updateProjectFiles(projectPath, files, results, states, touchedStates);
 }
 
-void ParserWorker::parseProjectDir(QString dir, QStringList & files)
+// replaces the symbols of the files in the project index,
+// files without a result were deleted, touched files only get their new state
+void ParserWorker::updateProjectFiles(QString projectPath, QStringList files, QVector<ParsePHP::SharedParseResult> results, QVector<QVariantMap> states, QVariantMap touchedStates)
+{
+    if (isBusy) {
+        // a running project update may have missed them
+        parseProjectFiles(projectPath, files + touchedStates.keys());
+        return;
+    }
+    ProjectSymbols symbols;
+    if (!Project::openPHPSymbols(projectPath, symbols)) return;
+    QSet<QString> paths;
+    QVariantMap oldMap = Project::createPHPResultMap();
+    for (const QString & file : files) {
+        paths.insert(file);
+        symbols.readFile(symbols.findFile(file), oldMap);
+    }
+    QVariantMap newMap = Project::createPHPResultMap();
+    for (int i=0; i<files.size(); i++) {
+        if (results.at(i).isNull()) continue;
+        Project::parsePHPResult(results.at(i), newMap, files.at(i), states.at(i));
+    }
+    Project::updatePHPResults(projectPath, symbols, paths, newMap, touchedStates);
+    symbols.close();
+    if (files.size() > 0) emit projectFileUpdated(files, oldMap, newMap);
+}
+
+void ParserWorker::parseProjectDir(QString dir, QStringList & files, QSet<QString> & linkedDirs)
 {
     QDirIterator it(dir, QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot);
     while (it.hasNext()) {
@@ -391,28 +690,13 @@ void ParserWorker::parseProjectDir(QString dir, QStringList & files)
         QFileInfo fInfo(path);
         if (!fInfo.exists() || !fInfo.isReadable()) continue;
         if (fInfo.isDir()) {
-            parseProjectDir(path, files);
+            if (Project::isProjectDir(fInfo, linkedDirs)) parseProjectDir(path, files, linkedDirs);
         } else if (fInfo.isFile() && Project::isProjectFile(path)) {
             files.append(path);
         }
     }
 }
 
-void ParserWorker::parseProjectFile(QString file, QVariantMap & map)
-{
-    QCoreApplication::processEvents();
-    if (wantStop) return;
-    if (!Helper::fileExists(file)) return;
-    emit updateProgressInfo(tr("Scanning")+": "+file);
-    QString content = Helper::loadTextFile(file, encoding, encodingFallback, true);
-    ParsePHP parser;
-    ParsePHP::ParseResult result = parser.parse(content);
-    QFileInfo fInfo(file);
-    QDateTime dt = fInfo.lastModified();
-    QString dts = QString::number(dt.toMSecsSinceEpoch());
-    Project::parsePHPResult(result, map, file, dts);
-}
-
 void ParserWorker::searchInFiles(QString searchDirectory, QString searchText, QString searchExtensions, bool searchOptionCase, bool searchOptionWord, bool searchOptionRegexp, QStringList excludeDirs)
 {
     if (isBusy) {
@@ -454,7 +738,7 @@ void ParserWorker::searchInDir(QString searchDirectory, QString searchText, QStr
         QString path = it.next();
         QFileInfo fInfo(path);
         if (!fInfo.exists() || !fInfo.isReadable()) continue;
-        if (fInfo.isDir() && (fInfo.fileName() == ".git" || fInfo.fileName() == PROJECT_SUBDIR || fInfo.fileName() == ".idea" || fInfo.fileName() == ".vscode" || fInfo.fileName() == "nbproject")) continue;
+        if (fInfo.isDir() && Project::isExcludedDir(fInfo.fileName())) continue;
         if (fInfo.isDir() && excludeDirs.contains(fInfo.absoluteFilePath())) continue;
         if (fInfo.isDir()) {
             searchInDir(path, searchText, searchExtensions, searchOptionCase, searchOptionWord, searchOptionRegexp, excludeDirs);
@@ -670,35 +954,26 @@ void ParserWorker::sassCommand(QString src, QString dst)
     if (!isBusy) emit deactivateProgress();
 }
 
-void ParserWorker::quickFind(QString dir, QString text, WordsMapList words, QStringList wordPrefixes)
+void ParserWorker::quickFind(QString dir, QString text, QString projectPath)
 {
     if (!isBusy) emit activateProgress();
     quickResultsCount = 0;
     quickBreaked = false;
-    // words
-    int it = 0;
-    for (auto wordsList : words) {
-        //QCoreApplication::processEvents();
-        if (!enabled) break;
-        QString prefix = "";
-        if (it < wordPrefixes.size()) prefix = wordPrefixes.at(it);
-        it++;
-        int co = 0;
-        // words
-        for (auto it : wordsList) {
-            QString name = QString::fromStdString(it.first);
-            if (name.indexOf(text, 0, Qt::CaseInsensitive) >= 0) {
-                QString dec_str = QString::fromStdString(it.second);
-                int p = dec_str.lastIndexOf(":");
-                if (p >= 0) {
-                    QString path = dec_str.mid(0, p).trimmed();
-                    int line = dec_str.mid(p+1).toInt();
-                    emit quickFound(text, prefix+name, path, line);
-                    co++;
-                    if (co >= 100) break;
-                }
+    // declarations
+    ProjectSymbols symbols;
+    if (projectPath.size() > 0 && Project::openPHPSymbols(projectPath, symbols)) {
+        const int kinds[] = {ProjectSymbols::KIND_CLASS, ProjectSymbols::KIND_METHOD, ProjectSymbols::KIND_FUNCTION};
+        const QString prefixes[] = {"class: ", "method: ", "function: "};
+        for (int k=0; k<3 && enabled; k++) {
+            QVector<int> found = symbols.searchSymbols(kinds[k], text, 100);
+            for (int index : found) {
+                int line = 0;
+                QString path = symbols.getSymbolFile(index, line);
+                if (path.size() == 0) continue;
+                emit quickFound(text, prefixes[k]+symbols.getSymbolName(index), path, line);
             }
         }
+        symbols.close();
     }
     // search files
     quickFindInDir(dir, dir, text);
@@ -716,7 +991,7 @@ void ParserWorker::quickFindInDir(QString startDir, QString dir, QString text)
         QString path = it.next();
         QFileInfo fInfo(path);
         if (!fInfo.exists() || !fInfo.isReadable()) continue;
-        if (fInfo.isDir() && (fInfo.fileName() == ".git" || fInfo.fileName() == PROJECT_SUBDIR || fInfo.fileName() == ".idea" || fInfo.fileName() == ".vscode" || fInfo.fileName() == "nbproject")) continue;
+        if (fInfo.isDir() && Project::isExcludedDir(fInfo.fileName())) continue;
         if (fInfo.isDir()) {
             quickFindInDir(startDir, path, text);
         } else if (fInfo.isFile()) {
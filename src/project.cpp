@@ -7,6 +7,7 @@
 #include "project.h"
 #include "parsephp.h"
 #include "helper.h"
+#include "settings.h"
 #include <QVariantMap>
 #include <QJsonObject>
 #include <QJsonDocument>
@@ -15,11 +16,12 @@
 #include <QDateTime>
 #include <QFileInfo>
 #include <QTextStream>
+#include <QDirIterator>
+#include <QCryptographicHash>
 
 const std::string PROJECT_DATA_ENCODING = "UTF-8";
 const QString PROJECT_SUBDIR = ".zira";
 const QString PROJECT_META_FILE = "meta.json";
-const QString PROJECT_PHP_DATA_FILE = "php_data.json";
 const QString PROJECT_PHP_CONSTS_FILE = "php_consts";
 const QString PROJECT_PHP_CLASS_CONSTS_FILE = "php_class_consts";
 const QString PROJECT_PHP_VARS_FILE = "php_globals";
@@ -30,11 +32,33 @@ const QString PROJECT_PHP_CLASSES_FILE = "php_classes";
 const QString PROJECT_PHP_CLASS_PARENTS_FILE = "php_class_parents";
 const QString PROJECT_PHP_CLASS_METHOD_TYPES_FILE = "php_class_method_types";
 const QString PROJECT_PHP_FUNCTION_TYPES_FILE = "php_function_types";
-const QString PROJECT_PHP_FUNCTIONS_SEARCH_FILE = "php_functions_search";
-const QString PROJECT_PHP_CLASS_METHODS_SEARCH_FILE = "php_class_methods_search";
-const QString PROJECT_PHP_CLASSES_SEARCH_FILE = "php_classes_search";
 const QString PROJECT_PHP_CLASS_METHODS_HELP_FILE = "php_class_methods_help";
 const QString PROJECT_PHP_FUNCTIONS_HELP_FILE = "php_functions_help";
+// created when the symbols database was updated without the word files
+const QString PROJECT_PHP_WORDS_OUTDATED_FILE = "php_words_outdated";
+// word files in the order they are loaded
+const QStringList PROJECT_PHP_WORDS_FILES = {
+    PROJECT_PHP_FUNCTIONS_FILE,
+    PROJECT_PHP_CONSTS_FILE,
+    PROJECT_PHP_CLASSES_FILE,
+    PROJECT_PHP_CLASS_METHODS_FILE,
+    PROJECT_PHP_CLASS_CONSTS_FILE,
+    PROJECT_PHP_CLASS_PROPS_FILE,
+    PROJECT_PHP_CLASS_PARENTS_FILE,
+    PROJECT_PHP_FUNCTION_TYPES_FILE,
+    PROJECT_PHP_CLASS_METHOD_TYPES_FILE,
+    PROJECT_PHP_FUNCTIONS_HELP_FILE,
+    PROJECT_PHP_CLASS_METHODS_HELP_FILE
+};
+// files of the older project versions
+const QStringList PROJECT_LEGACY_FILES = {
+    "php_data.json",
+    "php_functions_search",
+    "php_class_methods_search",
+    "php_classes_search"
+};
+const QString PROJECT_HIGHLIGHT_CACHE_SUBDIR = "highlight";
+const QString PROJECT_HIGHLIGHT_CACHE_EXTENSION = ".cache";
 
 const QString PARSE_PROJECT_PHP_EXT = "php";
 const QString GIT_IGNORE_FILE = ".gitignore";
@@ -64,9 +88,6 @@ void Project::reset()
     projectModified = "";
     projectPHPLintEnabled = false;
     projectPHPCSEnabled = false;
-    phpFunctionDeclarations.clear();
-    phpClassMethodDeclarations.clear();
-    phpClassDeclarations.clear();
 }
 
 bool Project::isOpen()
@@ -82,11 +103,24 @@ void Project::deleteDataFile()
     if (!Helper::folderExists(project_dir)) {
         return;
     }
-    QString data_filename = project_dir + "/" + PROJECT_PHP_DATA_FILE;
-    if (!Helper::fileExists(data_filename)) {
-        return;
+    QString data_filename = project_dir + "/" + PROJECT_PHP_SYMBOLS_FILE;
+    if (Helper::fileExists(data_filename)) {
+        Helper::deleteFile(data_filename);
+    }
+    QString export_filename = project_dir + "/" + PROJECT_PHP_SYMBOLS_EXPORT_FILE;
+    if (Helper::fileExists(export_filename)) {
+        Helper::deleteFile(export_filename);
+    }
+}
+
+void Project::deleteLegacyFiles(QString project_dir)
+{
+    for (const QString & legacyFile : PROJECT_LEGACY_FILES) {
+        QString legacy_filename = project_dir + "/" + legacyFile;
+        if (Helper::fileExists(legacy_filename)) {
+            Helper::deleteFile(legacy_filename);
+        }
     }
-    Helper::deleteFile(data_filename);
 }
 
 bool Project::updateMetaFile(QString name, QString path, bool lintEnabled, bool csEnabled, QString time_created, QString time_modified, QStringList openTabFiles, QList<int> openTabLines, int currentTabIndex, QString todo)
@@ -257,6 +291,7 @@ bool Project::open(QString path)
     int tabIndex = tabIndexVal.toInt();
     QJsonValue todoVal = o.value("todo");
     QString todo = todoVal.toString();
+    deleteLegacyFiles(project_dir);
     reset();
     projectName = name;
     projectPath = path;
@@ -290,6 +325,36 @@ void Project::save(QStringList openTabFiles, QList<int> openTabLines, int curren
     updateMetaFile(projectName, projectPath, projectPHPLintEnabled, projectPHPCSEnabled, projectCreated, time, openTabFiles, openTabLines, currentTabIndex, todo);
 }
 
+QString Project::getHighlightCacheFile(QString path)
+{
+    if (!isOpen()) return "";
+    QString cache_dir = projectPath + "/" + PROJECT_SUBDIR + "/" + PROJECT_HIGHLIGHT_CACHE_SUBDIR;
+    if (!Helper::folderExists(cache_dir) && !Helper::createDir(cache_dir)) {
+        return "";
+    }
+    QString name = QString::fromLatin1(QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Md5).toHex());
+    return cache_dir + "/" + name + PROJECT_HIGHLIGHT_CACHE_EXTENSION;
+}
+
+// removes cached highlight formats of the files that are not open
+void Project::cleanHighlightCache(QStringList openTabFiles)
+{
+    if (!isOpen()) return;
+    QString cache_dir = projectPath + "/" + PROJECT_SUBDIR + "/" + PROJECT_HIGHLIGHT_CACHE_SUBDIR;
+    if (!Helper::folderExists(cache_dir)) {
+        return;
+    }
+    QStringList cacheFiles;
+    for (int i=0; i<openTabFiles.size(); i++) {
+        cacheFiles.append(getHighlightCacheFile(openTabFiles.at(i)));
+    }
+    QDirIterator it(cache_dir, QStringList() << "*" + PROJECT_HIGHLIGHT_CACHE_EXTENSION, QDir::Files);
+    while (it.hasNext()) {
+        QString cacheFile = it.next();
+        if (!cacheFiles.contains(cacheFile)) Helper::deleteFile(cacheFile);
+    }
+}
+
 QString Project::getName()
 {
     return projectName;
@@ -323,14 +388,22 @@ void Project::loadWords()
 void Project::loadPHPWords(QString project_dir)
 {
     QString k;
+    for (const QString & type : PROJECT_PHP_WORDS_FILES) {
+        QFile f(project_dir + "/" + type);
+        f.open(QIODevice::ReadOnly);
+        QTextStream in(&f);
+        while (!in.atEnd()) {
+            k = in.readLine();
+            if (k == "") continue;
+            addPHPWord(type, k);
+        }
+        f.close();
+    }
+}
 
-    // php functions
-    QFile ff(project_dir + "/" + PROJECT_PHP_FUNCTIONS_FILE);
-    ff.open(QIODevice::ReadOnly);
-    QTextStream fin(&ff);
-    while (!fin.atEnd()) {
-        k = fin.readLine();
-        if (k == "") continue;
+void Project::addPHPWord(const QString & type, QString k)
+{
+    if (type == PROJECT_PHP_FUNCTIONS_FILE) {
         QString kName = "", kParams = "";
         int kSep = k.indexOf("(");
         if (kSep > 0) {
@@ -343,28 +416,10 @@ void Project::loadPHPWords(QString project_dir)
             CW->phpFunctionsComplete[k.toStdString()] = k.toStdString();
             //HighlightWords::addPHPFunction(k);
         }
-    }
-    ff.close();
-
-    // php consts
-    QFile cnf(project_dir + "/" + PROJECT_PHP_CONSTS_FILE);
-    cnf.open(QIODevice::ReadOnly);
-    QTextStream cnin(&cnf);
-    while (!cnin.atEnd()) {
-        k = cnin.readLine();
-        if (k == "") continue;
+    } else if (type == PROJECT_PHP_CONSTS_FILE) {
         CW->phpConstsComplete[k.toStdString()] = k.toStdString();
         HighlightWords::addPHPConstant(k);
-    }
-    cnf.close();
-
-    // php classes
-    QFile cf(project_dir + "/" + PROJECT_PHP_CLASSES_FILE);
-    cf.open(QIODevice::ReadOnly);
-    QTextStream cin(&cf);
-    while (!cin.atEnd()) {
-        k = cin.readLine();
-        if (k == "") continue;
+    } else if (type == PROJECT_PHP_CLASSES_FILE) {
         QString kName = "", kParams = "";
         int kSep = k.indexOf("(");
         if (kSep > 0) {
@@ -372,31 +427,17 @@ void Project::loadPHPWords(QString project_dir)
             kParams = k.mid(kSep).trimmed();
             CW->phpClassesComplete[kName.toStdString()] = kParams.toStdString();
             CW->tooltipsPHP[kName.toStdString()] = kParams.replace("<", "&lt;").replace(">", "&gt;").toStdString();
-            QStringList classParts = kName.split("\\");
-            for (int i=0; i<classParts.size(); i++) {
-                QString classPart = classParts.at(i);
-                if (classPart.size() == 0) continue;
-                HighlightWords::addPHPClass(classPart);
-            }
         } else {
+            kName = k;
             CW->phpClassesComplete[k.toStdString()] = k.toStdString();
-            QStringList classParts = k.split("\\");
-            for (int i=0; i<classParts.size(); i++) {
-                QString classPart = classParts.at(i);
-                if (classPart.size() == 0) continue;
-                HighlightWords::addPHPClass(classPart);
-            }
         }
-    }
-    cf.close();
-
-    // php class methods
-    QFile mf(project_dir + "/" + PROJECT_PHP_CLASS_METHODS_FILE);
-    mf.open(QIODevice::ReadOnly);
-    QTextStream min(&mf);
-    while (!min.atEnd()) {
-        k = min.readLine();
-        if (k == "") continue;
+        QStringList classParts = kName.split("\\");
+        for (int i=0; i<classParts.size(); i++) {
+            QString classPart = classParts.at(i);
+            if (classPart.size() == 0) continue;
+            HighlightWords::addPHPClass(classPart);
+        }
+    } else if (type == PROJECT_PHP_CLASS_METHODS_FILE) {
         QString kName = "", kParams = "";
         int kSep = k.indexOf("(");
         if (kSep > 0) {
@@ -409,177 +450,129 @@ void Project::loadPHPWords(QString project_dir)
             CW->phpClassMethodsComplete[k.toStdString()] = k.toStdString();
             //HighlightWords::addPHPFunction(k);
         }
-    }
-    mf.close();
-
-    // php class consts
-    QFile cof(project_dir + "/" + PROJECT_PHP_CLASS_CONSTS_FILE);
-    cof.open(QIODevice::ReadOnly);
-    QTextStream coin(&cof);
-    while (!coin.atEnd()) {
-        k = coin.readLine();
-        if (k == "") continue;
+    } else if (type == PROJECT_PHP_CLASS_CONSTS_FILE) {
         CW->phpClassConstsComplete[k.toStdString()] = k.toStdString();
         QStringList kParts = k.split("::");
         if (kParts.size() == 2) HighlightWords::addPHPClassConstant(kParts.at(0), kParts.at(1));
-    }
-    cof.close();
-
-    // php class props
-    QFile pof(project_dir + "/" + PROJECT_PHP_CLASS_PROPS_FILE);
-    pof.open(QIODevice::ReadOnly);
-    QTextStream poin(&pof);
-    while (!poin.atEnd()) {
-        k = poin.readLine();
-        if (k == "") continue;
+    } else if (type == PROJECT_PHP_CLASS_PROPS_FILE) {
         CW->phpClassPropsComplete[k.toStdString()] = k.toStdString();
+    } else if (type == PROJECT_PHP_CLASS_PARENTS_FILE || type == PROJECT_PHP_FUNCTION_TYPES_FILE || type == PROJECT_PHP_CLASS_METHOD_TYPES_FILE) {
+        QStringList kList = k.split(" ");
+        if (kList.size() != 2) return;
+        if (type == PROJECT_PHP_CLASS_PARENTS_FILE) CW->phpClassParents[kList.at(0).toStdString()] = kList.at(1).toStdString();
+        else if (type == PROJECT_PHP_FUNCTION_TYPES_FILE) CW->phpFunctionTypes[kList.at(0).toStdString()] = kList.at(1).toStdString();
+        else CW->phpClassMethodTypes[kList.at(0).toStdString()] = kList.at(1).toStdString();
+    } else {
+        if (k.indexOf(" ") < 0) return;
+        QString func = k.mid(0, k.indexOf(" "));
+        QString desc = k.mid(k.indexOf(" ")+1);
+        if (type == PROJECT_PHP_FUNCTIONS_HELP_FILE) HPW->phpFunctionDescs[func.toStdString()] = desc.replace("<br />", "\n").toStdString();
+        else if (type == PROJECT_PHP_CLASS_METHODS_HELP_FILE) HPW->phpClassMethodDescs[func.toStdString()] = desc.replace("<br />", "\n").toStdString();
     }
-    pof.close();
+}
 
-    // php class parents
-    QFile cpf(project_dir + "/" + PROJECT_PHP_CLASS_PARENTS_FILE);
-    cpf.open(QIODevice::ReadOnly);
-    QTextStream cpin(&cpf);
-    while (!cpin.atEnd()) {
-        k = cpin.readLine();
-        if (k == "") continue;
-        QStringList kList = k.split(" ");
-        if (kList.size() != 2) continue;
-        CW->phpClassParents[kList.at(0).toStdString()] = kList.at(1).toStdString();
-    }
-    cpf.close();
-
-    // php function types
-    QFile ftf(project_dir + "/" + PROJECT_PHP_FUNCTION_TYPES_FILE);
-    ftf.open(QIODevice::ReadOnly);
-    QTextStream ftin(&ftf);
-    while (!ftin.atEnd()) {
-        k = ftin.readLine();
-        if (k == "") continue;
-        QStringList kList = k.split(" ");
-        if (kList.size() != 2) continue;
-        CW->phpFunctionTypes[kList.at(0).toStdString()] = kList.at(1).toStdString();
-    }
-    ftf.close();
-
-    // php class method types
-    QFile mtf(project_dir + "/" + PROJECT_PHP_CLASS_METHOD_TYPES_FILE);
-    mtf.open(QIODevice::ReadOnly);
-    QTextStream mtin(&mtf);
-    while (!mtin.atEnd()) {
-        k = mtin.readLine();
-        if (k == "") continue;
-        QStringList kList = k.split(" ");
-        if (kList.size() != 2) continue;
-        CW->phpClassMethodTypes[kList.at(0).toStdString()] = kList.at(1).toStdString();
-    }
-    mtf.close();
-
-    QString func, desc;
-
-    // php function descriptions
-    QFile hpf(project_dir + "/" + PROJECT_PHP_FUNCTIONS_HELP_FILE);
-    hpf.open(QIODevice::ReadOnly);
-    QTextStream hpin(&hpf);
-    while (!hpin.atEnd()) {
-        k = hpin.readLine();
-        if (k == "" || k.indexOf(" ") < 0) continue;
-        func = k.mid(0, k.indexOf(" "));
-        desc = k.mid(k.indexOf(" ")+1);
-        HPW->phpFunctionDescs[func.toStdString()] = desc.replace("<br />", "\n").toStdString();
-    }
-    hpf.close();
-
-    // php class method descriptions
-    QFile hcf(project_dir + "/" + PROJECT_PHP_CLASS_METHODS_HELP_FILE);
-    hcf.open(QIODevice::ReadOnly);
-    QTextStream hcin(&hcf);
-    while (!hcin.atEnd()) {
-        k = hcin.readLine();
-        if (k == "" || k.indexOf(" ") < 0) continue;
-        func = k.mid(0, k.indexOf(" "));
-        desc = k.mid(k.indexOf(" ")+1);
-        HPW->phpClassMethodDescs[func.toStdString()] = desc.replace("<br />", "\n").toStdString();
-    }
-    hcf.close();
-
-    // php function declarations
-    QFile spf(project_dir + "/" + PROJECT_PHP_FUNCTIONS_SEARCH_FILE);
-    spf.open(QIODevice::ReadOnly);
-    QTextStream spin(&spf);
-    while (!spin.atEnd()) {
-        k = spin.readLine();
-        if (k == "" || k.indexOf(" ") < 0) continue;
-        func = k.mid(0, k.indexOf(" "));
-        desc = k.mid(k.indexOf(" ")+1);
-        phpFunctionDeclarations[func.toStdString()] = desc.toStdString();
-    }
-    spf.close();
-
-    // php class method declarations
-    QFile scf(project_dir + "/" + PROJECT_PHP_CLASS_METHODS_SEARCH_FILE);
-    scf.open(QIODevice::ReadOnly);
-    QTextStream scin(&scf);
-    while (!scin.atEnd()) {
-        k = scin.readLine();
-        if (k == "" || k.indexOf(" ") < 0) continue;
-        func = k.mid(0, k.indexOf(" "));
-        desc = k.mid(k.indexOf(" ")+1);
-        phpClassMethodDeclarations[func.toStdString()] = desc.toStdString();
-    }
-    scf.close();
-
-    // php class declarations
-    QFile lcf(project_dir + "/" + PROJECT_PHP_CLASSES_SEARCH_FILE);
-    lcf.open(QIODevice::ReadOnly);
-    QTextStream lcin(&lcf);
-    while (!lcin.atEnd()) {
-        k = lcin.readLine();
-        if (k == "" || k.indexOf(" ") < 0) continue;
-        func = k.mid(0, k.indexOf(" "));
-        desc = k.mid(k.indexOf(" ")+1);
-        phpClassDeclarations[func.toStdString()] = desc.toStdString();
-    }
-    lcf.close();
+// highlight words cannot be removed, they are dropped on the next project update
+void Project::removePHPWord(const QString & type, QString k)
+{
+    std::string kName;
+    int kSep = k.indexOf("(");
+    if (kSep > 0) kName = k.mid(0, kSep).trimmed().toStdString();
+    else kName = k.toStdString();
+    if (type == PROJECT_PHP_FUNCTIONS_FILE) {
+        CW->phpFunctionsComplete.erase(kName);
+        CW->tooltipsPHP.erase(kName);
+    } else if (type == PROJECT_PHP_CONSTS_FILE) {
+        CW->phpConstsComplete.erase(kName);
+    } else if (type == PROJECT_PHP_CLASSES_FILE) {
+        CW->phpClassesComplete.erase(kName);
+        CW->tooltipsPHP.erase(kName);
+    } else if (type == PROJECT_PHP_CLASS_METHODS_FILE) {
+        CW->phpClassMethodsComplete.erase(kName);
+        CW->tooltipsPHP.erase(kName);
+    } else if (type == PROJECT_PHP_CLASS_CONSTS_FILE) {
+        CW->phpClassConstsComplete.erase(kName);
+    } else if (type == PROJECT_PHP_CLASS_PROPS_FILE) {
+        CW->phpClassPropsComplete.erase(kName);
+    } else {
+        if (k.indexOf(" ") < 0) return;
+        std::string func = k.mid(0, k.indexOf(" ")).toStdString();
+        if (type == PROJECT_PHP_CLASS_PARENTS_FILE) CW->phpClassParents.erase(func);
+        else if (type == PROJECT_PHP_FUNCTION_TYPES_FILE) CW->phpFunctionTypes.erase(func);
+        else if (type == PROJECT_PHP_CLASS_METHOD_TYPES_FILE) CW->phpClassMethodTypes.erase(func);
+        else if (type == PROJECT_PHP_FUNCTIONS_HELP_FILE) HPW->phpFunctionDescs.erase(func);
+        else if (type == PROJECT_PHP_CLASS_METHODS_HELP_FILE) HPW->phpClassMethodDescs.erase(func);
+    }
 }
 
-void Project::findDeclaration(QString name, QString & path, int & line)
+// replaces the words of the files, that were prepared from their old symbols,
+// with the words of their new symbols. Names that are still declared
+// in other files get the words of those declarations back.
+void Project::updatePHPWords(QStringList files, QVariantMap & oldMap, QVariantMap & newMap)
 {
-    if (name.indexOf("::") >= 0) {
-        phpClassMethodDeclarationsIterator = phpClassMethodDeclarations.find(name.toStdString());
-        if (phpClassMethodDeclarationsIterator != phpClassMethodDeclarations.end()) {
-            QString dec_str = QString::fromStdString(phpClassMethodDeclarationsIterator->second);
-            int p = dec_str.lastIndexOf(":");
-            if (p >= 0) {
-                path = dec_str.mid(0, p).trimmed();
-                line = dec_str.mid(p+1).toInt();
+    if (!isOpen()) return;
+    ProjectSymbols symbols;
+    if (openPHPSymbols(projectPath, symbols)) {
+        const QString kindKeys[] = {"php_consts", "php_functions", "php_classes"};
+        const int kinds[] = {ProjectSymbols::KIND_CONSTANT, ProjectSymbols::KIND_FUNCTION, ProjectSymbols::KIND_CLASS};
+        for (int k=0; k<3; k++) {
+            QVariantMap oldKindMap = qvariant_cast<QVariantMap>(oldMap.value(kindKeys[k]));
+            QVariantMap newKindMap = qvariant_cast<QVariantMap>(newMap.take(kindKeys[k]));
+            for (QVariantMap::const_iterator it = oldKindMap.constBegin(); it != oldKindMap.constEnd(); ++it) {
+                QString name = qvariant_cast<QVariantMap>(it.value()).value("name").toString();
+                if (newKindMap.contains(name)) continue;
+                QVector<int> indexes = symbols.findSymbols(kinds[k], name);
+                for (int index : indexes) {
+                    QVariantMap m = symbols.getSymbol(index);
+                    if (files.contains(m.value("file").toString())) continue;
+                    ProjectSymbols::insertSymbol(newKindMap, m);
+                    break;
+                }
             }
+            newMap.insert(kindKeys[k], QVariant(newKindMap));
         }
-    } else {
-        phpClassDeclarationsIterator = phpClassDeclarations.find(name.toStdString());
-        if (phpClassDeclarationsIterator != phpClassDeclarations.end()) {
-            QString dec_str = QString::fromStdString(phpClassDeclarationsIterator->second);
-            int p = dec_str.lastIndexOf(":");
-            if (p >= 0) {
-                path = dec_str.mid(0, p).trimmed();
-                line = dec_str.mid(p+1).toInt();
-            }
+        symbols.close();
+    }
+    QHash<QString, QString> oldWords, newWords;
+    preparePHPWords(oldMap, oldWords);
+    preparePHPWords(newMap, newWords);
+    for (const QString & type : PROJECT_PHP_WORDS_FILES) {
+        QStringList lines = oldWords.value(type).split("\n");
+        for (const QString & k : lines) {
+            if (k == "") continue;
+            removePHPWord(type, k);
         }
-        if (path.size() == 0 || line <= 0) {
-            if (name.indexOf("\\") >= 0) name = name.mid(name.lastIndexOf("\\")+1);
-            phpFunctionDeclarationsIterator = phpFunctionDeclarations.find(name.toStdString());
-            if (phpFunctionDeclarationsIterator != phpFunctionDeclarations.end()) {
-                QString dec_str = QString::fromStdString(phpFunctionDeclarationsIterator->second);
-                int p = dec_str.lastIndexOf(":");
-                if (p >= 0) {
-                    path = dec_str.mid(0, p).trimmed();
-                    line = dec_str.mid(p+1).toInt();
-                }
-            }
+    }
+    for (const QString & type : PROJECT_PHP_WORDS_FILES) {
+        QStringList lines = newWords.value(type).split("\n");
+        for (const QString & k : lines) {
+            if (k == "") continue;
+            addPHPWord(type, k);
         }
     }
 }
 
+// methods are also looked up in the parent classes,
+// functions fall back to the global namespace
+void Project::findDeclaration(QString name, QString & path, int & line)
+{
+    if (!isOpen() || name.size() == 0) return;
+    ProjectSymbols symbols;
+    if (!openPHPSymbols(projectPath, symbols)) return;
+    if (name.at(0) != "\\") name = "\\" + name;
+    int index = -1;
+    int p = name.indexOf("::");
+    if (p >= 0) {
+        int classIndex = symbols.findSymbol(ProjectSymbols::KIND_CLASS, name.mid(0, p));
+        index = symbols.findClassMember(classIndex, ProjectSymbols::KIND_METHOD, name.mid(p+2));
+    } else {
+        index = symbols.findSymbol(ProjectSymbols::KIND_CLASS, name);
+        if (index < 0) index = symbols.findSymbol(ProjectSymbols::KIND_FUNCTION, name);
+        if (index < 0) index = symbols.findSymbol(ProjectSymbols::KIND_FUNCTION, name.mid(name.lastIndexOf("\\")));
+    }
+    if (index < 0) return;
+    path = symbols.getSymbolFile(index, line);
+}
+
 QVariantMap Project::createPHPResultMap()
 {
     QVariantMap map;
@@ -596,21 +589,36 @@ QVariantMap Project::createPHPResultMap()
     return map;
 }
 
-QVariantMap Project::loadPHPDataMap(QString path)
+bool Project::openPHPSymbols(QString path, ProjectSymbols & symbols)
 {
-    QVariantMap defaultMap;
     QString project_dir = path + "/" + PROJECT_SUBDIR;
     if (!Helper::folderExists(project_dir)) {
-        return defaultMap;
+        return false;
     }
-    QString data_filename = project_dir + "/" + PROJECT_PHP_DATA_FILE;
+    QString data_filename = project_dir + "/" + PROJECT_PHP_SYMBOLS_FILE;
     if (!Helper::fileExists(data_filename)) {
-        return defaultMap;
+        return false;
     }
-    QString data = Helper::loadTextFile(data_filename, PROJECT_DATA_ENCODING, PROJECT_DATA_ENCODING, true);
-    QJsonDocument d = QJsonDocument::fromJson(data.toUtf8());
-    QJsonObject o = d.object();
-    return o.toVariantMap();
+    return symbols.open(data_filename);
+}
+
+bool Project::isExcludedDir(QString name)
+{
+    return name == ".git" || name == PROJECT_SUBDIR || name == ".idea" || name == ".vscode" || name == "nbproject";
+}
+
+// directories of the project scan and the project watcher: hidden and excluded
+// directories are skipped, a linked directory is followed once per target
+bool Project::isProjectDir(const QFileInfo & fInfo, QSet<QString> & linkedDirs)
+{
+    if (!fInfo.isDir() || !fInfo.isReadable() || fInfo.isHidden()) return false;
+    if (isExcludedDir(fInfo.fileName())) return false;
+    if (fInfo.isSymLink()) {
+        QString target = fInfo.canonicalFilePath();
+        if (target.size() == 0 || linkedDirs.contains(target)) return false;
+        linkedDirs.insert(target);
+    }
+    return true;
 }
 
 bool Project::isProjectFile(QString path)
@@ -630,129 +638,81 @@ bool Project::isProjectFile(QString path)
     return true;
 }
 
-std::unordered_map<std::string, std::string> Project::getPHPFilesMapFromData(QVariantMap & data)
+// state of a file in the project index: modification time, size and content hash.
+// The data is the file as it is on disk, read without the text mode
+QVariantMap Project::createPHPFileState(QString path, const QByteArray & data)
 {
-    std::unordered_map<std::string, std::string> filesMap;
-    QVariant php_files_v = data.value("php_files");
-    QVariantMap php_files = qvariant_cast<QVariantMap>(php_files_v);
-    for (auto k : php_files.keys()) {
-        QVariant lastModifiedV = php_files.value(k);
-        QString lastModified = lastModifiedV.toString();
-        filesMap[k.toStdString()] = lastModified.toStdString();
-    }
-    return filesMap;
+    QFileInfo fInfo(path);
+    QDateTime dt = fInfo.lastModified();
+    QVariantMap state;
+    state.insert("modified", QString::number(dt.toMSecsSinceEpoch()));
+    state.insert("size", fInfo.size());
+    state.insert("hash", QString::number(Helper::hashData(data), 16));
+    return state;
 }
 
-void Project::checkParsePHPFilesModified(QStringList & files, QVariantMap & data, QVariantMap & map)
+QVariantMap Project::readPHPFileState(QString path)
 {
-    QVariant php_consts_v = map.value("php_consts");
-    QVariantMap php_consts = qvariant_cast<QVariantMap>(php_consts_v);
-    QVariant php_globals_v = map.value("php_globals");
-    QVariantMap php_globals = qvariant_cast<QVariantMap>(php_globals_v);
-    QVariant php_functions_v = map.value("php_functions");
-    QVariantMap php_functions = qvariant_cast<QVariantMap>(php_functions_v);
-    QVariant php_classes_v = map.value("php_classes");
-    QVariantMap php_classes = qvariant_cast<QVariantMap>(php_classes_v);
-    QVariant php_files_v = map.value("php_files");
-    QVariantMap php_files = qvariant_cast<QVariantMap>(php_files_v);
+    QByteArray data;
+    QFile f(path);
+    if (f.open(QIODevice::ReadOnly)) {
+        data = f.readAll();
+        f.close();
+    }
+    return createPHPFileState(path, data);
+}
 
-    std::unordered_map<std::string, std::string> filesMap = getPHPFilesMapFromData(data);
-    std::unordered_map<std::string, std::string> filesNotModifiedMap;
+// the content hash is only computed when the size or the modification time differ
+bool Project::isPHPFileChanged(QString path, const QVariantMap & state, QVariantMap & newState)
+{
+    newState = state;
+    QFileInfo fInfo(path);
+    QDateTime dt = fInfo.lastModified();
+    if (QString::number(dt.toMSecsSinceEpoch()) == state.value("modified").toString() && fInfo.size() == state.value("size").toLongLong()) return false;
+    newState = readPHPFileState(path);
+    return newState.value("hash").toString() != state.value("hash").toString();
+}
+
+// returns true if unchanged files got a new state
+bool Project::checkParsePHPFilesModified(QStringList & files, ProjectSymbols & symbols, QVariantMap & map)
+{
+    if (!symbols.isOpen()) return false;
+    bool isTouched = false;
+    QVariantMap php_files = qvariant_cast<QVariantMap>(map.take("php_files"));
     int i=0;
     while (i<files.size()) {
         QString file = files.at(i);
-        std::unordered_map<std::string, std::string>::iterator filesMapIt = filesMap.find(file.toStdString());
-        if (filesMapIt != filesMap.end()) {
-            QFileInfo fInfo(file);
-            QDateTime dt = fInfo.lastModified();
-            QString dts = QString::number(dt.toMSecsSinceEpoch());
-            if (dts.toStdString() == filesMapIt->second) {
+        int fileIndex = symbols.findFile(file);
+        if (fileIndex >= 0) {
+            QVariantMap state = symbols.getFileState(fileIndex);
+            QVariantMap newState;
+            if (!isPHPFileChanged(file, state, newState)) {
+                if (newState != state) isTouched = true;
                 files.removeAt(i);
-                php_files.insert(file, QVariant(dts));
-                filesNotModifiedMap[file.toStdString()] = dts.toStdString();
+                php_files.insert(file, QVariant(newState));
+                symbols.readFile(fileIndex, map);
                 continue;
             }
         }
         i++;
     }
-
-    QVariant _php_consts_v = data.value("php_consts");
-    QVariantMap _php_consts = qvariant_cast<QVariantMap>(_php_consts_v);
-    QVariant _php_globals_v = data.value("php_globals");
-    QVariantMap _php_globals = qvariant_cast<QVariantMap>(_php_globals_v);
-    QVariant _php_functions_v = data.value("php_functions");
-    QVariantMap _php_functions = qvariant_cast<QVariantMap>(_php_functions_v);
-    QVariant _php_classes_v = data.value("php_classes");
-    QVariantMap _php_classes = qvariant_cast<QVariantMap>(_php_classes_v);
-
-    for (auto k : _php_consts.keys()) {
-        QVariant v = _php_consts.value(k);
-        QVariantMap m = qvariant_cast<QVariantMap>(v);
-        QString name = m.value("name").toString();
-        QString file = m.value("file").toString();
-        std::unordered_map<std::string, std::string>::iterator filesNotModifiedMapIt = filesNotModifiedMap.find(file.toStdString());
-        if (filesNotModifiedMapIt != filesNotModifiedMap.end()) {
-            php_consts.insert(name, m);
-        }
-    }
-
-    for (auto k : _php_globals.keys()) {
-        QVariant v = _php_globals.value(k);
-        QVariantMap m = qvariant_cast<QVariantMap>(v);
-        QString name = m.value("name").toString();
-        QString file = m.value("file").toString();
-        std::unordered_map<std::string, std::string>::iterator filesNotModifiedMapIt = filesNotModifiedMap.find(file.toStdString());
-        if (filesNotModifiedMapIt != filesNotModifiedMap.end()) {
-            php_globals.insert(name, m);
-        }
-    }
-
-    for (auto k : _php_functions.keys()) {
-        QVariant v = _php_functions.value(k);
-        QVariantMap m = qvariant_cast<QVariantMap>(v);
-        QString name = m.value("name").toString();
-        QString file = m.value("file").toString();
-        std::unordered_map<std::string, std::string>::iterator filesNotModifiedMapIt = filesNotModifiedMap.find(file.toStdString());
-        if (filesNotModifiedMapIt != filesNotModifiedMap.end()) {
-            php_functions.insert(name, m);
-        }
-    }
-
-    for (auto k : _php_classes.keys()) {
-        QVariant v = _php_classes.value(k);
-        QVariantMap m = qvariant_cast<QVariantMap>(v);
-        QString name = m.value("name").toString();
-        QString file = m.value("file").toString();
-        std::unordered_map<std::string, std::string>::iterator filesNotModifiedMapIt = filesNotModifiedMap.find(file.toStdString());
-        if (filesNotModifiedMapIt != filesNotModifiedMap.end()) {
-            php_classes.insert(name, m);
-        }
-    }
-
-    map.insert("php_consts", QVariant(php_consts));
-    map.insert("php_globals", QVariant(php_globals));
-    map.insert("php_functions", QVariant(php_functions));
-    map.insert("php_classes", QVariant(php_classes));
     map.insert("php_files", QVariant(php_files));
+    return isTouched;
 }
 
-void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QString path, QString lastModified)
+void Project::parsePHPResult(ParsePHP::SharedParseResult result, QVariantMap & map, QString path, QVariantMap state)
 {
-    QVariant php_consts_v = map.value("php_consts");
-    QVariantMap php_consts = qvariant_cast<QVariantMap>(php_consts_v);
-    QVariant php_globals_v = map.value("php_globals");
-    QVariantMap php_globals = qvariant_cast<QVariantMap>(php_globals_v);
-    QVariant php_functions_v = map.value("php_functions");
-    QVariantMap php_functions = qvariant_cast<QVariantMap>(php_functions_v);
-    QVariant php_classes_v = map.value("php_classes");
-    QVariantMap php_classes = qvariant_cast<QVariantMap>(php_classes_v);
-    QVariant php_files_v = map.value("php_files");
-    QVariantMap php_files = qvariant_cast<QVariantMap>(php_files_v);
+    // maps are taken out of the result map, so that they are not copied on insert
+    QVariantMap php_consts = qvariant_cast<QVariantMap>(map.take("php_consts"));
+    QVariantMap php_globals = qvariant_cast<QVariantMap>(map.take("php_globals"));
+    QVariantMap php_functions = qvariant_cast<QVariantMap>(map.take("php_functions"));
+    QVariantMap php_classes = qvariant_cast<QVariantMap>(map.take("php_classes"));
+    QVariantMap php_files = qvariant_cast<QVariantMap>(map.take("php_files"));
 
-    php_files.insert(path, QVariant(lastModified));
+    php_files.insert(path, QVariant(state));
 
-    for (int c=0; c<result.constants.size(); c++) {
-        ParsePHP::ParseResultConstant constant = result.constants.at(c);
+    for (int c=0; c<result->constants.size(); c++) {
+        const ParsePHP::ParseResultConstant & constant = result->constants.at(c);
         if (constant.clsName.size() > 0) continue;
         QString name = constant.name;
         int p = constant.name.lastIndexOf("\\");
@@ -762,11 +722,11 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         data.insert("value", constant.value);
         data.insert("line", constant.line);
         data.insert("file", path);
-        php_consts.insert(constant.name, QVariant(data));
+        ProjectSymbols::insertSymbol(php_consts, data);
     }
     // variables
-    for (int v=0; v<result.variables.size(); v++) {
-        ParsePHP::ParseResultVariable variable = result.variables.at(v);
+    for (int v=0; v<result->variables.size(); v++) {
+        const ParsePHP::ParseResultVariable & variable = result->variables.at(v);
         if (variable.clsName.size() > 0 || variable.funcName.size() > 0) continue;
         QVariantMap data;
         data.insert("name", variable.name);
@@ -774,11 +734,11 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         data.insert("line", variable.line);
         data.insert("visibility", variable.visibility);
         data.insert("file", path);
-        php_globals.insert(variable.name, QVariant(data));
+        ProjectSymbols::insertSymbol(php_globals, data);
     }
     // functions
-    for (int f=0; f<result.functions.size(); f++) {
-        ParsePHP::ParseResultFunction func = result.functions.at(f);
+    for (int f=0; f<result->functions.size(); f++) {
+        const ParsePHP::ParseResultFunction & func = result->functions.at(f);
         if (func.clsName.size() > 0) continue;
 
         QString synopsis = func.name;
@@ -799,11 +759,11 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         data.insert("isAbstract", func.isAbstract);
         data.insert("visibility", func.visibility);
         data.insert("file", path);
-        php_functions.insert(func.name, QVariant(data));
+        ProjectSymbols::insertSymbol(php_functions, data);
     }
     // classes
-    for (int i=0; i<result.classes.size(); i++) {
-        ParsePHP::ParseResultClass cls = result.classes.at(i);
+    for (int i=0; i<result->classes.size(); i++) {
+        const ParsePHP::ParseResultClass & cls = result->classes.at(i);
 
         QVariantMap data;
         data.insert("name", cls.name);
@@ -823,8 +783,8 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         // class constants
         QVariantMap constantsMap;
         for (int c=0; c<cls.constantIndexes.size(); c++) {
-            if (result.constants.size() <= cls.constantIndexes.at(c)) break;
-            ParsePHP::ParseResultConstant constant = result.constants.at(cls.constantIndexes.at(c));
+            if (result->constants.size() <= cls.constantIndexes.at(c)) break;
+            const ParsePHP::ParseResultConstant & constant = result->constants.at(cls.constantIndexes.at(c));
 
             QVariantMap constantsData;
             constantsData.insert("name", constant.name);
@@ -838,8 +798,8 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         // class variables
         QVariantMap variablesMap;
         for (int v=0; v<cls.variableIndexes.size(); v++) {
-            if (result.variables.size() <= cls.variableIndexes.at(v)) break;
-            ParsePHP::ParseResultVariable variable = result.variables.at(cls.variableIndexes.at(v));
+            if (result->variables.size() <= cls.variableIndexes.at(v)) break;
+            const ParsePHP::ParseResultVariable & variable = result->variables.at(cls.variableIndexes.at(v));
 
             QVariantMap variablesData;
             variablesData.insert("name", variable.name);
@@ -854,8 +814,8 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         // class methods
         QVariantMap methodsMap;
         for (int f=0; f<cls.functionIndexes.size(); f++) {
-            if (result.functions.size() <= cls.functionIndexes.at(f)) break;
-            ParsePHP::ParseResultFunction func = result.functions.at(cls.functionIndexes.at(f));
+            if (result->functions.size() <= cls.functionIndexes.at(f)) break;
+            const ParsePHP::ParseResultFunction & func = result->functions.at(cls.functionIndexes.at(f));
 
             QString synopsis = func.name;
             if (func.args.size() > 0) synopsis += " ( "+func.args+" )";
@@ -894,7 +854,7 @@ void Project::parsePHPResult(ParsePHP::ParseResult result, QVariantMap & map, QS
         }
         data.insert("methods", QVariant(methodsMap));
 
-        php_classes.insert(cls.name, QVariant(data));
+        ProjectSymbols::insertSymbol(php_classes, data);
     }
 
     map.insert("php_consts", QVariant(php_consts));
@@ -915,29 +875,61 @@ void Project::savePHPResults(QString path, QVariantMap & map)
         return;
     }
     preparePHPResults(project_dir, map);
-    QJsonObject o = QJsonObject::fromVariantMap(map);
-    QJsonDocument d;
-    d.setObject(o);
-    QString data = QString(d.toJson());
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_DATA_FILE, data, PROJECT_DATA_ENCODING);
+    ProjectSymbols::save(project_dir + "/" + PROJECT_PHP_SYMBOLS_FILE, map);
+    if (Settings::get("parser_export_symbols_json") == "yes") {
+        ProjectSymbols::exportJSON(project_dir + "/" + PROJECT_PHP_SYMBOLS_EXPORT_FILE, map);
+    }
+    QString outdated_filename = project_dir + "/" + PROJECT_PHP_WORDS_OUTDATED_FILE;
+    if (Helper::fileExists(outdated_filename)) {
+        Helper::deleteFile(outdated_filename);
+    }
+}
+
+// replaces the symbols of the given files in the database.
+// Word files are prepared from all symbols, so they are left
+// to the next project update and the editor patches its loaded words.
+void Project::updatePHPResults(QString path, ProjectSymbols & symbols, const QSet<QString> & paths, QVariantMap & map, const QVariantMap & states)
+{
+    QString project_dir = path + "/" + PROJECT_SUBDIR;
+    if (!Helper::folderExists(project_dir)) {
+        return;
+    }
+    if (!symbols.update(project_dir + "/" + PROJECT_PHP_SYMBOLS_FILE, paths, map, states)) {
+        return;
+    }
+    QString outdated_filename = project_dir + "/" + PROJECT_PHP_WORDS_OUTDATED_FILE;
+    if (paths.size() > 0 && !Helper::fileExists(outdated_filename)) {
+        Helper::saveTextFile(outdated_filename, "", PROJECT_DATA_ENCODING);
+    }
+}
+
+bool Project::isPHPWordsOutdated(QString path)
+{
+    return Helper::fileExists(path + "/" + PROJECT_SUBDIR + "/" + PROJECT_PHP_WORDS_OUTDATED_FILE);
 }
 
 void Project::preparePHPResults(QString project_dir, QVariantMap & map)
+{
+    QHash<QString, QString> words;
+    preparePHPWords(map, words);
+    for (auto it = words.constBegin(); it != words.constEnd(); it++) {
+        Helper::saveTextFile(project_dir + "/" + it.key(), it.value(), PROJECT_DATA_ENCODING);
+    }
+}
+
+void Project::preparePHPWords(QVariantMap & map, QHash<QString, QString> & words)
 {
     QString consts_str = "";
     QString globals_str = "";
     QString functions_str = "";
     QString function_types_str = "";
-    QString functions_search_str = "";
     QString functions_help_str = "";
     QString classes_str = "";
     QString class_parents_str = "";
-    QString classes_search_str = "";
     QString class_consts_str = "";
     QString class_properties_str = "";
     QString class_methods_str = "";
     QString class_method_types_str = "";
-    QString class_methods_search_str = "";
     QString class_methods_help_str = "";
 
     // consts
@@ -974,7 +966,6 @@ void Project::preparePHPResults(QString project_dir, QVariantMap & map)
         if (method_type.size() > 0) {
             function_types_str += func_name + " " + method_type + "\n";
         }
-        functions_search_str += func_name + " " + method.value("file").toString() + ":" + method.value("line").toString() + "\n";
         QString function_help = method.value("comment").toString();
         if (function_help.size() > 0) {
             functions_help_str += func_name + " " + function_help.replace(QRegularExpression("[\r\n]+"), "<br />") + "\n";
@@ -1003,7 +994,7 @@ void Project::preparePHPResults(QString project_dir, QVariantMap & map)
         if (cls_name.size() > 0 && cls_name.at(0) == "\\") cls_name = cls_name.mid(1);
         QString cls_args = "()";
 
-        preparePHPClasses(cls_name, cls, cls_args, class_consts_str, class_properties_str, class_methods_str, class_method_types_str, class_methods_search_str, class_methods_help_str, cls_methods_map, cls_props_map, cls_consts_map);
+        preparePHPClasses(cls_name, cls, cls_args, class_consts_str, class_properties_str, class_methods_str, class_method_types_str, class_methods_help_str, cls_methods_map, cls_props_map, cls_consts_map);
         QString cls_parent = "";
         QString cls_parents = "";
         QVariantMap _cls = cls;
@@ -1014,7 +1005,7 @@ void Project::preparePHPResults(QString project_dir, QVariantMap & map)
                 std::unordered_map<std::string, QVariantMap>::iterator cls_map_it = cls_map.find(cls_parent.toStdString());
                 if (cls_map_it != cls_map.end()) {
                     _cls = cls_map_it->second;
-                    preparePHPClasses(cls_name, _cls, cls_args, class_consts_str, class_properties_str, class_methods_str, class_method_types_str, class_methods_search_str, class_methods_help_str, cls_methods_map, cls_props_map, cls_consts_map);
+                    preparePHPClasses(cls_name, _cls, cls_args, class_consts_str, class_properties_str, class_methods_str, class_method_types_str, class_methods_help_str, cls_methods_map, cls_props_map, cls_consts_map);
                     if (cls_parent.size() > 0) {
                         if (cls_parents.size() > 0) cls_parents += ",";
                         cls_parents += cls_parent;
@@ -1028,24 +1019,20 @@ void Project::preparePHPResults(QString project_dir, QVariantMap & map)
         QString cls_synopsis = cls_name + cls_args;
         classes_str += cls_synopsis + "\n";
         if (cls_parents.size() > 0) class_parents_str += cls_name + " " + cls_parents + "\n";
-        classes_search_str += cls_name + " " + cls.value("file").toString() + ":" + cls.value("line").toString() + "\n";
-    }
-
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CONSTS_FILE, consts_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_VARS_FILE, globals_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_FUNCTIONS_FILE, functions_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_FUNCTION_TYPES_FILE, function_types_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASSES_FILE, classes_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_PARENTS_FILE, class_parents_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_CONSTS_FILE, class_consts_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_PROPS_FILE, class_properties_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_METHODS_FILE, class_methods_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_METHOD_TYPES_FILE, class_method_types_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASSES_SEARCH_FILE, classes_search_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_METHODS_SEARCH_FILE, class_methods_search_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_FUNCTIONS_SEARCH_FILE, functions_search_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_FUNCTIONS_HELP_FILE, functions_help_str, PROJECT_DATA_ENCODING);
-    Helper::saveTextFile(project_dir + "/" + PROJECT_PHP_CLASS_METHODS_HELP_FILE, class_methods_help_str, PROJECT_DATA_ENCODING);
+    }
+
+    words.insert(PROJECT_PHP_CONSTS_FILE, consts_str);
+    words.insert(PROJECT_PHP_VARS_FILE, globals_str);
+    words.insert(PROJECT_PHP_FUNCTIONS_FILE, functions_str);
+    words.insert(PROJECT_PHP_FUNCTION_TYPES_FILE, function_types_str);
+    words.insert(PROJECT_PHP_CLASSES_FILE, classes_str);
+    words.insert(PROJECT_PHP_CLASS_PARENTS_FILE, class_parents_str);
+    words.insert(PROJECT_PHP_CLASS_CONSTS_FILE, class_consts_str);
+    words.insert(PROJECT_PHP_CLASS_PROPS_FILE, class_properties_str);
+    words.insert(PROJECT_PHP_CLASS_METHODS_FILE, class_methods_str);
+    words.insert(PROJECT_PHP_CLASS_METHOD_TYPES_FILE, class_method_types_str);
+    words.insert(PROJECT_PHP_FUNCTIONS_HELP_FILE, functions_help_str);
+    words.insert(PROJECT_PHP_CLASS_METHODS_HELP_FILE, class_methods_help_str);
 }
 
 void Project::preparePHPClasses(QString cls_name,
@@ -1055,7 +1042,6 @@ void Project::preparePHPClasses(QString cls_name,
                                 QString & class_properties_str,
                                 QString & class_methods_str,
                                 QString & class_method_types_str,
-                                QString & class_methods_search_str,
                                 QString & class_methods_help_str,
                                 std::unordered_map<std::string, std::string> & cls_methods_map,
                                 std::unordered_map<std::string, std::string> & cls_props_map,
@@ -1108,7 +1094,6 @@ void Project::preparePHPClasses(QString cls_name,
         if (cls_method_type.size() > 0) {
             class_method_types_str += cls_name + "::" + cls_method.value("name").toString() + " " + cls_method_type + "\n";
         }
-        class_methods_search_str += cls_name + "::" + cls_method.value("name").toString() + " " + cls_method.value("file").toString() + ":" + cls_method.value("line").toString() + "\n";
         QString cls_method_help = cls_method.value("comment").toString();
         if (cls_method_help.size() > 0) {
             class_methods_help_str += cls_name + "::" + cls_method.value("name").toString() + " " + cls_method_help.replace(QRegularExpression("[\r\n]+"), "<br />") + "\n";
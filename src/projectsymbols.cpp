@@ -0,0 +1,610 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include "projectsymbols.h"
+#include <QSaveFile>
+#include <QHash>
+#include <QVector>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include "helper.h"
+
+const QString PROJECT_PHP_SYMBOLS_FILE = "php_symbols.db";
+const QString PROJECT_PHP_SYMBOLS_EXPORT_FILE = "php_symbols.json";
+
+const quint32 SYMBOLS_MAGIC = 0x42445a5a; // "ZZDB"
+const quint32 SYMBOLS_VERSION = 2;
+
+const int SYMBOL_FLAG_STATIC = 1;
+const int SYMBOL_FLAG_ABSTRACT = 2;
+const int SYMBOL_FLAG_INTERFACE = 4;
+const int SYMBOL_FLAG_TRAIT = 8;
+
+// guards against inheritance cycles
+const int SYMBOLS_MAX_PARENTS = 32;
+
+ProjectSymbols::ProjectSymbols():
+    data(nullptr),
+    header(nullptr),
+    strings(nullptr),
+    files(nullptr),
+    symbols(nullptr),
+    names(nullptr)
+{
+
+}
+
+ProjectSymbols::~ProjectSymbols()
+{
+    close();
+}
+
+bool ProjectSymbols::open(QString path)
+{
+    close();
+    file.setFileName(path);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    qint64 size = file.size();
+    if (size < static_cast<qint64>(sizeof(Header)) || size > INT_MAX) {
+        close();
+        return false;
+    }
+    data = file.map(0, size);
+    if (data == nullptr) {
+        close();
+        return false;
+    }
+    header = reinterpret_cast<const Header *>(data);
+    // sections should be aligned and fit the file
+    bool valid = header->magic == SYMBOLS_MAGIC && header->version == SYMBOLS_VERSION;
+    const qint32 sections[][3] = {
+        {header->stringsOffset, header->stringsSize, static_cast<qint32>(sizeof(ushort))},
+        {header->filesOffset, header->filesCount, static_cast<qint32>(sizeof(FileRecord))},
+        {header->symbolsOffset, header->symbolsCount, static_cast<qint32>(sizeof(SymbolRecord))},
+        {header->namesOffset, header->namesCount, static_cast<qint32>(sizeof(qint32))}
+    };
+    for (int i=0; i<4 && valid; i++) {
+        qint64 offset = sections[i][0], count = sections[i][1], itemSize = sections[i][2];
+        if (offset < static_cast<qint64>(sizeof(Header)) || offset % 8 != 0 || count < 0 || offset + count * itemSize > size) valid = false;
+    }
+    if (!valid) {
+        close();
+        return false;
+    }
+    strings = reinterpret_cast<const ushort *>(data + header->stringsOffset);
+    files = reinterpret_cast<const FileRecord *>(data + header->filesOffset);
+    symbols = reinterpret_cast<const SymbolRecord *>(data + header->symbolsOffset);
+    names = reinterpret_cast<const qint32 *>(data + header->namesOffset);
+    return true;
+}
+
+void ProjectSymbols::close()
+{
+    if (data != nullptr) file.unmap(const_cast<uchar *>(data));
+    if (file.isOpen()) file.close();
+    data = nullptr;
+    header = nullptr;
+    strings = nullptr;
+    files = nullptr;
+    symbols = nullptr;
+    names = nullptr;
+}
+
+bool ProjectSymbols::isOpen()
+{
+    return data != nullptr;
+}
+
+QString ProjectSymbols::getString(const StringRef & ref)
+{
+    if (ref.offset < 0 || ref.length <= 0 || ref.offset > header->stringsSize - ref.length) return "";
+    return QString(reinterpret_cast<const QChar *>(strings + ref.offset), ref.length);
+}
+
+// the returned string uses the mapped data, it should not outlive the mapping
+QString ProjectSymbols::rawString(const StringRef & ref)
+{
+    if (ref.offset < 0 || ref.length <= 0 || ref.offset > header->stringsSize - ref.length) return QString();
+    return QString::fromRawData(reinterpret_cast<const QChar *>(strings + ref.offset), ref.length);
+}
+
+int ProjectSymbols::compareString(const StringRef & ref, const QString & str)
+{
+    int length = ref.offset >= 0 && ref.length > 0 && ref.offset <= header->stringsSize - ref.length ? ref.length : 0;
+    const ushort * refData = strings + ref.offset;
+    const ushort * strData = str.utf16();
+    int n = qMin(length, str.size());
+    for (int i=0; i<n; i++) {
+        if (refData[i] != strData[i]) return refData[i] < strData[i] ? -1 : 1;
+    }
+    return length - str.size();
+}
+
+int ProjectSymbols::getFilesCount()
+{
+    if (!isOpen()) return 0;
+    return header->filesCount;
+}
+
+QString ProjectSymbols::getFilePath(int fileIndex)
+{
+    if (!isOpen() || fileIndex < 0 || fileIndex >= header->filesCount) return "";
+    return getString(files[fileIndex].path);
+}
+
+int ProjectSymbols::findFile(const QString & path)
+{
+    if (!isOpen()) return -1;
+    int from = 0, to = header->filesCount;
+    while (from < to) {
+        int mid = from + (to - from) / 2;
+        int cmp = compareString(files[mid].path, path);
+        if (cmp == 0) return mid;
+        if (cmp < 0) from = mid + 1;
+        else to = mid;
+    }
+    return -1;
+}
+
+// returns the position of the first top-level symbol
+// that is not less than the given kind and name in the names index
+int ProjectSymbols::findName(int kind, const QString & name)
+{
+    int from = 0, to = header->namesCount;
+    while (from < to) {
+        int mid = from + (to - from) / 2;
+        int index = names[mid];
+        if (index < 0 || index >= header->symbolsCount) return header->namesCount;
+        const SymbolRecord & symbol = symbols[index];
+        int cmp = symbol.kind != kind ? symbol.kind - kind : compareString(symbol.name, name);
+        if (cmp < 0) from = mid + 1;
+        else to = mid;
+    }
+    return from;
+}
+
+int ProjectSymbols::findSymbol(int kind, const QString & name)
+{
+    if (!isOpen()) return -1;
+    int pos = findName(kind, name);
+    if (pos >= header->namesCount) return -1;
+    int index = names[pos];
+    if (index < 0 || index >= header->symbolsCount) return -1;
+    if (symbols[index].kind != kind || compareString(symbols[index].name, name) != 0) return -1;
+    return index;
+}
+
+// the same name can be declared in several files
+QVector<int> ProjectSymbols::findSymbols(int kind, const QString & name)
+{
+    QVector<int> found;
+    if (!isOpen()) return found;
+    for (int pos = findName(kind, name); pos < header->namesCount; pos++) {
+        int index = names[pos];
+        if (index < 0 || index >= header->symbolsCount) break;
+        if (symbols[index].kind != kind || compareString(symbols[index].name, name) != 0) break;
+        found.append(index);
+    }
+    return found;
+}
+
+// looks for a member in a class and its parents
+int ProjectSymbols::findClassMember(int classIndex, int kind, const QString & name)
+{
+    if (!isOpen()) return -1;
+    for (int depth=0; depth<SYMBOLS_MAX_PARENTS; depth++) {
+        if (classIndex < 0 || classIndex >= header->symbolsCount) return -1;
+        const SymbolRecord & cls = symbols[classIndex];
+        if (cls.kind != KIND_CLASS) return -1;
+        int to = qMin(classIndex + 1 + cls.membersCount, header->symbolsCount);
+        for (int i=classIndex+1; i<to; i++) {
+            if (symbols[i].kind == kind && compareString(symbols[i].name, name) == 0) return i;
+        }
+        QString parent = getString(cls.value);
+        if (parent.size() == 0) return -1;
+        if (parent.at(0) != "\\") parent = "\\" + parent;
+        classIndex = findSymbol(KIND_CLASS, parent);
+    }
+    return -1;
+}
+
+// class members follow their class
+int ProjectSymbols::findSymbolClass(int index)
+{
+    for (int i=index-1; i>=0; i--) {
+        if (symbols[i].kind == KIND_CLASS) return i + symbols[i].membersCount >= index ? i : -1;
+    }
+    return -1;
+}
+
+// returns symbols of a kind which names contain the text, methods are matched as Class::method
+QVector<int> ProjectSymbols::searchSymbols(int kind, const QString & text, int limit)
+{
+    QVector<int> found;
+    if (!isOpen() || text.size() == 0) return found;
+    bool qualified = text.indexOf("::") >= 0;
+    int classIndex = -1;
+    for (int i=0; i<header->symbolsCount && found.size() < limit; i++) {
+        if (symbols[i].kind == KIND_CLASS) classIndex = i;
+        if (symbols[i].kind != kind) continue;
+        if (kind != KIND_METHOD || classIndex < 0) {
+            if (rawString(symbols[i].name).indexOf(text, 0, Qt::CaseInsensitive) < 0) continue;
+        } else if (qualified) {
+            if (getSymbolName(i).indexOf(text, 0, Qt::CaseInsensitive) < 0) continue;
+        } else if (rawString(symbols[i].name).indexOf(text, 0, Qt::CaseInsensitive) < 0 && rawString(symbols[classIndex].name).indexOf(text, 0, Qt::CaseInsensitive) < 0) {
+            continue;
+        }
+        found.append(i);
+    }
+    return found;
+}
+
+// names are returned without the leading backslash, methods as Class::method
+QString ProjectSymbols::getSymbolName(int index)
+{
+    if (!isOpen() || index < 0 || index >= header->symbolsCount) return "";
+    QString name = getString(symbols[index].name);
+    int kind = symbols[index].kind;
+    if (kind == KIND_CLASS_CONSTANT || kind == KIND_PROPERTY || kind == KIND_METHOD) {
+        int classIndex = findSymbolClass(index);
+        if (classIndex >= 0) name = getString(symbols[classIndex].name) + "::" + name;
+    }
+    if (name.size() > 0 && name.at(0) == "\\") name = name.mid(1);
+    return name;
+}
+
+// the same state as created by Project::createPHPFileState
+QVariantMap ProjectSymbols::getFileState(int fileIndex)
+{
+    QVariantMap state;
+    if (!isOpen() || fileIndex < 0 || fileIndex >= header->filesCount) return state;
+    const FileRecord & fileRecord = files[fileIndex];
+    state.insert("modified", getString(fileRecord.lastModified));
+    state.insert("size", fileRecord.size);
+    state.insert("hash", QString::number(fileRecord.hash, 16));
+    return state;
+}
+
+QString ProjectSymbols::getSymbolFile(int index, int & line)
+{
+    line = -1;
+    if (!isOpen() || index < 0 || index >= header->symbolsCount) return "";
+    line = symbols[index].line;
+    // files are sorted by path, but their symbols are stored in order
+    int from = 0, to = header->filesCount;
+    while (from < to) {
+        int mid = from + (to - from) / 2;
+        if (files[mid].symbolsFrom + files[mid].symbolsCount <= index) from = mid + 1;
+        else to = mid;
+    }
+    if (from >= header->filesCount || files[from].symbolsFrom > index) return "";
+    return getString(files[from].path);
+}
+
+QVariantMap ProjectSymbols::getSymbol(int index)
+{
+    if (!isOpen() || index < 0 || index >= header->symbolsCount) return QVariantMap();
+    int line = 0;
+    QString file = getSymbolFile(index, line);
+    return readSymbol(index, file);
+}
+
+QVariantMap ProjectSymbols::readSymbol(int index, const QString & file)
+{
+    const SymbolRecord & symbol = symbols[index];
+    QVariantMap m;
+    m.insert("name", getString(symbol.name));
+    m.insert("line", symbol.line);
+    m.insert("file", file);
+    if (symbol.kind == KIND_CONSTANT || symbol.kind == KIND_CLASS_CONSTANT) {
+        m.insert("value", getString(symbol.value));
+    } else if (symbol.kind == KIND_GLOBAL || symbol.kind == KIND_PROPERTY) {
+        m.insert("type", getString(symbol.value));
+        m.insert("visibility", getString(symbol.visibility));
+    } else if (symbol.kind == KIND_FUNCTION || symbol.kind == KIND_METHOD) {
+        m.insert("args", getString(symbol.args));
+        m.insert("synopsis", getString(symbol.synopsis));
+        m.insert("return_type", getString(symbol.value));
+        m.insert("comment", getString(symbol.comment));
+        m.insert("isStatic", (symbol.flags & SYMBOL_FLAG_STATIC) != 0);
+        m.insert("isAbstract", (symbol.flags & SYMBOL_FLAG_ABSTRACT) != 0);
+        m.insert("visibility", getString(symbol.visibility));
+    } else if (symbol.kind == KIND_CLASS) {
+        m.insert("parent", getString(symbol.value));
+        m.insert("isAbstract", (symbol.flags & SYMBOL_FLAG_ABSTRACT) != 0);
+        m.insert("isInterface", (symbol.flags & SYMBOL_FLAG_INTERFACE) != 0);
+        m.insert("isTrait", (symbol.flags & SYMBOL_FLAG_TRAIT) != 0);
+        QVariantMap interfacesMap;
+        QString interfaces = getString(symbol.args);
+        if (interfaces.size() > 0) {
+            QStringList interfacesList = interfaces.split(",");
+            for (int i=0; i<interfacesList.size(); i++) {
+                interfacesMap.insert(QString::number(i), interfacesList.at(i));
+            }
+        }
+        m.insert("interfaces", QVariant(interfacesMap));
+        QVariantMap constantsMap, propertiesMap, methodsMap;
+        int to = qMin(index + 1 + symbol.membersCount, header->symbolsCount);
+        for (int i=index+1; i<to; i++) {
+            QVariantMap member = readSymbol(i, file);
+            QString memberName = member.value("name").toString();
+            if (symbols[i].kind == KIND_CLASS_CONSTANT) constantsMap.insert(memberName, QVariant(member));
+            else if (symbols[i].kind == KIND_PROPERTY) propertiesMap.insert(memberName, QVariant(member));
+            else if (symbols[i].kind == KIND_METHOD) methodsMap.insert(memberName, QVariant(member));
+        }
+        m.insert("constants", QVariant(constantsMap));
+        m.insert("properties", QVariant(propertiesMap));
+        m.insert("methods", QVariant(methodsMap));
+    }
+    return m;
+}
+
+// adds the symbols of a file to a result map of the project parser
+void ProjectSymbols::readFile(int fileIndex, QVariantMap & map)
+{
+    if (!isOpen() || fileIndex < 0 || fileIndex >= header->filesCount) return;
+    const FileRecord & fileRecord = files[fileIndex];
+    if (fileRecord.symbolsFrom < 0 || fileRecord.symbolsCount < 0 || fileRecord.symbolsFrom > header->symbolsCount - fileRecord.symbolsCount) return;
+    QString path = getString(fileRecord.path);
+    QVariantMap php_consts = qvariant_cast<QVariantMap>(map.take("php_consts"));
+    QVariantMap php_globals = qvariant_cast<QVariantMap>(map.take("php_globals"));
+    QVariantMap php_functions = qvariant_cast<QVariantMap>(map.take("php_functions"));
+    QVariantMap php_classes = qvariant_cast<QVariantMap>(map.take("php_classes"));
+    int to = fileRecord.symbolsFrom + fileRecord.symbolsCount;
+    for (int i=fileRecord.symbolsFrom; i<to; i++) {
+        int kind = symbols[i].kind;
+        if (kind == KIND_CLASS_CONSTANT || kind == KIND_PROPERTY || kind == KIND_METHOD) continue;
+        QVariantMap m = readSymbol(i, path);
+        if (kind == KIND_CONSTANT) insertSymbol(php_consts, m);
+        else if (kind == KIND_GLOBAL) insertSymbol(php_globals, m);
+        else if (kind == KIND_FUNCTION) insertSymbol(php_functions, m);
+        else if (kind == KIND_CLASS) insertSymbol(php_classes, m);
+    }
+    map.insert("php_consts", QVariant(php_consts));
+    map.insert("php_globals", QVariant(php_globals));
+    map.insert("php_functions", QVariant(php_functions));
+    map.insert("php_classes", QVariant(php_classes));
+}
+
+// symbols are keyed by name, a name declared in several files
+// is also kept for each of the other files
+void ProjectSymbols::insertSymbol(QVariantMap & kindMap, const QVariantMap & m)
+{
+    QString name = m.value("name").toString();
+    QVariantMap::const_iterator it = kindMap.constFind(name);
+    if (it != kindMap.constEnd() && qvariant_cast<QVariantMap>(it.value()).value("file") != m.value("file")) {
+        name += " " + m.value("file").toString();
+    }
+    kindMap.insert(name, QVariant(m));
+}
+
+// replaces the records of the given files with the symbols of the result map,
+// records of the other files are copied without conversion.
+// Files that are only in the states keep their symbols and get the new state.
+// The database is closed before it is written.
+bool ProjectSymbols::update(QString path, const QSet<QString> & paths, QVariantMap & map, const QVariantMap & states)
+{
+    if (!isOpen()) return false;
+    Builder builder;
+    QHash<QString, QVector<SymbolRecord>> fileSymbols;
+    builder.groupSymbols(map, fileSymbols);
+    QVariantMap php_files = qvariant_cast<QVariantMap>(map.value("php_files"));
+    QVariantMap::const_iterator newIt = php_files.constBegin();
+    for (int f=0; f<=header->filesCount; f++) {
+        const FileRecord * fileRecord = f < header->filesCount ? files + f : nullptr;
+        // files are merged in the order of their paths
+        while (newIt != php_files.constEnd() && (fileRecord == nullptr || compareString(fileRecord->path, newIt.key()) > 0)) {
+            builder.addFile(newIt.key(), qvariant_cast<QVariantMap>(newIt.value()), fileSymbols.value(newIt.key()));
+            ++newIt;
+        }
+        if (fileRecord == nullptr) break;
+        QString filePath = rawString(fileRecord->path);
+        if (paths.contains(filePath) || php_files.contains(filePath)) continue;
+        if (fileRecord->symbolsFrom < 0 || fileRecord->symbolsCount < 0 || fileRecord->symbolsFrom > header->symbolsCount - fileRecord->symbolsCount) continue;
+        FileRecord record = * fileRecord;
+        record.path = copyString(builder, fileRecord->path);
+        QVariantMap::const_iterator stateIt = states.constFind(filePath);
+        if (stateIt != states.constEnd()) {
+            QVariantMap state = qvariant_cast<QVariantMap>(stateIt.value());
+            record.lastModified = builder.addString(state.value("modified").toString());
+            record.size = state.value("size").toLongLong();
+            record.hash = state.value("hash").toString().toULongLong(nullptr, 16);
+        } else {
+            record.lastModified = copyString(builder, fileRecord->lastModified);
+        }
+        record.symbolsFrom = builder.symbolsData.size();
+        int to = fileRecord->symbolsFrom + fileRecord->symbolsCount;
+        for (int i=fileRecord->symbolsFrom; i<to; i++) {
+            SymbolRecord symbol = symbols[i];
+            symbol.name = copyString(builder, symbol.name);
+            symbol.value = copyString(builder, symbol.value);
+            symbol.args = copyString(builder, symbol.args);
+            symbol.synopsis = copyString(builder, symbol.synopsis);
+            symbol.visibility = copyString(builder, symbol.visibility);
+            symbol.comment = copyString(builder, symbol.comment);
+            builder.symbolsData.append(symbol);
+        }
+        builder.filesData.append(record);
+    }
+    close();
+    return builder.write(path);
+}
+
+ProjectSymbols::StringRef ProjectSymbols::copyString(Builder & builder, const StringRef & ref)
+{
+    if (ref.offset < 0 || ref.length <= 0 || ref.offset > header->stringsSize - ref.length) {
+        StringRef empty = {0, 0};
+        return empty;
+    }
+    return builder.copyString(strings, ref);
+}
+
+ProjectSymbols::StringRef ProjectSymbols::Builder::addString(const QString & str)
+{
+    StringRef ref = {0, 0};
+    if (str.size() == 0) return ref;
+    QHash<QString, StringRef>::const_iterator it = stringRefs.constFind(str);
+    if (it != stringRefs.constEnd()) return it.value();
+    ref.offset = stringsData.size();
+    ref.length = str.size();
+    const ushort * strData = str.utf16();
+    for (int i=0; i<str.size(); i++) stringsData.append(strData[i]);
+    stringRefs.insert(str, ref);
+    return ref;
+}
+
+// strings of the old database are copied once, they are not compared with the new strings
+ProjectSymbols::StringRef ProjectSymbols::Builder::copyString(const ushort * source, const StringRef & ref)
+{
+    qint64 key = (static_cast<qint64>(ref.offset) << 32) | static_cast<quint32>(ref.length);
+    QHash<qint64, StringRef>::const_iterator it = copiedRefs.constFind(key);
+    if (it != copiedRefs.constEnd()) return it.value();
+    StringRef newRef = {static_cast<qint32>(stringsData.size()), ref.length};
+    stringsData.resize(stringsData.size() + ref.length);
+    std::memcpy(stringsData.data() + newRef.offset, source + ref.offset, ref.length * sizeof(ushort));
+    copiedRefs.insert(key, newRef);
+    return newRef;
+}
+
+ProjectSymbols::SymbolRecord ProjectSymbols::Builder::createSymbol(int kind, const QVariantMap & m)
+{
+    SymbolRecord symbol;
+    std::memset(& symbol, 0, sizeof(SymbolRecord));
+    symbol.kind = kind;
+    symbol.line = m.value("line").toInt();
+    symbol.name = addString(m.value("name").toString());
+    if (kind == KIND_CONSTANT || kind == KIND_CLASS_CONSTANT) {
+        symbol.value = addString(m.value("value").toString());
+    } else if (kind == KIND_GLOBAL || kind == KIND_PROPERTY) {
+        symbol.value = addString(m.value("type").toString());
+        symbol.visibility = addString(m.value("visibility").toString());
+    } else if (kind == KIND_FUNCTION || kind == KIND_METHOD) {
+        symbol.args = addString(m.value("args").toString());
+        symbol.synopsis = addString(m.value("synopsis").toString());
+        symbol.value = addString(m.value("return_type").toString());
+        symbol.comment = addString(m.value("comment").toString());
+        symbol.visibility = addString(m.value("visibility").toString());
+        if (m.value("isStatic").toBool()) symbol.flags |= SYMBOL_FLAG_STATIC;
+        if (m.value("isAbstract").toBool()) symbol.flags |= SYMBOL_FLAG_ABSTRACT;
+    } else if (kind == KIND_CLASS) {
+        symbol.value = addString(m.value("parent").toString());
+        QVariantMap interfacesMap = qvariant_cast<QVariantMap>(m.value("interfaces"));
+        QStringList interfaces;
+        for (int i=0; i<interfacesMap.size(); i++) {
+            interfaces.append(interfacesMap.value(QString::number(i)).toString());
+        }
+        symbol.args = addString(interfaces.join(","));
+        if (m.value("isAbstract").toBool()) symbol.flags |= SYMBOL_FLAG_ABSTRACT;
+        if (m.value("isInterface").toBool()) symbol.flags |= SYMBOL_FLAG_INTERFACE;
+        if (m.value("isTrait").toBool()) symbol.flags |= SYMBOL_FLAG_TRAIT;
+    }
+    return symbol;
+}
+
+// symbols are grouped by file
+void ProjectSymbols::Builder::groupSymbols(QVariantMap & map, QHash<QString, QVector<SymbolRecord>> & fileSymbols)
+{
+    const QString kindKeys[] = {"php_consts", "php_globals", "php_functions", "php_classes"};
+    const int kinds[] = {KIND_CONSTANT, KIND_GLOBAL, KIND_FUNCTION, KIND_CLASS};
+    for (int k=0; k<4; k++) {
+        QVariantMap kindMap = qvariant_cast<QVariantMap>(map.value(kindKeys[k]));
+        for (QVariantMap::const_iterator it = kindMap.constBegin(); it != kindMap.constEnd(); ++it) {
+            QVariantMap m = qvariant_cast<QVariantMap>(it.value());
+            QVector<SymbolRecord> & list = fileSymbols[m.value("file").toString()];
+            list.append(createSymbol(kinds[k], m));
+            if (kinds[k] != KIND_CLASS) continue;
+            int classIndex = list.size() - 1;
+            const QString memberKeys[] = {"constants", "properties", "methods"};
+            const int memberKinds[] = {KIND_CLASS_CONSTANT, KIND_PROPERTY, KIND_METHOD};
+            for (int mk=0; mk<3; mk++) {
+                QVariantMap membersMap = qvariant_cast<QVariantMap>(m.value(memberKeys[mk]));
+                for (QVariantMap::const_iterator mit = membersMap.constBegin(); mit != membersMap.constEnd(); ++mit) {
+                    list.append(createSymbol(memberKinds[mk], qvariant_cast<QVariantMap>(mit.value())));
+                }
+            }
+            list[classIndex].membersCount = list.size() - 1 - classIndex;
+        }
+    }
+}
+
+void ProjectSymbols::Builder::addFile(const QString & path, const QVariantMap & state, const QVector<SymbolRecord> & fileSymbols)
+{
+    FileRecord fileRecord;
+    fileRecord.path = addString(path);
+    fileRecord.lastModified = addString(state.value("modified").toString());
+    fileRecord.size = state.value("size").toLongLong();
+    fileRecord.hash = state.value("hash").toString().toULongLong(nullptr, 16);
+    fileRecord.symbolsFrom = symbolsData.size();
+    symbolsData += fileSymbols;
+    fileRecord.symbolsCount = symbolsData.size() - fileRecord.symbolsFrom;
+    filesData.append(fileRecord);
+}
+
+bool ProjectSymbols::Builder::write(QString path)
+{
+    QVector<qint32> namesData;
+    for (int i=0; i<symbolsData.size(); i++) {
+        int kind = symbolsData.at(i).kind;
+        if (kind == KIND_CONSTANT || kind == KIND_GLOBAL || kind == KIND_FUNCTION || kind == KIND_CLASS) namesData.append(i);
+    }
+    std::sort(namesData.begin(), namesData.end(), [&](qint32 a, qint32 b) {
+        const SymbolRecord & symbolA = symbolsData.at(a);
+        const SymbolRecord & symbolB = symbolsData.at(b);
+        if (symbolA.kind != symbolB.kind) return symbolA.kind < symbolB.kind;
+        const ushort * nameA = stringsData.constData() + symbolA.name.offset;
+        const ushort * nameB = stringsData.constData() + symbolB.name.offset;
+        return std::lexicographical_compare(nameA, nameA + symbolA.name.length, nameB, nameB + symbolB.name.length);
+    });
+
+    // keep the sections aligned
+    while (stringsData.size() % 4 != 0) stringsData.append(0);
+    Header fileHeader;
+    fileHeader.magic = SYMBOLS_MAGIC;
+    fileHeader.version = SYMBOLS_VERSION;
+    fileHeader.stringsOffset = sizeof(Header);
+    fileHeader.stringsSize = stringsData.size();
+    fileHeader.filesOffset = fileHeader.stringsOffset + stringsData.size() * static_cast<int>(sizeof(ushort));
+    fileHeader.filesCount = filesData.size();
+    fileHeader.symbolsOffset = fileHeader.filesOffset + filesData.size() * static_cast<int>(sizeof(FileRecord));
+    fileHeader.symbolsCount = symbolsData.size();
+    fileHeader.namesOffset = fileHeader.symbolsOffset + symbolsData.size() * static_cast<int>(sizeof(SymbolRecord));
+    fileHeader.namesCount = namesData.size();
+
+    QSaveFile outputFile(path);
+    if (!outputFile.open(QIODevice::WriteOnly)) return false;
+    outputFile.write(reinterpret_cast<const char *>(& fileHeader), sizeof(Header));
+    outputFile.write(reinterpret_cast<const char *>(stringsData.constData()), stringsData.size() * static_cast<int>(sizeof(ushort)));
+    outputFile.write(reinterpret_cast<const char *>(filesData.constData()), filesData.size() * static_cast<int>(sizeof(FileRecord)));
+    outputFile.write(reinterpret_cast<const char *>(symbolsData.constData()), symbolsData.size() * static_cast<int>(sizeof(SymbolRecord)));
+    outputFile.write(reinterpret_cast<const char *>(namesData.constData()), namesData.size() * static_cast<int>(sizeof(qint32)));
+    return outputFile.commit();
+}
+
+// writes the result map of the project parser
+bool ProjectSymbols::save(QString path, QVariantMap & map)
+{
+    Builder builder;
+    QHash<QString, QVector<SymbolRecord>> fileSymbols;
+    builder.groupSymbols(map, fileSymbols);
+    // files are sorted by path as QVariantMap keys, comparing UTF-16 code units
+    QVariantMap php_files = qvariant_cast<QVariantMap>(map.value("php_files"));
+    for (QVariantMap::const_iterator it = php_files.constBegin(); it != php_files.constEnd(); ++it) {
+        builder.addFile(it.key(), qvariant_cast<QVariantMap>(it.value()), fileSymbols.value(it.key()));
+    }
+    return builder.write(path);
+}
+
+// writes the result map of the project parser as JSON for debugging
+bool ProjectSymbols::exportJSON(QString path, QVariantMap & map)
+{
+    QJsonObject o = QJsonObject::fromVariantMap(map);
+    QJsonDocument d;
+    d.setObject(o);
+    return Helper::saveTextFile(path, QString(d.toJson()), "UTF-8");
+}
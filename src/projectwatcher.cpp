@@ -0,0 +1,153 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include "projectwatcher.h"
+#include <QDirIterator>
+#include <QFileInfo>
+#include "project.h"
+
+#if defined(Q_OS_LINUX)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+const int PROJECT_WATCHER_DELAY = 500;
+// a batch is reported after this time even if the changes go on
+const int PROJECT_WATCHER_MAX_DELAY = 3000;
+const int PROJECT_WATCHER_BUFFER_SIZE = 65536;
+
+ProjectWatcher::ProjectWatcher(QObject *parent) :
+    QObject(parent),
+    fd(-1),
+    notifier(nullptr),
+    overflowed(false)
+{
+    // the timer is a child, so that it is moved to the thread of the watcher
+    timer = new QTimer(this);
+    timer->setSingleShot(true);
+    connect(timer, SIGNAL(timeout()), this, SLOT(timerTimeout()));
+}
+
+ProjectWatcher::~ProjectWatcher()
+{
+    stop();
+}
+
+void ProjectWatcher::start(QString path)
+{
+    stop();
+    #if defined(Q_OS_LINUX)
+    fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) return;
+    rootPath = path;
+    linkedDirs.insert(QFileInfo(path).canonicalFilePath());
+    addDir(path, false);
+    notifier = new QSocketNotifier(fd, QSocketNotifier::Read, this);
+    connect(notifier, SIGNAL(activated(int)), this, SLOT(readEvents()));
+    #else
+    Q_UNUSED(path);
+    #endif
+}
+
+void ProjectWatcher::stop()
+{
+    timer->stop();
+    batchTimer.invalidate();
+    if (notifier != nullptr) {
+        notifier->setEnabled(false);
+        notifier->deleteLater();
+        notifier = nullptr;
+    }
+    #if defined(Q_OS_LINUX)
+    if (fd >= 0) ::close(fd);
+    #endif
+    fd = -1;
+    rootPath = "";
+    watchDirs.clear();
+    changedFiles.clear();
+    linkedDirs.clear();
+    overflowed = false;
+}
+
+// files of directories that appear after the start are reported as changed
+void ProjectWatcher::addDir(QString dir, bool isNew)
+{
+    #if defined(Q_OS_LINUX)
+    uint32_t mask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+    int wd = inotify_add_watch(fd, QFile::encodeName(dir).constData(), mask);
+    // watch limit is reached, the directory is updated by the project scan only
+    if (wd < 0) return;
+    watchDirs.insert(wd, dir);
+    QDirIterator it(dir, QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        QString path = it.next();
+        QFileInfo fInfo(path);
+        if (fInfo.isDir()) {
+            if (Project::isProjectDir(fInfo, linkedDirs)) addDir(path, isNew);
+        } else if (isNew && fInfo.isFile()) {
+            changedFiles.insert(path);
+        }
+    }
+    #else
+    Q_UNUSED(dir);
+    Q_UNUSED(isNew);
+    #endif
+}
+
+void ProjectWatcher::readEvents()
+{
+    #if defined(Q_OS_LINUX)
+    alignas(struct inotify_event) char buffer[PROJECT_WATCHER_BUFFER_SIZE];
+    for (;;) {
+        ssize_t length = ::read(fd, buffer, sizeof(buffer));
+        if (length <= 0) break;
+        char * ptr = buffer;
+        while (ptr < buffer + length) {
+            const struct inotify_event * event = reinterpret_cast<const struct inotify_event *>(ptr);
+            ptr += sizeof(struct inotify_event) + event->len;
+            if (event->mask & IN_Q_OVERFLOW) {
+                overflowed = true;
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                watchDirs.remove(event->wd);
+                continue;
+            }
+            QHash<int, QString>::const_iterator it = watchDirs.constFind(event->wd);
+            if (it == watchDirs.constEnd() || event->len == 0) continue;
+            QString name = QFile::decodeName(event->name);
+            QString path = it.value() + "/" + name;
+            if (event->mask & IN_ISDIR) {
+                if (Project::isExcludedDir(name)) continue;
+                if ((event->mask & (IN_CREATE | IN_MOVED_TO)) && Project::isProjectDir(QFileInfo(path), linkedDirs)) addDir(path, true);
+                // files of a moved away directory are not known here
+                else if (event->mask & IN_MOVED_FROM) overflowed = true;
+                continue;
+            }
+            changedFiles.insert(path);
+        }
+    }
+    // events are batched until the changes settle down, but not longer than the maximum delay
+    if (changedFiles.size() == 0 && !overflowed) return;
+    if (!batchTimer.isValid()) batchTimer.start();
+    qint64 remaining = PROJECT_WATCHER_MAX_DELAY - batchTimer.elapsed();
+    timer->start(static_cast<int>(qBound(static_cast<qint64>(0), remaining, static_cast<qint64>(PROJECT_WATCHER_DELAY))));
+    #endif
+}
+
+void ProjectWatcher::timerTimeout()
+{
+    batchTimer.invalidate();
+    if (overflowed) {
+        overflowed = false;
+        changedFiles.clear();
+        emit rescanRequested();
+        return;
+    }
+    QStringList files = changedFiles.values();
+    changedFiles.clear();
+    if (files.size() > 0) emit filesChanged(files);
+}
@@ -8,6 +8,7 @@
 #include <QPaintEvent>
 #include <QPainter>
 #include <QListWidgetItem>
+#include <QMultiHash>
 #include <QTimer>
 #include <QScrollBar>
 #include <QFontDatabase>
@@ -165,18 +166,18 @@ void QuickAccess::slideIn(int x, int y, int width, int height)
     animateIn();
 }
 
-void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
+void QuickAccess::setParseResult(ParsePHP::SharedParseResult result, QString file)
 {
     parseResultPHP = result;
     parseResultFile = file;
     parseResultType = PARSE_RESULT_TYPE_PHP;
     findEdit->setText("");
     lastSearch = "";
-    resultsList->clear();
+    QList<QListWidgetItem *> items;
     int total = 0;
     // constants
-    for (int c=0; c<result.constants.size(); c++) {
-        ParsePHP::ParseResultConstant constant = result.constants.at(c);
+    for (int c=0; c<result->constants.size(); c++) {
+        const ParsePHP::ParseResultConstant & constant = result->constants.at(c);
         if (constant.clsName.size() > 0) continue;
         QString name = constant.name;
         int p = constant.name.lastIndexOf("\\");
@@ -186,13 +187,13 @@ void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
         item->setToolTip(constant.name+" = "+constant.value);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(constant.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
     // variables
-    for (int v=0; v<result.variables.size(); v++) {
-        ParsePHP::ParseResultVariable variable = result.variables.at(v);
+    for (int v=0; v<result->variables.size(); v++) {
+        const ParsePHP::ParseResultVariable & variable = result->variables.at(v);
         if (variable.clsName.size() > 0 || variable.funcName.size() > 0) continue;
         QListWidgetItem * item = new QListWidgetItem();
         item->setText(variable.name);
@@ -201,13 +202,13 @@ void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
         item->setToolTip(varDesc);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(variable.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
     // functions
-    for (int f=0; f<result.functions.size(); f++) {
-        ParsePHP::ParseResultFunction func = result.functions.at(f);
+    for (int f=0; f<result->functions.size(); f++) {
+        const ParsePHP::ParseResultFunction & func = result->functions.at(f);
         if (func.clsName.size() > 0) continue;
         QString name = func.name;
         int p = func.name.lastIndexOf("\\");
@@ -225,13 +226,13 @@ void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
         item->setToolTip(funcDesc);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(func.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
     // classes
-    for (int i=0; i<result.classes.size(); i++) {
-        ParsePHP::ParseResultClass cls = result.classes.at(i);
+    for (int i=0; i<result->classes.size(); i++) {
+        const ParsePHP::ParseResultClass & cls = result->classes.at(i);
         QString clsPrettyName = cls.name;
         int p = cls.name.lastIndexOf("\\");
         if (p >= 0) clsPrettyName = cls.name.mid(p+1);
@@ -254,26 +255,26 @@ void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
         item->setToolTip(clsDesc);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(cls.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
         // class constants
         for (int c=0; c<cls.constantIndexes.size(); c++) {
-            if (result.constants.size() <= cls.constantIndexes.at(c)) break;
-            ParsePHP::ParseResultConstant constant = result.constants.at(cls.constantIndexes.at(c));
+            if (result->constants.size() <= cls.constantIndexes.at(c)) break;
+            const ParsePHP::ParseResultConstant & constant = result->constants.at(cls.constantIndexes.at(c));
             QListWidgetItem * item = new QListWidgetItem();
             item->setText(clsPrettyName+"::"+constant.name);
             item->setToolTip(clsPrettyName+"::"+constant.name+" = "+constant.value);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(constant.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
         // class variables
         for (int v=0; v<cls.variableIndexes.size(); v++) {
-            if (result.variables.size() <= cls.variableIndexes.at(v)) break;
-            ParsePHP::ParseResultVariable variable = result.variables.at(cls.variableIndexes.at(v));
+            if (result->variables.size() <= cls.variableIndexes.at(v)) break;
+            const ParsePHP::ParseResultVariable & variable = result->variables.at(cls.variableIndexes.at(v));
             QListWidgetItem * item = new QListWidgetItem();
             item->setText(clsPrettyName+"::"+variable.name);
             QString varDesc = "";
@@ -284,14 +285,14 @@ void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
             item->setToolTip(varDesc);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(variable.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
         // class methods
         for (int f=0; f<cls.functionIndexes.size(); f++) {
-            if (result.functions.size() <= cls.functionIndexes.at(f)) break;
-            ParsePHP::ParseResultFunction func = result.functions.at(cls.functionIndexes.at(f));
+            if (result->functions.size() <= cls.functionIndexes.at(f)) break;
+            const ParsePHP::ParseResultFunction & func = result->functions.at(cls.functionIndexes.at(f));
             QListWidgetItem * item = new QListWidgetItem();
             QString funcDesc = clsPrettyName+"::"+func.name;
             if (func.args.size() > 0) funcDesc += "("+QString(".").repeated(func.maxArgs)+")";
@@ -309,52 +310,52 @@ void QuickAccess::setParseResult(ParsePHP::ParseResult result, QString file)
             item->setToolTip(funcDesc);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(func.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
     }
-    resultsList->sortItems();
+    updateResults(items);
 }
 
-void QuickAccess::setParseResult(ParseJS::ParseResult result, QString file)
+void QuickAccess::setParseResult(ParseJS::SharedParseResult result, QString file)
 {
     parseResultJS = result;
     parseResultFile = file;
     parseResultType = PARSE_RESULT_TYPE_JS;
     findEdit->setText("");
     lastSearch = "";
-    resultsList->clear();
+    QList<QListWidgetItem *> items;
     int total = 0;
     // constants
-    for (int c=0; c<result.constants.size(); c++) {
-        ParseJS::ParseResultConstant constant = result.constants.at(c);
+    for (int c=0; c<result->constants.size(); c++) {
+        const ParseJS::ParseResultConstant & constant = result->constants.at(c);
         if (constant.clsName.size() > 0 || constant.funcName.size() > 0) continue;
         QListWidgetItem * item = new QListWidgetItem();
         item->setText(constant.name);
         item->setToolTip(constant.name+" = "+constant.value);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(constant.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
     // variables
-    for (int v=0; v<result.variables.size(); v++) {
-        ParseJS::ParseResultVariable variable = result.variables.at(v);
+    for (int v=0; v<result->variables.size(); v++) {
+        const ParseJS::ParseResultVariable & variable = result->variables.at(v);
         if (variable.clsName.size() > 0 || variable.funcName.size() > 0) continue;
         QListWidgetItem * item = new QListWidgetItem();
         item->setText(variable.name);
         item->setToolTip(variable.name);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(variable.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
     // functions
-    for (int f=0; f<result.functions.size(); f++) {
-        ParseJS::ParseResultFunction func = result.functions.at(f);
+    for (int f=0; f<result->functions.size(); f++) {
+        const ParseJS::ParseResultFunction & func = result->functions.at(f);
         if (func.clsName.size() > 0) continue;
         QListWidgetItem * item = new QListWidgetItem();
         QString funcDesc = func.name;
@@ -369,31 +370,31 @@ void QuickAccess::setParseResult(ParseJS::ParseResult result, QString file)
         item->setToolTip(funcDesc);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(func.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
     // classes
-    for (int i=0; i<result.classes.size(); i++) {
-        ParseJS::ParseResultClass cls = result.classes.at(i);
+    for (int i=0; i<result->classes.size(); i++) {
+        const ParseJS::ParseResultClass & cls = result->classes.at(i);
         // class variables
         for (int v=0; v<cls.variableIndexes.size(); v++) {
-            if (result.variables.size() <= cls.variableIndexes.at(v)) break;
-            ParseJS::ParseResultVariable variable = result.variables.at(cls.variableIndexes.at(v));
+            if (result->variables.size() <= cls.variableIndexes.at(v)) break;
+            const ParseJS::ParseResultVariable & variable = result->variables.at(cls.variableIndexes.at(v));
             QListWidgetItem * item = new QListWidgetItem();
             item->setText(cls.name+"::"+variable.name);
             QString varDesc = variable.name;
             item->setToolTip(varDesc);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(variable.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
         // class methods
         for (int f=0; f<cls.functionIndexes.size(); f++) {
-            if (result.functions.size() <= cls.functionIndexes.at(f)) break;
-            ParseJS::ParseResultFunction func = result.functions.at(cls.functionIndexes.at(f));
+            if (result->functions.size() <= cls.functionIndexes.at(f)) break;
+            const ParseJS::ParseResultFunction & func = result->functions.at(cls.functionIndexes.at(f));
             QListWidgetItem * item = new QListWidgetItem();
             QString funcDesc = cls.name+"::"+func.name;
             if (func.args.size() > 0) funcDesc += "("+QString(".").repeated(func.maxArgs)+")";
@@ -407,77 +408,113 @@ void QuickAccess::setParseResult(ParseJS::ParseResult result, QString file)
             item->setToolTip(funcDesc);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(func.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
     }
-    resultsList->sortItems();
+    updateResults(items);
 }
 
-void QuickAccess::setParseResult(ParseCSS::ParseResult result, QString file)
+void QuickAccess::setParseResult(ParseCSS::SharedParseResult result, QString file)
 {
     parseResultCSS = result;
     parseResultFile = file;
     parseResultType = PARSE_RESULT_TYPE_CSS;
     findEdit->setText("");
     lastSearch = "";
-    resultsList->clear();
+    QList<QListWidgetItem *> items;
     int total = 0;
     // font-face
-    if (result.fonts.size() > 0) {
-        for (int i=0; i<result.fonts.size(); i++) {
-            ParseCSS::ParseResultFont font = result.fonts.at(i);
+    if (result->fonts.size() > 0) {
+        for (int i=0; i<result->fonts.size(); i++) {
+            const ParseCSS::ParseResultFont & font = result->fonts.at(i);
             QListWidgetItem * item = new QListWidgetItem();
             item->setText("@font-face: "+font.name);
             item->setToolTip("font-family: "+font.name);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(font.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
     }
     // media
-    if (result.medias.size() > 0) {
-        for (int i=0; i<result.medias.size(); i++) {
-            ParseCSS::ParseResultMedia media = result.medias.at(i);
+    if (result->medias.size() > 0) {
+        for (int i=0; i<result->medias.size(); i++) {
+            const ParseCSS::ParseResultMedia & media = result->medias.at(i);
             QListWidgetItem * item = new QListWidgetItem();
             item->setText("@media( "+media.name+" )");
             item->setToolTip("@media( "+media.name+" )");
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(media.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
     }
     // keyframes
-    if (result.keyframes.size() > 0) {
-        for (int i=0; i<result.keyframes.size(); i++) {
-            ParseCSS::ParseResultKeyframe keyframe = result.keyframes.at(i);
+    if (result->keyframes.size() > 0) {
+        for (int i=0; i<result->keyframes.size(); i++) {
+            const ParseCSS::ParseResultKeyframe & keyframe = result->keyframes.at(i);
             QListWidgetItem * item = new QListWidgetItem();
             item->setText("@keyframes: "+keyframe.name);
             item->setToolTip("@keyframes "+keyframe.name);
             item->setData(Qt::UserRole, QVariant(file));
             item->setData(Qt::UserRole+1, QVariant(keyframe.line));
-            resultsList->addItem(item);
+            items.append(item);
             total++;
             if (total >= LIMIT) break;
         }
     }
     // ids & classes
-    for (int i=0; i<result.names.size(); i++) {
-        ParseCSS::ParseResultName nm = result.names.at(i);
+    for (int i=0; i<result->names.size(); i++) {
+        const ParseCSS::ParseResultName & nm = result->names.at(i);
         QListWidgetItem * item = new QListWidgetItem();
         item->setText("> "+nm.name);
         item->setToolTip(nm.name);
         item->setData(Qt::UserRole, QVariant(file));
         item->setData(Qt::UserRole+1, QVariant(nm.line));
-        resultsList->addItem(item);
+        items.append(item);
         total++;
         if (total >= LIMIT) break;
     }
+    updateResults(items);
+}
+
+static QString getItemKey(QListWidgetItem * item)
+{
+    return item->text() + "\n" + item->toolTip() + "\n" + item->data(Qt::UserRole).toString();
+}
+
+// keeps the list if only the lines of the symbols have changed
+void QuickAccess::updateResults(QList<QListWidgetItem *> items)
+{
+    if (resultsList->count() == items.size()) {
+        QMultiHash<QString, QListWidgetItem *> currentItems;
+        for (int i=0; i<resultsList->count(); i++) {
+            QListWidgetItem * item = resultsList->item(i);
+            currentItems.insert(getItemKey(item), item);
+        }
+        QList<QListWidgetItem *> matchedItems;
+        for (int i=0; i<items.size(); i++) {
+            QListWidgetItem * item = currentItems.take(getItemKey(items.at(i)));
+            if (item == nullptr) break;
+            matchedItems.append(item);
+        }
+        if (matchedItems.size() == items.size()) {
+            for (int i=0; i<items.size(); i++) {
+                QVariant line = items.at(i)->data(Qt::UserRole+1);
+                if (matchedItems.at(i)->data(Qt::UserRole+1) != line) matchedItems.at(i)->setData(Qt::UserRole+1, line);
+            }
+            qDeleteAll(items);
+            return;
+        }
+    }
+    resultsList->clear();
+    for (int i=0; i<items.size(); i++) {
+        resultsList->addItem(items.at(i));
+    }
     resultsList->sortItems();
 }
 
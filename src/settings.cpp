@@ -70,6 +70,9 @@ void Settings::initData()
         {"editor_wrap_long_lines", "no"},
         {"highlight_spaces", "no"},
         {"highlight_tabs", "no"},
+        {"highlight_in_background", "yes"},
+        {"highlight_lazy", "yes"},
+        {"highlight_debug_stats", "no"},
         {"highlight_php_extensions", "php, phtml, tpl, html"},
         {"highlight_js_extensions", "js, dart"},
         {"highlight_css_extensions", "css, less, scss, sass"},
@@ -79,6 +82,9 @@ void Settings::initData()
         {"parser_enable_parse_php", "yes"},
         {"parser_enable_parse_js", "yes"},
         {"parser_enable_parse_css", "yes"},
+        {"parser_debug_stats", "no"},
+        {"parser_export_symbols_json", "no"},
+        {"parser_watch_project", "yes"},
         {"parser_enable_git", "yes"},
         {"parser_enable_servers", "yes"},
         {"parser_php_path", ""},
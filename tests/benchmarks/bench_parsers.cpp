@@ -0,0 +1,117 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include <QtTest>
+#include "parsephp.h"
+
+const int CLASS_LINES = 10000;
+const int LINE_LOOKUPS = 1000;
+
+// Parses a generated PHP class of 10k lines. The line number benchmarks
+// compare the line index of the parsers with the prefix count it replaced,
+// run with "-iterations N" or "-tickcounter" for steadier numbers.
+class BenchParsers : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void parsePHP();
+    void parsePHPEdit();
+    void getLineIndex();
+    void getLinePrefixCount();
+private:
+    QString text;
+    QVector<int> lookupOffsets;
+    int editOffset;
+    int lastFunctionLine;
+};
+
+// each property with its method takes ten lines
+static QString generateClass(int lines)
+{
+    QString text = "<?php\nnamespace Bench;\n\nuse Bench\\Base;\n\n/**\n * Generated class\n */\nclass Generated extends Base\n{\n";
+    int methods = (lines - 11) / 10;
+    for (int i=0; i<methods; i++) {
+        QString n = QString::number(i);
+        text += "    protected $value" + n + " = " + n + ";\n";
+        text += "    /**\n     * @return string\n     */\n";
+        text += "    public function method" + n + "($arg, array $list = []) {\n";
+        text += "        $result = $this->value" + n + " + count($list);\n";
+        text += "        if ($arg) $result .= \"value: {$arg}\";\n";
+        text += "        return strtoupper((string) $result);\n";
+        text += "    }\n\n";
+    }
+    text += "}\n";
+    return text;
+}
+
+void BenchParsers::initTestCase()
+{
+    text = generateClass(CLASS_LINES);
+    QVERIFY(text.count('\n') > CLASS_LINES - 10);
+    lastFunctionLine = text.left(text.lastIndexOf("public function")).count('\n') + 1;
+    for (int i=0; i<LINE_LOOKUPS; i++) {
+        lookupOffsets.append(static_cast<int>(static_cast<qint64>(text.size()) * i / LINE_LOOKUPS));
+    }
+    editOffset = text.indexOf("$result = ", text.size() / 2) + 7;
+    QVERIFY(editOffset > 0);
+}
+
+void BenchParsers::parsePHP()
+{
+    ParsePHP parser;
+    ParsePHP::SharedParseResult result;
+    QBENCHMARK {
+        result = parser.parse(text);
+    }
+    QVERIFY(result->functions.size() > 0);
+    QCOMPARE(result->functions.last().line, lastFunctionLine);
+}
+
+// types a char into a variable name of a method body and removes it again
+void BenchParsers::parsePHPEdit()
+{
+    ParsePHP parser;
+    parser.parse(text, -1, -1);
+    QString edited = text;
+    edited.insert(editOffset, "x");
+    ParsePHP::SharedParseResult result;
+    QBENCHMARK {
+        parser.parse(edited, editOffset, editOffset + 1);
+        result = parser.parse(text, editOffset, editOffset);
+    }
+    QCOMPARE(result->functions.last().line, lastFunctionLine);
+}
+
+void BenchParsers::getLineIndex()
+{
+    ParsePHP parser;
+    int lines = 0;
+    QBENCHMARK {
+        lines = 0;
+        for (int offset : lookupOffsets) {
+            lines += parser.getLine(text, offset);
+        }
+    }
+    QVERIFY(lines > 0);
+}
+
+// line numbers as they were found before the line index
+void BenchParsers::getLinePrefixCount()
+{
+    int lines = 0;
+    QBENCHMARK {
+        lines = 0;
+        for (int offset : lookupOffsets) {
+            lines += text.mid(0, offset).count("\n") + 1;
+        }
+    }
+    QVERIFY(lines > 0);
+}
+
+QTEST_GUILESS_MAIN(BenchParsers)
+
+#include "bench_parsers.moc"
@@ -0,0 +1,24 @@
+QT       += core testlib
+QT       -= gui
+
+TARGET = bench_parsers
+TEMPLATE = app
+
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../../include
+
+SOURCES += \
+    bench_parsers.cpp \
+    ../../src/parse.cpp \
+    ../../src/parsephp.cpp
+
+HEADERS += \
+    ../../include/parse.h \
+    ../../include/parsephp.h
+
+RESOURCES += \
+    ../../qrc/highlight.qrc
@@ -0,0 +1,211 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include <QtTest>
+#include <QTextDocument>
+#include <QTextBlock>
+#include <QTextLayout>
+#include "highlight.h"
+#include "highlightdata.h"
+
+const int PAGE_ITEMS = 1000;
+const int TEMPLATE_FUNCTIONS = 1000;
+const int MINIFIED_ITEMS = 2000;
+const int LINE_LOOKUPS = 1000;
+
+// Highlights a generated PHP template of about 9k lines with html, css and js
+// in it and a PHP file of docblocks and heredocs, once with the inert chars
+// skipping and once without it. Needs a gui platform, run with
+// "-platform offscreen" when there is no display. The context lookup benchmark
+// asks for the mode, state and scopes at spread positions of a minified line.
+// The skipping check compares the formats and states of each line with the
+// skipping on and off.
+class BenchHighlight : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void inertCharsSkipping_data();
+    void inertCharsSkipping();
+    void rehighlight_data();
+    void rehighlight();
+    void contextLookup_data();
+    void contextLookup();
+};
+
+// each item is a mix of html, php, comments and attribute strings
+static QString generatePage(int items)
+{
+    QString text = "<?php\n/**\n * Generated template\n */\n$title = 'Bench';\n?>\n<!DOCTYPE html>\n<html>\n<head>\n<title><?php echo $title; ?></title>\n";
+    text += "<style>\n/* layout of the list */\nbody { margin: 0; font-family: \"Helvetica Neue\", Arial, sans-serif; }\n.item { padding: 4px 8px; border-bottom: 1px solid #ccc; }\n</style>\n</head>\n<body>\n";
+    for (int i=0; i<items; i++) {
+        QString n = QString::number(i);
+        text += "<!-- item " + n + ": rendered from the list of items -->\n";
+        text += "<div class=\"item item-" + n + "\" data-id=\"<?= $items[" + n + "]['id'] ?>\" title=\"Item number " + n + " of the generated list\">\n";
+        text += "    <h2><?php echo htmlspecialchars($items[" + n + "]['title']); ?></h2>\n";
+        text += "    <p>Plain text paragraph " + n + " with some words, punctuation; and (parens) to highlight.</p>\n";
+        text += "    <?php if ($items[" + n + "]['visible']) { /* show the link of the item */ ?>\n";
+        text += "    <a href=\"/items/" + n + "\" onclick=\"return confirm('Open item " + n + "?');\">Open</a>\n";
+        text += "    <?php } ?>\n";
+        text += "</div>\n";
+    }
+    text += "<script>\n// generated click handlers\nvar items = document.querySelectorAll('.item');\nfor (var i = 0; i < items.length; i++) {\n";
+    text += "    items[i].addEventListener('click', function(e) { console.log(\"clicked item\", e.target); });\n}\n</script>\n</body>\n</html>\n";
+    return text;
+}
+
+// most of the text is in comments, heredoc and nowdoc bodies
+static QString generateTemplates(int functions)
+{
+    QString text = "<?php\nnamespace Bench;\n\n";
+    for (int i=0; i<functions; i++) {
+        QString n = QString::number(i);
+        text += "/**\n * Renders the template number " + n + " of the generated list of templates.\n";
+        text += " * The text of the template is kept in a heredoc, the styles in a nowdoc.\n *\n";
+        text += " * @param array $item the item to render, it should have a title and a description\n * @return string\n */\n";
+        text += "function template" + n + "(array $item) {\n";
+        text += "    $style = <<<'CSS'\n.template-" + n + " { margin: 0 auto; padding: 8px 16px; border: 1px solid #cccccc; }\nCSS;\n";
+        text += "    return <<<HTML\n<div class=\"template-" + n + "\">\n";
+        text += "    <h2>{$item['title']}</h2>\n    <p>Description of the item number " + n + ": {$item['description']}</p>\n";
+        text += "    <p>Plain line of the template text that stays the same for every item of the list.</p>\n</div>\nHTML;\n}\n\n";
+    }
+    return text;
+}
+
+// a single minified line, every item opens its own class, function, media or tag scope
+static QString generateMinified(QString extension, int items)
+{
+    QString text;
+    for (int i=0; i<items; i++) {
+        QString n = QString::number(i);
+        if (extension == "js") {
+            text += "class Item" + n + "{constructor(a){this.a=a}get(){return function(b){var c='item " + n + "';return b+c}}}";
+        } else if (extension == "css") {
+            text += "@media (max-width:" + n + "px){.item-" + n + "{margin:0;padding:4px}.item-" + n + " a{color:#333}}";
+        } else {
+            text += "<div class=\"item\"><p><?php namespace Bench" + n + "{class Item{function get(){return 'item " + n + "';}}} ?></p>";
+            text += "<script>var item" + n + "=function(){return " + n + "};</script></div>";
+        }
+    }
+    return text + "\n";
+}
+
+void BenchHighlight::initTestCase()
+{
+    Settings::load();
+    HighlightWords::setColors();
+}
+
+void BenchHighlight::inertCharsSkipping_data()
+{
+    QTest::addColumn<QString>("text");
+    QFile f(QFINDTESTDATA("data/heredoc.php"));
+    QVERIFY(f.open(QIODevice::ReadOnly | QIODevice::Text));
+    QTest::newRow("heredoc corpus") << QString::fromUtf8(f.readAll());
+    QTest::newRow("heredocs") << generateTemplates(50);
+    QTest::newRow("mixed") << generatePage(50);
+}
+
+void BenchHighlight::inertCharsSkipping()
+{
+    QFETCH(QString, text);
+    QTextDocument doc, docNoSkip;
+    doc.setPlainText(text);
+    docNoSkip.setPlainText(text);
+    Highlight highlight(&doc), highlightNoSkip(&docNoSkip);
+    highlight.initMode("php", -1);
+    highlightNoSkip.initMode("php", -1);
+    highlight.setFirstRunMode(true);
+    highlightNoSkip.setFirstRunMode(true);
+    highlight.setInertCharsSkipping(true);
+    highlightNoSkip.setInertCharsSkipping(false);
+    highlight.rehighlight();
+    highlightNoSkip.rehighlight();
+    QTextBlock block = doc.firstBlock(), blockNoSkip = docNoSkip.firstBlock();
+    while (block.isValid() && blockNoSkip.isValid()) {
+        QString line = QString::number(block.blockNumber() + 1);
+        HighlightData * data = dynamic_cast<HighlightData *>(block.userData());
+        HighlightData * dataNoSkip = dynamic_cast<HighlightData *>(blockNoSkip.userData());
+        QVERIFY2(data != nullptr && dataNoSkip != nullptr, qPrintable("no data at line " + line));
+        QVERIFY2(data->isSameState(*dataNoSkip), qPrintable("state differs at line " + line));
+        QVERIFY2(block.layout()->formats() == blockNoSkip.layout()->formats(), qPrintable("formats differ at line " + line));
+        block = block.next();
+        blockNoSkip = blockNoSkip.next();
+    }
+    QVERIFY(!block.isValid() && !blockNoSkip.isValid());
+}
+
+void BenchHighlight::rehighlight_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<bool>("skipping");
+    QString page = generatePage(PAGE_ITEMS);
+    QTest::newRow("mixed") << page << true;
+    QTest::newRow("mixed, no skipping") << page << false;
+    QString templates = generateTemplates(TEMPLATE_FUNCTIONS);
+    QTest::newRow("heredocs") << templates << true;
+    QTest::newRow("heredocs, no skipping") << templates << false;
+}
+
+void BenchHighlight::rehighlight()
+{
+    QFETCH(QString, text);
+    QFETCH(bool, skipping);
+    QTextDocument doc;
+    doc.setPlainText(text);
+    Highlight highlight(&doc);
+    highlight.initMode("php", -1);
+    highlight.setFirstRunMode(true);
+    highlight.setInertCharsSkipping(skipping);
+    QBENCHMARK {
+        highlight.rehighlight();
+    }
+    QVERIFY(highlight.getFoundModes().contains(QString::fromStdString(MODE_PHP)));
+}
+
+void BenchHighlight::contextLookup_data()
+{
+    QTest::addColumn<QString>("extension");
+    QTest::newRow("php") << "php";
+    QTest::newRow("js") << "js";
+    QTest::newRow("css") << "css";
+}
+
+void BenchHighlight::contextLookup()
+{
+    QFETCH(QString, extension);
+    QTextDocument doc;
+    doc.setPlainText(generateMinified(extension, MINIFIED_ITEMS));
+    Highlight highlight(&doc);
+    highlight.initMode(extension, -1);
+    highlight.setFirstRunMode(true);
+    highlight.rehighlight();
+    QTextBlock block = doc.firstBlock();
+    QVector<int> positions;
+    for (int i=0; i<LINE_LOOKUPS; i++) {
+        positions.append(static_cast<int>(static_cast<qint64>(block.length() - 1) * i / LINE_LOOKUPS));
+    }
+    int found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (int pos : positions) {
+            if (highlight.findModeAtCursor(&block, pos) != MODE_HTML) found++;
+            if (highlight.findStateAtCursor(&block, pos) != STATE_NONE) found++;
+            if (highlight.findNsPHPAtCursor(&block, pos).size() > 0) found++;
+            if (highlight.findClsPHPAtCursor(&block, pos).size() > 0) found++;
+            if (highlight.findFuncPHPAtCursor(&block, pos).size() > 0) found++;
+            if (highlight.findClsJSAtCursor(&block, pos).size() > 0) found++;
+            if (highlight.findFuncJSAtCursor(&block, pos).size() > 0) found++;
+            if (highlight.findMediaCSSAtCursor(&block, pos).size() > 0) found++;
+            if (highlight.findTagChainHTMLAtCursor(&block, pos).size() > 0) found++;
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+QTEST_MAIN(BenchHighlight)
+
+#include "bench_highlight.moc"
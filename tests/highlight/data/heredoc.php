@@ -0,0 +1,63 @@
+<?php
+/**
+ * Heredoc and nowdoc bodies for the inert chars skipping check
+ */
+$name = 'World';
+$item = ['title' => 'Item', 'tags' => ['a', 'b']];
+$obj = new stdClass();
+$obj->value = 42;
+
+$plain = <<<EOT
+Plain text of a heredoc, with some words, punctuation; and (parens).
+EOT;
+
+$interpolated = <<<EOT
+Hello $name, {$item['title']} has ${name} and $item[title] tags.
+Object value is $obj->value and {$obj->value}, the total is {$item['tags'][0]}.
+Escaped \$name, \{$name}, \\ backslash, \t tab, \x41 hex, \u{1F600} and \101 octal.
+Braces { alone } and dollar $ alone, $1 is not a variable.
+EOT;
+
+$quoted = <<<"EOT"
+Quoted heredoc with "double" and 'single' quotes, $name and {$obj->value}.
+EOT;
+
+$nowdoc = <<<'EOT'
+Nowdoc keeps $name, {$item['title']} and \n as they are; (parens) too.
+EOT;
+
+$markup = <<<HTML
+<div class="item">
+    <?php echo $name; ?>
+    <p>Closing tag ?> inside the body does not end php</p>
+    <script>var a = "?>";</script>
+</div>
+HTML;
+
+$nearMiss = <<<EOT
+notEOT;
+EOTX;
+ EOT
+EOT ;
+EOT;
+
+$indented = <<<'CSS'
+    .item { margin: 0; padding: 4px; }
+    CSS;
+CSS;
+
+function template($title) {
+    return <<<TPL
+<h1>{$title}</h1>
+<p>Text with // not a comment and /* not a comment */ in it.</p>
+TPL;
+}
+
+echo template(<<<ARG
+argument $name
+ARG
+);
+$after = "string after the heredocs $name";
+// line comment after the heredocs
+?>
+<p>html after php</p>
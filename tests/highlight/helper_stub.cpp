@@ -0,0 +1,23 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include "helper.h"
+#include <sstream>
+#include <QVersionNumber>
+
+// The highlighter and the settings use only these helpers,
+// helper.cpp itself would pull in the whole application.
+
+QString Helper::doubleToStr(double n)
+{
+    std::stringstream ss;
+    ss << n;
+    return QString::fromStdString(ss.str());
+}
+
+bool Helper::isQtVersionLessThan(int maj, int min, int mic) {
+    return QVersionNumber::compare(QVersionNumber::fromString(qVersion()), QVersionNumber(maj, min, mic)) < 0;
+}
@@ -0,0 +1,32 @@
+QT       += core gui widgets testlib
+
+TARGET = bench_highlight
+TEMPLATE = app
+
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../../include
+
+SOURCES += \
+    bench_highlight.cpp \
+    helper_stub.cpp \
+    ../../src/settings.cpp \
+    ../../src/highlightdata.cpp \
+    ../../src/highlight.cpp \
+    ../../src/highlightwords.cpp \
+    ../../src/highlightwordsmap.cpp \
+    ../../src/highlightwordstables.cpp
+
+HEADERS += \
+    ../../include/settings.h \
+    ../../include/highlightdata.h \
+    ../../include/highlight.h \
+    ../../include/highlightwords.h \
+    ../../include/highlightwordsmap.h
+
+# helper.h includes the context dialog header
+FORMS += \
+    ../../ui/contextdialog.ui
@@ -0,0 +1,55 @@
+// Shopping cart
+class Item {
+    constructor(name, price = 0) {
+        this.name = name;
+        this.price = price;
+    }
+
+    total(count) {
+        return this.price * count;
+    }
+}
+
+class Cart extends Item {
+    constructor() {
+        super('cart');
+        this.items = [];
+        this.discount = new Discount();
+    }
+
+    /**
+     * Adds an item
+     */
+    add(item, count = 1) {
+        const entry = {item: item, count: count};
+        this.items.push(entry);
+        return this;
+    }
+
+    static fromJSON(json) {
+        let cart = new Cart();
+        for (const entry of JSON.parse(json)) {
+            cart.add(new Item(entry.name, entry.price), entry.count);
+        }
+        return cart;
+    }
+
+    get size() {
+        return this.items.length;
+    }
+}
+
+const Logger = class {
+    log(message) {
+        console.log('[cart] ' + message);
+    }
+};
+
+async function loadCart(url) {
+    const response = await fetch(url);
+    const cart = Cart.fromJSON(await response.text());
+    return cart;
+}
+
+const formatPrice = (value) => value.toFixed(2);
+let carts = new Map();
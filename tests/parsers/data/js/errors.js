@@ -0,0 +1,10 @@
+function broken(a, b {
+    var list = [1, 2, 3;
+    if (a > b) {
+        return list;
+}
+
+function unclosedString() {
+    var text = "never closed;
+    return text;
+}
@@ -0,0 +1,73 @@
+/**
+ * Notification widget
+ * Shows messages at the top of the page
+ */
+var Notify = (function () {
+    'use strict';
+
+    var DEFAULT_TIMEOUT = 3000;
+    var queue = [];
+
+    // creates the message element
+    function createElement(text, type) {
+        var element = document.createElement('div');
+        element.className = 'notify notify-' + type;
+        element.textContent = text;
+        return element;
+    }
+
+    /**
+     * Adds a message to the queue
+     * @param {string} text
+     * @param {number} timeout
+     */
+    function show(text, type, timeout) {
+        var element = createElement(text, type || 'info');
+        queue.push(element);
+        document.body.appendChild(element);
+        setTimeout(function () {
+            hide(element);
+        }, timeout || DEFAULT_TIMEOUT);
+        return element;
+    }
+
+    function hide(element) {
+        var index = queue.indexOf(element);
+        if (index >= 0) {
+            queue.splice(index, 1);
+        }
+        if (element.parentNode) {
+            element.parentNode.removeChild(element);
+        }
+    }
+
+    return {
+        show: show,
+        hide: hide
+    };
+})();
+
+function Counter(start) {
+    this.value = start || 0;
+    this.label = new Label('counter');
+}
+
+Counter.prototype.increment = function (step) {
+    this.value += step || 1;
+    return this;
+};
+
+Counter.prototype.reset = function () {
+    this.value = 0;
+    return this;
+};
+
+function createCounter() {
+    var counter = new Counter(10);
+    return counter;
+}
+
+const MAX_ITEMS = 50;
+let total = 0;
+var pattern = /^[a-z]+\/[0-9]*$/i, escaped = "quote \" inside";
+var template = `Total: ${total}`;
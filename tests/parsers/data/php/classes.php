@@ -0,0 +1,104 @@
+<?php
+namespace App\Models;
+
+use App\Contracts\Storable;
+use App\Support\Collection as List;
+use function App\Support\format_price;
+use const App\Support\DEFAULT_CURRENCY;
+
+/**
+ * Anything that has a price
+ */
+interface Priced extends Storable
+{
+    public function price(): float;
+}
+
+trait HasName
+{
+    protected $name = '';
+
+    public function getName(): string
+    {
+        return $this->name;
+    }
+}
+
+/**
+ * Base class of the products
+ */
+abstract class Product implements Priced, \JsonSerializable
+{
+    use HasName;
+
+    const CURRENCY = DEFAULT_CURRENCY;
+    const TAX = 0.2;
+
+    /**
+     * @var int
+     */
+    public static $count = 0;
+    private $price;
+    protected $tags = [];
+
+    public function __construct(string $name, float $price = 0.0, array $tags = [])
+    {
+        $this->name = $name;
+        $this->price = $price;
+        $this->tags = $tags;
+        self::$count++;
+    }
+
+    abstract protected function category(): string;
+
+    /**
+     * Price with the tax
+     */
+    public function price(): float
+    {
+        $total = $this->price * (1 + self::TAX);
+        return round($total, 2);
+    }
+
+    public static function create($name, ...$args)
+    {
+        $product = new static($name, ...$args);
+        return $product;
+    }
+
+    public function jsonSerialize()
+    {
+        $format = function ($value) use ($product) {
+            $label = format_price($value);
+            return $label;
+        };
+        $logger = new class {
+            public function log($message) {
+                $line = date('c') . ' ' . $message;
+                echo $line;
+            }
+        };
+        $logger->log($this->name);
+        return ['name' => $this->name, 'price' => $format($this->price())];
+    }
+}
+
+final class Book extends Product
+{
+    private ?string $isbn = null;
+
+    protected function category(): string
+    {
+        $category = 'books';
+        return $category;
+    }
+}
+
+function total(List $items, $discount = 0)
+{
+    $sum = 0;
+    foreach ($items as $item) {
+        $sum += $item->price();
+    }
+    return $sum - $discount;
+}
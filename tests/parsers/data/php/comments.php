@@ -0,0 +1,38 @@
+<html>
+<body>
+<?php // the comment ends before the closing tag ?>
+<p>Between the tags</p>
+<?php # hash comments end there too ?>
+<?php
+/**
+ * Counts the visits
+ *
+ * @param int $start
+ * @return int
+ */
+function visits($start = 0) {
+    // $ignored = 1;
+    # $alsoIgnored = 2;
+    /* $blockIgnored = 3; */
+    $visits = $start + 1; // trailing comment with a brace {
+    return $visits;
+}
+
+/** Not a docblock of anything */
+
+// A comment right above the class
+class Counter
+{
+    /**
+     * Increments the value
+     */
+    public function increment($value) { return $value + 1; }
+    // function commented() {}
+}
+?>
+<div><?php echo visits(); // print ?></div>
+<?php
+function afterTags() {
+    $after = true; // the parser has to find this function ?> <?php
+    return $after;
+}
@@ -0,0 +1,19 @@
+<?php
+function broken($a, $b {
+    $list = [1, 2, 3;
+    if ($a > $b) {
+        return $list;
+}
+
+function unclosedString() {
+    $text = "never closed;
+    return $text;
+}
+
+class Extra
+{
+    public function method() {
+        return 1;
+    }
+}
+}
@@ -0,0 +1,46 @@
+<?php
+function page($title) {
+    $head = <<<HTML
+<head>
+    <title>{$title}</title>
+    <script>function notPhp() { return "{"; }</script>
+</head>
+HTML;
+    $style = <<<'CSS'
+body { margin: 0; } /* function fake() {} */
+CSS;
+    $quoted = <<<"TEXT"
+    class Fake { }
+    TEXT;
+    return $head . $style . $quoted;
+}
+
+function indented() {
+    $list = [
+        <<<ITEM
+          first item with an unclosed ( bracket
+          ITEM,
+        <<<'ITEM'
+          second item with $notAVariable
+          ITEM,
+    ];
+    return $list;
+}
+
+class Template
+{
+    public function render($data) {
+        $html = <<<EOT
+        <ul>
+            <li>{$data['name']}</li>
+        </ul>
+        EOT;
+        return $html;
+    }
+
+    public function empty() {
+        $text = <<<END
+END;
+        return $text;
+    }
+}
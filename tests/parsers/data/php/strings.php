@@ -0,0 +1,28 @@
+<?php
+namespace Strings;
+
+const GREETING = "Hello, {$name}";
+
+function quoted() {
+    $single = 'function notAFunction() { $notAVar = 1; }';
+    $double = "class NotAClass { const NOT_CONST = 1; }";
+    $escaped = "a \"quoted\" \\ string with a brace { and a paren (";
+    $apostrophe = 'it\'s a { brace';
+    $path = 'C:\\path\\';
+    $interpolated = "value: {$single} and ${double} and $escaped[0]";
+    $command = `ls -la /tmp`;
+    $concat = $single . '//' . $double . '/* not a comment */' . '#';
+    return [$single, $double, $escaped, $apostrophe, $path, $interpolated, $command, $concat];
+}
+
+class Messages
+{
+    const WELCOME = 'Welcome { to the site';
+    const BYE = "Bye ) for now";
+    public $template = "<?php echo 'nested'; ?>";
+
+    public function message($key = 'default', $fallback = "none") {
+        $messages = ['welcome' => self::WELCOME, "bye" => self::BYE];
+        return $messages[$key] ?? $fallback;
+    }
+}
@@ -0,0 +1,71 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include "helper.h"
+
+// Built only with PARSERS_ROOT. The parsers of checkouts before
+// Parse::stripScopedText use this helper of helper.cpp, the code is the same.
+
+QString Helper::stripScopedText(QString scopedText)
+{
+    // parenthesis
+    int pars = 0, parsStart = -1;
+    int p = scopedText.indexOf("(");
+    if (p >= 0) {
+        pars++;
+        parsStart = p;
+    }
+    while(p >= 0) {
+        int pO = scopedText.indexOf("(", p+1);
+        int pC = scopedText.indexOf(")", p+1);
+        int pM = -1;
+        if (pO >= 0 && pC >= 0) pM = std::min(pO, pC);
+        else if (pO >= 0 && pC < 0) pM = pO;
+        else if (pO < 0 && pC >= 0) pM = pC;
+        if (pM >= 0) {
+            if (pM == pO) {
+                if (pars == 0) parsStart = pM;
+                pars++;
+            }
+            if (pM == pC) pars--;
+            int start = parsStart + 1;
+            int len = pM-parsStart-1;
+            if (pars == 0 && len > 0) {
+                scopedText.replace(start, len, QString(" ").repeated(len));
+            }
+        }
+        p = pM;
+    }
+    // braces
+    int scope = 0, scopeStart = -1;
+    p = scopedText.indexOf("{");
+    if (p >= 0) {
+        scope++;
+        scopeStart = p;
+    }
+    while(p >= 0) {
+        int pO = scopedText.indexOf("{", p+1);
+        int pC = scopedText.indexOf("}", p+1);
+        int pM = -1;
+        if (pO >= 0 && pC >= 0) pM = std::min(pO, pC);
+        else if (pO >= 0 && pC < 0) pM = pO;
+        else if (pO < 0 && pC >= 0) pM = pC;
+        if (pM >= 0) {
+            if (pM == pO) {
+                if (scope == 0) scopeStart = pM;
+                scope++;
+            }
+            if (pM == pC) scope--;
+            int start = scopeStart + 1;
+            int len = pM-scopeStart-1;
+            if (scope == 0 && len > 0) {
+                scopedText.replace(start, len, QString(" ").repeated(len));
+            }
+        }
+        p = pM;
+    }
+    return scopedText.replace(QRegularExpression("[\\s]+"), " ");
+}
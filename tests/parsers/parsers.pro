@@ -0,0 +1,40 @@
+QT       += core testlib
+QT       -= gui
+
+TARGET = tst_parsers
+TEMPLATE = app
+
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# qmake PARSERS_ROOT=<checkout> tests the parsers of another checkout,
+# the expected files were written with the parsers of d2b4c60
+isEmpty(PARSERS_ROOT) {
+    PARSERS_ROOT = ../..
+} else {
+    # helper.h includes widgets and the context dialog header
+    QT += gui widgets
+    SOURCES += helper_stub.cpp
+    FORMS += $$PARSERS_ROOT/ui/contextdialog.ui
+}
+
+INCLUDEPATH += $$PARSERS_ROOT/include
+
+SOURCES += \
+    tst_parsers.cpp \
+    $$PARSERS_ROOT/src/parse.cpp \
+    $$PARSERS_ROOT/src/parsephp.cpp \
+    $$PARSERS_ROOT/src/parsejs.cpp \
+    $$PARSERS_ROOT/src/parsecss.cpp
+
+HEADERS += \
+    $$PARSERS_ROOT/include/parse.h \
+    $$PARSERS_ROOT/include/parsephp.h \
+    $$PARSERS_ROOT/include/parsejs.h \
+    $$PARSERS_ROOT/include/parsecss.h
+
+RESOURCES += \
+    $$PARSERS_ROOT/qrc/highlight.qrc \
+    $$PARSERS_ROOT/qrc/syntax.qrc
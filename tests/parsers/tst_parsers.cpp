@@ -0,0 +1,397 @@
+/*******************************************
+ * Zira Editor
+ * A lightweight PHP Editor
+ * (C)2019 https://github.com/ziracms/editor
+ *******************************************/
+
+#include <QtTest>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QRandomGenerator>
+#include "parsephp.h"
+#include "parsejs.h"
+#include "parsecss.h"
+
+const int RANDOM_EDITS = 300;
+const int RANDOM_EDITS_RESTORE = 10;
+
+// The files in the data directory are parsed and the results are compared
+// with the .expected files next to them. The expected files hold the output
+// of the regex based parsers of d2b4c60, lines starting with # are notes on
+// where the output of the tokenizers differs from it on purpose and are not
+// compared. Build with "qmake PARSERS_ROOT=<checkout>" to run the test
+// against the parsers of another checkout, with ZIRA_DUMP_RESULTS=<dir> set
+// the results are written to that directory and every test fails, so the
+// expected files can only be changed by copying the dumps over by hand.
+class TestParsers : public QObject
+{
+    Q_OBJECT
+private slots:
+    void parsePHP_data();
+    void parsePHP();
+    void parsePHPEdits_data();
+    void parsePHPEdits();
+    void parseJS_data();
+    void parseJS();
+    void parseCSS_data();
+    void parseCSS();
+private:
+    void addFiles(QString dir, QString extension);
+    QString loadFile(QString path);
+    void compareExpected(QString path, QString output);
+};
+
+// text the random edits insert, it opens and closes scopes, strings,
+// comments and php tags
+static const char * EDIT_SNIPPETS[] = {
+    " ", "\n", ";", "{", "}", "(", ")", "[", "]", "'", "\"", "`", "$", "//", "#", "/*", "*/", "?>", "<?php ",
+    "$value", " = ", "$value = 1;", "return $value;", "function ", "function added($a) { $b = $a; }",
+    "class Added { public $p; }", "namespace Added;", "use Added\\Name;", "const ADDED = 1;",
+    "/** @return int */", "<<<EOT\n", "\nEOT;\n", "{$value}", "static::", "->", "=>"
+};
+
+// braces of the named function bodies, strings are not skipped
+static QVector<QPair<int, int>> findFunctionBodies(const QString & text)
+{
+    QVector<QPair<int, int>> bodies;
+    int p = text.indexOf("function");
+    while (p >= 0) {
+        int open = text.indexOf("{", p), close = -1;
+        if (open < 0) break;
+        int depth = 0;
+        for (int i=open; i<text.size(); i++) {
+            if (text.at(i) == '{') depth++;
+            if (text.at(i) == '}' && --depth == 0) {
+                close = i;
+                break;
+            }
+        }
+        if (close < 0) break;
+        bodies.append(qMakePair(open, close));
+        p = text.indexOf("function", p + 8);
+    }
+    return bodies;
+}
+
+// parse() returned the results by value before they were shared
+template <typename T>
+static const T & resultOf(const T & result)
+{
+    return result;
+}
+
+template <typename T>
+static const T & resultOf(const QSharedPointer<const T> & result)
+{
+    return *result;
+}
+
+static QString escape(QString text)
+{
+    return text.replace("\\", "\\\\").replace("\n", "\\n");
+}
+
+static QString indexes(const QVector<int> & list)
+{
+    QStringList items;
+    for (int i=0; i<list.size(); i++) {
+        items.append(QString::number(list.at(i)));
+    }
+    return "[" + items.join(",") + "]";
+}
+
+static QString flag(bool value)
+{
+    return QString::number(value ? 1 : 0);
+}
+
+static QString dumpResult(const ParsePHP::ParseResult & result)
+{
+    QStringList lines;
+    for (const ParsePHP::ParseResultImport & import : result.imports) {
+        lines.append("import " + import.type + " " + import.name + " path=" + import.path + " line=" + QString::number(import.line));
+    }
+    for (const ParsePHP::ParseResultNamespace & ns : result.namespaces) {
+        lines.append("namespace " + ns.name + " line=" + QString::number(ns.line) + " imports=" + indexes(ns.importsIndexes));
+    }
+    for (const ParsePHP::ParseResultClass & cls : result.classes) {
+        lines.append("class " + cls.name + " abstract=" + flag(cls.isAbstract) + " interface=" + flag(cls.isInterface) + " trait=" + flag(cls.isTrait) + " parent=" + cls.parent + " interfaces=" + cls.interfaces.join(",") + " line=" + QString::number(cls.line) + " functions=" + indexes(cls.functionIndexes) + " variables=" + indexes(cls.variableIndexes) + " constants=" + indexes(cls.constantIndexes));
+    }
+    for (const ParsePHP::ParseResultFunction & func : result.functions) {
+        lines.append("function " + func.clsName + "::" + func.name + "(" + func.args + ") args=" + QString::number(func.minArgs) + "-" + QString::number(func.maxArgs) + " static=" + flag(func.isStatic) + " abstract=" + flag(func.isAbstract) + " visibility=" + func.visibility + " return=" + func.returnType + " line=" + QString::number(func.line) + " variables=" + indexes(func.variableIndexes) + " comment=" + escape(func.comment));
+    }
+    for (const ParsePHP::ParseResultVariable & variable : result.variables) {
+        lines.append("variable " + variable.clsName + "::" + variable.funcName + "::" + variable.name + " static=" + flag(variable.isStatic) + " visibility=" + variable.visibility + " type=" + variable.type + " line=" + QString::number(variable.line));
+    }
+    for (const ParsePHP::ParseResultConstant & constant : result.constants) {
+        lines.append("constant " + constant.clsName + "::" + constant.name + " value=" + escape(constant.value) + " line=" + QString::number(constant.line));
+    }
+    for (const ParsePHP::ParseResultComment & comment : result.comments) {
+        lines.append("comment " + escape(comment.name) + " line=" + QString::number(comment.line) + " text=" + escape(comment.text));
+    }
+    for (const ParsePHP::ParseResultError & error : result.errors) {
+        lines.append("error " + error.text + " line=" + QString::number(error.line) + " symbol=" + QString::number(error.symbol));
+    }
+    return lines.join("\n") + "\n";
+}
+
+static QString dumpResult(const ParseJS::ParseResult & result)
+{
+    QStringList lines;
+    for (const ParseJS::ParseResultClass & cls : result.classes) {
+        lines.append("class " + cls.name + " line=" + QString::number(cls.line) + " functions=" + indexes(cls.functionIndexes) + " variables=" + indexes(cls.variableIndexes));
+    }
+    for (const ParseJS::ParseResultFunction & func : result.functions) {
+        lines.append("function " + func.clsName + "::" + func.name + "(" + func.args + ") args=" + QString::number(func.minArgs) + "-" + QString::number(func.maxArgs) + " global=" + QString::number(func.isGlobal ? 1 : 0) + " return=" + func.returnType + " line=" + QString::number(func.line) + " variables=" + indexes(func.variableIndexes) + " constants=" + indexes(func.constantIndexes) + " comment=" + escape(func.comment));
+    }
+    for (const ParseJS::ParseResultVariable & variable : result.variables) {
+        lines.append("variable " + variable.clsName + "::" + variable.funcName + "::" + variable.name + " type=" + variable.type + " line=" + QString::number(variable.line));
+    }
+    for (const ParseJS::ParseResultConstant & constant : result.constants) {
+        lines.append("constant " + constant.clsName + "::" + constant.funcName + "::" + constant.name + " value=" + escape(constant.value) + " line=" + QString::number(constant.line));
+    }
+    for (const ParseJS::ParseResultComment & comment : result.comments) {
+        lines.append("comment " + escape(comment.name) + " line=" + QString::number(comment.line) + " text=" + escape(comment.text));
+    }
+    for (const ParseJS::ParseResultError & error : result.errors) {
+        lines.append("error " + error.text + " line=" + QString::number(error.line) + " symbol=" + QString::number(error.symbol));
+    }
+    return lines.join("\n") + "\n";
+}
+
+static QString dumpResult(const ParseCSS::ParseResult & result)
+{
+    QStringList lines;
+    for (const ParseCSS::ParseResultSelector & selector : result.selectors) {
+        lines.append("selector " + selector.name + " line=" + QString::number(selector.line));
+    }
+    for (const ParseCSS::ParseResultName & name : result.names) {
+        lines.append("name " + name.name + " line=" + QString::number(name.line));
+    }
+    for (const ParseCSS::ParseResultMedia & media : result.medias) {
+        lines.append("media " + media.name + " line=" + QString::number(media.line));
+    }
+    for (const ParseCSS::ParseResultKeyframe & keyframe : result.keyframes) {
+        lines.append("keyframes " + keyframe.name + " line=" + QString::number(keyframe.line));
+    }
+    for (const ParseCSS::ParseResultFont & font : result.fonts) {
+        lines.append("font " + font.name + " line=" + QString::number(font.line));
+    }
+    for (const ParseCSS::ParseResultComment & comment : result.comments) {
+        lines.append("comment " + escape(comment.name) + " line=" + QString::number(comment.line) + " text=" + escape(comment.text));
+    }
+    for (const ParseCSS::ParseResultError & error : result.errors) {
+        lines.append("error " + error.text + " line=" + QString::number(error.line) + " symbol=" + QString::number(error.symbol));
+    }
+    return lines.join("\n") + "\n";
+}
+
+void TestParsers::addFiles(QString dir, QString extension)
+{
+    QTest::addColumn<QString>("path");
+    QString dataDir = QFINDTESTDATA("data/" + dir);
+    QVERIFY(!dataDir.isEmpty());
+    QStringList files = QDir(dataDir).entryList(QStringList() << "*." + extension, QDir::Files, QDir::Name);
+    QVERIFY(!files.isEmpty());
+    for (QString file : files) {
+        QTest::newRow(file.toUtf8().constData()) << dataDir + "/" + file;
+    }
+}
+
+QString TestParsers::loadFile(QString path)
+{
+    QFile f(path);
+    if (!f.open(QIODevice::ReadOnly)) return "";
+    return QString::fromUtf8(f.readAll());
+}
+
+void TestParsers::compareExpected(QString path, QString output)
+{
+    QString expectedPath = path + ".expected";
+    QString dumpDir = qEnvironmentVariable("ZIRA_DUMP_RESULTS");
+    if (!dumpDir.isEmpty()) {
+        QString dumpPath = QDir(dumpDir).filePath(QFileInfo(expectedPath).fileName());
+        QFile f(dumpPath);
+        QVERIFY(f.open(QIODevice::WriteOnly));
+        f.write(output.toUtf8());
+        QFAIL(qPrintable("Results written to " + dumpPath + " instead of comparing them"));
+    }
+    QVERIFY2(QFile::exists(expectedPath), qPrintable("Missing " + expectedPath));
+    QStringList outputLines = output.split("\n");
+    QStringList expectedLines;
+    for (QString line : loadFile(expectedPath).split("\n")) {
+        if (!line.startsWith("#")) expectedLines.append(line);
+    }
+    for (int i=0; i<outputLines.size() && i<expectedLines.size(); i++) {
+        QCOMPARE(outputLines.at(i), expectedLines.at(i));
+    }
+    QCOMPARE(outputLines.size(), expectedLines.size());
+}
+
+void TestParsers::parsePHP_data()
+{
+    addFiles("php", "php");
+}
+
+void TestParsers::parsePHP()
+{
+    QFETCH(QString, path);
+    ParsePHP parser;
+    compareExpected(path, dumpResult(resultOf(parser.parse(loadFile(path)))));
+}
+
+// Applies the edits the way the parser worker does and compares the result
+// of the incremental parse with a full parse of the new text. Returns the
+// first line of the results that differs.
+static QString parseEdits(ParsePHP & parser, QString & text, const QVector<Parse::TextEdit> & edits)
+{
+    int prefix = text.size(), suffix = text.size();
+    for (const Parse::TextEdit & edit : edits) {
+        prefix = qMin(prefix, edit.position);
+        suffix = qMin(suffix, text.size() - edit.position - edit.removed);
+        text.replace(edit.position, edit.removed, edit.added);
+    }
+    int changeStart = prefix;
+    int changeEnd = text.size() - qMin(suffix, text.size() - prefix);
+    QStringList incremental = dumpResult(resultOf(parser.parse(text, changeStart, changeEnd))).split("\n");
+    ParsePHP fullParser;
+    QStringList full = dumpResult(resultOf(fullParser.parse(text))).split("\n");
+    for (int i=0; i<incremental.size() || i<full.size(); i++) {
+        QString incrementalLine = i < incremental.size() ? incremental.at(i) : "";
+        QString fullLine = i < full.size() ? full.at(i) : "";
+        if (incrementalLine != fullLine) return "incremental \"" + incrementalLine + "\", full \"" + fullLine + "\"";
+    }
+    return "";
+}
+
+static QString describeEdit(QString step, const Parse::TextEdit & edit)
+{
+    return step + " at " + QString::number(edit.position) + " removing " + QString::number(edit.removed) + " adding \"" + escape(edit.added) + "\"";
+}
+
+void TestParsers::parsePHPEdits_data()
+{
+    addFiles("php", "php");
+}
+
+// Edits inside, across and at the braces of the function bodies,
+// each scripted edit is undone right after it
+void TestParsers::parsePHPEdits()
+{
+    QFETCH(QString, path);
+    QString original = loadFile(path);
+    QString text = original;
+    ParsePHP parser;
+    parser.parse(text);
+    const int scriptedEdits = 17;
+    for (int b=0; b<findFunctionBodies(original).size(); b++) {
+        for (int e=0; e<scriptedEdits; e++) {
+            QVector<QPair<int, int>> bodies = findFunctionBodies(text);
+            QVERIFY(b < bodies.size());
+            int open = bodies.at(b).first, close = bodies.at(b).second;
+            int middle = (open + close + 1) / 2;
+            Parse::TextEdit edit;
+            switch (e) {
+            case 0: edit = {open + 1, 0, "\n    $inserted = 1;"}; break;
+            case 1: edit = {close, 0, "$atEnd = 2;"}; break;
+            case 2: edit = {open, 1, ""}; break;
+            case 3: edit = {close, 1, ""}; break;
+            case 4: edit = {middle, qMin(close + 3, text.size()) - middle, ""}; break;
+            case 5: edit = {qMax(0, open - 2), 4, " "}; break;
+            case 6: edit = {middle, 0, "{"}; break;
+            case 7: edit = {middle, 0, "}"}; break;
+            case 8: edit = {middle, 0, "/*"}; break;
+            case 9: edit = {middle, 0, "\""}; break;
+            case 10: edit = {middle, 0, "function nested($n) { $m = $n; }"}; break;
+            case 11: edit = {middle, 0, "?>"}; break;
+            case 12: edit = {close + 1, 0, "\n$outside = 3;"}; break;
+            case 13: edit = {open, 0, "\n\n"}; break;
+            case 14: edit = {close - 1, 0, "/** @return int */"}; break;
+            case 15: edit = {middle, 0, "?>\n<?php "}; break;
+            default: edit = {middle, 0, "/** Inner */\nfunction inner() {}\n"};
+            }
+            Parse::TextEdit undo = {edit.position, edit.added.size(), text.mid(edit.position, edit.removed)};
+            QString diff = parseEdits(parser, text, {edit});
+            QVERIFY2(diff.isEmpty(), qPrintable(describeEdit("Edit", edit) + ": " + diff));
+            diff = parseEdits(parser, text, {undo});
+            QVERIFY2(diff.isEmpty(), qPrintable(describeEdit("Undo", undo) + ": " + diff));
+        }
+        // typing and deleting a statement char by char
+        QString typed = "$typed = [1, 'a' => $b];";
+        int position = (findFunctionBodies(text).at(b).first + findFunctionBodies(text).at(b).second + 1) / 2;
+        for (int i=0; i<typed.size(); i++) {
+            QString diff = parseEdits(parser, text, {{position + i, 0, typed.mid(i, 1)}});
+            QVERIFY2(diff.isEmpty(), qPrintable("Typing \"" + typed.left(i + 1) + "\": " + diff));
+        }
+        for (int i=typed.size()-1; i>=0; i--) {
+            QString diff = parseEdits(parser, text, {{position + i, 1, ""}});
+            QVERIFY2(diff.isEmpty(), qPrintable("Deleting \"" + typed.left(i + 1) + "\": " + diff));
+        }
+        QCOMPARE(text, original);
+    }
+    // random edits, mostly near the function bodies, a few of them
+    // at once and the original text restored from time to time
+    QRandomGenerator random(1);
+    int snippets = static_cast<int>(sizeof(EDIT_SNIPPETS) / sizeof(EDIT_SNIPPETS[0]));
+    for (int step=0; step<RANDOM_EDITS; step++) {
+        QVector<Parse::TextEdit> edits;
+        if (step % RANDOM_EDITS_RESTORE == RANDOM_EDITS_RESTORE - 1) {
+            edits.append({0, text.size(), original});
+        } else {
+            int count = random.bounded(1, 4);
+            QString after = text;
+            for (int i=0; i<count; i++) {
+                QVector<QPair<int, int>> bodies = findFunctionBodies(after);
+                int from = 0, to = after.size();
+                if (!bodies.isEmpty() && random.bounded(5) > 0) {
+                    QPair<int, int> body = bodies.at(random.bounded(bodies.size()));
+                    from = qMax(0, body.first - 8);
+                    to = qMin(after.size(), body.second + 9);
+                }
+                Parse::TextEdit edit;
+                edit.position = random.bounded(from, to + 1);
+                edit.removed = random.bounded(3) > 0 ? 0 : qMin(random.bounded(1, 9), after.size() - edit.position);
+                edit.added = random.bounded(4) > 0 ? EDIT_SNIPPETS[random.bounded(snippets)] : "";
+                if (edit.removed == 0 && edit.added.isEmpty()) edit.added = " ";
+                after.replace(edit.position, edit.removed, edit.added);
+                edits.append(edit);
+            }
+        }
+        QStringList described;
+        for (const Parse::TextEdit & edit : edits) {
+            described.append(describeEdit("edit", edit));
+        }
+        QString diff = parseEdits(parser, text, edits);
+        QVERIFY2(diff.isEmpty(), qPrintable("Random step " + QString::number(step) + ", " + described.join(", ") + ": " + diff));
+    }
+}
+
+void TestParsers::parseJS_data()
+{
+    addFiles("js", "js");
+}
+
+void TestParsers::parseJS()
+{
+    QFETCH(QString, path);
+    ParseJS parser;
+    compareExpected(path, dumpResult(resultOf(parser.parse(loadFile(path)))));
+}
+
+void TestParsers::parseCSS_data()
+{
+    addFiles("css", "css");
+}
+
+void TestParsers::parseCSS()
+{
+    QFETCH(QString, path);
+    ParseCSS parser;
+    compareExpected(path, dumpResult(resultOf(parser.parse(loadFile(path)))));
+}
+
+QTEST_GUILESS_MAIN(TestParsers)
+
+#include "tst_parsers.moc"
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# Zira Editor
+# Generates src/highlightwordstables.cpp from the highlight word lists
+# in qrc/resources/highlight. Run "make highlightwords" or this script
+# directly after changing any of the word lists.
+#
+
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WORDS_DIR = os.path.join(ROOT, 'qrc', 'resources', 'highlight')
+OUTPUT = os.path.join(ROOT, 'src', 'highlightwordstables.cpp')
+
+# table name, case insensitive, [(word list, format id)]
+# later lists override earlier ones, as the former runtime loader did
+TABLES = [
+    ('PHP_WORDS', True, [
+        ('php/keywords', 'FORMAT_KEYWORD'),
+        ('php/types', 'FORMAT_KNOWN'),
+        ('php/classes', 'FORMAT_KNOWN'),
+    ]),
+    ('PHP_WORDS_CS', False, [
+        ('php/consts', 'FORMAT_KEYWORD'),
+    ]),
+    ('JS_WORDS_CS', False, [
+        ('js/keywords', 'FORMAT_KEYWORD'),
+    ]),
+    ('CSS_WORDS', True, [
+        ('css/keywords', 'FORMAT_KEYWORD'),
+        ('css/special', 'FORMAT_CSS_SPECIAL'),
+        ('css/pseudo', 'FORMAT_PSEUDO_CLASS'),
+    ]),
+    ('GENERAL_WORDS', True, [
+        ('general/keywords', 'FORMAT_KEYWORD'),
+    ]),
+]
+
+HASH_PRIME = 0x01000193
+
+
+# must match HighlightWordsMap::tableHash
+def word_hash(seed, word):
+    h = seed if seed != 0 else HASH_PRIME
+    for c in word:
+        h = ((h * HASH_PRIME) ^ ord(c)) & 0xffffffff
+    return h
+
+
+def read_words(path, case_insensitive):
+    words = []
+    with open(os.path.join(WORDS_DIR, path), encoding='ascii') as f:
+        for line in f.read().splitlines():
+            if line == '':
+                continue
+            if case_insensitive:
+                line = line.lower()
+            words.append(line)
+    return words
+
+
+# hash and displace: every bucket of the first level hash gets a seed
+# that maps its words into free slots of the second level
+def build_perfect_hash(words):
+    size = len(words)
+    buckets = [[] for _ in range(size)]
+    for word in words:
+        buckets[word_hash(0, word) % size].append(word)
+    buckets.sort(key=len, reverse=True)
+    seeds = [0] * size
+    slots = [None] * size
+    b = 0
+    while b < size and len(buckets[b]) > 1:
+        bucket = buckets[b]
+        seed = 1
+        taken = []
+        item = 0
+        while item < len(bucket):
+            slot = word_hash(seed, bucket[item]) % size
+            if slots[slot] is not None or slot in taken:
+                seed += 1
+                taken = []
+                item = 0
+            else:
+                taken.append(slot)
+                item += 1
+        seeds[word_hash(0, bucket[0]) % size] = seed
+        for i, slot in enumerate(taken):
+            slots[slot] = bucket[i]
+        b += 1
+    free = [i for i in range(size) if slots[i] is None]
+    while b < size and len(buckets[b]) > 0:
+        slot = free.pop()
+        seeds[word_hash(0, buckets[b][0]) % size] = -slot - 1
+        slots[slot] = buckets[b][0]
+        b += 1
+    return seeds, slots
+
+
+def escape(word):
+    return word.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def format_list(items, per_line):
+    lines = []
+    for i in range(0, len(items), per_line):
+        lines.append('    ' + ', '.join(items[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def main():
+    out = []
+    out.append('/*******************************************')
+    out.append(' * Zira Editor')
+    out.append(' * A lightweight PHP Editor')
+    out.append(' * (C)2019 https://github.com/ziracms/editor')
+    out.append(' *******************************************/')
+    out.append('')
+    out.append('// generated by tools/highlightwords.py, do not edit')
+    out.append('')
+    out.append('#include "highlightwordsmap.h"')
+    for name, case_insensitive, lists in TABLES:
+        formats = {}
+        for path, format_id in lists:
+            for word in read_words(path, case_insensitive):
+                formats.pop(word, None)
+                formats[word] = format_id
+        words = list(formats.keys())
+        seeds, slots = build_perfect_hash(words)
+        prefix = 'TABLE_' + name
+        out.append('')
+        out.append('static const int %s_SEEDS[] = {' % prefix)
+        out.append(format_list([str(s) for s in seeds], 16))
+        out.append('};')
+        out.append('')
+        out.append('static const char * const %s_WORDS[] = {' % prefix)
+        out.append(format_list(['"%s"' % escape(w) for w in slots], 4))
+        out.append('};')
+        out.append('')
+        out.append('static const unsigned char %s_FORMATS[] = {' % prefix)
+        out.append(format_list([formats[w] for w in slots], 4))
+        out.append('};')
+        out.append('')
+        out.append('const HighlightWordsTable HIGHLIGHT_%s = {' % name)
+        out.append('    %d, %s_SEEDS, %s_WORDS, %s_FORMATS' % (len(words), prefix, prefix, prefix))
+        out.append('};')
+    with open(OUTPUT, 'w', encoding='ascii', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())